@@ -0,0 +1,811 @@
+#include <RCNET/RCNET.h>               // modules mesurés
+#include <SDL3/SDL_log.h>              // sink de log muet (mesure du logger sans I/O console)
+
+#include <cJSON.h>                     // décodage JSON des inputs (comme le serveur en mode debug) + rapport
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ------------------------------------------------------------
+// Microbenchmarks des chemins chauds de RCNET (harness minimal, sans dépendance).
+//
+// Chaque benchmark enchaîne des rounds : un round prépare ses données hors mesure, puis mesure
+// un lot d'opérations (BenchTimer::begin / end). Le temps par opération de chaque round est
+// enregistré dans un RCNET_Histogram : le rapport donne moyenne et percentiles par opération.
+//
+// Rapport texte sur stdout, JSON avec --json (un fichier par release, à comparer en review).
+// ------------------------------------------------------------
+
+#ifndef RCNET_BENCH_VERSION
+#define RCNET_BENCH_VERSION "unknown"
+#endif
+
+// ------------------------------------------------------------
+// Harness
+// ------------------------------------------------------------
+struct BenchConfig
+{
+    uint32_t minTimeMs = 300;   // durée mesurée minimale par benchmark
+    std::string filter;         // sous-chaîne du nom (vide : tous)
+    std::string jsonOutput;     // vide : pas de rapport JSON
+};
+
+struct BenchResult
+{
+    std::string name;
+    std::string unit;
+    uint64_t operations;
+    RCNET_HistogramSummary summary;   // par opération (ou par échantillon pour les mesures de précision)
+};
+
+// Mesure d'un round : begin() après la préparation, end(ops) après le lot mesuré
+class BenchTimer
+{
+public:
+    explicit BenchTimer(RCNET_Histogram* histogram) : mHistogram(histogram) {}
+
+    void begin(void) { mStartNs = rcnet_timer_get_time_ns(); }
+
+    void end(uint64_t operations)
+    {
+        uint64_t elapsedNs = rcnet_timer_get_time_ns() - mStartNs;
+        mMeasuredNs += elapsedNs;
+        if (operations == 0)
+            return;
+
+        mOperations += operations;
+        rcnet_histogram_record(mHistogram, elapsedNs / operations);
+    }
+
+    // Echantillon direct (ex: retard de réveil d'un timer), compté dans le temps mesuré
+    void record(uint64_t value, uint64_t elapsedNs)
+    {
+        mMeasuredNs += elapsedNs;
+        mOperations++;
+        rcnet_histogram_record(mHistogram, value);
+    }
+
+    uint64_t measuredNs(void) const { return mMeasuredNs; }
+    uint64_t operations(void) const { return mOperations; }
+
+private:
+    RCNET_Histogram* mHistogram;
+    uint64_t mStartNs = 0;
+    uint64_t mMeasuredNs = 0;
+    uint64_t mOperations = 0;
+};
+
+static std::vector<BenchResult> gResults;
+
+static bool IsBenchSelected(const BenchConfig& config, const char* name)
+{
+    return config.filter.empty() || std::strstr(name, config.filter.c_str()) != nullptr;
+}
+
+static void RunBench(const BenchConfig& config, const char* name, const char* unit, const std::function<void(BenchTimer&)>& round)
+{
+    if (!IsBenchSelected(config, name))
+        return;
+
+    RCNET_Histogram* histogram = rcnet_histogram_create();
+    if (histogram == nullptr)
+        return;
+
+    // Warm-up (caches, allocations paresseuses), non enregistré
+    {
+        RCNET_Histogram* warmup = rcnet_histogram_create();
+        BenchTimer timer(warmup);
+        for (int i = 0; i < 3; ++i)
+            round(timer);
+        rcnet_histogram_destroy(warmup);
+    }
+
+    BenchTimer timer(histogram);
+    const uint64_t minTimeNs = static_cast<uint64_t>(config.minTimeMs) * 1000000ull;
+    uint64_t rounds = 0;
+    while (timer.measuredNs() < minTimeNs || rounds < 10)
+    {
+        round(timer);
+        rounds++;
+    }
+
+    BenchResult result;
+    result.name = name;
+    result.unit = unit;
+    result.operations = timer.operations();
+    rcnet_histogram_get_summary(histogram, &result.summary);
+    rcnet_histogram_destroy(histogram);
+
+    std::printf("%-40s %12llu ops  mean %8llu  p50 %8llu  p99 %8llu  max %10llu  %s\n", name,
+                (unsigned long long)result.operations, (unsigned long long)result.summary.mean,
+                (unsigned long long)result.summary.p50, (unsigned long long)result.summary.p99,
+                (unsigned long long)result.summary.max, unit);
+    std::fflush(stdout);
+
+    gResults.push_back(result);
+}
+
+// Empêche le compilateur d'éliminer un résultat inutilisé
+static volatile uint64_t gSink = 0;
+
+// ------------------------------------------------------------
+// Logger : message filtré (niveau sous la priorité) vs émis (synchrone / asynchrone)
+// ------------------------------------------------------------
+static void NullLogOutput(void* userdata, int category, SDL_LogPriority priority, const char* message)
+{
+    (void)userdata;
+    (void)category;
+    (void)priority;
+    gSink = gSink + (message != nullptr ? 1u : 0u);
+}
+
+static void BenchLogger(const BenchConfig& config)
+{
+    const RCNET_LogLevel previousPriority = rcnet_logger_get_priority();
+    SDL_SetLogOutputFunction(NullLogOutput, NULL);
+
+    rcnet_logger_set_priority(RCNET_LOG_WARN);
+    RunBench(config, "logger/filtered", "ns/op", [](BenchTimer& timer) {
+        timer.begin();
+        for (uint32_t i = 0; i < 1000; ++i)
+            RCNET_log(RCNET_LOG_DEBUG, "[BENCH] filtered message clientId=%u tick=%llu\n", i, (unsigned long long)i);
+        timer.end(1000);
+    });
+
+    rcnet_logger_set_priority(RCNET_LOG_DEBUG);
+    RunBench(config, "logger/emitted_sync", "ns/op", [](BenchTimer& timer) {
+        timer.begin();
+        for (uint32_t i = 0; i < 100; ++i)
+            RCNET_log(RCNET_LOG_INFO, "[BENCH] emitted message clientId=%u tick=%llu\n", i, (unsigned long long)i);
+        timer.end(100);
+    });
+
+    // Asynchrone : coût côté thread appelant (formatage + ring buffer), le thread d'écriture vide en parallèle.
+    // Lots courts + pause hors mesure : le ring ne déborde pas (sinon on mesurerait les pertes).
+    if (rcnet_logger_start_async(NULL))
+    {
+        RunBench(config, "logger/emitted_async", "ns/op", [](BenchTimer& timer) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            timer.begin();
+            for (uint32_t i = 0; i < 64; ++i)
+                RCNET_log(RCNET_LOG_INFO, "[BENCH] emitted message clientId=%u tick=%llu\n", i, (unsigned long long)i);
+            timer.end(64);
+        });
+        rcnet_logger_stop_async();
+    }
+
+    rcnet_logger_set_priority(previousPriority);
+}
+
+// ------------------------------------------------------------
+// Décodage d'un input : JSON (mode debug des exemples) vs codec binaire
+// ------------------------------------------------------------
+static void BenchInputDecode(const BenchConfig& config)
+{
+    const char* json = "{\"clientTick\":123456,\"seq\":123456,\"buttons\":5,\"ax\":0.25,\"ay\":-0.1}";
+    const size_t jsonLength = std::strlen(json);
+
+    RunBench(config, "input_decode/json", "ns/op", [&](BenchTimer& timer) {
+        timer.begin();
+        for (uint32_t i = 0; i < 1000; ++i)
+        {
+            cJSON* root = cJSON_ParseWithLength(json, jsonLength);
+            cJSON* tick = cJSON_GetObjectItemCaseSensitive(root, "clientTick");
+            cJSON* seq = cJSON_GetObjectItemCaseSensitive(root, "seq");
+            cJSON* buttons = cJSON_GetObjectItemCaseSensitive(root, "buttons");
+            cJSON* ax = cJSON_GetObjectItemCaseSensitive(root, "ax");
+            cJSON* ay = cJSON_GetObjectItemCaseSensitive(root, "ay");
+            if (cJSON_IsNumber(tick) && cJSON_IsNumber(seq) && cJSON_IsNumber(buttons) && cJSON_IsNumber(ax) && cJSON_IsNumber(ay))
+                gSink = gSink + static_cast<uint64_t>(seq->valuedouble);
+            cJSON_Delete(root);
+        }
+        timer.end(1000);
+    });
+
+    RCNET_ClientInput input;
+    input.clientId = 0;
+    input.clientTickId = 123456;
+    input.clientInputSeq = 123456;
+    input.buttonsMask = 5;
+    input.axisX = 0.25f;
+    input.axisY = -0.1f;
+
+    uint8_t packet[RCNET_CLIENT_INPUT_PACKET_SIZE];
+    size_t packetLength = rcnet_codec_encode_client_input(&input, packet, sizeof(packet));
+
+    RunBench(config, "input_decode/binary", "ns/op", [&](BenchTimer& timer) {
+        RCNET_ClientInput decoded;
+        timer.begin();
+        for (uint32_t i = 0; i < 1000; ++i)
+        {
+            if (rcnet_codec_decode_client_input(packet, packetLength, 7, &decoded))
+                gSink = gSink + decoded.clientInputSeq;
+        }
+        timer.end(1000);
+    });
+
+    // Packet groupé de 8 inputs (RCNET_InputSender par défaut) : coût par input décodé
+    RCNET_ClientInput batch[8];
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        batch[i] = input;
+        batch[i].clientTickId -= i;
+        batch[i].clientInputSeq -= i;
+        batch[i].axisX = 0.25f - 0.01f * static_cast<float>(i);
+    }
+
+    uint8_t batchPacket[RCNET_CLIENT_INPUT_BATCH_MAX_PACKET_SIZE];
+    size_t batchLength = rcnet_codec_encode_client_input_batch(batch, 8, batchPacket, sizeof(batchPacket));
+
+    RunBench(config, "input_decode/binary_batch8", "ns/input", [&](BenchTimer& timer) {
+        RCNET_ClientInput decoded[RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS];
+        uint64_t inputs = 0;
+        timer.begin();
+        for (uint32_t i = 0; i < 1000; ++i)
+            inputs += rcnet_codec_decode_client_input_batch(batchPacket, batchLength, 7, decoded);
+        timer.end(inputs);
+    });
+}
+
+// ------------------------------------------------------------
+// Snapshots : encodage par peer (delta contre l'état acké, complet, filtré par intérêt) + LZ4
+// ------------------------------------------------------------
+static constexpr uint32_t kBenchEntities = 128;
+static constexpr uint32_t kBenchPeers = 128;
+static constexpr uint32_t kBenchPositionBits = 16;
+static constexpr float kBenchWorldHalfExtent = 512.0f;
+
+enum BenchSnapshotField : uint32_t
+{
+    kBenchFieldPosX = 0,
+    kBenchFieldPosY,
+    kBenchFieldButtons,
+    kBenchFieldCount
+};
+
+static RCNET_SnapshotHistory* CreateBenchHistory(void)
+{
+    RCNET_SnapshotSchema schema;
+    std::memset(&schema, 0, sizeof(schema));
+    schema.maxEntities = kBenchEntities;
+    schema.fieldCount = kBenchFieldCount;
+    schema.fieldBits[kBenchFieldPosX] = kBenchPositionBits;
+    schema.fieldBits[kBenchFieldPosY] = kBenchPositionBits;
+    schema.fieldBits[kBenchFieldButtons] = 8;
+
+    return rcnet_snapshot_history_create(&schema, 64, kBenchPeers);
+}
+
+// Monde type : la moitié des entités bouge à chaque tick (cercles), l'autre moitié est immobile
+// sur une grille (joueurs inactifs), boutons stables
+static void WriteBenchFrame(RCNET_SnapshotHistory* history, RCNET_Interest* interest, uint64_t tick)
+{
+    rcnet_snapshot_history_begin_frame(history, tick);
+    for (uint32_t entityId = 0; entityId < kBenchEntities; ++entityId)
+    {
+        float x = static_cast<float>(entityId % 8) * 64.0f - 256.0f;
+        float y = static_cast<float>(entityId / 8) * 32.0f - 256.0f;
+        if ((entityId & 1u) == 0)
+        {
+            float angle = static_cast<float>(entityId) * 0.7f + static_cast<float>(tick) * 0.02f;
+            float radius = 40.0f + static_cast<float>(entityId % 16) * 25.0f;
+            x = std::cos(angle) * radius;
+            y = std::sin(angle) * radius;
+        }
+
+        uint32_t fields[kBenchFieldCount];
+        fields[kBenchFieldPosX] = rcnet_quantize_float(x, -kBenchWorldHalfExtent, kBenchWorldHalfExtent, kBenchPositionBits);
+        fields[kBenchFieldPosY] = rcnet_quantize_float(y, -kBenchWorldHalfExtent, kBenchWorldHalfExtent, kBenchPositionBits);
+        fields[kBenchFieldButtons] = entityId & 0x3u;
+        rcnet_snapshot_history_write_entity(history, entityId, fields);
+
+        if (interest)
+            rcnet_interest_set_entity(interest, entityId, x, y, 1.0f);
+    }
+    rcnet_snapshot_history_commit_frame(history);
+}
+
+static void BenchCompression(const BenchConfig& config, const char* compressName, const char* decompressName, const std::vector<uint8_t>& data)
+{
+    std::vector<uint8_t> compressed(rcnet_compression_get_max_output_size(data.size()));
+    std::vector<uint8_t> decompressed(data.size());
+    size_t compressedSize = rcnet_compression_compress_block(data.data(), data.size(), compressed.data(), compressed.size(), 0, 1);
+
+    RunBench(config, compressName, "ns/op", [&](BenchTimer& timer) {
+        timer.begin();
+        for (uint32_t i = 0; i < 100; ++i)
+            gSink = gSink + rcnet_compression_compress_block(data.data(), data.size(), compressed.data(), compressed.size(), 0, 1);
+        timer.end(100);
+    });
+
+    RunBench(config, decompressName, "ns/op", [&](BenchTimer& timer) {
+        timer.begin();
+        for (uint32_t i = 0; i < 100; ++i)
+            gSink = gSink + rcnet_compression_decompress_block(compressed.data(), compressedSize, decompressed.data(), decompressed.size());
+        timer.end(100);
+    });
+
+    if (IsBenchSelected(config, compressName) || IsBenchSelected(config, decompressName))
+        std::printf("%-40s %zu B -> %zu B\n", "", data.size(), compressedSize);
+}
+
+static void BenchSnapshots(const BenchConfig& config)
+{
+    RCNET_SnapshotHistory* history = CreateBenchHistory();
+    if (history == nullptr)
+        return;
+
+    std::vector<uint8_t> buffer(rcnet_snapshot_history_get_max_encoded_size(history));
+
+    // Deux états : le peer 0 a acké le premier, le peer 1 rien (snapshot complet)
+    WriteBenchFrame(history, nullptr, 1);
+    rcnet_snapshot_history_ack(history, 0, 1);
+    WriteBenchFrame(history, nullptr, 2);
+
+    RunBench(config, "snapshot/encode_delta_per_peer", "ns/op", [&](BenchTimer& timer) {
+        timer.begin();
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            RCNET_PacketWriter writer;
+            rcnet_packet_writer_init(&writer, buffer.data(), buffer.size());
+            if (rcnet_snapshot_history_encode(history, 0, &writer, nullptr))
+                gSink = gSink + writer.size;
+        }
+        timer.end(100);
+    });
+
+    RunBench(config, "snapshot/encode_full_per_peer", "ns/op", [&](BenchTimer& timer) {
+        timer.begin();
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            RCNET_PacketWriter writer;
+            rcnet_packet_writer_init(&writer, buffer.data(), buffer.size());
+            if (rcnet_snapshot_history_encode(history, 1, &writer, nullptr))
+                gSink = gSink + writer.size;
+        }
+        timer.end(100);
+    });
+
+    // Données "forme snapshot" pour LZ4 :
+    // - bitpacked : snapshot complet tel que le serveur le compresse (peu compressible)
+    // - aligned   : mêmes entités en enregistrements alignés [x u16][y u16][buttons u8]
+    RCNET_PacketWriter fullWriter;
+    rcnet_packet_writer_init(&fullWriter, buffer.data(), buffer.size());
+    rcnet_snapshot_history_encode(history, 1, &fullWriter, nullptr);
+    std::vector<uint8_t> bitpacked(buffer.begin(), buffer.begin() + fullWriter.size);
+
+    std::vector<uint8_t> aligned;
+    uint32_t fields[kBenchFieldCount];
+    for (uint32_t entityId = 0; entityId < kBenchEntities; ++entityId)
+    {
+        if (!rcnet_snapshot_history_read_entity(history, 2, entityId, fields))
+            continue;
+        aligned.push_back(static_cast<uint8_t>(fields[kBenchFieldPosX]));
+        aligned.push_back(static_cast<uint8_t>(fields[kBenchFieldPosX] >> 8));
+        aligned.push_back(static_cast<uint8_t>(fields[kBenchFieldPosY]));
+        aligned.push_back(static_cast<uint8_t>(fields[kBenchFieldPosY] >> 8));
+        aligned.push_back(static_cast<uint8_t>(fields[kBenchFieldButtons]));
+    }
+
+    BenchCompression(config, "lz4/compress_bitpacked_snapshot", "lz4/decompress_bitpacked_snapshot", bitpacked);
+    BenchCompression(config, "lz4/compress_aligned_snapshot", "lz4/decompress_aligned_snapshot", aligned);
+    rcnet_snapshot_history_destroy(history);
+
+    // Chemin serveur : un nouvel état par round, visibilité + priorités + encodage filtré pour chaque peer
+    history = CreateBenchHistory();
+    RCNET_InterestConfig interestConfig;
+    rcnet_interest_get_default_config(&interestConfig);
+    interestConfig.maxEntities = kBenchEntities;
+    interestConfig.maxPeers = kBenchPeers;
+    interestConfig.worldMinX = -kBenchWorldHalfExtent;
+    interestConfig.worldMinY = -kBenchWorldHalfExtent;
+    interestConfig.worldMaxX = kBenchWorldHalfExtent;
+    interestConfig.worldMaxY = kBenchWorldHalfExtent;
+    RCNET_Interest* interest = rcnet_interest_create(&interestConfig);
+
+    if (history && interest && rcnet_snapshot_history_enable_interest(history))
+    {
+        for (uint32_t peerId = 0; peerId < kBenchPeers; ++peerId)
+            rcnet_interest_set_peer_entity(interest, peerId, peerId);
+
+        uint64_t tick = 0;
+        RunBench(config, "snapshot/encode_interest_per_peer", "ns/op", [&](BenchTimer& timer) {
+            WriteBenchFrame(history, interest, ++tick);
+
+            uint32_t fields[kBenchFieldCount];
+            timer.begin();
+            for (uint32_t peerId = 0; peerId < kBenchPeers; ++peerId)
+            {
+                float viewerX = 0.0f;
+                float viewerY = 0.0f;
+                if (rcnet_snapshot_history_read_entity(history, tick, peerId, fields))
+                {
+                    viewerX = rcnet_dequantize_float(fields[kBenchFieldPosX], -kBenchWorldHalfExtent, kBenchWorldHalfExtent, kBenchPositionBits);
+                    viewerY = rcnet_dequantize_float(fields[kBenchFieldPosY], -kBenchWorldHalfExtent, kBenchWorldHalfExtent, kBenchPositionBits);
+                }
+
+                RCNET_SnapshotInterest filter;
+                rcnet_interest_update_peer(interest, peerId, viewerX, viewerY, &filter);
+
+                RCNET_PacketWriter writer;
+                rcnet_packet_writer_init(&writer, buffer.data(), buffer.size());
+                uint32_t writtenCount = 0;
+                if (rcnet_snapshot_history_encode_interest(history, peerId, &writer, &filter, &writtenCount, nullptr))
+                {
+                    rcnet_interest_commit_peer(interest, peerId, writtenCount);
+                    gSink = gSink + writer.size;
+                }
+            }
+            timer.end(kBenchPeers);
+
+            // Acks parfaits : le prochain round encode des deltas
+            for (uint32_t peerId = 0; peerId < kBenchPeers; ++peerId)
+                rcnet_snapshot_history_ack(history, peerId, tick);
+        });
+    }
+
+    rcnet_interest_destroy(interest);
+    rcnet_snapshot_history_destroy(history);
+}
+
+// ------------------------------------------------------------
+// Inputs : queue réseau -> simulation, placement par tick cible
+// ------------------------------------------------------------
+static void BenchInputPipeline(const BenchConfig& config)
+{
+    RCNET_RingQueue* queue = rcnet_ring_queue_create(sizeof(RCNET_ClientInput), 1024, RCNET_RING_QUEUE_MPSC);
+    if (queue)
+    {
+        RunBench(config, "input_queue/push_pop", "ns/op", [&](BenchTimer& timer) {
+            RCNET_ClientInput input;
+            std::memset(&input, 0, sizeof(input));
+            RCNET_ClientInput drained[256];
+
+            timer.begin();
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                input.clientInputSeq = i;
+                rcnet_ring_queue_push(queue, &input);
+            }
+            gSink = gSink + rcnet_ring_queue_pop_batch(queue, drained, 256);
+            timer.end(256);
+        });
+        rcnet_ring_queue_destroy(queue);
+    }
+
+    RCNET_InputBuffer* buffer = rcnet_input_buffer_create(16, kBenchPeers);
+    if (buffer)
+    {
+        uint64_t tick = 0;
+        RunBench(config, "input_buffer/place", "ns/op", [&](BenchTimer& timer) {
+            RCNET_ClientInput input;
+            std::memset(&input, 0, sizeof(input));
+            tick++;
+
+            // Un input par client, 2 ticks d'avance (délai d'input typique)
+            timer.begin();
+            for (uint32_t clientId = 0; clientId < kBenchPeers; ++clientId)
+            {
+                input.clientId = clientId;
+                input.clientInputSeq = static_cast<uint32_t>(tick);
+                rcnet_input_buffer_place(buffer, tick + 2, &input);
+            }
+            timer.end(kBenchPeers);
+
+            uint32_t count = 0;
+            rcnet_input_buffer_take_tick(buffer, tick, &count);
+            gSink = gSink + count;
+        });
+        rcnet_input_buffer_destroy(buffer);
+    }
+}
+
+// ------------------------------------------------------------
+// Kernels SIMD : même colonne pour chaque backend supporté (scalaire compris)
+// ------------------------------------------------------------
+static constexpr uint32_t kBenchKernelValues = 4096;
+
+static void BenchSimd(const BenchConfig& config)
+{
+    // Colonne typique : 3/4 des entités immobiles, les autres bougent de quelques pas de quantification
+    std::vector<float> positions(kBenchKernelValues);
+    std::vector<uint32_t> baseline(kBenchKernelValues);
+    std::vector<uint32_t> current(kBenchKernelValues);
+    for (uint32_t i = 0; i < kBenchKernelValues; ++i)
+    {
+        positions[i] = std::sin(static_cast<float>(i) * 0.37f) * kBenchWorldHalfExtent;
+        baseline[i] = rcnet_quantize_float(positions[i], -kBenchWorldHalfExtent, kBenchWorldHalfExtent, kBenchPositionBits);
+        current[i] = (i % 4 == 0) ? baseline[i] + (i % 13) - 6 : baseline[i];
+    }
+
+    std::vector<uint32_t> quantized(kBenchKernelValues);
+    std::vector<uint64_t> changedMask((kBenchKernelValues + 63) / 64);
+    std::vector<uint32_t> packed(kBenchKernelValues);
+    std::vector<uint8_t> varint(RCNET_SIMD_VARINT_MAX_SIZE(kBenchKernelValues));
+
+    static const RCNET_SimdBackend kBackends[] = {
+        RCNET_SIMD_BACKEND_SCALAR, RCNET_SIMD_BACKEND_SSE41, RCNET_SIMD_BACKEND_AVX2, RCNET_SIMD_BACKEND_NEON
+    };
+
+    for (RCNET_SimdBackend backend : kBackends)
+    {
+        if (!rcnet_simd_set_backend(backend))
+            continue;
+
+        // Temps pour 1024 valeurs (une opération = 1k valeurs, le ns/valeur est trop fin pour l'histogramme)
+        const uint64_t operations = kBenchKernelValues / 1024;
+        std::string prefix = std::string("simd/") + rcnet_simd_get_backend_name(backend);
+
+        RunBench(config, (prefix + "/quantize").c_str(), "ns/1k values", [&](BenchTimer& timer) {
+            timer.begin();
+            rcnet_simd_quantize_floats(positions.data(), kBenchKernelValues, -kBenchWorldHalfExtent, kBenchWorldHalfExtent,
+                                       kBenchPositionBits, quantized.data());
+            timer.end(operations);
+            gSink = gSink + quantized[kBenchKernelValues / 2];
+        });
+
+        RunBench(config, (prefix + "/xor_diff").c_str(), "ns/1k values", [&](BenchTimer& timer) {
+            timer.begin();
+            uint32_t changed = rcnet_simd_xor_diff(current.data(), baseline.data(), kBenchKernelValues, changedMask.data(), packed.data());
+            timer.end(operations);
+            gSink = gSink + changed;
+        });
+
+        RunBench(config, (prefix + "/delta_varint").c_str(), "ns/1k values", [&](BenchTimer& timer) {
+            timer.begin();
+            size_t size = rcnet_simd_encode_delta_varint(current.data(), baseline.data(), kBenchKernelValues, varint.data(), varint.size());
+            timer.end(operations);
+            gSink = gSink + size;
+        });
+    }
+
+    rcnet_simd_set_backend(RCNET_SIMD_BACKEND_AUTO);
+}
+
+// ------------------------------------------------------------
+// Chiffrement des payloads ENet : seal / open en place (coût ajouté à chaque packet)
+// ------------------------------------------------------------
+static constexpr uint32_t kBenchSecurePackets = 64;
+
+static void BenchSecureChannel(const BenchConfig& config)
+{
+    RCNET_SecureKeyPair serverKeys;
+    RCNET_SecureSession* client = rcnet_secure_session_create(2);
+    RCNET_SecureSession* server = rcnet_secure_session_create(2);
+    uint8_t hello[RCNET_SECURE_HELLO_SIZE];
+    uint8_t welcome[RCNET_SECURE_WELCOME_SIZE];
+    if (client == nullptr || server == nullptr || !rcnet_secure_generate_keypair(&serverKeys) ||
+        !rcnet_secure_session_start_client(client, serverKeys.publicKey, hello) ||
+        !rcnet_secure_session_accept_client(server, &serverKeys, hello, sizeof(hello), welcome) ||
+        !rcnet_secure_session_finish_client(client, welcome, sizeof(welcome)))
+    {
+        rcnet_secure_session_destroy(client);
+        rcnet_secure_session_destroy(server);
+        return;
+    }
+
+    static const size_t kPayloadSizes[] = { 64, 256, 1200 };
+    for (size_t payloadSize : kPayloadSizes)
+    {
+        const size_t packetSize = payloadSize + RCNET_SECURE_OVERHEAD;
+        std::vector<uint8_t> packets(packetSize * kBenchSecurePackets, 0x5A);
+        std::string sealName = "secure/seal_" + std::to_string(payloadSize) + "B";
+        std::string openName = "secure/open_" + std::to_string(payloadSize) + "B";
+
+        RunBench(config, sealName.c_str(), "ns/packet", [&](BenchTimer& timer) {
+            timer.begin();
+            for (uint32_t i = 0; i < kBenchSecurePackets; ++i)
+                gSink = gSink + rcnet_secure_session_seal(client, 1, &packets[i * packetSize], payloadSize, packetSize);
+            timer.end(kBenchSecurePackets);
+        });
+
+        RunBench(config, openName.c_str(), "ns/packet", [&](BenchTimer& timer) {
+            for (uint32_t i = 0; i < kBenchSecurePackets; ++i)
+                rcnet_secure_session_seal(client, 1, &packets[i * packetSize], payloadSize, packetSize);
+
+            timer.begin();
+            for (uint32_t i = 0; i < kBenchSecurePackets; ++i)
+            {
+                const uint8_t* payload = nullptr;
+                size_t length = 0;
+                if (rcnet_secure_session_open(server, 1, &packets[i * packetSize], packetSize, &payload, &length))
+                    gSink = gSink + length;
+            }
+            timer.end(kBenchSecurePackets);
+        });
+    }
+
+    rcnet_secure_session_destroy(client);
+    rcnet_secure_session_destroy(server);
+}
+
+// ------------------------------------------------------------
+// Métriques : compteur par thread vs atomic partagé (4 threads qui comptent en parallèle),
+// puis coût d'un scrape (rendu texte, hors HTTP)
+// ------------------------------------------------------------
+static constexpr uint32_t kBenchMetricsThreads = 4;
+static constexpr uint32_t kBenchMetricsAddsPerThread = 100000;
+
+static void BenchMetrics(const BenchConfig& config)
+{
+    // Port 0 : rendu seul, sans endpoint HTTP
+    RCNET_MetricsServerConfig serverConfig;
+    rcnet_metrics_server_get_default_config(&serverConfig);
+    serverConfig.port = 0;
+
+    RCNET_MetricsServer* server = rcnet_metrics_server_create(&serverConfig);
+    RCNET_MetricsCounter* counter = rcnet_metrics_counter_create();
+    RCNET_PacketPool* pool = rcnet_packet_pool_create(NULL);
+    RCNET_RingQueue* queue = rcnet_ring_queue_create(sizeof(uint64_t), 1024, RCNET_RING_QUEUE_MPSC);
+    if (counter == nullptr || server == nullptr || pool == nullptr || queue == nullptr)
+    {
+        rcnet_metrics_server_destroy(server);
+        rcnet_metrics_counter_destroy(counter);
+        rcnet_packet_pool_destroy(pool);
+        rcnet_ring_queue_destroy(queue);
+        return;
+    }
+
+    RunBench(config, "metrics/counter_add_4threads", "ns/add", [&](BenchTimer& timer) {
+        std::vector<std::thread> threads;
+        timer.begin();
+        for (uint32_t t = 0; t < kBenchMetricsThreads; ++t)
+            threads.emplace_back([&]() {
+                for (uint32_t i = 0; i < kBenchMetricsAddsPerThread; ++i)
+                    rcnet_metrics_counter_add(counter, 1);
+            });
+        for (std::thread& thread : threads)
+            thread.join();
+        timer.end(static_cast<uint64_t>(kBenchMetricsThreads) * kBenchMetricsAddsPerThread);
+    });
+
+    std::atomic<uint64_t> shared{0};
+    RunBench(config, "metrics/shared_atomic_add_4threads", "ns/add", [&](BenchTimer& timer) {
+        std::vector<std::thread> threads;
+        timer.begin();
+        for (uint32_t t = 0; t < kBenchMetricsThreads; ++t)
+            threads.emplace_back([&]() {
+                for (uint32_t i = 0; i < kBenchMetricsAddsPerThread; ++i)
+                    shared.fetch_add(1, std::memory_order_relaxed);
+            });
+        for (std::thread& thread : threads)
+            thread.join();
+        timer.end(static_cast<uint64_t>(kBenchMetricsThreads) * kBenchMetricsAddsPerThread);
+    });
+    gSink = gSink + shared.load(std::memory_order_relaxed);
+
+    rcnet_metrics_server_add_collector(server, rcnet_metrics_collect_engine, NULL, NULL);
+    rcnet_metrics_server_add_collector(server, rcnet_metrics_collect_packet_pool, pool, NULL);
+    rcnet_metrics_server_add_collector(server, rcnet_metrics_collect_ring_queue, queue, "queue=\"inputs\"");
+    rcnet_metrics_server_add_counter(server, counter, RCNET_METRIC_COUNTER, "bench_adds_total", "Bench adds", NULL);
+
+    std::vector<char> text(64 * 1024);
+    RunBench(config, "metrics/render", "ns/scrape", [&](BenchTimer& timer) {
+        timer.begin();
+        gSink = gSink + rcnet_metrics_server_render(server, text.data(), text.size());
+        timer.end(1);
+    });
+
+    rcnet_metrics_server_destroy(server);
+    rcnet_metrics_counter_destroy(counter);
+    rcnet_packet_pool_destroy(pool);
+    rcnet_ring_queue_destroy(queue);
+}
+
+// ------------------------------------------------------------
+// Timer : retard de réveil de rcnet_timer_sleep_until (échéance à +1 ms)
+// ------------------------------------------------------------
+static void BenchTimerAccuracy(const BenchConfig& config, const char* name, RCNET_TimerBackend backend)
+{
+    if (!IsBenchSelected(config, name))
+        return;
+
+    RCNET_Timer* sleepTimer = rcnet_timer_create(backend);
+    if (sleepTimer == nullptr)
+        return;
+
+    // Le backend PLATFORM peut retomber sur PORTABLE : ne pas mesurer deux fois le même
+    if (backend != RCNET_TIMER_BACKEND_PORTABLE && rcnet_timer_get_backend(sleepTimer) == RCNET_TIMER_BACKEND_PORTABLE)
+    {
+        rcnet_timer_destroy(sleepTimer);
+        return;
+    }
+
+    RunBench(config, name, "ns late", [&](BenchTimer& timer) {
+        uint64_t startNs = rcnet_timer_get_time_ns();
+        uint64_t deadlineNs = startNs + 1000000ull;
+        rcnet_timer_sleep_until(sleepTimer, deadlineNs, nullptr);
+        uint64_t wokeNs = rcnet_timer_get_time_ns();
+        timer.record(wokeNs > deadlineNs ? wokeNs - deadlineNs : 0, wokeNs - startNs);
+    });
+
+    std::printf("%-40s spin margin %llu ns\n", "", (unsigned long long)rcnet_timer_get_spin_margin_ns(sleepTimer));
+    rcnet_timer_destroy(sleepTimer);
+}
+
+// ------------------------------------------------------------
+// Rapport JSON
+// ------------------------------------------------------------
+static bool WriteJsonReport(const BenchConfig& config)
+{
+    cJSON* root = cJSON_CreateObject();
+    cJSON_AddStringToObject(root, "rcnetVersion", RCNET_BENCH_VERSION);
+    cJSON_AddNumberToObject(root, "minTimeMs", (double)config.minTimeMs);
+    cJSON_AddStringToObject(root, "simdBackend", rcnet_simd_get_backend_name(rcnet_simd_get_backend()));
+
+    cJSON* benchmarks = cJSON_AddArrayToObject(root, "benchmarks");
+    for (const BenchResult& result : gResults)
+    {
+        cJSON* item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "name", result.name.c_str());
+        cJSON_AddStringToObject(item, "unit", result.unit.c_str());
+        cJSON_AddNumberToObject(item, "operations", (double)result.operations);
+        cJSON_AddNumberToObject(item, "mean", (double)result.summary.mean);
+        cJSON_AddNumberToObject(item, "min", (double)result.summary.min);
+        cJSON_AddNumberToObject(item, "p50", (double)result.summary.p50);
+        cJSON_AddNumberToObject(item, "p90", (double)result.summary.p90);
+        cJSON_AddNumberToObject(item, "p99", (double)result.summary.p99);
+        cJSON_AddNumberToObject(item, "max", (double)result.summary.max);
+        cJSON_AddItemToArray(benchmarks, item);
+    }
+
+    char* printed = cJSON_Print(root);
+    cJSON_Delete(root);
+    if (printed == nullptr)
+        return false;
+
+    FILE* file = std::fopen(config.jsonOutput.c_str(), "wb");
+    bool written = file != nullptr && std::fprintf(file, "%s\n", printed) > 0;
+    if (file)
+        std::fclose(file);
+    cJSON_free(printed);
+
+    if (!written)
+        std::fprintf(stderr, "Failed to write %s\n", config.jsonOutput.c_str());
+    return written;
+}
+
+int main(int argc, char* argv[])
+{
+    BenchConfig config;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--min-time" && i + 1 < argc)
+            config.minTimeMs = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--filter" && i + 1 < argc)
+            config.filter = argv[++i];
+        else if (arg == "--json" && i + 1 < argc)
+            config.jsonOutput = argv[++i];
+        else
+        {
+            std::printf("Usage: rcnet_bench [--min-time <ms>] [--filter <substring>] [--json <file>]\n");
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+
+    std::printf("rcnet_bench %s (min %u ms per benchmark, simd %s)\n", RCNET_BENCH_VERSION, config.minTimeMs,
+                rcnet_simd_get_backend_name(rcnet_simd_get_backend()));
+
+    BenchLogger(config);
+    BenchInputDecode(config);
+    BenchSnapshots(config);
+    BenchInputPipeline(config);
+    BenchSimd(config);
+    BenchSecureChannel(config);
+    BenchMetrics(config);
+    BenchTimerAccuracy(config, "timer/sleep_until_1ms_portable", RCNET_TIMER_BACKEND_PORTABLE);
+    BenchTimerAccuracy(config, "timer/sleep_until_1ms_platform", RCNET_TIMER_BACKEND_PLATFORM);
+
+    if (!config.jsonOutput.empty() && !WriteJsonReport(config))
+        return 1;
+    return 0;
+}
@@ -1,17 +1,53 @@
-#include <RCNET/RCNET.h>               // logger
+#include <RCNET/RCNET.h>               // logger + codec binaire
 #include <rcenet/RCENET_enet.h>        // wrapper ENet de RCENET                
 
-#include <cJSON.h>                     // pour construire un JSON d’input
+#include "snapshot_schema.h"           // schéma des snapshots partagé avec le serveur
+
+#include <cJSON.h>                     // pour construire un JSON d’input (mode debug RCNET_EXAMPLE_JSON_DEBUG)
 
 #include <cstdio>
 #include <cstring>
 #include <string>
+#include <vector>
 #include <chrono>
 #include <thread>
 
 // ------------------------------------------------------------
-// Helper: crée un JSON input comme ton serveur l'attend
+// Schéma des snapshots : partagé avec le serveur (snapshot_schema.h)
+// ------------------------------------------------------------
+static constexpr uint32_t kSnapshotHistorySize = 64;
+
+static RCNET_SnapshotHistory* CreateSnapshotHistory(void)
+{
+    RCNET_SnapshotSchema schema;
+    std::memset(&schema, 0, sizeof(schema));
+    schema.maxEntities = kMaxServerClients;
+    schema.fieldCount = kPlayerFieldCount;
+    schema.fieldBits[kPlayerFieldPosX] = kPositionBits;
+    schema.fieldBits[kPlayerFieldPosY] = kPositionBits;
+    schema.fieldBits[kPlayerFieldButtons] = kButtonsBits;
+
+    // Côté client : pas d'acks à suivre (maxClients = 0)
+    return rcnet_snapshot_history_create(&schema, kSnapshotHistorySize, 0);
+}
+
+// Compression des snapshots : kSnapshotChannel en LZ4 bloc, identique au serveur
+static RCNET_Compressor* CreateSnapshotCompressor(void)
+{
+    RCNET_CompressionConfig config;
+    rcnet_compression_get_default_config(&config);
+    config.channelCount = 2;
+    config.channelModes[kSnapshotChannel] = RCNET_COMPRESSION_MODE_BLOCK;
+    config.maxPacketSize = 16 * 1024;
+
+    return rcnet_compressor_create(&config);
+}
+
+#ifdef RCNET_EXAMPLE_JSON_DEBUG
+// ------------------------------------------------------------
+// Helper: crée un JSON input comme ton serveur l'attend (mode debug)
 // { "clientTick": X, "seq": Y, "buttons": B, "ax": ..., "ay": ... }
+// Par défaut, l'input est encodé en binaire avec rcnet_codec_encode_client_input().
 // ------------------------------------------------------------
 static std::string BuildInputJson(uint32_t clientTickId, uint32_t inputSeq, uint32_t buttonsMask, float ax, float ay)
 {
@@ -36,6 +72,7 @@ static std::string BuildInputJson(uint32_t clientTickId, uint32_t inputSeq, uint
 
     return json;
 }
+#endif
 
 int initializeClient(void)
 {
@@ -115,7 +152,7 @@ int initializeClient(void)
     // ------------------------------------------------------------
     // 5) Boucle client simple :
     // - service events (receive/disconnect)
-    // - envoyer input JSON toutes les ~16ms (≈60Hz)
+    // - envoyer input (binaire, ou JSON en debug) toutes les ~16ms (≈60Hz)
     // ------------------------------------------------------------
     uint32_t clientTickId = 0;
     uint32_t inputSeq = 0;
@@ -123,6 +160,17 @@ int initializeClient(void)
     auto lastSendTime = std::chrono::steady_clock::now();
     constexpr int sendIntervalMs = 16; // ~60 Hz input envoi (simple)
 
+    // Derniers états reçus (baselines des deltas snapshot)
+    RCNET_SnapshotHistory* snapshotHistory = CreateSnapshotHistory();
+
+    // Décompression du channel snapshot (buffer réutilisé pour chaque packet)
+    RCNET_Compressor* snapshotCompressor = CreateSnapshotCompressor();
+    std::vector<uint8_t> decompressedPacket(16 * 1024);
+
+    // Inputs groupés : chaque packet porte les derniers inputs non ackés (un packet perdu est
+    // rattrapé par le suivant), un packet toutes les 2 frames
+    RCNET_InputSender* inputSender = rcnet_input_sender_create(NULL);
+
     while (isConnected)
     {
         // --------------------------------------------------------
@@ -134,9 +182,77 @@ int initializeClient(void)
             {
                 case ENET_EVENT_TYPE_RECEIVE:
                 {
+                    const uint8_t* packetData = event.packet->data;
+                    size_t packetLength = event.packet->dataLength;
+
+                    // Channel compressé : restaurer le packet d'origine avant de le décoder
+                    if (rcnet_compressor_is_channel_enabled(snapshotCompressor, event.channelID))
+                    {
+                        packetLength = rcnet_compressor_decompress(snapshotCompressor, event.channelID, packetData, packetLength,
+                                                                   decompressedPacket.data(), decompressedPacket.size());
+                        packetData = decompressedPacket.data();
+                        if (packetLength == 0)
+                        {
+                            std::printf("[RECV] invalid compressed packet (len=%zu)\n", (size_t)event.packet->dataLength);
+                            enet_packet_destroy(event.packet);
+                            break;
+                        }
+                    }
+
+                    // Snapshot binaire (mode par défaut)
+                    if (rcnet_codec_peek_type(packetData, packetLength) == RCNET_PACKET_TYPE_SNAPSHOT)
+                    {
+                        RCNET_PacketReader reader;
+                        rcnet_packet_reader_init(&reader, packetData, packetLength);
+
+                        RCNET_SnapshotHeader header;
+                        if (rcnet_codec_read_snapshot_header(&reader, &header))
+                        {
+                            // Inputs confirmés par le serveur : plus besoin de les renvoyer
+                            if (inputSender)
+                                rcnet_input_sender_ack(inputSender, header.ackRecv);
+
+                            // Reconstruire l'état (delta contre une baseline locale, ou complet)
+                            if (snapshotHistory && rcnet_snapshot_history_decode(snapshotHistory, header.serverTick, &reader))
+                            {
+                                // Ack : baseline des prochains deltas envoyés par le serveur
+                                uint8_t ackBuffer[RCNET_SNAPSHOT_ACK_PACKET_SIZE];
+                                size_t ackLength = rcnet_codec_encode_snapshot_ack(header.serverTick, ackBuffer, sizeof(ackBuffer));
+                                enet_peer_send(serverPeer, 0, enet_packet_create(ackBuffer, ackLength, ENET_PACKET_FLAG_UNSEQUENCED));
+
+                                uint32_t playerCount = 0;
+                                uint32_t fields[kPlayerFieldCount];
+                                for (uint32_t entityId = 0; entityId < kMaxServerClients; ++entityId)
+                                {
+                                    if (!rcnet_snapshot_history_read_entity(snapshotHistory, header.serverTick, entityId, fields))
+                                        continue;
+
+                                    if (playerCount == 0)
+                                    {
+                                        std::printf("[RECV] player=%u pos=(%.2f, %.2f)\n", entityId,
+                                                    rcnet_dequantize_float(fields[kPlayerFieldPosX], -kWorldHalfExtent, kWorldHalfExtent, kPositionBits),
+                                                    rcnet_dequantize_float(fields[kPlayerFieldPosY], -kWorldHalfExtent, kWorldHalfExtent, kPositionBits));
+                                    }
+                                    playerCount++;
+                                }
+
+                                std::printf("[RECV] serverTick=%llu ackApplied=%u ackRecv=%u players=%u\n",
+                                            (unsigned long long)header.serverTick, header.ackApplied, header.ackRecv, playerCount);
+                            }
+                        }
+                        else
+                        {
+                            std::printf("[RECV] invalid binary snapshot (len=%zu)\n", packetLength);
+                        }
+
+                        enet_packet_destroy(event.packet);
+                        break;
+                    }
+
+                    // Snapshot JSON (mode debug du serveur)
                     std::string snapshotText(
-                        reinterpret_cast<const char*>(event.packet->data),
-                        reinterpret_cast<const char*>(event.packet->data) + event.packet->dataLength
+                        reinterpret_cast<const char*>(packetData),
+                        reinterpret_cast<const char*>(packetData) + packetLength
                     );
 
                     // cJSON veut une string terminée par '\0'
@@ -206,18 +322,49 @@ int initializeClient(void)
             float ay = -0.10f;
             uint32_t buttons = 1; // ex: "W"
 
+#ifdef RCNET_EXAMPLE_JSON_DEBUG
+            // Mode debug : JSON lisible (plus lent, allocations), un input par packet
             std::string inputJson = BuildInputJson(clientTickId, inputSeq, buttons, ax, ay);
+            const void* inputBytes  = inputJson.data();
+            size_t      inputLength = inputJson.size();
+#else
+            // Mode par défaut : binaire RCNET_codec, derniers inputs non ackés bit-packés (aucune allocation)
+            RCNET_ClientInput input;
+            input.clientId       = 0; // déduit du peer côté serveur
+            input.clientTickId   = clientTickId;
+            input.clientInputSeq = inputSeq;
+            input.buttonsMask    = buttons;
+            input.axisX          = ax;
+            input.axisY          = ay;
+
+            uint8_t inputBuffer[RCNET_CLIENT_INPUT_BATCH_MAX_PACKET_SIZE];
+            const void* inputBytes  = inputBuffer;
+            size_t      inputLength = 0;
+            if (inputSender)
+            {
+                // Pas de packet cette frame (inputLength = 0) : l'input partira avec le suivant
+                if (rcnet_input_sender_add(inputSender, &input))
+                    inputLength = rcnet_input_sender_encode(inputSender, inputBuffer, sizeof(inputBuffer));
+            }
+            else
+            {
+                inputLength = rcnet_codec_encode_client_input(&input, inputBuffer, sizeof(inputBuffer));
+            }
+#endif
 
-            ENetPacket* inputPacket = enet_packet_create(
-                inputJson.data(),
-                inputJson.size(),
-                ENET_PACKET_FLAG_UNSEQUENCED // inputs => souvent unsequenced ou unreliable
-            );
+            if (inputLength > 0)
+            {
+                ENetPacket* inputPacket = enet_packet_create(
+                    inputBytes,
+                    inputLength,
+                    ENET_PACKET_FLAG_UNSEQUENCED // inputs => souvent unsequenced ou unreliable
+                );
 
-            enet_peer_send(serverPeer, 0, inputPacket);
+                enet_peer_send(serverPeer, 0, inputPacket);
 
-            // Flush pour pousser vite (optionnel)
-            enet_host_flush(clientHost);
+                // Flush pour pousser vite (optionnel)
+                enet_host_flush(clientHost);
+            }
 
             // (Option) log
             // std::printf("[SEND] %s\n", inputJson.c_str());
@@ -230,6 +377,10 @@ int initializeClient(void)
     // ------------------------------------------------------------
     // 6) Cleanup
     // ------------------------------------------------------------
+    rcnet_snapshot_history_destroy(snapshotHistory);
+    rcnet_compressor_destroy(snapshotCompressor);
+    rcnet_input_sender_destroy(inputSender);
+
     if (serverPeer)
     {
         enet_peer_disconnect(serverPeer, 0);
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+// ------------------------------------------------------------
+// Schéma des snapshots partagé par example-server, example-client et example-loadgen.
+//
+// Une entité par joueur (entityId == clientId) : position + boutons.
+// Le codec delta des snapshots n'est décodable que si les deux côtés utilisent exactement
+// les mêmes bornes, bits par champ et channel : toute modification se fait ici, une seule fois.
+// ------------------------------------------------------------
+
+// Nombre maximum de clients côté serveur (= entités du monde)
+static constexpr uint32_t kMaxServerClients = 128;
+
+static constexpr float kWorldHalfExtent = 512.0f;   // positions dans [-512, 512]
+static constexpr uint32_t kPositionBits = 16;       // ~1.6 cm de précision
+static constexpr uint32_t kButtonsBits = 8;
+
+enum PlayerSnapshotField : uint32_t
+{
+    kPlayerFieldPosX = 0,
+    kPlayerFieldPosY,
+    kPlayerFieldButtons,
+    kPlayerFieldCount
+};
+
+// Channels ENet : 0 = inputs / acks (petits, jamais compressés), 1 = snapshots (LZ4 bloc).
+// Le channel snapshot est unreliable : chaque packet doit se décompresser seul, d'où le mode
+// bloc (le mode stream est réservé aux channels reliable).
+static constexpr uint8_t kSnapshotChannel = 1;
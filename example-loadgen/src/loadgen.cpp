@@ -0,0 +1,793 @@
+#include <RCNET/RCNET.h>               // logger + codec binaire + snapshots + inputs groupés
+#include <rcenet/RCENET_enet.h>        // wrapper ENet de RCENET
+
+#include "snapshot_schema.h"           // schéma des snapshots partagé avec le serveur
+
+#include <cJSON.h>                     // rapport JSON
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ------------------------------------------------------------
+// Générateur de charge headless : des milliers de clients simulés sur quelques threads.
+//
+// Chaque thread possède plusieurs ENetHost (peersPerHost connexions sortantes chacun) et fait
+// tourner, pour chaque client, la même boucle que example-client (inputs groupés et redondants,
+// décodage + ack des snapshots), sans rendu. Pertes et gigue sont injectées côté applicatif.
+//
+// Mesures (après la phase de connexion) :
+// - latence input -> ackRecv / ackApplied (en-tête des snapshots)
+// - intervalle entre deux snapshots d'un même client
+// - dépassements côté serveur : snapshots en retard (stalls) et retard du tick serveur sur l'horloge murale
+//
+// Rapport JSON sur stdout (ou --output), à comparer d'une release à l'autre.
+// ------------------------------------------------------------
+
+// ------------------------------------------------------------
+// Schéma des snapshots : partagé avec le serveur (snapshot_schema.h)
+// ------------------------------------------------------------
+
+// Moins d'états conservés que example-client (~1 s à 30 Hz) : la mémoire est multipliée par le nombre de clients
+static constexpr uint32_t kSnapshotHistorySize = 32;
+
+// Dates de création des inputs (indexées par clientInputSeq) pour mesurer la latence jusqu'à l'ack
+static constexpr uint32_t kInputTimeRingSize = 256;
+
+// Packets retardés par la gigue injectée (au-delà, envoyé sans délai)
+static constexpr uint32_t kMaxDelayedPackets = 16;
+
+// ------------------------------------------------------------
+// Configuration (ligne de commande)
+// ------------------------------------------------------------
+struct LoadgenConfig
+{
+    std::string host = "127.0.0.1";
+    uint16_t port = 7777;
+    uint32_t clients = 100;
+    uint32_t threads = 4;
+    uint32_t peersPerHost = 64;
+    uint32_t durationSeconds = 30;
+    uint32_t connectTimeoutMs = 5000;
+    double inputHz = 60.0;
+    double lossPercent = 0.0;       // appliqué aux packets envoyés et aux snapshots reçus
+    uint32_t jitterMs = 0;          // délai aléatoire [0, jitterMs] avant l'envoi de chaque packet
+    uint32_t serverSimHz = 60;      // tick rate simulation du serveur (retard du tick serveur)
+    uint32_t stallMs = 150;         // intervalle entre snapshots au-delà duquel un snapshot compte comme stall
+    bool decodeSnapshots = true;    // false : pas de décodage ni d'ack (le serveur n'envoie que des snapshots complets)
+    std::string output;             // vide : stdout
+};
+
+// ------------------------------------------------------------
+// Résultats partagés entre threads (histogrammes lock-free, en microsecondes)
+// ------------------------------------------------------------
+struct LoadgenResults
+{
+    RCNET_Histogram* inputToAckRecvUs = nullptr;
+    RCNET_Histogram* inputToAckAppliedUs = nullptr;
+    RCNET_Histogram* snapshotInterarrivalUs = nullptr;
+
+    std::atomic<uint64_t> connected{0};
+    std::atomic<uint64_t> connectFailed{0};
+    std::atomic<uint64_t> disconnected{0};
+
+    std::atomic<uint64_t> inputsGenerated{0};
+    std::atomic<uint64_t> packetsSent{0};
+    std::atomic<uint64_t> packetsDropped{0};       // pertes injectées (envoi)
+    std::atomic<uint64_t> bytesSent{0};
+
+    std::atomic<uint64_t> snapshotsReceived{0};
+    std::atomic<uint64_t> snapshotsDropped{0};     // pertes injectées (réception)
+    std::atomic<uint64_t> snapshotsInvalid{0};
+    std::atomic<uint64_t> snapshotDecodeFailures{0};
+    std::atomic<uint64_t> bytesReceived{0};
+
+    std::atomic<uint64_t> snapshotStalls{0};
+    std::atomic<uint64_t> serverTickLagMax{0};    // ticks de simulation
+};
+
+static LoadgenResults gResults;
+
+// Phases : connexion (pas de mesure) -> mesure -> arrêt
+static std::atomic<uint32_t> gReadyThreads{0};
+static std::atomic<bool> gMeasuring{false};
+static std::atomic<bool> gStopRequested{false};
+
+static const std::chrono::steady_clock::time_point gEpoch = std::chrono::steady_clock::now();
+
+static uint64_t NowNs(void)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - gEpoch).count());
+}
+
+static void AtomicStoreMax(std::atomic<uint64_t>& target, uint64_t value)
+{
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+// ------------------------------------------------------------
+// Client simulé
+// ------------------------------------------------------------
+struct DelayedPacket
+{
+    uint64_t releaseNs;
+    ENetPacket* packet;
+};
+
+struct LoadgenClient
+{
+    ENetPeer* peer = nullptr;
+    ENetHost* host = nullptr;
+    bool connected = false;
+    bool closed = false;   // déconnecté ou jamais connecté
+
+    RCNET_InputSender* inputSender = nullptr;
+    RCNET_SnapshotHistory* snapshotHistory = nullptr;
+
+    uint32_t clientTickId = 0;
+    uint32_t inputSeq = 0;
+    uint64_t nextInputNs = 0;
+    float phase = 0.0f;
+
+    uint64_t inputTimeNs[kInputTimeRingSize];
+    uint32_t lastAckRecv = 0;
+    uint32_t lastAckApplied = 0;
+
+    uint64_t lastSnapshotNs = 0;
+    bool hasServerTick = false;
+    uint64_t firstServerTick = 0;
+    uint64_t firstServerTickNs = 0;
+
+    DelayedPacket delayed[kMaxDelayedPackets];
+    uint32_t delayedCount = 0;
+};
+
+static RCNET_SnapshotHistory* CreateSnapshotHistory(void)
+{
+    RCNET_SnapshotSchema schema;
+    std::memset(&schema, 0, sizeof(schema));
+    schema.maxEntities = kMaxServerClients;
+    schema.fieldCount = kPlayerFieldCount;
+    schema.fieldBits[kPlayerFieldPosX] = kPositionBits;
+    schema.fieldBits[kPlayerFieldPosY] = kPositionBits;
+    schema.fieldBits[kPlayerFieldButtons] = kButtonsBits;
+
+    // Côté client : pas d'acks à suivre (maxClients = 0)
+    return rcnet_snapshot_history_create(&schema, kSnapshotHistorySize, 0);
+}
+
+// Compression des snapshots : channel 1 en LZ4 bloc, identique au serveur
+static RCNET_Compressor* CreateSnapshotCompressor(void)
+{
+    RCNET_CompressionConfig config;
+    rcnet_compression_get_default_config(&config);
+    config.channelCount = 2;
+    config.channelModes[kSnapshotChannel] = RCNET_COMPRESSION_MODE_BLOCK;
+    config.maxPacketSize = 16 * 1024;
+
+    return rcnet_compressor_create(&config);
+}
+
+// Latence création de l'input -> première confirmation, pour chaque seq de ]lastAcked, acked]
+static void RecordAckLatencies(LoadgenClient& client, uint32_t& lastAcked, uint32_t acked, uint64_t nowNs, RCNET_Histogram* histogram)
+{
+    if (static_cast<int32_t>(acked - lastAcked) <= 0 || static_cast<int32_t>(acked - client.inputSeq) > 0)
+        return;
+
+    uint32_t first = lastAcked + 1;
+    if (acked - lastAcked > kInputTimeRingSize)
+        first = acked - kInputTimeRingSize + 1;
+
+    for (uint32_t seq = first; seq != acked + 1; ++seq)
+    {
+        uint64_t createdNs = client.inputTimeNs[seq % kInputTimeRingSize];
+        if (createdNs != 0 && nowNs >= createdNs)
+            rcnet_histogram_record(histogram, (nowNs - createdNs) / 1000);
+    }
+
+    lastAcked = acked;
+}
+
+// ------------------------------------------------------------
+// Réception
+// ------------------------------------------------------------
+static void HandleReceive(const LoadgenConfig& config, LoadgenClient& client, RCNET_Compressor* compressor,
+                          std::vector<uint8_t>& decompressed, std::minstd_rand& rng, const ENetEvent& event)
+{
+    const bool measuring = gMeasuring.load(std::memory_order_relaxed);
+    const uint8_t* packetData = event.packet->data;
+    size_t packetLength = event.packet->dataLength;
+
+    if (measuring)
+        gResults.bytesReceived.fetch_add(packetLength, std::memory_order_relaxed);
+
+    // Perte injectée : le snapshot n'a jamais été reçu (pas d'ack, pas de mesure)
+    std::uniform_real_distribution<double> percent(0.0, 100.0);
+    if (config.lossPercent > 0.0 && percent(rng) < config.lossPercent)
+    {
+        if (measuring)
+            gResults.snapshotsDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // Channel compressé : restaurer le packet d'origine avant de le décoder
+    if (rcnet_compressor_is_channel_enabled(compressor, event.channelID))
+    {
+        packetLength = rcnet_compressor_decompress(compressor, event.channelID, packetData, packetLength,
+                                                   decompressed.data(), decompressed.size());
+        packetData = decompressed.data();
+    }
+
+    RCNET_PacketReader reader;
+    rcnet_packet_reader_init(&reader, packetData, packetLength);
+
+    RCNET_SnapshotHeader header;
+    if (packetLength == 0 || rcnet_codec_peek_type(packetData, packetLength) != RCNET_PACKET_TYPE_SNAPSHOT
+        || !rcnet_codec_read_snapshot_header(&reader, &header))
+    {
+        if (measuring)
+            gResults.snapshotsInvalid.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const uint64_t nowNs = NowNs();
+    if (client.inputSender)
+        rcnet_input_sender_ack(client.inputSender, header.ackRecv);
+
+    if (measuring)
+    {
+        gResults.snapshotsReceived.fetch_add(1, std::memory_order_relaxed);
+
+        RecordAckLatencies(client, client.lastAckRecv, header.ackRecv, nowNs, gResults.inputToAckRecvUs);
+        RecordAckLatencies(client, client.lastAckApplied, header.ackApplied, nowNs, gResults.inputToAckAppliedUs);
+
+        if (client.lastSnapshotNs != 0)
+        {
+            uint64_t interarrivalNs = nowNs - client.lastSnapshotNs;
+            rcnet_histogram_record(gResults.snapshotInterarrivalUs, interarrivalNs / 1000);
+            if (interarrivalNs > static_cast<uint64_t>(config.stallMs) * 1000000ull)
+                gResults.snapshotStalls.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Retard du tick serveur sur l'horloge murale depuis le premier snapshot mesuré
+        if (!client.hasServerTick)
+        {
+            client.hasServerTick = true;
+            client.firstServerTick = header.serverTick;
+            client.firstServerTickNs = nowNs;
+        }
+        else if (header.serverTick >= client.firstServerTick)
+        {
+            uint64_t expectedTicks = (nowNs - client.firstServerTickNs) * config.serverSimHz / 1000000000ull;
+            uint64_t observedTicks = header.serverTick - client.firstServerTick;
+            if (expectedTicks > observedTicks)
+                AtomicStoreMax(gResults.serverTickLagMax, expectedTicks - observedTicks);
+        }
+    }
+    else
+    {
+        // Pendant la connexion : suivre les acks sans mesurer
+        client.lastAckRecv = header.ackRecv;
+        client.lastAckApplied = header.ackApplied;
+    }
+    client.lastSnapshotNs = nowNs;
+
+    if (!config.decodeSnapshots || client.snapshotHistory == nullptr)
+        return;
+
+    // Reconstruire l'état puis acker : baseline des prochains deltas envoyés par le serveur
+    if (!rcnet_snapshot_history_decode(client.snapshotHistory, header.serverTick, &reader))
+    {
+        if (measuring)
+            gResults.snapshotDecodeFailures.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    uint8_t ackBuffer[RCNET_SNAPSHOT_ACK_PACKET_SIZE];
+    size_t ackLength = rcnet_codec_encode_snapshot_ack(header.serverTick, ackBuffer, sizeof(ackBuffer));
+    enet_peer_send(client.peer, 0, enet_packet_create(ackBuffer, ackLength, ENET_PACKET_FLAG_UNSEQUENCED));
+}
+
+// ------------------------------------------------------------
+// Envoi
+// ------------------------------------------------------------
+static void SendOrDelay(const LoadgenConfig& config, LoadgenClient& client, std::minstd_rand& rng, const void* bytes, size_t length, uint64_t nowNs)
+{
+    const bool measuring = gMeasuring.load(std::memory_order_relaxed);
+
+    std::uniform_real_distribution<double> percent(0.0, 100.0);
+    if (config.lossPercent > 0.0 && percent(rng) < config.lossPercent)
+    {
+        if (measuring)
+            gResults.packetsDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ENetPacket* packet = enet_packet_create(bytes, length, ENET_PACKET_FLAG_UNSEQUENCED);
+    if (packet == nullptr)
+        return;
+
+    if (measuring)
+    {
+        gResults.packetsSent.fetch_add(1, std::memory_order_relaxed);
+        gResults.bytesSent.fetch_add(length, std::memory_order_relaxed);
+    }
+
+    // Gigue injectée : les packets peuvent arriver dans le désordre (channel unsequenced)
+    if (config.jitterMs > 0 && client.delayedCount < kMaxDelayedPackets)
+    {
+        std::uniform_int_distribution<uint32_t> delayMs(0, config.jitterMs);
+        DelayedPacket& delayed = client.delayed[client.delayedCount++];
+        delayed.releaseNs = nowNs + static_cast<uint64_t>(delayMs(rng)) * 1000000ull;
+        delayed.packet = packet;
+        return;
+    }
+
+    enet_peer_send(client.peer, 0, packet);
+}
+
+static void ReleaseDelayedPackets(LoadgenClient& client, uint64_t nowNs)
+{
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < client.delayedCount; ++i)
+    {
+        if (client.delayed[i].releaseNs <= nowNs)
+            enet_peer_send(client.peer, 0, client.delayed[i].packet);
+        else
+            client.delayed[kept++] = client.delayed[i];
+    }
+    client.delayedCount = kept;
+}
+
+static void GenerateInput(const LoadgenConfig& config, LoadgenClient& client, std::minstd_rand& rng, uint64_t nowNs)
+{
+    client.clientTickId++;
+    client.inputSeq++;
+    client.inputTimeNs[client.inputSeq % kInputTimeRingSize] = nowNs;
+
+    // Déplacement circulaire (axes qui changent à chaque frame, comme un joueur actif)
+    float angle = client.phase + static_cast<float>(client.clientTickId) * 0.05f;
+
+    RCNET_ClientInput input;
+    input.clientId       = 0; // déduit du peer côté serveur
+    input.clientTickId   = client.clientTickId;
+    input.clientInputSeq = client.inputSeq;
+    input.buttonsMask    = (client.clientTickId / 30) & 0x3u;
+    input.axisX          = std::cos(angle);
+    input.axisY          = std::sin(angle);
+
+    if (gMeasuring.load(std::memory_order_relaxed))
+        gResults.inputsGenerated.fetch_add(1, std::memory_order_relaxed);
+
+    uint8_t inputBuffer[RCNET_CLIENT_INPUT_BATCH_MAX_PACKET_SIZE];
+    size_t inputLength = 0;
+    if (client.inputSender)
+    {
+        if (rcnet_input_sender_add(client.inputSender, &input))
+            inputLength = rcnet_input_sender_encode(client.inputSender, inputBuffer, sizeof(inputBuffer));
+    }
+    else
+    {
+        inputLength = rcnet_codec_encode_client_input(&input, inputBuffer, sizeof(inputBuffer));
+    }
+
+    if (inputLength > 0)
+        SendOrDelay(config, client, rng, inputBuffer, inputLength, nowNs);
+}
+
+// ------------------------------------------------------------
+// Thread : plusieurs ENetHost, clients [firstClient, firstClient + clientCount)
+// ------------------------------------------------------------
+static void RunLoadgenThread(const LoadgenConfig& config, const ENetAddress& serverAddress, uint32_t threadIndex, uint32_t clientCount)
+{
+    std::minstd_rand rng(0x5eed1234u + threadIndex);
+    RCNET_Compressor* compressor = CreateSnapshotCompressor();
+    std::vector<uint8_t> decompressed(16 * 1024);
+
+    std::vector<LoadgenClient> clients(clientCount);
+    std::vector<ENetHost*> hosts;
+
+    // Connexions : un ENetHost (donc un socket UDP) pour peersPerHost clients
+    for (uint32_t i = 0; i < clientCount; ++i)
+    {
+        if (i % config.peersPerHost == 0)
+        {
+            uint32_t hostPeers = std::min(config.peersPerHost, clientCount - i);
+            ENetHost* host = enet_host_create(serverAddress.type, NULL, hostPeers, 2, 0, 0);
+            if (host == nullptr)
+            {
+                RCNET_log(RCNET_LOG_ERROR, "[LOADGEN] enet_host_create failed (thread=%u)\n", threadIndex);
+                break;
+            }
+            hosts.push_back(host);
+        }
+
+        LoadgenClient& client = clients[i];
+        std::memset(client.inputTimeNs, 0, sizeof(client.inputTimeNs));
+        client.host = hosts.back();
+        client.phase = static_cast<float>(threadIndex * clientCount + i) * 0.37f;
+        client.inputSender = rcnet_input_sender_create(NULL);
+        if (config.decodeSnapshots)
+            client.snapshotHistory = CreateSnapshotHistory();
+
+        client.peer = enet_host_connect(client.host, &serverAddress, 2, 0);
+        if (client.peer == nullptr)
+        {
+            client.closed = true;
+            continue;
+        }
+        client.peer->data = &client;
+    }
+
+    const uint64_t inputPeriodNs = static_cast<uint64_t>(1000000000.0 / config.inputHz);
+    const uint64_t connectDeadlineNs = NowNs() + static_cast<uint64_t>(config.connectTimeoutMs) * 1000000ull;
+    bool ready = false;
+
+    while (!gStopRequested.load(std::memory_order_relaxed))
+    {
+        // A) Pump réseau de tous les hosts du thread
+        ENetEvent event;
+        for (ENetHost* host : hosts)
+        {
+            while (enet_host_service(host, &event, 0) > 0)
+            {
+                LoadgenClient* client = event.peer ? static_cast<LoadgenClient*>(event.peer->data) : nullptr;
+                switch (event.type)
+                {
+                    case ENET_EVENT_TYPE_CONNECT:
+                        if (client)
+                        {
+                            client->connected = true;
+                            client->nextInputNs = NowNs();
+                            gResults.connected.fetch_add(1, std::memory_order_relaxed);
+                        }
+                        break;
+
+                    case ENET_EVENT_TYPE_RECEIVE:
+                        if (client && client->connected)
+                            HandleReceive(config, *client, compressor, decompressed, rng, event);
+                        enet_packet_destroy(event.packet);
+                        break;
+
+                    case ENET_EVENT_TYPE_DISCONNECT:
+                    case ENET_EVENT_TYPE_DISCONNECT_TIMEOUT:
+                        if (client && !client->closed)
+                        {
+                            if (client->connected)
+                                gResults.disconnected.fetch_add(1, std::memory_order_relaxed);
+                            else
+                                gResults.connectFailed.fetch_add(1, std::memory_order_relaxed);
+                            client->connected = false;
+                            client->closed = true;
+                        }
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+        }
+
+        // B) Inputs à intervalle fixe + packets retardés
+        uint64_t nowNs = NowNs();
+        uint32_t pendingConnections = 0;
+        for (LoadgenClient& client : clients)
+        {
+            if (client.closed)
+                continue;
+
+            if (!client.connected)
+            {
+                pendingConnections++;
+                continue;
+            }
+
+            // Thread en retard : on ne rattrape pas plus de 4 frames (sinon rafale d'inputs)
+            if (nowNs > client.nextInputNs + 4 * inputPeriodNs)
+                client.nextInputNs = nowNs;
+
+            while (client.nextInputNs <= nowNs)
+            {
+                GenerateInput(config, client, rng, nowNs);
+                client.nextInputNs += inputPeriodNs;
+            }
+
+            ReleaseDelayedPackets(client, nowNs);
+        }
+
+        for (ENetHost* host : hosts)
+            enet_host_flush(host);
+
+        // Fin de la phase de connexion : tout le monde est connecté, ou délai dépassé
+        if (!ready && (pendingConnections == 0 || nowNs >= connectDeadlineNs))
+        {
+            ready = true;
+            for (LoadgenClient& client : clients)
+            {
+                if (!client.closed && !client.connected)
+                {
+                    client.closed = true;
+                    gResults.connectFailed.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            gReadyThreads.fetch_add(1, std::memory_order_release);
+        }
+
+        // Petite pause pour éviter 100% CPU
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Déconnexion propre : libère les slots côté serveur
+    for (LoadgenClient& client : clients)
+    {
+        if (client.connected)
+            enet_peer_disconnect(client.peer, 0);
+    }
+    uint64_t disconnectDeadlineNs = NowNs() + 200000000ull;
+    while (NowNs() < disconnectDeadlineNs)
+    {
+        ENetEvent event;
+        for (ENetHost* host : hosts)
+        {
+            while (enet_host_service(host, &event, 0) > 0)
+            {
+                if (event.type == ENET_EVENT_TYPE_RECEIVE)
+                    enet_packet_destroy(event.packet);
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    for (LoadgenClient& client : clients)
+    {
+        for (uint32_t i = 0; i < client.delayedCount; ++i)
+            enet_packet_destroy(client.delayed[i].packet);
+        rcnet_input_sender_destroy(client.inputSender);
+        rcnet_snapshot_history_destroy(client.snapshotHistory);
+    }
+    for (ENetHost* host : hosts)
+        enet_host_destroy(host);
+    rcnet_compressor_destroy(compressor);
+
+    // Thread qui n'a pas pu créer ses hosts : ne pas bloquer le thread principal
+    if (!ready)
+        gReadyThreads.fetch_add(1, std::memory_order_release);
+}
+
+// ------------------------------------------------------------
+// Ligne de commande
+// ------------------------------------------------------------
+static void PrintUsage(void)
+{
+    std::printf(
+        "Usage: rcnet_loadgen [options]\n"
+        "  --host <addr>             Serveur (defaut 127.0.0.1)\n"
+        "  --port <port>             Port (defaut 7777)\n"
+        "  --clients <n>             Clients simules (defaut 100)\n"
+        "  --threads <n>             Threads (defaut 4)\n"
+        "  --peers-per-host <n>      Connexions par ENetHost (defaut 64)\n"
+        "  --duration <s>            Duree de mesure apres connexion (defaut 30)\n"
+        "  --connect-timeout <ms>    Delai max de la phase de connexion (defaut 5000)\n"
+        "  --input-hz <hz>           Inputs par seconde et par client (defaut 60)\n"
+        "  --loss <pct>              Perte injectee, envoi et reception (defaut 0)\n"
+        "  --jitter <ms>             Gigue injectee a l'envoi (defaut 0)\n"
+        "  --server-sim-hz <hz>      Tick rate simulation du serveur (defaut 60)\n"
+        "  --stall <ms>              Seuil d'un snapshot en retard (defaut 150)\n"
+        "  --no-decode               Ne pas decoder ni acker les snapshots\n"
+        "  --output <file>           Rapport JSON (defaut stdout)\n");
+}
+
+static bool ParseArguments(int argc, char* argv[], LoadgenConfig& config)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            PrintUsage();
+            return false;
+        }
+        if (arg == "--no-decode")
+        {
+            config.decodeSnapshots = false;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+        {
+            std::fprintf(stderr, "Missing value for %s\n", arg.c_str());
+            return false;
+        }
+        const char* value = argv[++i];
+
+        if (arg == "--host")                 config.host = value;
+        else if (arg == "--port")            config.port = static_cast<uint16_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--clients")         config.clients = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--threads")         config.threads = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--peers-per-host")  config.peersPerHost = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--duration")        config.durationSeconds = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--connect-timeout") config.connectTimeoutMs = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--input-hz")        config.inputHz = std::strtod(value, nullptr);
+        else if (arg == "--loss")            config.lossPercent = std::strtod(value, nullptr);
+        else if (arg == "--jitter")          config.jitterMs = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--server-sim-hz")   config.serverSimHz = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--stall")           config.stallMs = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+        else if (arg == "--output")          config.output = value;
+        else
+        {
+            std::fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            PrintUsage();
+            return false;
+        }
+    }
+
+    if (config.clients == 0 || config.threads == 0 || config.peersPerHost == 0 || config.inputHz <= 0.0 || config.serverSimHz == 0)
+    {
+        std::fprintf(stderr, "Invalid configuration (clients, threads, peers-per-host, input-hz and server-sim-hz must be > 0)\n");
+        return false;
+    }
+
+    if (config.threads > config.clients)
+        config.threads = config.clients;
+    return true;
+}
+
+// ------------------------------------------------------------
+// Rapport JSON
+// ------------------------------------------------------------
+static void AddHistogram(cJSON* parent, const char* name, const RCNET_Histogram* histogram)
+{
+    RCNET_HistogramSummary summary;
+    rcnet_histogram_get_summary(histogram, &summary);
+
+    cJSON* item = cJSON_AddObjectToObject(parent, name);
+    cJSON_AddNumberToObject(item, "count", (double)summary.count);
+    cJSON_AddNumberToObject(item, "min", (double)summary.min);
+    cJSON_AddNumberToObject(item, "mean", (double)summary.mean);
+    cJSON_AddNumberToObject(item, "p50", (double)summary.p50);
+    cJSON_AddNumberToObject(item, "p90", (double)summary.p90);
+    cJSON_AddNumberToObject(item, "p99", (double)summary.p99);
+    cJSON_AddNumberToObject(item, "p999", (double)summary.p999);
+    cJSON_AddNumberToObject(item, "max", (double)summary.max);
+}
+
+static bool WriteReport(const LoadgenConfig& config, double measuredSeconds)
+{
+    cJSON* root = cJSON_CreateObject();
+
+    cJSON* configItem = cJSON_AddObjectToObject(root, "config");
+    cJSON_AddStringToObject(configItem, "host", config.host.c_str());
+    cJSON_AddNumberToObject(configItem, "port", (double)config.port);
+    cJSON_AddNumberToObject(configItem, "clients", (double)config.clients);
+    cJSON_AddNumberToObject(configItem, "threads", (double)config.threads);
+    cJSON_AddNumberToObject(configItem, "peersPerHost", (double)config.peersPerHost);
+    cJSON_AddNumberToObject(configItem, "inputHz", config.inputHz);
+    cJSON_AddNumberToObject(configItem, "lossPercent", config.lossPercent);
+    cJSON_AddNumberToObject(configItem, "jitterMs", (double)config.jitterMs);
+    cJSON_AddBoolToObject(configItem, "decodeSnapshots", config.decodeSnapshots);
+
+    cJSON_AddNumberToObject(root, "measuredSeconds", measuredSeconds);
+
+    cJSON* connections = cJSON_AddObjectToObject(root, "connections");
+    cJSON_AddNumberToObject(connections, "connected", (double)gResults.connected.load());
+    cJSON_AddNumberToObject(connections, "failed", (double)gResults.connectFailed.load());
+    cJSON_AddNumberToObject(connections, "disconnected", (double)gResults.disconnected.load());
+
+    cJSON* traffic = cJSON_AddObjectToObject(root, "traffic");
+    cJSON_AddNumberToObject(traffic, "inputsGenerated", (double)gResults.inputsGenerated.load());
+    cJSON_AddNumberToObject(traffic, "packetsSent", (double)gResults.packetsSent.load());
+    cJSON_AddNumberToObject(traffic, "packetsDropped", (double)gResults.packetsDropped.load());
+    cJSON_AddNumberToObject(traffic, "bytesSent", (double)gResults.bytesSent.load());
+    cJSON_AddNumberToObject(traffic, "snapshotsReceived", (double)gResults.snapshotsReceived.load());
+    cJSON_AddNumberToObject(traffic, "snapshotsDropped", (double)gResults.snapshotsDropped.load());
+    cJSON_AddNumberToObject(traffic, "snapshotsInvalid", (double)gResults.snapshotsInvalid.load());
+    cJSON_AddNumberToObject(traffic, "snapshotDecodeFailures", (double)gResults.snapshotDecodeFailures.load());
+    cJSON_AddNumberToObject(traffic, "bytesReceived", (double)gResults.bytesReceived.load());
+
+    cJSON* latency = cJSON_AddObjectToObject(root, "latencyUs");
+    AddHistogram(latency, "inputToAckRecv", gResults.inputToAckRecvUs);
+    AddHistogram(latency, "inputToAckApplied", gResults.inputToAckAppliedUs);
+    AddHistogram(latency, "snapshotInterarrival", gResults.snapshotInterarrivalUs);
+
+    cJSON* overruns = cJSON_AddObjectToObject(root, "serverTickOverruns");
+    cJSON_AddNumberToObject(overruns, "snapshotStalls", (double)gResults.snapshotStalls.load());
+    cJSON_AddNumberToObject(overruns, "stallThresholdMs", (double)config.stallMs);
+    cJSON_AddNumberToObject(overruns, "maxServerTickLag", (double)gResults.serverTickLagMax.load());
+
+    char* printed = cJSON_Print(root);
+    cJSON_Delete(root);
+    if (printed == nullptr)
+        return false;
+
+    bool written = true;
+    if (config.output.empty())
+    {
+        std::printf("%s\n", printed);
+    }
+    else
+    {
+        FILE* file = std::fopen(config.output.c_str(), "wb");
+        written = file != nullptr && std::fprintf(file, "%s\n", printed) > 0;
+        if (file)
+            std::fclose(file);
+        if (!written)
+            RCNET_log(RCNET_LOG_ERROR, "[LOADGEN] failed to write %s\n", config.output.c_str());
+    }
+
+    cJSON_free(printed);
+    return written;
+}
+
+int main(int argc, char* argv[])
+{
+    LoadgenConfig config;
+    if (!ParseArguments(argc, argv, config))
+        return 1;
+
+    rcnet_logger_set_priority(RCNET_LOG_WARN);
+
+    if (enet_initialize() != 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "[LOADGEN] enet_initialize failed\n");
+        return 1;
+    }
+
+    ENetAddress serverAddress;
+    std::memset(&serverAddress, 0, sizeof(serverAddress));
+    if (enet_address_set_host(&serverAddress, ENET_ADDRESS_TYPE_ANY, config.host.c_str()) != 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "[LOADGEN] cannot resolve %s\n", config.host.c_str());
+        enet_deinitialize();
+        return 1;
+    }
+    serverAddress.port = config.port;
+
+    gResults.inputToAckRecvUs = rcnet_histogram_create();
+    gResults.inputToAckAppliedUs = rcnet_histogram_create();
+    gResults.snapshotInterarrivalUs = rcnet_histogram_create();
+
+    // Répartition des clients : les premiers threads prennent le reste
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < config.threads; ++t)
+    {
+        uint32_t clientCount = config.clients / config.threads + (t < config.clients % config.threads ? 1u : 0u);
+        threads.emplace_back(RunLoadgenThread, std::cref(config), std::cref(serverAddress), t, clientCount);
+    }
+
+    // Phase de connexion (non mesurée), puis mesure pendant durationSeconds
+    while (gReadyThreads.load(std::memory_order_acquire) < config.threads)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    std::fprintf(stderr, "[LOADGEN] %llu/%u clients connected, measuring for %us...\n",
+                 (unsigned long long)gResults.connected.load(), config.clients, config.durationSeconds);
+
+    uint64_t measureStartNs = NowNs();
+    gMeasuring.store(true, std::memory_order_relaxed);
+    std::this_thread::sleep_for(std::chrono::seconds(config.durationSeconds));
+    gMeasuring.store(false, std::memory_order_relaxed);
+    double measuredSeconds = static_cast<double>(NowNs() - measureStartNs) / 1e9;
+
+    gStopRequested.store(true, std::memory_order_relaxed);
+    for (std::thread& thread : threads)
+        thread.join();
+
+    bool written = WriteReport(config, measuredSeconds);
+
+    rcnet_histogram_destroy(gResults.inputToAckRecvUs);
+    rcnet_histogram_destroy(gResults.inputToAckAppliedUs);
+    rcnet_histogram_destroy(gResults.snapshotInterarrivalUs);
+    enet_deinitialize();
+
+    return (written && gResults.connected.load() > 0) ? 0 : 1;
+}
@@ -1,9 +1,96 @@
 #include "server.h"
 
 #include <cstring> // memset
+#include <cstdlib> // getenv
+#include <new>     // std::nothrow
+#include <string>
+#include <mutex>
+#include <condition_variable>
 
 #include <RCNET/RCNET.h>
 
+// ------------------------------------------------------------
+// Mode serveur pré-initialisé (RCNET_WARM_NATS_URL défini) :
+// le process démarre, initialise tout ce qui peut l'être, puis attend son match sur NATS.
+// L'autoscaler fait un request sur RCNET_WARM_SUBJECT (payload = assignation) et reçoit "ok"
+// quand le serveur démarre : il ne reste alors que rcnet_load avant le premier tick.
+// Un serveur déjà assigné répond "busy" : l'autoscaler réessaie aussitôt sur un autre serveur.
+// ------------------------------------------------------------
+struct WarmAssignment
+{
+    std::mutex mutex;
+    std::condition_variable received;
+    bool ready = false;
+    std::string payload;
+};
+
+static void OnMatchAssignment(natsConnection* connection, natsSubscription* subscription, natsMsg* msg, void* closure)
+{
+    WarmAssignment* assignment = static_cast<WarmAssignment*>(closure);
+    bool accepted = false;
+    {
+        std::lock_guard<std::mutex> lock(assignment->mutex);
+        if (!assignment->ready)
+        {
+            assignment->payload.assign(natsMsg_GetData(msg), static_cast<size_t>(natsMsg_GetDataLength(msg)));
+            assignment->ready = true;
+            accepted = true;
+            assignment->received.notify_one();
+        }
+    }
+
+    // "ok" uniquement pour l'assignation retenue : les suivantes (requests concurrents) sont refusées
+    const char* reply = natsMsg_GetReply(msg);
+    if (reply != NULL)
+    {
+        if (accepted)
+            natsConnection_Publish(connection, reply, "ok", 2);
+        else
+            natsConnection_Publish(connection, reply, "busy", 4);
+    }
+    natsMsg_Destroy(msg);
+}
+
+// Bloque jusqu'à l'assignation d'un match. Retourne false si NATS est injoignable.
+static bool WaitForMatchAssignment(const char* natsUrl)
+{
+    const char* subject = std::getenv("RCNET_WARM_SUBJECT");
+    if (subject == NULL)
+        subject = "rcnet.match.assign";
+
+    RCNET_NATSClient client;
+    std::memset(&client, 0, sizeof(client));
+    if (rcnet_nats_initialize(&client, natsUrl, NULL, NULL, NULL, false, std::getenv("RCNET_NATS_NKEY"),
+                              std::getenv("RCNET_NATS_SEED")) != 0)
+    {
+        rcnet_nats_cleanup(&client);
+        return false;
+    }
+
+    // Sur le tas : libéré seulement quand plus aucun OnMatchAssignment ne peut tourner
+    WarmAssignment* assignment = new (std::nothrow) WarmAssignment();
+    RCNET_NATSSubscriptionHandle handle = RCNET_NATS_INVALID_SUBSCRIPTION;
+    if (assignment == NULL || rcnet_nats_subscribe(&client, subject, OnMatchAssignment, assignment, &handle) != 0)
+    {
+        delete assignment;
+        rcnet_nats_cleanup(&client);
+        return false;
+    }
+
+    RCNET_log(RCNET_LOG_INFO, "Serveur pre-initialise, en attente d'un match sur %s\n", subject);
+    {
+        std::unique_lock<std::mutex> lock(assignment->mutex);
+        assignment->received.wait(lock, [&] { return assignment->ready; });
+    }
+    RCNET_log(RCNET_LOG_INFO, "Match assigne : %s\n", assignment->payload.c_str());
+
+    // Un OnMatchAssignment (request refusé) peut encore tourner sur le thread de livraison NATS
+    if (rcnet_nats_unsubscribe_and_wait(&client, handle, RCNET_NATS_UNSUBSCRIBE_WAIT_TIMEOUT_MS) != -2)
+        delete assignment;
+    rcnet_nats_cleanup(&client);
+    return true;
+}
+
 int main(int argc, char* argv[])
 {
     RCNET_log(RCNET_LOG_INFO, "Server Started\n");
@@ -14,6 +101,9 @@ int main(int argc, char* argv[])
     rcnet_logger_set_priority(RCNET_LOG_DEBUG);
 #endif
 
+    // Les threads de simulation / réseau ne font plus d'I/O console : un thread dédié écrit les logs
+    rcnet_logger_start_async(NULL);
+
     // Init à 0 pour éviter des pointeurs non initialisés
     RCNET_Callbacks myServerCallbacks;
     std::memset(&myServerCallbacks, 0, sizeof(myServerCallbacks));
@@ -24,12 +114,33 @@ int main(int argc, char* argv[])
     myServerCallbacks.rcnet_network_update = rcnet_network_update;
     myServerCallbacks.rcnet_simulation_update = rcnet_simulation_update;
 
+    // Simulation et réseau sur deux threads : l'encodage des snapshots ne retarde plus la simulation
+    rcnet_engine_set_threading_mode(RCNET_ENGINE_THREADING_SPLIT);
+
+    // Mode pré-initialisé : dépendances (RCENet pour les shards de rcnet_load), pool et timers prêts avant l'assignation
+    const char* warmNatsUrl = std::getenv("RCNET_WARM_NATS_URL");
+    if (warmNatsUrl != NULL)
+    {
+        rcnet_engine_set_subsystems(RCNET_SUBSYSTEM_FLAG_RCENET);
+        if (!rcnet_engine_prewarm() || !WaitForMatchAssignment(warmNatsUrl))
+        {
+            RCNET_log(RCNET_LOG_ERROR, "Failed to start in warm mode\n");
+            rcnet_logger_stop_async();
+            return 1;
+        }
+    }
+
     // Lancer le moteur avec nos callbacks et les tick rates désirés
     if(!rcnet_engine_run(&myServerCallbacks, 60, 30))
     {
         RCNET_log(RCNET_LOG_ERROR, "Failed to start the engine\n");
+        rcnet_logger_stop_async();
         return 1;
     }
 
+    if (rcnet_logger_get_dropped_count() > 0)
+        RCNET_log(RCNET_LOG_WARN, "%llu log message(s) dropped\n", (unsigned long long)rcnet_logger_get_dropped_count());
+
+    rcnet_logger_stop_async();
     return 0;
 }
\ No newline at end of file
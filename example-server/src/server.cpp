@@ -1,4 +1,5 @@
 #include "server.h"
+#include "snapshot_schema.h"
 
 #include <RCNET/RCNET.h>
 
@@ -7,21 +8,17 @@
 // ------------------------------------------------------------
 #include <atomic>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
-#include <string>
-#include <vector>
 #include <algorithm>
+#include <cmath>
 
 // ------------------------------------------------------------
 // RCENet (fork ENet)
 // ------------------------------------------------------------
 #include <rcenet/RCENET_enet.h>
 
-// ------------------------------------------------------------
-// SDL3 (threads + mutex)
-// ------------------------------------------------------------
-#include <SDL3/SDL.h>
-
 // ------------------------------------------------------------
 // cJSON (parsing JSON)
 // ------------------------------------------------------------
@@ -31,16 +28,7 @@
 // 1) Structures de données
 // ============================================================
 
-// Input "gameplay" côté serveur (ce que la simulation consomme)
-struct RCNET_ClientInput
-{
-    uint32_t clientId;         // id du client (ex: peer->incomingPeerID)
-    uint32_t clientTickId;     // tick côté client (utile pour debug/prediction)
-    uint32_t clientInputSeq;   // séquence input (anti-duplication/ack)
-    uint32_t buttonsMask;      // bitmask des inputs (WASD, jump, shoot, etc.)
-    float axisX;               // stick/mouse axis X
-    float axisY;               // stick/mouse axis Y
-};
+// RCNET_ClientInput (ce que la simulation consomme) est fourni par RCNET_codec.h
 
 // Ce que le thread réseau envoie au thread simulation :
 // un input + le tick serveur auquel il doit s'appliquer.
@@ -54,11 +42,13 @@ struct RCNET_QueuedInputForSimulation
 // ACK par client : dernier input reçu / appliqué
 // ============================================================
 
-// Doit correspondre à la capacité de ton enet_host_create(..., maxClients, ...)
-// Ici tu as 64.
-static constexpr uint32_t kMaxServerClients = 64;
+// Réseau shardé : kNetworkShardCount ENetHost (un thread chacun), kPeersPerShard peers par host.
+// clientId = shardIndex * kPeersPerShard + incomingPeerID (voir RCNET_net_shards.h)
+static constexpr uint32_t kNetworkShardCount = 2;
+static constexpr uint32_t kPeersPerShard = kMaxServerClients / kNetworkShardCount;
+static_assert(kNetworkShardCount * kPeersPerShard == kMaxServerClients, "kMaxServerClients doit être un multiple de kNetworkShardCount");
 
-// Dernier seq reçu (mis à jour par le thread réseau)
+// Dernier seq reçu (mis à jour par les threads réseau)
 static std::atomic<uint32_t> gLastReceivedInputSeqByClientId[kMaxServerClients];
 
 // Dernier seq appliqué (mis à jour par la simulation)
@@ -74,24 +64,26 @@ static inline bool IsClientIdInRange(uint32_t clientId)
 // 2) Etat global réseau ENet
 // ============================================================
 
-// Host serveur ENet (gère les peers, envoi/réception)
-static ENetHost* gEnetServerHost = nullptr;
-
-// Thread réseau SDL
-static SDL_Thread* gEnetNetworkThreadHandle = nullptr;
-
-// Flag pour arrêter proprement le thread réseau
-static std::atomic<bool> gEnetNetworkThreadRunning{false};
+// Shards réseau : chaque ENetHost est servi par son propre thread
+// (SO_REUSEPORT sur Linux, plage de ports sur Windows / macOS)
+static RCNET_NetShards* gNetShards = nullptr;
 
 // ============================================================
-// 3) Communication inter-threads : queue thread-safe
+// 3) Communication inter-threads : queue lock-free
 // ============================================================
 
-// Mutex SDL pour protéger la queue
-static SDL_Mutex* gIncomingInputsQueueMutex = nullptr;
+// Capacité de la queue réseau -> simulation.
+// 128 clients * 60 inputs/s => ~128 inputs par tick, 4096 laisse une grosse marge.
+static constexpr uint32_t kIncomingInputsQueueCapacity = 4096;
+
+// Queue MPSC : un producteur par thread de shard, la simulation (consommateur)
+static RCNET_RingQueue* gIncomingInputsQueue = nullptr;
+
+// Buffer de drain, préalloué une fois (la simulation n'alloue rien par tick)
+static RCNET_QueuedInputForSimulation gDrainedIncomingInputs[kIncomingInputsQueueCapacity];
 
-// Queue: inputs venant du thread réseau, en attente d'être consommés par la simulation
-static std::vector<RCNET_QueuedInputForSimulation> gIncomingInputsQueue;
+// Dernier compteur d'overflow loggé (simulation uniquement)
+static uint64_t gLastLoggedIncomingInputsOverflow = 0;
 
 // ============================================================
 // 4) Tick serveur partagé
@@ -103,65 +95,178 @@ static std::atomic<uint64_t> gCurrentServerSimulationTickId{0};
 // Input delay : "au tick suivant" => 1
 static constexpr uint32_t kServerInputDelayInTicks = 1;
 
+// Inputs groupés (RCNET_PACKET_TYPE_CLIENT_INPUT_BATCH) : dédoublonnage par clientInputSeq et
+// tick cible stable par client, même pour un input rattrapé par redondance (créé dans rcnet_load)
+static RCNET_InputReceiver* gInputReceiver = nullptr;
+
 // ============================================================
 // 5) Buffer inputs par tick serveur
 // ============================================================
 //
 // On stocke les inputs à appliquer à des ticks futurs.
-// Comme on ne veut pas un std::map infini, on utilise un ring buffer.
+// RCNET_InputBuffer : ring de slots préalloués (kMaxServerClients inputs par slot),
+// un input par client et par tick (le clientInputSeq le plus récent gagne),
+// les inputs hors fenêtre sont rejetés et comptés au lieu d'écraser un slot vivant.
 //
 // Exemple : 256 ticks de buffer.
 // A 60 Hz, 256 ticks ~ 4.26 secondes.
 // Si tu veux plus de marge pour rollback/debug, augmente.
 static constexpr uint32_t kScheduledInputsRingBufferSize = 256;
 
-// Un slot du ring buffer : "tous les inputs à appliquer pour ce tick"
-struct RCNET_ScheduledInputsSlot
+// Buffer complet (créé dans rcnet_load)
+static RCNET_InputBuffer* gScheduledInputs = nullptr;
+
+// ============================================================
+// 5.B) Monde minimal + historique de snapshots
+// ============================================================
+//
+// Une entité par joueur (entityId == clientId) : position + boutons.
+// Le schéma (bits par champ, bornes de quantification) est partagé avec le client : snapshot_schema.h.
+
+static constexpr float kPlayerSpeed = 5.0f;         // unités / seconde à axe = 1
+
+// Nombre d'états conservés (baselines possibles) : 64 ticks réseau ~ 2 s à 30 Hz
+static constexpr uint32_t kSnapshotHistorySize = 64;
+
+// Etat des joueurs (simulation uniquement) : une entité par joueur dans un store SoA, index == clientId.
+// Les inputs fixent la vitesse, rcnet_entity_store_integrate() avance toutes les positions d'un coup
+// et marque les entités qui ont bougé (l'historique de lag compensation ne réécrit qu'elles).
+enum PlayerColumn : uint32_t
 {
-    uint64_t serverTickIdForThisSlot = 0;          // quel tick ce slot représente réellement
-    std::vector<RCNET_ClientInput> inputsToApply;  // inputs à appliquer
+    kPlayerColumnPosX = 0,
+    kPlayerColumnPosY,
+    kPlayerColumnVelX,
+    kPlayerColumnVelY,
+    kPlayerColumnButtons,
+    kPlayerColumnCount
 };
 
-// Ring buffer complet
-static RCNET_ScheduledInputsSlot gScheduledInputsRing[kScheduledInputsRingBufferSize];
+static RCNET_EntityStore* gPlayerStore = nullptr;
+
+// Demande de reset du joueur (nouvelle connexion, posée par un thread réseau)
+static std::atomic<bool> gPlayerResetRequested[kMaxServerClients];
 
-// Helper : obtenir l’index dans le ring buffer pour un tick donné
-static inline uint32_t GetRingIndexForServerTick(uint64_t serverTickId)
+// Copie de l'état des joueurs publiée par la simulation à chaque tick.
+// Le tick réseau tourne sur son propre thread (RCNET_ENGINE_THREADING_SPLIT) : il encode depuis
+// une copie immuable pendant que la simulation continue, sans jamais lire gPlayerStore directement.
+struct WorldStateSnapshot
 {
-    return static_cast<uint32_t>(serverTickId % kScheduledInputsRingBufferSize);
-}
+    uint64_t serverTick; // 0 = pas encore d'état publié
+    float posX[kMaxServerClients];
+    float posY[kMaxServerClients];
+    uint32_t buttons[kMaxServerClients];
+};
+
+static RCNET_TripleBuffer* gWorldStateBuffer = nullptr;
+
+// Ring des derniers états encodés + dernier snapshot acké par client (créé dans rcnet_load)
+static RCNET_SnapshotHistory* gSnapshotHistory = nullptr;
+
+// Interest management : chaque client ne reçoit que les joueurs proches, par priorité, dans un
+// budget d'octets par snapshot. Mis à jour par le thread réseau depuis l'état publié (jamais par la simulation).
+static RCNET_Interest* gInterest = nullptr;
+
+// Historique des hitboxes des joueurs pour la lag compensation : un tir est validé contre l'état
+// que le tireur voyait (RTT / 2 + interpolation client), pas contre l'état courant du serveur.
+// Ecrit et lu par la simulation uniquement (créé dans rcnet_load).
+static RCNET_WorldHistory* gWorldHistory = nullptr;
+
+static constexpr uint32_t kSimulationTickRateHz = 60;     // identique à rcnet_engine_run (main.cpp)
+static constexpr uint32_t kMaxLagCompensationMs = 250;    // au-delà, le tir est validé à l'état le plus ancien
+static constexpr uint32_t kClientInterpolationTicks = 2;  // retard de rendu des clients (~1 tick réseau)
+static constexpr float kPlayerHitboxHalfExtent = 0.5f;
+static constexpr uint32_t kFireButtonMask = 1u << 1;
+static constexpr float kFireRange = 64.0f;
+
+// Demande de reset de l'interest d'un client (nouvelle connexion, posée par un thread réseau)
+static std::atomic<bool> gInterestResetRequested[kMaxServerClients];
+
+// Compression des snapshots sur kSnapshotChannel (snapshot_schema.h), configuration identique côté client.
+static constexpr size_t kMaxSnapshotPacketSize = 16 * 1024;
+
+// Un compresseur par client (compteurs de ratio / temps CPU par peer), créés dans rcnet_load.
+// Utilisés seulement par le tick réseau (et ses jobs d'encodage) : un thread à la fois par compresseur.
+static RCNET_Compressor* gSnapshotCompressors[kMaxServerClients];
+
+// Demande de reset du compresseur d'un client (nouvelle connexion, posée par un thread réseau)
+static std::atomic<bool> gCompressorResetRequested[kMaxServerClients];
+
+// Buffers des packets snapshot : compressés directement dedans, rendus au pool quand ENet détruit le packet
+static RCNET_PacketPool* gPacketPool = nullptr;
+
+// Endpoint Prometheus (http://<serveur>:9464/metrics) : les collectors lisent les stats à chaque scrape
+static RCNET_MetricsServer* gMetricsServer = nullptr;
 
 // ============================================================
-// 6) Helpers queue thread-safe (réseau -> simulation)
+// 6) Helpers queue lock-free (réseau -> simulation)
 // ============================================================
 
-// Le thread réseau push des inputs ici
+// Les threads réseau push des inputs ici (jamais bloquant : si la queue est pleine,
+// l'input est droppé et compté dans le compteur d'overflow de la queue)
 static void PushIncomingInputToQueue(const RCNET_QueuedInputForSimulation& queuedInput)
 {
-    SDL_LockMutex(gIncomingInputsQueueMutex);
-    gIncomingInputsQueue.push_back(queuedInput);
-    SDL_UnlockMutex(gIncomingInputsQueueMutex);
+    rcnet_ring_queue_push(gIncomingInputsQueue, &queuedInput);
 }
 
-// La simulation récupère tous les inputs d’un coup (swap => lock minimal)
-static void PopAllIncomingInputsFromQueue(std::vector<RCNET_QueuedInputForSimulation>& outInputs)
+// La simulation récupère tous les inputs d’un coup dans le buffer préalloué
+static uint32_t PopAllIncomingInputsFromQueue(void)
 {
-    outInputs.clear();
-
-    SDL_LockMutex(gIncomingInputsQueueMutex);
-    outInputs.swap(gIncomingInputsQueue); // O(1)
-    SDL_UnlockMutex(gIncomingInputsQueueMutex);
+    return rcnet_ring_queue_pop_batch(gIncomingInputsQueue, gDrainedIncomingInputs, kIncomingInputsQueueCapacity);
 }
 
 // Clamp helper (évite les valeurs absurdes / triche / NaN)
 static inline float ClampFloat(float v, float minV, float maxV)
 {
+    if (!std::isfinite(v)) return 0.0f;
     if (v < minV) return minV;
     if (v > maxV) return maxV;
     return v;
 }
 
-// Parse JSON -> RCNET_ClientInput
+// Decode binaire (RCNET_codec) -> RCNET_ClientInput
+// Retourne true si OK, false si packet invalide (version, type ou taille).
+static bool ParseBinaryClientInput(const uint8_t* packetBytes, size_t packetLength, uint32_t clientId, RCNET_ClientInput& outInput)
+{
+    if (!rcnet_codec_decode_client_input(packetBytes, packetLength, clientId, &outInput))
+        return false;
+
+    // Même validation que pour le JSON
+    outInput.axisX = ClampFloat(outInput.axisX, -1.0f, 1.0f);
+    outInput.axisY = ClampFloat(outInput.axisY, -1.0f, 1.0f);
+    return true;
+}
+
+#ifdef RCNET_EXAMPLE_JSON_DEBUG
+// Allocateur de cJSON : dans l'arena de réception du shard (reset après chaque passe de réception),
+// sur le heap hors d'un thread de shard. L'en-tête indique d'où vient le bloc.
+// Installé seulement en mode debug : hors debug, cJSON garde l'allocateur du processus.
+static constexpr size_t kJsonAllocHeaderSize = 16;
+
+static void* JsonArenaMalloc(size_t size)
+{
+    RCNET_Arena* arena = rcnet_net_shards_get_receive_arena();
+    uint8_t* block = arena ? static_cast<uint8_t*>(rcnet_arena_alloc(arena, size + kJsonAllocHeaderSize, kJsonAllocHeaderSize)) : nullptr;
+    bool fromArena = block != nullptr;
+    if (!block)
+        block = static_cast<uint8_t*>(std::malloc(size + kJsonAllocHeaderSize));
+    if (!block)
+        return nullptr;
+
+    block[0] = fromArena ? 1 : 0;
+    return block + kJsonAllocHeaderSize;
+}
+
+static void JsonArenaFree(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    uint8_t* block = static_cast<uint8_t*>(ptr) - kJsonAllocHeaderSize;
+    if (block[0] == 0)
+        std::free(block);
+}
+
+// Parse JSON -> RCNET_ClientInput (mode debug uniquement, voir RCNET_EXAMPLE_JSON_DEBUG)
 // Retourne true si OK, false si JSON invalide ou champs manquants.
 static bool ParseJsonClientInput_cJSON(const char* jsonBytes, size_t jsonLength, uint32_t clientId, RCNET_ClientInput& outInput)
 {
@@ -176,18 +281,11 @@ static bool ParseJsonClientInput_cJSON(const char* jsonBytes, size_t jsonLength,
     outInput.axisY = 0.0f;
 
     // ------------------------------------------------------------
-    // 1) cJSON attend une string null-terminated.
-    // ENet packet data n'est pas forcément null-terminated.
-    // Donc on copie dans un buffer temporaire avec '\0'.
-    // ------------------------------------------------------------
-    std::string jsonText;
-    jsonText.assign(jsonBytes, jsonBytes + jsonLength);
-    jsonText.push_back('\0');
-
+    // 1) Parser JSON
+    // ENet packet data n'est pas forcément null-terminated : parse avec la taille, sans copie.
+    // L'arbre cJSON est alloué dans l'arena de réception (voir JsonArenaMalloc).
     // ------------------------------------------------------------
-    // 2) Parser JSON
-    // ------------------------------------------------------------
-    cJSON* root = cJSON_Parse(jsonText.c_str());
+    cJSON* root = cJSON_ParseWithLength(jsonBytes, jsonLength);
     if (!root)
         return false;
 
@@ -240,88 +338,102 @@ static bool ParseJsonClientInput_cJSON(const char* jsonBytes, size_t jsonLength,
     cleanup();
     return true;
 }
+#endif // RCNET_EXAMPLE_JSON_DEBUG
 
 // ============================================================
-// 8) Thread réseau ENet (réception + push queue)
+// 8) Callbacks des shards réseau (appelés depuis les threads de shard)
 // ============================================================
-static int EnetNetworkThreadMain(void* /*userdata*/)
+static void OnNetShardConnect(uint32_t clientId, void* /*userdata*/)
 {
-    ENetEvent event;
+    // Nouveau client sur ce slot : repartir de zéro pour les ACK
+    gLastReceivedInputSeqByClientId[clientId].store(0, std::memory_order_relaxed);
+    gLastAppliedInputSeqByClientId[clientId].store(0, std::memory_order_relaxed);
+
+    rcnet_input_receiver_reset_client(gInputReceiver, clientId);
 
-    while (gEnetNetworkThreadRunning.load(std::memory_order_relaxed))
+    // Pas de baseline connue : le prochain snapshot sera complet
+    rcnet_snapshot_history_reset_client(gSnapshotHistory, clientId);
+    gCompressorResetRequested[clientId].store(true, std::memory_order_release);
+    gPlayerResetRequested[clientId].store(true, std::memory_order_release);
+    gInterestResetRequested[clientId].store(true, std::memory_order_release);
+
+    RCNET_log(RCNET_LOG_INFO, "[ENET] Client connected. clientId=%u\n", clientId);
+}
+
+static void OnNetShardDisconnect(uint32_t clientId, bool timedOut, void* /*userdata*/)
+{
+    if (timedOut)
+        RCNET_log(RCNET_LOG_INFO, "[ENET] Client timed out. clientId=%u\n", clientId);
+    else
+        RCNET_log(RCNET_LOG_INFO, "[ENET] Client disconnected. clientId=%u\n", clientId);
+}
+
+static void OnNetShardReceive(uint32_t clientId, uint8_t /*channelId*/, const uint8_t* packetBytes, size_t packetLength, void* /*userdata*/)
+{
+    // 0) Ack de snapshot : nouvelle baseline pour les deltas de ce client
+    if (rcnet_codec_peek_type(packetBytes, packetLength) == RCNET_PACKET_TYPE_SNAPSHOT_ACK)
     {
-        int serviceResult = enet_host_service(gEnetServerHost, &event, 1); // timeout 1 ms (petit pour réactivité, mais pas 0 pour éviter CPU à 100% si pas de clients)
+        uint64_t ackedSnapshotTick = 0;
+        if (rcnet_codec_decode_snapshot_ack(packetBytes, packetLength, &ackedSnapshotTick))
+            rcnet_snapshot_history_ack(gSnapshotHistory, clientId, ackedSnapshotTick);
+        return;
+    }
 
-        if (serviceResult <= 0)
+    // 0 bis) Inputs groupés : seuls les inputs pas encore reçus sont poussés, chacun à son tick cible
+    if (rcnet_codec_peek_type(packetBytes, packetLength) == RCNET_PACKET_TYPE_CLIENT_INPUT_BATCH)
+    {
+        RCNET_ScheduledInput scheduled[RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS];
+        uint64_t currentServerTickId = gCurrentServerSimulationTickId.load(std::memory_order_relaxed);
+        uint32_t scheduledCount = rcnet_input_receiver_accept(gInputReceiver, clientId, packetBytes, packetLength, currentServerTickId, scheduled);
+
+        for (uint32_t i = 0; i < scheduledCount; ++i)
         {
-            // 0 => pas d'événement ; <0 => erreur (optionnel à traiter)
-            continue;
+            RCNET_QueuedInputForSimulation queued;
+            queued.targetServerSimTickId = scheduled[i].targetServerTick;
+            queued.input = scheduled[i].input;
+            queued.input.axisX = ClampFloat(queued.input.axisX, -1.0f, 1.0f);
+            queued.input.axisY = ClampFloat(queued.input.axisY, -1.0f, 1.0f);
+            PushIncomingInputToQueue(queued);
         }
 
-        switch (event.type)
-        {
-            case ENET_EVENT_TYPE_CONNECT:
-            {
-                RCNET_log(RCNET_LOG_INFO, "[ENET] Client connected. peerID=%u\n", event.peer->incomingPeerID);
-                break;
-            }
+        gLastReceivedInputSeqByClientId[clientId].store(rcnet_input_receiver_get_last_seq(gInputReceiver, clientId), std::memory_order_relaxed);
+        return;
+    }
 
-            case ENET_EVENT_TYPE_RECEIVE:
-            {
-                // 1) Récupérer les bytes du packet ENet
-                const char* packetBytes  = reinterpret_cast<const char*>(event.packet->data);
-                size_t      packetLength = static_cast<size_t>(event.packet->dataLength);
-                uint32_t    clientId     = event.peer->incomingPeerID;
-                
-                // 2) Parser JSON -> ClientInput
-                RCNET_ClientInput parsedInput;
-                if (ParseJsonClientInput_cJSON(packetBytes, packetLength, clientId, parsedInput))
-                {
-                    // Met à jour "dernier seq reçu" pour ce client
-                    if (IsClientIdInRange(parsedInput.clientId))
-                    {
-                        gLastReceivedInputSeqByClientId[parsedInput.clientId].store(parsedInput.clientInputSeq, std::memory_order_relaxed);
-                    }
-                    
-                    // 3) Calculer le tick serveur cible : "tick courant + inputDelay"
-                    uint64_t currentServerTickId = gCurrentServerSimulationTickId.load(std::memory_order_relaxed);
-                    uint64_t targetServerTickId = currentServerTickId + static_cast<uint64_t>(kServerInputDelayInTicks);
-
-                    RCNET_QueuedInputForSimulation queued;
-                    queued.targetServerSimTickId = targetServerTickId;
-                    queued.input = parsedInput;
-
-                    // 4) Push dans la queue thread-safe
-                    PushIncomingInputToQueue(queued);
-                }
-                else
-                {
-                    RCNET_log(RCNET_LOG_WARN, "[ENET] Invalid input JSON from client=%u (len=%zu)\n", clientId, packetLength);
-                }
+    // 1) Décoder -> ClientInput
+    // Binaire par défaut ; en mode debug, un packet qui commence par '{' est un input JSON.
+    // Hors debug, le parseur JSON n'est pas compilé : ces packets échouent au décodage binaire.
+    RCNET_ClientInput parsedInput;
+    bool parsed = false;
+#ifdef RCNET_EXAMPLE_JSON_DEBUG
+    if (packetLength > 0 && packetBytes[0] == '{')
+        parsed = ParseJsonClientInput_cJSON(reinterpret_cast<const char*>(packetBytes), packetLength, clientId, parsedInput);
+    else
+#endif
+        parsed = ParseBinaryClientInput(packetBytes, packetLength, clientId, parsedInput);
 
-                // 5) Libérer le packet ENet
-                enet_packet_destroy(event.packet);
-                break;
-            }
+    if (!parsed)
+    {
+        RCNET_log(RCNET_LOG_WARN, "[ENET] Invalid input packet from client=%u (len=%zu)\n", clientId, packetLength);
+        return;
+    }
 
-            case ENET_EVENT_TYPE_DISCONNECT:
-            {
-                RCNET_log(RCNET_LOG_INFO, "[ENET] Client disconnected. peerID=%u\n", event.peer->incomingPeerID);
-                break;
-            }
+    // Met à jour "dernier seq reçu" pour ce client
+    if (IsClientIdInRange(parsedInput.clientId))
+    {
+        gLastReceivedInputSeqByClientId[parsedInput.clientId].store(parsedInput.clientInputSeq, std::memory_order_relaxed);
+    }
 
-            case ENET_EVENT_TYPE_DISCONNECT_TIMEOUT:
-            {
-                RCNET_log(RCNET_LOG_INFO, "[ENET] Client timed out. peerID=%u\n", event.peer->incomingPeerID);
-                break;
-            }
+    // 2) Calculer le tick serveur cible : "tick courant + inputDelay"
+    uint64_t currentServerTickId = gCurrentServerSimulationTickId.load(std::memory_order_relaxed);
+    uint64_t targetServerTickId = currentServerTickId + static_cast<uint64_t>(kServerInputDelayInTicks);
 
-            default:
-                break;
-        }
-    }
+    RCNET_QueuedInputForSimulation queued;
+    queued.targetServerSimTickId = targetServerTickId;
+    queued.input = parsedInput;
 
-    return 0;
+    // 3) Push dans la queue thread-safe (le packet ENet est libéré par le shard)
+    PushIncomingInputToQueue(queued);
 }
 
 // ============================================================
@@ -331,102 +443,269 @@ static int EnetNetworkThreadMain(void* /*userdata*/)
 void rcnet_load(void)
 {
     RCNET_log(RCNET_LOG_INFO, "Server Loaded (ENet example)\n");
+    RCNET_log(RCNET_LOG_INFO, "SIMD kernels: %s\n", rcnet_simd_get_backend_name(rcnet_simd_get_backend()));
 
     // Initialiser les ACK seq par client
     for (uint32_t i = 0; i < kMaxServerClients; ++i)
     {
         gLastReceivedInputSeqByClientId[i].store(0, std::memory_order_relaxed);
         gLastAppliedInputSeqByClientId[i].store(0, std::memory_order_relaxed);
+
+        gPlayerResetRequested[i].store(false, std::memory_order_relaxed);
+        gInterestResetRequested[i].store(false, std::memory_order_relaxed);
+        gCompressorResetRequested[i].store(false, std::memory_order_relaxed);
     }
 
-    // ----------------------------
-    // A) Créer le mutex de queue
-    // ----------------------------
-    gIncomingInputsQueueMutex = SDL_CreateMutex();
-    if (!gIncomingInputsQueueMutex)
+    // Historique de snapshots (avant les shards : les callbacks réseau l'utilisent)
+    RCNET_SnapshotSchema snapshotSchema;
+    std::memset(&snapshotSchema, 0, sizeof(snapshotSchema));
+    snapshotSchema.maxEntities = kMaxServerClients;
+    snapshotSchema.fieldCount = kPlayerFieldCount;
+    snapshotSchema.fieldBits[kPlayerFieldPosX] = kPositionBits;
+    snapshotSchema.fieldBits[kPlayerFieldPosY] = kPositionBits;
+    snapshotSchema.fieldBits[kPlayerFieldButtons] = kButtonsBits;
+
+    gSnapshotHistory = rcnet_snapshot_history_create(&snapshotSchema, kSnapshotHistorySize, kMaxServerClients);
+    if (!gSnapshotHistory)
     {
-        RCNET_log(RCNET_LOG_CRITICAL, "SDL_CreateMutex failed: %s\n", SDL_GetError());
+        RCNET_log(RCNET_LOG_CRITICAL, "rcnet_snapshot_history_create failed\n");
         rcnet_engine_eventQuit();
         return;
     }
 
-    // ----------------------------
-    // B) Créer le serveur ENet
-    // ----------------------------
-    ENetAddress address;
-    enet_address_build_any(&address, ENET_ADDRESS_TYPE_IPV6);
-    address.port = 7777;
-
-    gEnetServerHost = enet_host_create(
-        ENET_ADDRESS_TYPE_ANY, // dual-stack IPv4/IPv6
-        &address,
-        64,  // max clients
-        2,   // channels
-        0,   // incoming bandwidth
-        0    // outgoing bandwidth
-    );
-    if (!gEnetServerHost)
-    {
-        RCNET_log(RCNET_LOG_CRITICAL, "Failed to create ENet server host\n");
+    // Une entité par joueur (entityId = clientId), chaque client voit depuis son propre joueur
+    RCNET_InterestConfig interestConfig;
+    rcnet_interest_get_default_config(&interestConfig);
+    interestConfig.maxEntities = kMaxServerClients;
+    interestConfig.maxPeers = kMaxServerClients;
+    interestConfig.worldMinX = -kWorldHalfExtent;
+    interestConfig.worldMinY = -kWorldHalfExtent;
+    interestConfig.worldMaxX = kWorldHalfExtent;
+    interestConfig.worldMaxY = kWorldHalfExtent;
+
+    gInterest = rcnet_interest_create(&interestConfig);
+    if (!gInterest || !rcnet_snapshot_history_enable_interest(gSnapshotHistory))
+    {
+        RCNET_log(RCNET_LOG_CRITICAL, "rcnet_interest_create failed\n");
+        rcnet_engine_eventQuit();
+        return;
+    }
+
+    RCNET_EntityStoreConfig playerStoreConfig;
+    rcnet_entity_store_get_default_config(&playerStoreConfig);
+    playerStoreConfig.maxEntities = kMaxServerClients;
+    playerStoreConfig.columnCount = kPlayerColumnCount;
+    playerStoreConfig.columnTypes[kPlayerColumnPosX] = RCNET_ENTITY_COLUMN_FLOAT;
+    playerStoreConfig.columnTypes[kPlayerColumnPosY] = RCNET_ENTITY_COLUMN_FLOAT;
+    playerStoreConfig.columnTypes[kPlayerColumnVelX] = RCNET_ENTITY_COLUMN_FLOAT;
+    playerStoreConfig.columnTypes[kPlayerColumnVelY] = RCNET_ENTITY_COLUMN_FLOAT;
+    playerStoreConfig.columnTypes[kPlayerColumnButtons] = RCNET_ENTITY_COLUMN_UINT32;
+
+    gPlayerStore = rcnet_entity_store_create(&playerStoreConfig);
+    if (!gPlayerStore)
+    {
+        RCNET_log(RCNET_LOG_CRITICAL, "rcnet_entity_store_create failed\n");
+        rcnet_engine_eventQuit();
+        return;
+    }
+
+    RCNET_WorldHistoryConfig worldHistoryConfig;
+    rcnet_world_history_get_default_config(&worldHistoryConfig);
+    worldHistoryConfig.maxEntities = kMaxServerClients;
+    worldHistoryConfig.simTickRateHz = kSimulationTickRateHz;
+    worldHistoryConfig.maxRewindMs = kMaxLagCompensationMs;
+
+    gWorldHistory = rcnet_world_history_create(&worldHistoryConfig);
+    if (!gWorldHistory)
+    {
+        RCNET_log(RCNET_LOG_CRITICAL, "rcnet_world_history_create failed\n");
+        rcnet_engine_eventQuit();
+        return;
+    }
+
+    // Compresseurs du channel snapshot
+    RCNET_CompressionConfig compressionConfig;
+    rcnet_compression_get_default_config(&compressionConfig);
+    compressionConfig.channelCount = 2;
+    compressionConfig.channelModes[kSnapshotChannel] = RCNET_COMPRESSION_MODE_BLOCK;
+    compressionConfig.maxPacketSize = kMaxSnapshotPacketSize;
+
+    for (uint32_t i = 0; i < kMaxServerClients; ++i)
+    {
+        gSnapshotCompressors[i] = rcnet_compressor_create(&compressionConfig);
+        if (!gSnapshotCompressors[i])
+        {
+            RCNET_log(RCNET_LOG_CRITICAL, "rcnet_compressor_create failed\n");
+            rcnet_engine_eventQuit();
+            return;
+        }
+    }
+
+    // Handoff simulation -> réseau
+    gWorldStateBuffer = rcnet_triple_buffer_create(sizeof(WorldStateSnapshot));
+    if (!gWorldStateBuffer)
+    {
+        RCNET_log(RCNET_LOG_CRITICAL, "rcnet_triple_buffer_create failed\n");
         rcnet_engine_eventQuit();
         return;
     }
-    RCNET_log(RCNET_LOG_INFO, "ENet server listening on port %u (dual-stack)\n", address.port);
 
     // ----------------------------
-    // C) Lancer le thread réseau
+    // A) Créer la queue réseau -> simulation
     // ----------------------------
-    gEnetNetworkThreadRunning.store(true, std::memory_order_relaxed);
-    gEnetNetworkThreadHandle = SDL_CreateThread(EnetNetworkThreadMain, "RCNET_EnetNetworkThread", nullptr);
-    if (!gEnetNetworkThreadHandle)
+    gIncomingInputsQueue = rcnet_ring_queue_create(sizeof(RCNET_QueuedInputForSimulation), kIncomingInputsQueueCapacity, RCNET_RING_QUEUE_MPSC);
+    if (!gIncomingInputsQueue)
     {
-        RCNET_log(RCNET_LOG_CRITICAL, "SDL_CreateThread failed: %s\n", SDL_GetError());
-        gEnetNetworkThreadRunning.store(false, std::memory_order_relaxed);
+        RCNET_log(RCNET_LOG_CRITICAL, "rcnet_ring_queue_create failed\n");
         rcnet_engine_eventQuit();
         return;
     }
-}
+    gLastLoggedIncomingInputsOverflow = 0;
 
-void rcnet_unload(void)
-{
-    RCNET_log(RCNET_LOG_INFO, "Server Unloading (ENet example)...\n");
+    // Buffer d'inputs planifiés (toute la mémoire est allouée ici, une seule fois)
+    gScheduledInputs = rcnet_input_buffer_create(kScheduledInputsRingBufferSize, kMaxServerClients);
+    if (!gScheduledInputs)
+    {
+        RCNET_log(RCNET_LOG_CRITICAL, "rcnet_input_buffer_create failed\n");
+        rcnet_engine_eventQuit();
+        return;
+    }
+
+    // Receiver des inputs groupés (avant les shards : les callbacks réseau l'utilisent)
+    RCNET_InputReceiverConfig inputReceiverConfig;
+    rcnet_input_receiver_get_default_config(&inputReceiverConfig);
+    inputReceiverConfig.maxClients = kMaxServerClients;
+    inputReceiverConfig.inputDelayTicks = kServerInputDelayInTicks;
+
+    gInputReceiver = rcnet_input_receiver_create(&inputReceiverConfig);
+    if (!gInputReceiver)
+    {
+        RCNET_log(RCNET_LOG_CRITICAL, "rcnet_input_receiver_create failed\n");
+        rcnet_engine_eventQuit();
+        return;
+    }
+
+    // Pool des buffers de packets (avant les shards, détruit après eux)
+    gPacketPool = rcnet_packet_pool_create(NULL);
+    if (!gPacketPool)
+    {
+        RCNET_log(RCNET_LOG_CRITICAL, "rcnet_packet_pool_create failed\n");
+        rcnet_engine_eventQuit();
+        return;
+    }
+
+#ifdef RCNET_EXAMPLE_JSON_DEBUG
+    // L'arbre des inputs JSON de debug est alloué dans l'arena de réception des shards
+    cJSON_Hooks jsonHooks;
+    jsonHooks.malloc_fn = JsonArenaMalloc;
+    jsonHooks.free_fn = JsonArenaFree;
+    cJSON_InitHooks(&jsonHooks);
+#endif
 
     // ----------------------------
-    // A) Stop thread réseau
+    // B) Créer les shards réseau ENet
     // ----------------------------
-    if (gEnetNetworkThreadHandle)
+    RCNET_NetShardsConfig netConfig;
+    rcnet_net_shards_get_default_config(&netConfig);
+    netConfig.port = 7777;
+    netConfig.shardCount = kNetworkShardCount;
+    netConfig.peersPerShard = kPeersPerShard;
+    netConfig.channelCount = 2;
+    netConfig.callbacks.on_connect = OnNetShardConnect;
+    netConfig.callbacks.on_disconnect = OnNetShardDisconnect;
+    netConfig.callbacks.on_receive = OnNetShardReceive;
+
+    gNetShards = rcnet_net_shards_create(&netConfig);
+    if (!gNetShards)
     {
-        gEnetNetworkThreadRunning.store(false, std::memory_order_relaxed);
-        SDL_WaitThread(gEnetNetworkThreadHandle, nullptr);
-        gEnetNetworkThreadHandle = nullptr;
+        RCNET_log(RCNET_LOG_CRITICAL, "Failed to create ENet server shards\n");
+        rcnet_engine_eventQuit();
+        return;
     }
 
     // ----------------------------
-    // B) Détruire ENet host
+    // C) Lancer les threads réseau (un par shard)
     // ----------------------------
-    if (gEnetServerHost)
+    if (!rcnet_net_shards_start(gNetShards))
     {
-        enet_host_destroy(gEnetServerHost);
-        gEnetServerHost = nullptr;
+        RCNET_log(RCNET_LOG_CRITICAL, "rcnet_net_shards_start failed\n");
+        rcnet_engine_eventQuit();
+        return;
     }
 
+    // Peers agrégés dans rcnet_engine_get_stats (RTT, congestion, débit)
+    rcnet_engine_set_net_shards(gNetShards);
+
     // ----------------------------
-    // C) Détruire mutex + vider queue
+    // D) Métriques (optionnelles : le serveur tourne sans si le port est pris)
     // ----------------------------
-    if (gIncomingInputsQueueMutex)
+    gMetricsServer = rcnet_metrics_server_create(NULL);
+    if (gMetricsServer)
     {
-        SDL_DestroyMutex(gIncomingInputsQueueMutex);
-        gIncomingInputsQueueMutex = nullptr;
+        rcnet_metrics_server_add_collector(gMetricsServer, rcnet_metrics_collect_engine, NULL, NULL);
+        rcnet_metrics_server_add_collector(gMetricsServer, rcnet_metrics_collect_net_shards, gNetShards, NULL);
+        rcnet_metrics_server_add_collector(gMetricsServer, rcnet_metrics_collect_input_receiver, gInputReceiver, NULL);
+        rcnet_metrics_server_add_collector(gMetricsServer, rcnet_metrics_collect_ring_queue, gIncomingInputsQueue, "queue=\"inputs\"");
+        rcnet_metrics_server_add_collector(gMetricsServer, rcnet_metrics_collect_packet_pool, gPacketPool, "pool=\"snapshots\"");
     }
+    else
+        RCNET_log(RCNET_LOG_WARN, "Metrics endpoint disabled\n");
+}
+
+void rcnet_unload(void)
+{
+    RCNET_log(RCNET_LOG_INFO, "Server Unloading (ENet example)...\n");
+
+    // Plus aucun scrape ne lit les objets détruits ci-dessous
+    rcnet_metrics_server_destroy(gMetricsServer);
+    gMetricsServer = nullptr;
+
+    // ----------------------------
+    // A) Stop threads réseau + détruire les ENet hosts
+    // ----------------------------
+    rcnet_engine_set_net_shards(nullptr);
+    rcnet_net_shards_destroy(gNetShards);
+    gNetShards = nullptr;
+
+    // Plus aucun packet en vol : les buffers sont tous revenus au pool
+    rcnet_packet_pool_destroy(gPacketPool);
+    gPacketPool = nullptr;
+
+    // ----------------------------
+    // B) Détruire la queue
+    // ----------------------------
+    rcnet_ring_queue_destroy(gIncomingInputsQueue);
+    gIncomingInputsQueue = nullptr;
+
+    // Détruire le buffer d'inputs planifiés
+    rcnet_input_buffer_destroy(gScheduledInputs);
+    gScheduledInputs = nullptr;
 
-    // Reset queue et scheduled ring
-    gIncomingInputsQueue.clear();
-    for (uint32_t i = 0; i < kScheduledInputsRingBufferSize; i++)
+    rcnet_input_receiver_destroy(gInputReceiver);
+    gInputReceiver = nullptr;
+
+    // Détruire l'historique de snapshots (après les shards qui l'utilisent)
+    rcnet_snapshot_history_destroy(gSnapshotHistory);
+    gSnapshotHistory = nullptr;
+
+    rcnet_interest_destroy(gInterest);
+    gInterest = nullptr;
+
+    rcnet_world_history_destroy(gWorldHistory);
+    gWorldHistory = nullptr;
+
+    rcnet_entity_store_destroy(gPlayerStore);
+    gPlayerStore = nullptr;
+
+    for (uint32_t i = 0; i < kMaxServerClients; ++i)
     {
-        gScheduledInputsRing[i].serverTickIdForThisSlot = 0;
-        gScheduledInputsRing[i].inputsToApply.clear();
+        rcnet_compressor_destroy(gSnapshotCompressors[i]);
+        gSnapshotCompressors[i] = nullptr;
     }
 
+    rcnet_triple_buffer_destroy(gWorldStateBuffer);
+    gWorldStateBuffer = nullptr;
+
     RCNET_log(RCNET_LOG_INFO, "Server Unloaded (ENet example)\n");
 }
 
@@ -436,11 +715,49 @@ void rcnet_unload(void)
 //
 // Etapes à chaque tick :
 // 1) incrémenter serverSimTickId
-// 2) publier serverSimTickId dans atomic (pour le thread réseau)
-// 3) récupérer tous les inputs reçus (queue)
-// 4) ranger ces inputs dans inputsByTick[targetTickId]
+// 2) publier serverSimTickId dans atomic (pour les threads réseau)
+// 3) récupérer tous les inputs reçus (queue lock-free, buffer préalloué)
+// 4) ranger ces inputs dans le RCNET_InputBuffer pour leur tick cible
 // 5) appliquer les inputs du tick courant
-// 6) simuler le monde (dt fixe)
+// 6) simuler le monde (dt fixe) + enregistrer les hitboxes dans l'historique (lag compensation)
+// 7) publier une copie de l'état pour le tick réseau (triple buffer)
+
+// Tir hitscan dans la direction des axes : rewind de RTT / 2 + interpolation client, borné à l'historique
+static void ResolveLagCompensatedFire(const RCNET_ClientInput& in, uint64_t serverSimTickId)
+{
+    if (!gWorldHistory || (in.axisX == 0.0f && in.axisY == 0.0f))
+        return;
+
+    RCNET_NetPeerStats peerStats;
+    if (!rcnet_net_shards_get_peer_stats(gNetShards, in.clientId, &peerStats))
+        return;
+
+    // Temps de rewind en ticks fractionnaires : partie entière = tick, reste = interpolation
+    double rewindTicks = (peerStats.roundTripTimeMs * 0.5) * kSimulationTickRateHz / 1000.0 + kClientInterpolationTicks;
+    uint64_t latestTick = rcnet_world_history_get_latest_tick(gWorldHistory);
+    uint64_t oldestTick = rcnet_world_history_get_oldest_tick(gWorldHistory);
+    double viewTick = std::max(static_cast<double>(oldestTick), static_cast<double>(latestTick) - rewindTicks);
+    uint64_t rewindTick = static_cast<uint64_t>(viewTick);
+    float alpha = static_cast<float>(viewTick - static_cast<double>(rewindTick));
+
+    RCNET_WorldHistoryEntity shooter;
+    if (!rcnet_world_history_sample_entity(gWorldHistory, rewindTick, alpha, in.clientId, &shooter))
+        return;
+
+    float length = std::sqrt(in.axisX * in.axisX + in.axisY * in.axisY);
+    float endX = shooter.posX + in.axisX / length * kFireRange;
+    float endY = shooter.posY + in.axisY / length * kFireRange;
+
+    uint32_t hitClientId = 0;
+    float hitFraction = 0.0f;
+    if (rcnet_world_history_raycast(gWorldHistory, rewindTick, alpha, shooter.posX, shooter.posY, endX, endY,
+                                    in.clientId, &hitClientId, &hitFraction))
+    {
+        RCNET_log(RCNET_LOG_DEBUG, "[SIM tick=%llu] Hit: shooter=%u target=%u distance=%.2f rewind=%llu ticks\n",
+                  (unsigned long long)serverSimTickId, in.clientId, hitClientId, hitFraction * kFireRange,
+                  (unsigned long long)(latestTick - rewindTick));
+    }
+}
 
 void rcnet_simulation_update(double dt)
 {
@@ -449,73 +766,138 @@ void rcnet_simulation_update(double dt)
     gCurrentServerSimulationTickId.store(serverSimTickId, std::memory_order_relaxed);
 
     // 2) Récupérer tous les inputs entrants depuis le réseau (sans bloquer longtemps)
-    std::vector<RCNET_QueuedInputForSimulation> newlyReceivedInputs;
-    PopAllIncomingInputsFromQueue(newlyReceivedInputs);
+    uint32_t newlyReceivedCount = PopAllIncomingInputsFromQueue();
 
-    // 3) Placer ces inputs dans le ring buffer pour leur tick cible
-    for (const auto& queued : newlyReceivedInputs)
+    // Signaler (une fois par changement) les inputs droppés car la queue était pleine
+    uint64_t overflowCount = rcnet_ring_queue_get_overflow_count(gIncomingInputsQueue);
+    if (overflowCount != gLastLoggedIncomingInputsOverflow)
     {
-        uint64_t targetTick = queued.targetServerSimTickId;
+        RCNET_log(RCNET_LOG_WARN, "[SIM] Incoming inputs queue full: %llu inputs dropped so far\n", (unsigned long long)overflowCount);
+        gLastLoggedIncomingInputsOverflow = overflowCount;
+    }
 
-        uint32_t ringIndex = GetRingIndexForServerTick(targetTick);
-        RCNET_ScheduledInputsSlot& slot = gScheduledInputsRing[ringIndex];
+    // 3) Placer ces inputs dans le buffer pour leur tick cible (aucune allocation)
+    for (uint32_t i = 0; i < newlyReceivedCount; ++i)
+    {
+        const RCNET_QueuedInputForSimulation& queued = gDrainedIncomingInputs[i];
+
+        // Les rejets (late / too far / doublons) sont comptés dans les stats du buffer
+        rcnet_input_buffer_place(gScheduledInputs, queued.targetServerSimTickId, &queued.input);
+    }
+
+    // Nouveaux joueurs : nouvelle entité au centre du monde. Joueurs partis : entité détruite.
+    for (uint32_t clientId = 0; clientId < kMaxServerClients; ++clientId)
+    {
+        RCNET_EntityHandle player = rcnet_entity_store_get_handle(gPlayerStore, clientId);
 
-        // IMPORTANT : le ring buffer réutilise les slots.
-        // Si le slot contient un ancien tick, on doit le reset.
-        if (slot.serverTickIdForThisSlot != targetTick)
+        if (gPlayerResetRequested[clientId].exchange(false, std::memory_order_acquire))
         {
-            slot.serverTickIdForThisSlot = targetTick;
-            slot.inputsToApply.clear();
+            rcnet_entity_store_destroy_entity(gPlayerStore, player);
+            rcnet_entity_store_create_entity_at(gPlayerStore, clientId);
+        }
+        else if (player != RCNET_ENTITY_HANDLE_INVALID && !rcnet_net_shards_is_connected(gNetShards, clientId))
+        {
+            rcnet_entity_store_destroy_entity(gPlayerStore, player);
         }
-
-        // Ajout de l'input dans le slot cible
-        slot.inputsToApply.push_back(queued.input);
     }
 
-    // 4) Récupérer la liste d’inputs pour CE tick
-    uint32_t currentRingIndex = GetRingIndexForServerTick(serverSimTickId);
-    RCNET_ScheduledInputsSlot& currentTickSlot = gScheduledInputsRing[currentRingIndex];
+    const uint32_t* playerButtons = rcnet_entity_store_get_uint32_column(gPlayerStore, kPlayerColumnButtons);
+
+    // 4) Récupérer la liste d’inputs pour CE tick (tableau packé, parcours linéaire)
+    uint32_t currentTickInputCount = 0;
+    const RCNET_ClientInput* currentTickInputs = rcnet_input_buffer_take_tick(gScheduledInputs, serverSimTickId, &currentTickInputCount);
 
-    // Si le slot ne correspond pas au tick courant, alors aucun input planifié
-    if (currentTickSlot.serverTickIdForThisSlot == serverSimTickId)
+    // 5) Appliquer les inputs de CE tick
+    // (aucun input si pas de joueurs ou si aucun input reçu pour ce tick)
+    for (uint32_t i = 0; i < currentTickInputCount; ++i)
     {
-        // 5) Appliquer les inputs de CE tick
-        for (const RCNET_ClientInput& in : currentTickSlot.inputsToApply)
+        const RCNET_ClientInput& in = currentTickInputs[i];
+
+        // Met à jour "dernier seq appliqué"
+        if (IsClientIdInRange(in.clientId))
         {
-            // TODO: Ajouter logique de jeu ici réellement
+            gLastAppliedInputSeqByClientId[in.clientId].store(in.clientInputSeq, std::memory_order_relaxed);
+        }
 
-            // Met à jour "dernier seq appliqué"
-            if (IsClientIdInRange(in.clientId))
-            {
-                gLastAppliedInputSeqByClientId[in.clientId].store(in.clientInputSeq, std::memory_order_relaxed);
-            }
+        // Tir (front montant) : validé contre l'état que le tireur voyait, avant son déplacement
+        if (IsClientIdInRange(in.clientId) && (in.buttonsMask & kFireButtonMask) && !(playerButtons[in.clientId] & kFireButtonMask))
+        {
+            ResolveLagCompensatedFire(in, serverSimTickId);
+        }
 
-            // TODO: Ajouter logique de jeu ici: par exemple, convertir buttons/axes -> velocity -> position.
-            RCNET_log(
-                RCNET_LOG_DEBUG,
-                "[SIM tick=%llu] Apply input: client=%u clientTick=%u seq=%u buttons=%u ax=%.2f ay=%.2f\n",
-                (unsigned long long)serverSimTickId,
-                in.clientId,
-                in.clientTickId,
-                in.clientInputSeq,
-                in.buttonsMask,
-                in.axisX,
-                in.axisY
-            );
+        // Logique de jeu minimale : axes -> vitesse (la vitesse reste celle du dernier input reçu)
+        if (IsClientIdInRange(in.clientId) && rcnet_entity_store_get_handle(gPlayerStore, in.clientId) != RCNET_ENTITY_HANDLE_INVALID)
+        {
+            rcnet_entity_store_set_float(gPlayerStore, in.clientId, kPlayerColumnVelX, in.axisX * kPlayerSpeed);
+            rcnet_entity_store_set_float(gPlayerStore, in.clientId, kPlayerColumnVelY, in.axisY * kPlayerSpeed);
+            rcnet_entity_store_set_uint32(gPlayerStore, in.clientId, kPlayerColumnButtons, in.buttonsMask);
         }
 
-        // Important : on peut clear après usage pour libérer mémoire
-        // (mais on garde serverTickIdForThisSlot pour la cohérence)
-        currentTickSlot.inputsToApply.clear();
+        RCNET_log(
+            RCNET_LOG_DEBUG,
+            "[SIM tick=%llu] Apply input: client=%u clientTick=%u seq=%u buttons=%u ax=%.2f ay=%.2f\n",
+            (unsigned long long)serverSimTickId,
+            in.clientId,
+            in.clientTickId,
+            in.clientInputSeq,
+            in.buttonsMask,
+            in.axisX,
+            in.axisY
+        );
     }
-    else
+
+    // 6) Simuler le monde (dt fixe = 1/60) : vitesse -> position (bornée au monde), toutes les entités d'un coup
+    // -> update gameplay, collisions simples, timers, etc.
+    rcnet_entity_store_integrate(gPlayerStore, kPlayerColumnPosX, kPlayerColumnVelX, static_cast<float>(dt), -kWorldHalfExtent, kWorldHalfExtent);
+    rcnet_entity_store_integrate(gPlayerStore, kPlayerColumnPosY, kPlayerColumnVelY, static_cast<float>(dt), -kWorldHalfExtent, kWorldHalfExtent);
+
+    const float* playerPosX = rcnet_entity_store_get_float_column(gPlayerStore, kPlayerColumnPosX);
+    const float* playerPosY = rcnet_entity_store_get_float_column(gPlayerStore, kPlayerColumnPosY);
+
+    // Enregistrer l'état du tick : seules les entités créées / détruites / déplacées sont réécrites
+    if (gWorldHistory && rcnet_world_history_begin_tick(gWorldHistory, serverSimTickId))
+    {
+        const uint64_t* spawnMask = rcnet_entity_store_get_spawn_mask(gPlayerStore);
+        const uint64_t* aliveMask = rcnet_entity_store_get_alive_mask(gPlayerStore);
+        const uint64_t* dirtyPosX = rcnet_entity_store_get_dirty_mask(gPlayerStore, kPlayerColumnPosX);
+        const uint64_t* dirtyPosY = rcnet_entity_store_get_dirty_mask(gPlayerStore, kPlayerColumnPosY);
+
+        for (uint32_t word = 0; word < rcnet_entity_store_get_mask_words(gPlayerStore); ++word)
+        {
+            uint64_t changed = spawnMask[word] | dirtyPosX[word] | dirtyPosY[word];
+            for (uint32_t bit = 0; changed != 0; ++bit, changed >>= 1)
+            {
+                if (!(changed & 1u))
+                    continue;
+
+                uint32_t clientId = word * 64 + bit;
+                if ((aliveMask[word] >> bit) & 1u)
+                {
+                    rcnet_world_history_set_entity(gWorldHistory, clientId, playerPosX[clientId], playerPosY[clientId],
+                                                   kPlayerHitboxHalfExtent, kPlayerHitboxHalfExtent);
+                }
+                else
+                {
+                    rcnet_world_history_remove_entity(gWorldHistory, clientId);
+                }
+            }
+        }
+        rcnet_world_history_commit_tick(gWorldHistory);
+    }
+
+    // 7) Publier l'état du tick pour le thread réseau (copie, jamais d'attente)
+    if (gWorldStateBuffer)
     {
-        // Aucun input prévu pour ce tick
-        // (normal si pas de joueurs ou si aucun input reçu)
+        WorldStateSnapshot* world = static_cast<WorldStateSnapshot*>(rcnet_triple_buffer_get_write_slot(gWorldStateBuffer));
+        world->serverTick = serverSimTickId;
+        std::memcpy(world->posX, playerPosX, sizeof(world->posX));
+        std::memcpy(world->posY, playerPosY, sizeof(world->posY));
+        std::memcpy(world->buttons, playerButtons, sizeof(world->buttons));
+        rcnet_triple_buffer_publish(gWorldStateBuffer);
     }
 
-    // 6) Simuler le monde (dt fixe = 1/60)
-    // -> update gameplay, collisions simples, timers, etc.
+    // Tous les consommateurs des bitsets de ce tick sont passés
+    rcnet_entity_store_clear_dirty(gPlayerStore);
 }
 
 // ============================================================
@@ -523,65 +905,283 @@ void rcnet_simulation_update(double dt)
 // ============================================================
 //
 // Ici : envoyer des snapshots/deltas.
-// L'exemple : broadcast un JSON minimal avec serverTickId.
+// L'exemple : envoie un snapshot binaire (en-tête + delta de l'état du monde contre le dernier
+// snapshot acké par le client), ou un JSON minimal sans état du monde en debug.
+//
+// Etapes à chaque tick réseau :
+// 1) récupérer la dernière copie publiée par la simulation, l'enregistrer dans l'historique
+//    + lister les clients connectés
+// 2) encoder un snapshot par client EN PARALLELE (rcnet_engine_parallel_for),
+//    chaque worker écrit dans sa propre arena de scratch (reset par le moteur à chaque tick réseau),
+//    puis compresse directement dans un buffer de gPacketPool
+// 3) créer (sans copie, ENET_PACKET_FLAG_NO_ALLOCATE) + envoyer les packets ENet en série, sur ce thread
 //
 // IMPORTANT :
 // - ne fais pas de logique gameplay ici
 // - idéalement tu packs + envoies
 
+// Snapshot encodé pour un client (rempli par un worker, envoyé ensuite en série)
+struct RCNET_EncodedSnapshot
+{
+    uint32_t clientId;
+    float viewerX;        // point de vue de l'interest (position du joueur du client)
+    float viewerY;
+    uint8_t* bytes;       // buffer de gPacketPool (possédé par le packet une fois envoyé)
+    size_t length;        // 0 = échec d'encodage, rien à envoyer
+};
+
+// Préalloués : un slot par client possible
+static RCNET_EncodedSnapshot gEncodedSnapshots[kMaxServerClients];
+
+// Ticks réseau depuis le dernier snapshot de chaque client (comparé à RCNET_NetPeerStats::sendInterval)
+static uint32_t gNetTicksSinceSnapshot[kMaxServerClients];
+
+// Intervalle de log des stats moteur (en ticks réseau : 300 ticks ~ 10 s à 30 Hz)
+static constexpr uint32_t kEngineStatsLogIntervalNetTicks = 300;
+
+// Ticks réseau sans aucun client avant de suspendre le moteur (30 ticks ~ 1 s à 30 Hz).
+// Les shards réveillent le moteur dès qu'un client se connecte ou envoie un packet.
+static constexpr uint32_t kIdleAfterEmptyNetTicks = 30;
+
+// Taille max d'un snapshot JSON de debug
+#ifdef RCNET_EXAMPLE_JSON_DEBUG
+static constexpr size_t kMaxJsonSnapshotLength = 128;
+#endif
+
+// Job d'encodage : index = position dans gEncodedSnapshots
+static void EncodeSnapshotJob(uint32_t index, uint32_t workerIndex, void* userdata)
+{
+#ifdef RCNET_EXAMPLE_JSON_DEBUG
+    const uint64_t serverTick = *static_cast<const uint64_t*>(userdata);
+#else
+    (void)userdata;
+#endif
+    RCNET_EncodedSnapshot& encoded = gEncodedSnapshots[index];
+    RCNET_Arena* arena = rcnet_engine_get_worker_arena(workerIndex);
+
+    encoded.bytes = NULL;
+    encoded.length = 0;
+    if (!arena)
+        return;
+
+    uint32_t ackSeqApplied  = gLastAppliedInputSeqByClientId[encoded.clientId].load(std::memory_order_relaxed);
+    uint32_t ackSeqReceived = gLastReceivedInputSeqByClientId[encoded.clientId].load(std::memory_order_relaxed);
+
+    // Snapshot minimal :
+    // serverTick : tick courant serveur
+    // ackApplied : dernier seq input appliqué (le plus important)
+    // ackRecv    : dernier seq input reçu (optionnel mais utile debug)
+#ifdef RCNET_EXAMPLE_JSON_DEBUG
+    // Mode debug : JSON lisible (plus lent)
+    char* json = static_cast<char*>(rcnet_arena_alloc(arena, kMaxJsonSnapshotLength, 1));
+    if (!json)
+        return;
+
+    int jsonLength = std::snprintf(json, kMaxJsonSnapshotLength,
+                                   "{\"serverTick\":%llu,\"ackApplied\":%u,\"ackRecv\":%u}",
+                                   (unsigned long long)serverTick, ackSeqApplied, ackSeqReceived);
+    if (jsonLength <= 0 || static_cast<size_t>(jsonLength) >= kMaxJsonSnapshotLength)
+        return;
+
+    const uint8_t* snapshotBytes = reinterpret_cast<const uint8_t*>(json);
+    size_t snapshotLength = static_cast<size_t>(jsonLength);
+#else
+    // Mode par défaut : binaire RCNET_codec, en-tête + delta bit-packé (ou complet si pas de baseline)
+    size_t capacity = RCNET_SNAPSHOT_HEADER_PACKET_SIZE + rcnet_snapshot_history_get_max_encoded_size(gSnapshotHistory);
+    uint8_t* buffer = static_cast<uint8_t*>(rcnet_arena_alloc(arena, capacity, 8));
+    if (!buffer)
+        return;
+
+    RCNET_PacketWriter writer;
+    rcnet_packet_writer_init(&writer, buffer, capacity);
+
+    // serverTick = tick de l'état encodé (c'est ce tick que le client ackera)
+    RCNET_SnapshotHeader header;
+    header.serverTick = rcnet_snapshot_history_get_latest_tick(gSnapshotHistory);
+    header.ackApplied = ackSeqApplied;
+    header.ackRecv    = ackSeqReceived;
+    rcnet_codec_write_snapshot_header(&writer, &header);
+
+    // Seulement les entités visibles, par priorité, dans le budget d'octets du client.
+    // false = cet état a déjà été envoyé à ce client (pas de nouveau tick simulation).
+    RCNET_SnapshotInterest interest;
+    rcnet_interest_update_peer(gInterest, encoded.clientId, encoded.viewerX, encoded.viewerY, &interest);
+
+    uint32_t writtenCount = 0;
+    if (!rcnet_snapshot_history_encode_interest(gSnapshotHistory, encoded.clientId, &writer, &interest, &writtenCount, NULL))
+        return;
+
+    rcnet_interest_commit_peer(gInterest, encoded.clientId, writtenCount);
+
+    const uint8_t* snapshotBytes = writer.data;
+    size_t snapshotLength = writer.size;
+#endif
+
+    // Etape de compression du channel snapshot (les deltas sous le seuil restent bruts),
+    // directement dans le buffer du packet : ni copie ni malloc à l'envoi
+    size_t compressedCapacity = rcnet_compression_get_max_output_size(snapshotLength);
+    uint8_t* compressed = static_cast<uint8_t*>(rcnet_packet_pool_acquire(gPacketPool, compressedCapacity));
+    if (!compressed)
+        return;
+
+    encoded.length = rcnet_compressor_compress(gSnapshotCompressors[encoded.clientId], kSnapshotChannel,
+                                               snapshotBytes, snapshotLength, compressed, compressedCapacity);
+    if (encoded.length == 0)
+    {
+        rcnet_packet_pool_release(compressed);
+        return;
+    }
+    encoded.bytes = compressed;
+}
+
 void rcnet_network_update(void)
 {
-    if (!gEnetServerHost)
+    if (!gNetShards || !gWorldStateBuffer)
         return;
 
     // Tick serveur à inclure dans le snapshot
     uint64_t serverTick = gCurrentServerSimulationTickId.load(std::memory_order_relaxed);
 
-    // On envoie un snapshot par peer car ackSeq est différent pour chaque client.
-    for (size_t peerIndex = 0; peerIndex < gEnetServerHost->peerCount; ++peerIndex)
+    // Dernier état publié par la simulation (inchangé s'il n'y a pas eu de tick simulation depuis)
+    rcnet_triple_buffer_acquire(gWorldStateBuffer);
+    const WorldStateSnapshot* world = static_cast<const WorldStateSnapshot*>(rcnet_triple_buffer_get_read_slot(gWorldStateBuffer));
+
+    // 1) Etat du monde de ce tick (une seule fois par tick simulation : un état déjà envoyé
+    //    ne doit jamais changer, les clients peuvent l'utiliser comme baseline)
+    bool buildFrame = world->serverTick != 0 && world->serverTick != rcnet_snapshot_history_get_latest_tick(gSnapshotHistory);
+    // Positions quantifiées de tous les slots d'un coup (kernel vectoriel), puis écrites client par client
+    uint32_t quantizedPosX[kMaxServerClients];
+    uint32_t quantizedPosY[kMaxServerClients];
+    if (buildFrame)
     {
-        ENetPeer* peer = &gEnetServerHost->peers[peerIndex];
+        rcnet_snapshot_history_begin_frame(gSnapshotHistory, world->serverTick);
+        rcnet_simd_quantize_floats(world->posX, kMaxServerClients, -kWorldHalfExtent, kWorldHalfExtent, kPositionBits, quantizedPosX);
+        rcnet_simd_quantize_floats(world->posY, kMaxServerClients, -kWorldHalfExtent, kWorldHalfExtent, kPositionBits, quantizedPosY);
+    }
 
-        // On ne parle qu'aux peers connectés
-        if (peer->state != ENET_PEER_STATE_CONNECTED)
+    // On envoie un snapshot par client car ackSeq / baseline sont différents pour chaque client.
+    uint32_t snapshotCount = 0;
+    uint32_t connectedCount = 0;
+    for (uint32_t clientId = 0; clientId < kMaxServerClients; ++clientId)
+    {
+        // On ne parle qu'aux clients connectés
+        if (!rcnet_net_shards_is_connected(gNetShards, clientId))
+        {
+            if (buildFrame)
+                rcnet_interest_remove_entity(gInterest, clientId);
             continue;
+        }
 
-        // Dans ton code, clientId == incomingPeerID.
-        uint32_t clientId = peer->incomingPeerID;
+        connectedCount++;
 
-        // Sécurité : si jamais incomingPeerID dépasse ton tableau (devrait pas)
-        uint32_t ackSeqApplied = 0;
-        uint32_t ackSeqReceived = 0;
+        if (gInterestResetRequested[clientId].exchange(false, std::memory_order_acquire))
+        {
+            rcnet_interest_reset_peer(gInterest, clientId);
+            rcnet_interest_set_peer_entity(gInterest, clientId, clientId);
+            gNetTicksSinceSnapshot[clientId] = 0;
+        }
+
+        // Avant tout job d'encodage de ce tick : aucun autre thread n'utilise le compresseur
+        if (gCompressorResetRequested[clientId].exchange(false, std::memory_order_acquire))
+            rcnet_compressor_reset(gSnapshotCompressors[clientId]);
+
+        if (buildFrame)
+        {
+            rcnet_interest_set_entity(gInterest, clientId, world->posX[clientId], world->posY[clientId], 1.0f);
 
-        if (IsClientIdInRange(clientId))
+            uint32_t fields[kPlayerFieldCount];
+            fields[kPlayerFieldPosX]    = quantizedPosX[clientId];
+            fields[kPlayerFieldPosY]    = quantizedPosY[clientId];
+            fields[kPlayerFieldButtons] = world->buttons[clientId] & ((1u << kButtonsBits) - 1u);
+            rcnet_snapshot_history_write_entity(gSnapshotHistory, clientId, fields);
+        }
+
+        // Débit adapté au lien du client (mesuré par son shard) : un lien congestionné reçoit des
+        // snapshots plus petits et plus espacés au lieu de remplir sa queue ENet
+        RCNET_NetPeerStats peerStats;
+        if (rcnet_net_shards_get_peer_stats(gNetShards, clientId, &peerStats))
         {
-            ackSeqApplied  = gLastAppliedInputSeqByClientId[clientId].load(std::memory_order_relaxed);
-            ackSeqReceived = gLastReceivedInputSeqByClientId[clientId].load(std::memory_order_relaxed);
+            rcnet_interest_set_peer_budget(gInterest, clientId, peerStats.payloadBudgetBytes);
+            if (++gNetTicksSinceSnapshot[clientId] < peerStats.sendInterval)
+                continue;
         }
+        gNetTicksSinceSnapshot[clientId] = 0;
+
+        RCNET_EncodedSnapshot& encoded = gEncodedSnapshots[snapshotCount++];
+        encoded.clientId = clientId;
+        encoded.viewerX = world->posX[clientId];
+        encoded.viewerY = world->posY[clientId];
+    }
 
-        // JSON snapshot minimal :
-        // serverTick : tick courant serveur
-        // ackApplied : dernier seq input appliqué (le plus important)
-        // ackRecv    : dernier seq input reçu (optionnel mais utile debug)
-        std::string snapshotJson =
-            std::string("{\"serverTick\":") + std::to_string(serverTick) +
-            ",\"ackApplied\":" + std::to_string(ackSeqApplied) +
-            ",\"ackRecv\":" + std::to_string(ackSeqReceived) +
-            "}";
-
-        ENetPacket* packet = enet_packet_create(
-            snapshotJson.data(),
-            snapshotJson.size(),
+    if (buildFrame)
+        rcnet_snapshot_history_commit_frame(gSnapshotHistory);
+
+    // 2) Encodage en parallèle (un job par client)
+    rcnet_engine_parallel_for(snapshotCount, EncodeSnapshotJob, &serverTick);
+
+    // 3) Envoi en série
+    for (uint32_t i = 0; i < snapshotCount; ++i)
+    {
+        RCNET_EncodedSnapshot& encoded = gEncodedSnapshots[i];
+        if (encoded.length == 0)
+            continue;
+
+        // Le packet prend le buffer (ENET_PACKET_FLAG_NO_ALLOCATE), rendu au pool à sa destruction
+        ENetPacket* packet = rcnet_packet_pool_create_packet(
+            encoded.bytes,
+            encoded.length,
             0 // Unreliable
         );
-        
-        // Envoi au peer uniquement (pas broadcast)
-        enet_peer_send(peer, 0, packet);
+        encoded.bytes = nullptr;
+        if (!packet)
+            continue;
+
+        // Envoi au client uniquement (pas broadcast) : mis en queue puis envoyé + flushé par son shard
+        rcnet_net_shards_send(gNetShards, encoded.clientId, kSnapshotChannel, packet);
     }
 
-    // Flush: pousse les paquets à la socket (latence plus faible)
-    enet_host_flush(gEnetServerHost);
+    // Serveur vide : plus de ticks (CPU ~0) jusqu'au prochain client
+    static uint32_t emptyNetworkTicks = 0;
+    emptyNetworkTicks = (connectedCount == 0) ? emptyNetworkTicks + 1 : 0;
+    if (emptyNetworkTicks >= kIdleAfterEmptyNetTicks)
+    {
+        emptyNetworkTicks = 0;
+        RCNET_log(RCNET_LOG_INFO, "[ENGINE] No client connected, engine idle until next client.\n");
+        rcnet_engine_set_idle(true);
+    }
 
     // Log debug (optionnel, mais évite spam si tu as plein de clients)
     // RCNET_log(RCNET_LOG_DEBUG, "[NET] Sent per-peer snapshots tick=%llu\n", (unsigned long long)serverTick);
-}
\ No newline at end of file
+
+    // 4) Profil de la boucle moteur toutes les ~10 s (à exporter vers un dashboard en prod)
+    static uint32_t networkTicksSinceStatsLog = 0;
+    if (++networkTicksSinceStatsLog >= kEngineStatsLogIntervalNetTicks)
+    {
+        networkTicksSinceStatsLog = 0;
+
+        RCNET_EngineStats engineStats;
+        if (rcnet_engine_get_stats(&engineStats))
+        {
+            RCNET_log(RCNET_LOG_INFO,
+                      "[ENGINE] sim p50=%lluus p99=%lluus p999=%lluus | net p50=%lluus p99=%lluus | oversleep p99=%lluus spin margin=%lluus | catch-up=%llu drops=%llu\n",
+                      (unsigned long long)(engineStats.simUpdateNs.p50 / 1000), (unsigned long long)(engineStats.simUpdateNs.p99 / 1000),
+                      (unsigned long long)(engineStats.simUpdateNs.p999 / 1000),
+                      (unsigned long long)(engineStats.netUpdateNs.p50 / 1000), (unsigned long long)(engineStats.netUpdateNs.p99 / 1000),
+                      (unsigned long long)(engineStats.sleepOvershootNs.p99 / 1000), (unsigned long long)(engineStats.spinMarginNs / 1000),
+                      (unsigned long long)engineStats.simCatchUpTicks, (unsigned long long)engineStats.simBacklogDrops);
+            RCNET_log(RCNET_LOG_INFO,
+                      "[ENGINE] peers=%u congested=%u rtt avg=%ums max=%ums | sent=%lluB/s delivered~%lluB/s\n",
+                      engineStats.peerCount, engineStats.congestedPeerCount, engineStats.peerRttAvgMs, engineStats.peerRttMaxMs,
+                      (unsigned long long)engineStats.peerSentBytesPerSecond, (unsigned long long)engineStats.peerEstimatedBytesPerSecond);
+        }
+
+        RCNET_InputReceiverStats inputStats;
+        rcnet_input_receiver_get_stats(gInputReceiver, &inputStats);
+        RCNET_log(RCNET_LOG_INFO,
+                  "[INPUT] packets=%llu invalid=%llu | inputs=%llu accepted=%llu redundant=%llu recovered=%llu late=%llu resyncs=%llu\n",
+                  (unsigned long long)inputStats.packets, (unsigned long long)inputStats.invalidPackets,
+                  (unsigned long long)inputStats.inputs, (unsigned long long)inputStats.accepted,
+                  (unsigned long long)inputStats.redundant, (unsigned long long)inputStats.recovered,
+                  (unsigned long long)inputStats.late, (unsigned long long)inputStats.resyncs);
+    }
+}
@@ -1,8 +1,32 @@
 #ifndef RCNET_H
 #define RCNET_H
 
+#include <RCNET/RCNET_arena.h>
+#include <RCNET/RCNET_codec.h>
+#include <RCNET/RCNET_compression.h>
 #include <RCNET/RCNET_engine.h>
+#include <RCNET/RCNET_engine_host.h>
+#include <RCNET/RCNET_entity_store.h>
+#include <RCNET/RCNET_histogram.h>
+#include <RCNET/RCNET_input_buffer.h>
+#include <RCNET/RCNET_input_transport.h>
+#include <RCNET/RCNET_interest.h>
 #include <RCNET/RCNET_logger.h>
+#include <RCNET/RCNET_metrics.h>
 #include <RCNET/RCNET_nats.h>
+#include <RCNET/RCNET_net_shards.h>
+#include <RCNET/RCNET_packet_pool.h>
+#include <RCNET/RCNET_queue.h>
+#include <RCNET/RCNET_redis.h>
+#include <RCNET/RCNET_redis_cache.h>
+#include <RCNET/RCNET_replication.h>
+#include <RCNET/RCNET_secure_channel.h>
+#include <RCNET/RCNET_simd.h>
+#include <RCNET/RCNET_snapshot.h>
+#include <RCNET/RCNET_subsystem.h>
+#include <RCNET/RCNET_timer.h>
+#include <RCNET/RCNET_triple_buffer.h>
+#include <RCNET/RCNET_world_history.h>
+#include <RCNET/RCNET_worker_pool.h>
 
 #endif // RCNET_H
\ No newline at end of file
@@ -0,0 +1,82 @@
+#ifndef RCNET_ARENA_H
+#define RCNET_ARENA_H
+
+// Standard C/C++ Libraries
+#include <stddef.h> // size_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Arena "bump" : allocations linéaires, libérées toutes ensemble par rcnet_arena_reset().
+ *
+ * Si une allocation ne tient pas dans le bloc courant, un bloc de débordement est alloué ;
+ * au reset suivant les blocs sont fusionnés en un seul bloc assez grand pour le pic observé.
+ * En régime établi, allouer et reset n'allouent donc plus jamais sur le heap.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_Arena RCNET_Arena;
+
+/**
+ * \brief Crée une arena.
+ *
+ * \param {size_t} capacity - Taille initiale du bloc en octets (ex: 256 * 1024).
+ * \return {RCNET_Arena*} L'arena, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_Arena* rcnet_arena_create(size_t capacity);
+
+/**
+ * \brief Détruit une arena et tous ses blocs.
+ *
+ * \param {RCNET_Arena*} arena - L'arena (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_arena_destroy(RCNET_Arena* arena);
+
+/**
+ * \brief Alloue size octets alignés sur alignment.
+ *
+ * \param {RCNET_Arena*} arena - L'arena.
+ * \param {size_t} size - Taille en octets.
+ * \param {size_t} alignment - Alignement (puissance de 2, ex: 8 ou 16).
+ * \return {void*} La mémoire (valide jusqu'au prochain reset), ou NULL si plus de mémoire.
+ *
+ * \threadsafety Une arena n'est utilisée que par un seul thread à la fois.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void* rcnet_arena_alloc(RCNET_Arena* arena, size_t size, size_t alignment);
+
+/**
+ * \brief Libère toutes les allocations d'un coup (O(1) en régime établi).
+ *
+ * \param {RCNET_Arena*} arena - L'arena.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_arena_reset(RCNET_Arena* arena);
+
+/**
+ * \brief Nombre d'octets utilisés depuis le dernier reset (padding d'alignement inclus).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_arena_get_used(const RCNET_Arena* arena);
+
+/**
+ * \brief Capacité totale actuellement réservée (tous blocs confondus).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_arena_get_capacity(const RCNET_Arena* arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_ARENA_H
@@ -0,0 +1,479 @@
+#ifndef RCNET_CODEC_H
+#define RCNET_CODEC_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint8_t, uint32_t, uint64_t
+#include <string.h>  // memcpy
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Version du format binaire RCNET.
+ *
+ * Premier octet de chaque packet. Un packet dont la version ne correspond pas
+ * est rejeté par les fonctions de décodage.
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_CODEC_VERSION 1
+
+/**
+ * \brief Taille de l'en-tête commun à tous les packets : [version u8][type u8].
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_PACKET_HEADER_SIZE 2
+
+/**
+ * \brief Taille exacte d'un packet RCNET_PACKET_TYPE_CLIENT_INPUT encodé.
+ *
+ * Layout (little-endian) :
+ * [version u8][type u8][clientTickId u32][clientInputSeq u32][buttonsMask u32][axisX f32][axisY f32]
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_CLIENT_INPUT_PACKET_SIZE (RCNET_PACKET_HEADER_SIZE + 20)
+
+/**
+ * \brief Taille de l'en-tête d'un packet RCNET_PACKET_TYPE_SNAPSHOT encodé.
+ *
+ * Layout (little-endian) :
+ * [version u8][type u8][serverTick u64][ackApplied u32][ackRecv u32][payload...]
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_SNAPSHOT_HEADER_PACKET_SIZE (RCNET_PACKET_HEADER_SIZE + 16)
+
+/**
+ * \brief Taille exacte d'un packet RCNET_PACKET_TYPE_SNAPSHOT_ACK encodé.
+ *
+ * Layout (little-endian) :
+ * [version u8][type u8][snapshotTick u64]
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_SNAPSHOT_ACK_PACKET_SIZE (RCNET_PACKET_HEADER_SIZE + 8)
+
+/**
+ * \brief Nombre maximum d'inputs dans un packet RCNET_PACKET_TYPE_CLIENT_INPUT_BATCH.
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS 32
+
+/**
+ * \brief Bits de quantification de chaque axe dans un packet RCNET_PACKET_TYPE_CLIENT_INPUT_BATCH ([-1, 1]).
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_CLIENT_INPUT_BATCH_AXIS_BITS 12
+
+/**
+ * \brief Taille maximale d'un packet RCNET_PACKET_TYPE_CLIENT_INPUT_BATCH encodé.
+ *
+ * Layout (little-endian) :
+ * [version u8][type u8][count u8][newestSeq u32][newestClientTick u32][bits...]
+ * Bits (LSB first), du plus récent au plus ancien :
+ * - le plus récent : buttonsMask (32), axisX, axisY (RCNET_CLIENT_INPUT_BATCH_AXIS_BITS chacun)
+ * - les suivants : écart de seq (1 bit si 1, sinon 0 + écart sur 8 bits), écart de clientTick
+ *   (1 bit si égal à l'écart de seq, sinon 0 + 8 bits), puis buttons et axes, chacun précédé
+ *   d'un bit "modifié" par rapport à l'input plus récent.
+ * Un input répété sans changement coûte donc 4 bits.
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_CLIENT_INPUT_BATCH_MAX_PACKET_SIZE \
+    (RCNET_PACKET_HEADER_SIZE + 9 + (32 + 2 * RCNET_CLIENT_INPUT_BATCH_AXIS_BITS \
+        + (RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS - 1) * (18 + 33 + 1 + 2 * RCNET_CLIENT_INPUT_BATCH_AXIS_BITS) + 7) / 8)
+
+/**
+ * \brief Types de packets connus par le codec RCNET (deuxième octet de l'en-tête).
+ *
+ * \since Cette enum est disponible depuis RCNET 1.1.0.
+ */
+typedef enum RCNET_PacketType {
+    /**
+     * Packet vide, version inconnue ou type inconnu.
+     */
+    RCNET_PACKET_TYPE_INVALID = 0,
+
+    /**
+     * Input client -> serveur (RCNET_ClientInput).
+     */
+    RCNET_PACKET_TYPE_CLIENT_INPUT = 1,
+
+    /**
+     * Snapshot serveur -> client (RCNET_SnapshotHeader + payload).
+     */
+    RCNET_PACKET_TYPE_SNAPSHOT = 2,
+
+    /**
+     * Client -> serveur : tick du dernier snapshot décodé (baseline des prochains deltas).
+     */
+    RCNET_PACKET_TYPE_SNAPSHOT_ACK = 3,
+
+    /**
+     * Inputs client -> serveur : les derniers inputs non ackés, redondants d'un packet à l'autre
+     * (un packet perdu est rattrapé par le suivant, sans channel reliable).
+     */
+    RCNET_PACKET_TYPE_CLIENT_INPUT_BATCH = 4
+} RCNET_PacketType;
+
+/**
+ * \brief Input "gameplay" d'un client, tel que consommé par la simulation.
+ *
+ * Note : clientId n'est pas transmis sur le réseau, le serveur le déduit du peer.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_ClientInput {
+    uint32_t clientId;         // id du client (ex: peer->incomingPeerID)
+    uint32_t clientTickId;     // tick côté client (utile pour debug/prediction)
+    uint32_t clientInputSeq;   // séquence input (anti-duplication/ack)
+    uint32_t buttonsMask;      // bitmask des inputs (WASD, jump, shoot, etc.)
+    float axisX;               // stick/mouse axis X
+    float axisY;               // stick/mouse axis Y
+} RCNET_ClientInput;
+
+/**
+ * \brief En-tête d'un snapshot serveur -> client.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_SnapshotHeader {
+    uint64_t serverTick;  // tick courant serveur
+    uint32_t ackApplied;  // dernier seq input appliqué
+    uint32_t ackRecv;     // dernier seq input reçu
+} RCNET_SnapshotHeader;
+
+/**
+ * \brief Writer binaire little-endian sur un buffer fourni par l'appelant (aucune allocation).
+ *
+ * Si une écriture dépasse la capacité, rien n'est écrit et overflow passe à true.
+ * Il suffit donc de vérifier overflow une seule fois à la fin de l'encodage.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_PacketWriter {
+    uint8_t* data;
+    size_t capacity;
+    size_t size;
+    bool overflow;
+} RCNET_PacketWriter;
+
+/**
+ * \brief Reader binaire little-endian sur un buffer existant (aucune allocation, aucune copie).
+ *
+ * Si une lecture dépasse la taille, la valeur lue vaut 0 et overflow passe à true.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_PacketReader {
+    const uint8_t* data;
+    size_t size;
+    size_t offset;
+    bool overflow;
+} RCNET_PacketReader;
+
+// ============================================================
+// Writer (inline : utilisé sur le hot path réseau)
+// ============================================================
+
+static inline void rcnet_packet_writer_init(RCNET_PacketWriter* writer, void* buffer, size_t capacity)
+{
+    writer->data = (uint8_t*)buffer;
+    writer->capacity = capacity;
+    writer->size = 0;
+    writer->overflow = false;
+}
+
+static inline bool rcnet_packet_writer_reserve(RCNET_PacketWriter* writer, size_t byteCount)
+{
+    if (writer->overflow || writer->capacity - writer->size < byteCount)
+    {
+        writer->overflow = true;
+        return false;
+    }
+    return true;
+}
+
+static inline void rcnet_packet_write_u8(RCNET_PacketWriter* writer, uint8_t value)
+{
+    if (!rcnet_packet_writer_reserve(writer, 1)) return;
+    writer->data[writer->size++] = value;
+}
+
+static inline void rcnet_packet_write_u16(RCNET_PacketWriter* writer, uint16_t value)
+{
+    if (!rcnet_packet_writer_reserve(writer, 2)) return;
+    uint8_t* p = writer->data + writer->size;
+    p[0] = (uint8_t)(value);
+    p[1] = (uint8_t)(value >> 8);
+    writer->size += 2;
+}
+
+static inline void rcnet_packet_write_u32(RCNET_PacketWriter* writer, uint32_t value)
+{
+    if (!rcnet_packet_writer_reserve(writer, 4)) return;
+    uint8_t* p = writer->data + writer->size;
+    p[0] = (uint8_t)(value);
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+    writer->size += 4;
+}
+
+static inline void rcnet_packet_write_u64(RCNET_PacketWriter* writer, uint64_t value)
+{
+    if (!rcnet_packet_writer_reserve(writer, 8)) return;
+    rcnet_packet_write_u32(writer, (uint32_t)(value));
+    rcnet_packet_write_u32(writer, (uint32_t)(value >> 32));
+}
+
+static inline void rcnet_packet_write_f32(RCNET_PacketWriter* writer, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    rcnet_packet_write_u32(writer, bits);
+}
+
+static inline void rcnet_packet_write_bytes(RCNET_PacketWriter* writer, const void* bytes, size_t byteCount)
+{
+    if (!rcnet_packet_writer_reserve(writer, byteCount)) return;
+    if (byteCount > 0) memcpy(writer->data + writer->size, bytes, byteCount);
+    writer->size += byteCount;
+}
+
+// ============================================================
+// Reader (inline : utilisé sur le hot path réseau)
+// ============================================================
+
+static inline void rcnet_packet_reader_init(RCNET_PacketReader* reader, const void* bytes, size_t size)
+{
+    reader->data = (const uint8_t*)bytes;
+    reader->size = size;
+    reader->offset = 0;
+    reader->overflow = false;
+}
+
+static inline bool rcnet_packet_reader_require(RCNET_PacketReader* reader, size_t byteCount)
+{
+    if (reader->overflow || reader->size - reader->offset < byteCount)
+    {
+        reader->overflow = true;
+        return false;
+    }
+    return true;
+}
+
+static inline size_t rcnet_packet_reader_remaining(const RCNET_PacketReader* reader)
+{
+    return reader->overflow ? 0 : reader->size - reader->offset;
+}
+
+static inline uint8_t rcnet_packet_read_u8(RCNET_PacketReader* reader)
+{
+    if (!rcnet_packet_reader_require(reader, 1)) return 0;
+    return reader->data[reader->offset++];
+}
+
+static inline uint16_t rcnet_packet_read_u16(RCNET_PacketReader* reader)
+{
+    if (!rcnet_packet_reader_require(reader, 2)) return 0;
+    const uint8_t* p = reader->data + reader->offset;
+    reader->offset += 2;
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t rcnet_packet_read_u32(RCNET_PacketReader* reader)
+{
+    if (!rcnet_packet_reader_require(reader, 4)) return 0;
+    const uint8_t* p = reader->data + reader->offset;
+    reader->offset += 4;
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint64_t rcnet_packet_read_u64(RCNET_PacketReader* reader)
+{
+    if (!rcnet_packet_reader_require(reader, 8)) return 0;
+    uint64_t low  = rcnet_packet_read_u32(reader);
+    uint64_t high = rcnet_packet_read_u32(reader);
+    return low | (high << 32);
+}
+
+static inline float rcnet_packet_read_f32(RCNET_PacketReader* reader)
+{
+    uint32_t bits = rcnet_packet_read_u32(reader);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static inline const uint8_t* rcnet_packet_read_bytes(RCNET_PacketReader* reader, size_t byteCount)
+{
+    if (!rcnet_packet_reader_require(reader, byteCount)) return NULL;
+    const uint8_t* p = reader->data + reader->offset;
+    reader->offset += byteCount;
+    return p;
+}
+
+// ============================================================
+// Packets RCNET
+// ============================================================
+
+/**
+ * \brief Lit l'en-tête d'un packet et retourne son type.
+ *
+ * \param {const void*} bytes - Données brutes du packet (ex: ENetPacket::data).
+ * \param {size_t} size - Taille des données.
+ * \return {RCNET_PacketType} Le type du packet, ou RCNET_PACKET_TYPE_INVALID si la version
+ * ou le type est inconnu (ex: packet JSON de debug, qui commence par '{').
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_PacketType rcnet_codec_peek_type(const void* bytes, size_t size);
+
+/**
+ * \brief Ecrit l'en-tête commun [version][type] dans un writer.
+ *
+ * \param {RCNET_PacketWriter*} writer - Writer cible.
+ * \param {RCNET_PacketType} type - Type du packet.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_codec_write_header(RCNET_PacketWriter* writer, RCNET_PacketType type);
+
+/**
+ * \brief Encode un input client dans le buffer fourni.
+ *
+ * \param {const RCNET_ClientInput*} input - Input à encoder (clientId est ignoré).
+ * \param {void*} outBuffer - Buffer de sortie.
+ * \param {size_t} outCapacity - Capacité du buffer (au moins RCNET_CLIENT_INPUT_PACKET_SIZE).
+ * \return {size_t} Nombre d'octets écrits, 0 si le buffer est trop petit.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_codec_encode_client_input(const RCNET_ClientInput* input, void* outBuffer, size_t outCapacity);
+
+/**
+ * \brief Décode un packet input client.
+ *
+ * \param {const void*} bytes - Données brutes du packet.
+ * \param {size_t} size - Taille des données.
+ * \param {uint32_t} clientId - Id du client émetteur (déduit du peer côté serveur).
+ * \param {RCNET_ClientInput*} outInput - Input décodé.
+ * \return {bool} true si OK, false si version/type/taille invalide.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_codec_decode_client_input(const void* bytes, size_t size, uint32_t clientId, RCNET_ClientInput* outInput);
+
+/**
+ * \brief Encode plusieurs inputs client dans un seul packet (redondance, voir RCNET_input_transport.h).
+ *
+ * Les inputs sont passés du plus récent au plus ancien (clientInputSeq décroissant).
+ * L'encodage s'arrête avant un input trop éloigné du précédent (écart de seq ou de tick > 256) :
+ * ces inputs anciens sont simplement omis.
+ *
+ * \param {const RCNET_ClientInput*} inputs - Inputs, du plus récent au plus ancien (clientId ignoré).
+ * \param {uint32_t} count - Nombre d'inputs (1 à RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS).
+ * \param {void*} outBuffer - Buffer de sortie.
+ * \param {size_t} outCapacity - Capacité (RCNET_CLIENT_INPUT_BATCH_MAX_PACKET_SIZE suffit toujours).
+ * \return {size_t} Nombre d'octets écrits, 0 si count invalide ou buffer trop petit.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_codec_encode_client_input_batch(const RCNET_ClientInput* inputs, uint32_t count, void* outBuffer, size_t outCapacity);
+
+/**
+ * \brief Décode un packet d'inputs groupés.
+ *
+ * \param {const void*} bytes - Données brutes du packet.
+ * \param {size_t} size - Taille des données.
+ * \param {uint32_t} clientId - Id du client émetteur (déduit du peer côté serveur).
+ * \param {RCNET_ClientInput*} outInputs - Inputs décodés, du plus récent au plus ancien
+ *                                          (RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS places).
+ * \return {uint32_t} Nombre d'inputs décodés, 0 si version/type/taille invalide.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_codec_decode_client_input_batch(const void* bytes, size_t size, uint32_t clientId, RCNET_ClientInput* outInputs);
+
+/**
+ * \brief Ecrit l'en-tête complet d'un snapshot dans un writer.
+ *
+ * Le payload (état du monde) peut ensuite être écrit à la suite dans le même writer.
+ *
+ * \param {RCNET_PacketWriter*} writer - Writer cible.
+ * \param {const RCNET_SnapshotHeader*} header - En-tête à écrire.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_codec_write_snapshot_header(RCNET_PacketWriter* writer, const RCNET_SnapshotHeader* header);
+
+/**
+ * \brief Lit l'en-tête d'un snapshot depuis un reader.
+ *
+ * Après l'appel, le reader est positionné au début du payload.
+ *
+ * \param {RCNET_PacketReader*} reader - Reader positionné au début du packet.
+ * \param {RCNET_SnapshotHeader*} outHeader - En-tête décodé.
+ * \return {bool} true si OK, false si version/type/taille invalide.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_codec_read_snapshot_header(RCNET_PacketReader* reader, RCNET_SnapshotHeader* outHeader);
+
+/**
+ * \brief Encode un ack de snapshot (client -> serveur).
+ *
+ * \param {uint64_t} snapshotTick - Tick (serverTick) du snapshot décodé.
+ * \param {void*} outBuffer - Buffer de sortie.
+ * \param {size_t} outCapacity - Capacité du buffer (au moins RCNET_SNAPSHOT_ACK_PACKET_SIZE).
+ * \return {size_t} Nombre d'octets écrits, 0 si le buffer est trop petit.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_codec_encode_snapshot_ack(uint64_t snapshotTick, void* outBuffer, size_t outCapacity);
+
+/**
+ * \brief Décode un ack de snapshot.
+ *
+ * \param {const void*} bytes - Données brutes du packet.
+ * \param {size_t} size - Taille des données.
+ * \param {uint64_t*} outSnapshotTick - Tick acké.
+ * \return {bool} true si OK, false si version/type/taille invalide.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_codec_decode_snapshot_ack(const void* bytes, size_t size, uint64_t* outSnapshotTick);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_CODEC_H
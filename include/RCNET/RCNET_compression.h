@@ -0,0 +1,229 @@
+#ifndef RCNET_COMPRESSION_H
+#define RCNET_COMPRESSION_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint8_t, uint32_t, uint64_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Nombre maximum de channels ENet configurables dans un RCNET_CompressionConfig.
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_COMPRESSION_MAX_CHANNELS 8
+
+/**
+ * \brief Taille de l'en-tête ajouté par l'étape de compression.
+ *
+ * [marker u8] pour un packet non compressé, [marker u8][originalSize u32] pour un packet compressé.
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_COMPRESSION_RAW_HEADER_SIZE 1
+#define RCNET_COMPRESSION_LZ4_HEADER_SIZE 5
+
+/**
+ * \brief Mode de compression d'un channel.
+ *
+ * \since Cette enum est disponible depuis RCNET 1.1.0.
+ */
+typedef enum RCNET_CompressionMode {
+    /**
+     * Pas d'étape de compression sur ce channel (packets envoyés tels quels, sans en-tête).
+     */
+    RCNET_COMPRESSION_MODE_NONE = 0,
+
+    /**
+     * Chaque packet est compressé indépendamment (LZ4 bloc).
+     * Compatible avec les channels unreliable / unsequenced (pertes, réordonnancement).
+     */
+    RCNET_COMPRESSION_MODE_BLOCK,
+
+    /**
+     * Les packets sont compressés en stream par peer (LZ4_compress_fast_continue) :
+     * les 64 Ko précédents servent de dictionnaire, la structure répétée des packets se compresse très bien.
+     * Uniquement pour les channels reliable (ENet garantit l'ordre et la livraison de chaque packet).
+     */
+    RCNET_COMPRESSION_MODE_STREAM
+} RCNET_CompressionMode;
+
+/**
+ * \brief Configuration de l'étape de compression (identique des deux côtés de la connexion).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_CompressionConfig {
+    uint32_t channelCount;                                           // channels configurés (<= RCNET_COMPRESSION_MAX_CHANNELS)
+    RCNET_CompressionMode channelModes[RCNET_COMPRESSION_MAX_CHANNELS];
+    size_t minCompressSize;                                          // en dessous : envoyé brut (ex: 128, inputs ignorés)
+    size_t maxPacketSize;                                            // taille max d'un packet non compressé (ex: 64 * 1024)
+    int acceleration;                                                // LZ4 acceleration (1 = meilleur ratio, plus = plus rapide)
+} RCNET_CompressionConfig;
+
+/**
+ * \brief Compteurs d'un RCNET_Compressor (un par peer : ratio et coût CPU par peer).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_CompressionStats {
+    uint64_t packetsCompressed;    // packets envoyés compressés
+    uint64_t packetsSkipped;       // packets envoyés bruts (sous le seuil ou incompressibles)
+    uint64_t inputBytes;           // octets avant compression (tous packets passés par l'étape)
+    uint64_t outputBytes;          // octets après compression (en-têtes compris)
+    uint64_t compressTimeNs;       // temps CPU passé à compresser
+    uint64_t packetsDecompressed;
+    uint64_t decompressFailures;   // packet invalide / stream désynchronisé
+    uint64_t decompressTimeNs;     // temps CPU passé à décompresser
+} RCNET_CompressionStats;
+
+/**
+ * \brief Etat de compression d'un peer (encodeur + décodeur de chaque channel).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_Compressor RCNET_Compressor;
+
+/**
+ * \brief Remplit une configuration avec les valeurs par défaut (tous les channels en NONE).
+ *
+ * minCompressSize 128, maxPacketSize 64 Ko, acceleration 1.
+ *
+ * \param {RCNET_CompressionConfig*} outConfig - Configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_compression_get_default_config(RCNET_CompressionConfig* outConfig);
+
+/**
+ * \brief Crée l'état de compression d'un peer.
+ *
+ * \param {const RCNET_CompressionConfig*} config - Configuration (copiée).
+ * \return {RCNET_Compressor*} Le compresseur, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_Compressor* rcnet_compressor_create(const RCNET_CompressionConfig* config);
+
+/**
+ * \brief Détruit un compresseur.
+ *
+ * \param {RCNET_Compressor*} compressor - Le compresseur (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_compressor_destroy(RCNET_Compressor* compressor);
+
+/**
+ * \brief Remet les streams à zéro (nouvelle connexion) et les compteurs à 0.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_compressor_reset(RCNET_Compressor* compressor);
+
+/**
+ * \brief Indique si l'étape de compression est active sur un channel.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_compressor_is_channel_enabled(const RCNET_Compressor* compressor, uint8_t channelId);
+
+/**
+ * \brief Taille de buffer suffisante pour rcnet_compressor_compress() d'un packet de inputSize octets.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_compression_get_max_output_size(size_t inputSize);
+
+/**
+ * \brief Passe un packet sortant dans l'étape de compression d'un channel actif.
+ *
+ * \param {RCNET_Compressor*} compressor - Compresseur du peer destinataire.
+ * \param {uint8_t} channelId - Channel ENet (doit être actif).
+ * \param {const void*} input - Packet à envoyer.
+ * \param {size_t} inputSize - Taille (<= maxPacketSize).
+ * \param {void*} output - Buffer de sortie (rcnet_compression_get_max_output_size(inputSize) octets).
+ * \param {size_t} outputCapacity - Capacité du buffer.
+ * \return {size_t} Taille à envoyer, 0 en cas d'erreur.
+ *
+ * \threadsafety Un seul thread à la fois par compresseur pour l'envoi (l'envoi et la réception sont indépendants).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_compressor_compress(RCNET_Compressor* compressor, uint8_t channelId, const void* input, size_t inputSize, void* output, size_t outputCapacity);
+
+/**
+ * \brief Inverse de rcnet_compressor_compress() pour un packet reçu sur un channel actif.
+ *
+ * \param {RCNET_Compressor*} compressor - Compresseur du peer émetteur.
+ * \param {uint8_t} channelId - Channel ENet.
+ * \param {const void*} input - Packet reçu.
+ * \param {size_t} inputSize - Taille reçue.
+ * \param {void*} output - Buffer de sortie (maxPacketSize octets suffisent).
+ * \param {size_t} outputCapacity - Capacité du buffer.
+ * \return {size_t} Taille du packet d'origine, 0 si packet invalide.
+ *
+ * \threadsafety Un seul thread à la fois par compresseur pour la réception.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_compressor_decompress(RCNET_Compressor* compressor, uint8_t channelId, const void* input, size_t inputSize, void* output, size_t outputCapacity);
+
+/**
+ * \brief Récupère les compteurs du compresseur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_compressor_get_stats(const RCNET_Compressor* compressor, RCNET_CompressionStats* outStats);
+
+/**
+ * \brief Compresse un buffer indépendant (même format qu'un packet RCNET_COMPRESSION_MODE_BLOCK).
+ *
+ * Sans état : utilisable pour les payloads NATS (voir rcnet_nats_publish_compressed()).
+ * Les buffers de moins de minCompressSize octets, ou incompressibles, sont écrits bruts.
+ *
+ * \param {const void*} input - Données.
+ * \param {size_t} inputSize - Taille.
+ * \param {void*} output - Buffer de sortie (rcnet_compression_get_max_output_size(inputSize) octets).
+ * \param {size_t} outputCapacity - Capacité du buffer.
+ * \param {size_t} minCompressSize - Seuil de compression.
+ * \param {int} acceleration - LZ4 acceleration.
+ * \return {size_t} Taille écrite, 0 en cas d'erreur.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_compression_compress_block(const void* input, size_t inputSize, void* output, size_t outputCapacity, size_t minCompressSize, int acceleration);
+
+/**
+ * \brief Taille d'origine d'un buffer produit par rcnet_compression_compress_block(), 0 si invalide.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_compression_get_block_original_size(const void* input, size_t inputSize);
+
+/**
+ * \brief Inverse de rcnet_compression_compress_block().
+ *
+ * \param {const void*} input - Données compressées.
+ * \param {size_t} inputSize - Taille.
+ * \param {void*} output - Buffer de sortie (rcnet_compression_get_block_original_size() octets).
+ * \param {size_t} outputCapacity - Capacité du buffer.
+ * \return {size_t} Taille d'origine, 0 si invalide.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_compression_decompress_block(const void* input, size_t inputSize, void* output, size_t outputCapacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_COMPRESSION_H
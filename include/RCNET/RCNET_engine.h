@@ -3,6 +3,13 @@
 
 // Standard C/C++ Libraries
 #include <stdbool.h> // bool
+#include <stdint.h>  // uint32_t
+
+#include <RCNET/RCNET_histogram.h>   // RCNET_HistogramSummary
+#include <RCNET/RCNET_net_shards.h>  // RCNET_NetShards, RCNET_NetPeerStats
+#include <RCNET/RCNET_subsystem.h>   // RCNET_SUBSYSTEM_FLAG_*
+#include <RCNET/RCNET_timer.h>       // RCNET_TimerBackend
+#include <RCNET/RCNET_worker_pool.h> // RCNET_ParallelForFn, RCNET_Arena
 
 #ifdef __cplusplus
 extern "C" {
@@ -38,6 +45,27 @@ typedef struct RCNET_Callbacks {
     void (*rcnet_network_update)(void);
 } RCNET_Callbacks;
 
+/**
+ * \brief Répartition des ticks sur les threads du moteur.
+ *
+ * \since Cette enum est disponible depuis RCNET 1.1.0.
+ */
+typedef enum RCNET_EngineThreadingMode {
+    /**
+     * Mode par défaut : ticks simulation et réseau entrelacés sur le thread de rcnet_engine_run.
+     */
+    RCNET_ENGINE_THREADING_SINGLE = 0,
+
+    /**
+     * Simulation sur le thread de rcnet_engine_run, réseau sur un thread dédié, chacun avec son
+     * propre ordonnanceur à fréquence fixe : un rcnet_network_update lent ne retarde plus la simulation.
+     * rcnet_load / rcnet_unload restent appelés sur le thread de rcnet_engine_run.
+     * L'état lu par rcnet_network_update doit être transmis par la simulation via un RCNET_TripleBuffer
+     * (ou des atomics), jamais lu directement.
+     */
+    RCNET_ENGINE_THREADING_SPLIT
+} RCNET_EngineThreadingMode;
+
 /**
  * \brief Démarre le moteur RCNET.
  *
@@ -49,11 +77,226 @@ typedef struct RCNET_Callbacks {
  */
 bool rcnet_engine_run(RCNET_Callbacks* callbacks, int simTickRateHz, int netTickRateHz);
 
+/**
+ * \brief Dépendances initialisées par rcnet_engine_run en plus de celles des modules (à appeler avant).
+ *
+ * Par défaut aucune : RCNET_NetShards acquiert RCENet, le client Redis TLS acquiert OpenSSL, etc.
+ * A utiliser si les callbacks appellent directement ENet, OpenSSL ou libsodium.
+ *
+ * \param flags  Combinaison de RCNET_SUBSYSTEM_FLAG_* (voir RCNET_subsystem.h).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_engine_set_subsystems(uint32_t flags);
+
+/**
+ * \brief Prépare le prochain rcnet_engine_run (serveur pré-initialisé en attente d'un match).
+ *
+ * Initialise à l'avance les dépendances de rcnet_engine_set_subsystems, le pool de workers, le
+ * profiler et les timers : rcnet_engine_run ne paie plus que rcnet_load avant le premier tick.
+ * A appeler après les rcnet_engine_set_* et avant rcnet_engine_run, sur le même thread.
+ * Les modules créés ensuite dans rcnet_load (RCNET_NetShards, ...) peuvent aussi être pré-initialisés
+ * en acquérant leurs sous-systèmes (rcnet_subsystem_acquire) pendant l'attente.
+ *
+ * Les dépendances restent initialisées jusqu'à la fin du processus ; le pool de workers est détruit à la
+ * fin de chaque rcnet_engine_run, à rappeler donc avant chaque run à préparer.
+ *
+ * \return true si tout est prêt, false sinon (rcnet_engine_run refera alors l'init).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_engine_prewarm(void);
+
 /**
  * \brief Stop le serveur (thread-safe).
  */
 void rcnet_engine_eventQuit(void);
 
+/**
+ * \brief Choisit la répartition des ticks sur les threads (à appeler avant rcnet_engine_run).
+ *
+ * \param mode  RCNET_ENGINE_THREADING_SINGLE (défaut) ou RCNET_ENGINE_THREADING_SPLIT.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_engine_set_threading_mode(RCNET_EngineThreadingMode mode);
+
+/**
+ * \brief Choisit le backend de timer des boucles du moteur (à appeler avant le premier rcnet_engine_run).
+ *
+ * \param backend  RCNET_TIMER_BACKEND_AUTO (défaut), PORTABLE ou PLATFORM (voir RCNET_timer.h).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_engine_set_timer_backend(RCNET_TimerBackend backend);
+
+/**
+ * \brief Met le moteur en idle (ex: plus aucun client connecté) ou le relance.
+ *
+ * En idle, les ticks simulation et réseau sont suspendus et les boucles dorment sans consommer de CPU
+ * jusqu'à rcnet_engine_wake() ou rcnet_engine_set_idle(false). A la reprise, le temps passé en idle
+ * n'est pas rattrapé (pas de rafale de ticks).
+ *
+ * \param idle  true pour suspendre les ticks, false pour les relancer.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_engine_set_idle(bool idle);
+
+/**
+ * \brief Signale une activité (ex: packet reçu) : sort le moteur de l'idle et réveille ses boucles.
+ *
+ * Sans effet (et sans appel système) si le moteur n'est pas en idle.
+ * Appelée automatiquement par RCNET_NetShards si wakeEngineOnActivity est activé.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_engine_wake(void);
+
+/**
+ * \brief Nombre de threads workers du moteur (à appeler avant rcnet_engine_run).
+ *
+ * \param threadCount  Threads en plus du thread moteur (0 = tout en série, < 0 = auto : coeurs - 1, max 8).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_engine_set_worker_threads(int threadCount);
+
+/**
+ * \brief Exécute fn(index, workerIndex, userdata) pour index dans [0, count) sur le pool de workers du moteur.
+ *
+ * Typiquement depuis rcnet_network_update : un job d'encodage de snapshot par client connecté,
+ * l'envoi ENet restant fait en série après le parallel_for.
+ * Bloque jusqu'à la fin de tous les jobs. Hors rcnet_engine_run, exécute tout en série (workerIndex = 0).
+ * En mode RCNET_ENGINE_THREADING_SPLIT, le pool appartient au thread réseau : appelée depuis
+ * la simulation, la fonction exécute tout en série (workerIndex = 0, sans arena de worker).
+ *
+ * \param count     Nombre de jobs.
+ * \param fn        Fonction exécutée pour chaque index.
+ * \param userdata  Donnée utilisateur.
+ *
+ * \threadsafety A appeler depuis les callbacks du moteur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_engine_parallel_for(uint32_t count, RCNET_ParallelForFn fn, void* userdata);
+
+/**
+ * \brief Nombre de workers du moteur (threads workers + thread moteur), 1 hors rcnet_engine_run.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_engine_get_worker_count(void);
+
+/**
+ * \brief Arena de scratch d'un worker du moteur, reset au début de chaque tick réseau.
+ *
+ * \param workerIndex  Index reçu par RCNET_ParallelForFn.
+ * \return L'arena, ou NULL si hors rcnet_engine_run / index invalide / appelée depuis la simulation
+ *         en mode RCNET_ENGINE_THREADING_SPLIT (les arenas appartiennent au thread réseau).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_Arena* rcnet_engine_get_worker_arena(uint32_t workerIndex);
+
+/**
+ * \brief Statistiques de la boucle du moteur (durées en nanosecondes).
+ *
+ * Les histogrammes couvrent tous les ticks depuis le démarrage (ou le dernier rcnet_engine_reset_stats).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_EngineStats {
+    uint64_t simTickCount;
+    uint64_t netTickCount;
+
+    // Ticks de rattrapage : ticks exécutés en plus du premier dans une même itération de boucle
+    uint64_t simCatchUpTicks;
+    uint64_t netCatchUpTicks;
+
+    // kMaxCatchUpTicks atteint : nombre d'événements et temps de backlog abandonné
+    uint64_t simBacklogDrops;
+    uint64_t netBacklogDrops;
+    uint64_t simBacklogDroppedNs;
+    uint64_t netBacklogDroppedNs;
+
+    RCNET_HistogramSummary simUpdateNs;      // durée de rcnet_simulation_update
+    RCNET_HistogramSummary netUpdateNs;      // durée de rcnet_network_update (reset des arenas compris)
+    RCNET_HistogramSummary simTicksPerLoop;  // ticks simulation par itération (quand > 0)
+    RCNET_HistogramSummary sleepOvershootNs; // réveil - échéance visée (oversleep)
+    RCNET_HistogramSummary sleepSpinNs;      // temps passé en spin avant l'échéance (sleep trop court)
+
+    RCNET_TimerBackend timerBackend;         // backend effectivement utilisé (PORTABLE ou PLATFORM)
+    uint64_t spinMarginNs;                   // marge de spin apprise (boucle simulation)
+    uint64_t idleWakeups;                    // sorties d'idle sur activité
+
+    // Peers des RCNET_NetShards attachés (rcnet_engine_set_net_shards), 0 sinon
+    uint32_t peerCount;                      // clients connectés
+    uint32_t congestedPeerCount;             // clients congestionnés au dernier échantillon
+    uint32_t peerRttAvgMs;
+    uint32_t peerRttMaxMs;
+    uint64_t peerSentBytesPerSecond;         // somme sur tous les clients
+    uint64_t peerEstimatedBytesPerSecond;    // somme du débit livré estimé
+
+    // Dernier démarrage de rcnet_engine_run (conservés par rcnet_engine_reset_stats)
+    uint64_t startupInitNs;                  // dépendances, pool, profiler, timers (~0 après rcnet_engine_prewarm)
+    uint64_t startupLoadNs;                  // durée de rcnet_load
+} RCNET_EngineStats;
+
+/**
+ * \brief Récupère les statistiques de la boucle du moteur.
+ *
+ * Les statistiques restent lisibles après la fin de rcnet_engine_run (dernier run).
+ *
+ * \param outStats  Statistiques (remplies à 0 si le moteur n'a jamais démarré).
+ * \return true si des statistiques sont disponibles, false sinon.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_engine_get_stats(RCNET_EngineStats* outStats);
+
+/**
+ * \brief Attache les shards réseau dont les peers sont agrégés dans RCNET_EngineStats.
+ *
+ * \param shards  Les shards (NULL pour détacher, obligatoire avant rcnet_net_shards_destroy).
+ *
+ * Au retour, plus aucun rcnet_engine_get_stats() / rcnet_engine_get_peer_stats() en cours n'utilise
+ * les shards précédemment attachés : ils peuvent être détruits.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_engine_set_net_shards(RCNET_NetShards* shards);
+
+/**
+ * \brief Etat réseau d'un client des shards attachés (RTT, perte, queue, débit, budget recommandé).
+ *
+ * \param clientId  Le client.
+ * \param outStats  Etat à remplir (tout à 0 si pas de shards attachés ou client déconnecté).
+ * \return true si le client est connecté.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_engine_get_peer_stats(uint32_t clientId, RCNET_NetPeerStats* outStats);
+
+/**
+ * \brief Remet les statistiques du moteur à zéro (ex: après le chargement, ou à chaque export).
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_engine_reset_stats(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,285 @@
+#ifndef RCNET_ENGINE_HOST_H
+#define RCNET_ENGINE_HOST_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint32_t, uint64_t
+
+#include <RCNET/RCNET_arena.h>     // RCNET_Arena
+#include <RCNET/RCNET_histogram.h> // RCNET_HistogramSummary
+#include <RCNET/RCNET_subsystem.h> // RCNET_SUBSYSTEM_FLAG_*
+#include <RCNET/RCNET_timer.h>     // RCNET_TimerBackend
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Plusieurs matchs indépendants dans un même process, sur un pool de threads partagé.
+ *
+ * Un RCNET_EngineHost possède un nombre fixe de threads workers et acquiert une seule fois les
+ * dépendances (RCNET_subsystem : OpenSSL, RCENet, libsodium). Chaque RCNET_Engine (un match) a ses propres callbacks,
+ * fréquences de ticks et userdata, et la même politique de boucle que rcnet_engine_run (rattrapage
+ * limité à 5 ticks, drop du backlog au-delà).
+ *
+ * Ordonnancement : chaque worker a sa file de matchs triée par échéance (prochain tick simulation ou
+ * réseau, la plus proche d'abord). Un worker sans match échu vole le match échu le plus en retard
+ * des autres files. Un match n'est jamais exécuté sur deux threads à la fois : ses callbacks n'ont
+ * pas besoin de verrou pour son propre état, mais ne doivent pas bloquer (ils retardent les autres
+ * matchs du même worker tant qu'aucun worker n'est libre pour voler).
+ *
+ * rcnet_engine_run reste l'API mono-match (boucle sur le thread appelant) et ne dépend pas de ce module.
+ *
+ * \since Ce module est disponible depuis RCNET 1.1.0.
+ */
+
+/**
+ * \brief Pool de threads qui exécute les ticks des matchs.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_EngineHost RCNET_EngineHost;
+
+/**
+ * \brief Un match (instance du moteur) exécuté par un RCNET_EngineHost.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_Engine RCNET_Engine;
+
+/**
+ * \brief Callbacks d'un match (mêmes rôles que RCNET_Callbacks, avec le match et sa userdata).
+ *
+ * Tous les callbacks d'un match sont appelés sur un worker du host, jamais en parallèle entre eux,
+ * mais pas forcément sur le même worker d'un appel à l'autre. rcnet_load est appelé avant le premier
+ * tick, rcnet_unload après le dernier.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_EngineCallbacks {
+    void (*rcnet_load)(RCNET_Engine* engine, void* userdata);
+    void (*rcnet_unload)(RCNET_Engine* engine, void* userdata);
+    void (*rcnet_simulation_update)(RCNET_Engine* engine, double dt, void* userdata);
+    void (*rcnet_network_update)(RCNET_Engine* engine, void* userdata);
+} RCNET_EngineCallbacks;
+
+/**
+ * \brief Configuration d'un host.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_EngineHostConfig {
+    uint32_t threadCount;            // threads workers (0 = un par coeur)
+    uint32_t maxEngines;             // matchs simultanés (files des workers pré-allouées)
+    uint32_t subsystems;             // RCNET_SUBSYSTEM_FLAG_* acquis pour tous les matchs (défaut : tous)
+    RCNET_TimerBackend timerBackend; // attente des workers entre deux échéances
+    size_t arenaBytesPerWorker;      // arena de scratch de chaque worker (grandit si besoin)
+} RCNET_EngineHostConfig;
+
+/**
+ * \brief Configuration d'un match.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_EngineConfig {
+    RCNET_EngineCallbacks callbacks;
+    void* userdata;                  // passée à chaque callback
+    int simTickRateHz;               // <= 0 : 60
+    int netTickRateHz;               // <= 0 : 20
+    const char* name;                // nom dans les logs (copié, tronqué à 31 caractères), NULL autorisé
+} RCNET_EngineConfig;
+
+/**
+ * \brief Statistiques d'un match (durées en nanosecondes).
+ *
+ * Le retard (lateness) est l'écart entre l'échéance d'un tick et le début de son exécution : il mesure
+ * la saturation du host, pas le coût du match.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_EngineInstanceStats {
+    uint64_t simTickId;
+    uint64_t netTickId;
+
+    uint64_t simCatchUpTicks;
+    uint64_t netCatchUpTicks;
+    uint64_t simBacklogDrops;
+    uint64_t netBacklogDrops;
+
+    uint64_t lateRuns;               // exécutions démarrées plus d'un tick simulation après l'échéance
+    uint64_t maxLatenessNs;
+    uint64_t migrations;             // exécutions volées par un autre worker
+
+    RCNET_HistogramSummary simUpdateNs;
+    RCNET_HistogramSummary netUpdateNs;
+} RCNET_EngineInstanceStats;
+
+/**
+ * \brief Statistiques d'un host.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_EngineHostStats {
+    uint32_t workerCount;
+    uint32_t engineCount;            // matchs créés et pas encore détruits
+
+    uint64_t runs;                   // exécutions de matchs (un ou plusieurs ticks chacune)
+    uint64_t steals;
+    uint64_t sleeps;                 // attentes des workers (aucun match échu)
+
+    RCNET_HistogramSummary latenessNs; // retard au démarrage de chaque exécution, tous matchs confondus
+} RCNET_EngineHostStats;
+
+/**
+ * \brief Configuration par défaut d'un host (un worker par coeur, 1024 matchs, tous les sous-systèmes, timer AUTO,
+ *        arenas de 256 Ko).
+ *
+ * \param {RCNET_EngineHostConfig*} outConfig - La configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_engine_host_get_default_config(RCNET_EngineHostConfig* outConfig);
+
+/**
+ * \brief Initialise les dépendances et démarre les workers.
+ *
+ * \param {const RCNET_EngineHostConfig*} config - La configuration (NULL = configuration par défaut).
+ * \return {RCNET_EngineHost*} Le host, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_EngineHost* rcnet_engine_host_create(const RCNET_EngineHostConfig* config);
+
+/**
+ * \brief Arrête les workers puis décharge (rcnet_unload, sur le thread appelant) et détruit les matchs restants.
+ *
+ * \param {RCNET_EngineHost*} host - Le host (NULL accepté).
+ *
+ * \threadsafety A appeler hors des workers du host, une fois les autres appels sur le host terminés.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_engine_host_destroy(RCNET_EngineHost* host);
+
+/**
+ * \brief Nombre de workers du host.
+ *
+ * \param {const RCNET_EngineHost*} host - Le host.
+ * \return {uint32_t} Le nombre de workers (0 si host est NULL).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_engine_host_get_worker_count(const RCNET_EngineHost* host);
+
+/**
+ * \brief Récupère les statistiques du host.
+ *
+ * \param {const RCNET_EngineHost*} host - Le host.
+ * \param {RCNET_EngineHostStats*} outStats - Statistiques à remplir.
+ * \return {bool} false si un paramètre est NULL.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_engine_host_get_stats(const RCNET_EngineHost* host, RCNET_EngineHostStats* outStats);
+
+/**
+ * \brief Configuration par défaut d'un match (60 Hz / 20 Hz, sans callbacks).
+ *
+ * \param {RCNET_EngineConfig*} outConfig - La configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_engine_get_default_config(RCNET_EngineConfig* outConfig);
+
+/**
+ * \brief Crée un match et le place sur le worker le moins chargé (rcnet_load y est appelé dès que possible).
+ *
+ * \param {RCNET_EngineHost*} host - Le host.
+ * \param {const RCNET_EngineConfig*} config - La configuration du match.
+ * \return {RCNET_Engine*} Le match, ou NULL en cas d'erreur.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread, y compris depuis les callbacks d'un autre match.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_Engine* rcnet_engine_create(RCNET_EngineHost* host, const RCNET_EngineConfig* config);
+
+/**
+ * \brief Demande l'arrêt d'un match (asynchrone) : rcnet_unload est appelé au plus tard à son prochain tick.
+ *
+ * \param {RCNET_Engine*} engine - Le match.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread, y compris depuis les callbacks du match.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_engine_stop(RCNET_Engine* engine);
+
+/**
+ * \brief Indique si un match est arrêté (rcnet_unload terminé).
+ *
+ * \param {const RCNET_Engine*} engine - Le match.
+ * \return {bool} true si le match ne sera plus exécuté.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_engine_is_stopped(const RCNET_Engine* engine);
+
+/**
+ * \brief Arrête un match, attend la fin de rcnet_unload, puis le libère.
+ *
+ * \param {RCNET_Engine*} engine - Le match (NULL accepté).
+ * \return {bool} true si le match est libéré au retour ; false si appelée depuis un worker du host
+ *         (pas d'attente : le match est libéré par son worker à la fin de rcnet_unload).
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread (y compris les callbacks du match), une seule fois.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_engine_destroy(RCNET_Engine* engine);
+
+/**
+ * \brief Userdata du match (RCNET_EngineConfig::userdata).
+ *
+ * \param {const RCNET_Engine*} engine - Le match.
+ * \return {void*} La userdata.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void* rcnet_engine_get_userdata(const RCNET_Engine* engine);
+
+/**
+ * \brief Arena de scratch du worker qui exécute le match, reset avant chaque tick réseau du match.
+ *
+ * \param {RCNET_Engine*} engine - Le match.
+ * \return {RCNET_Arena*} L'arena, valide jusqu'à la fin du callback courant (NULL hors des callbacks du match).
+ *
+ * \threadsafety A appeler depuis les callbacks du match.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_Arena* rcnet_engine_get_scratch_arena(RCNET_Engine* engine);
+
+/**
+ * \brief Récupère les statistiques d'un match.
+ *
+ * \param {const RCNET_Engine*} engine - Le match.
+ * \param {RCNET_EngineInstanceStats*} outStats - Statistiques à remplir.
+ * \return {bool} false si un paramètre est NULL.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_engine_get_instance_stats(const RCNET_Engine* engine, RCNET_EngineInstanceStats* outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_ENGINE_HOST_H
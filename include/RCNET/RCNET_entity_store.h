@@ -0,0 +1,350 @@
+#ifndef RCNET_ENTITY_STORE_H
+#define RCNET_ENTITY_STORE_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stdint.h>  // uint32_t, uint64_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Nombre maximum de colonnes d'un RCNET_EntityStore.
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_ENTITY_STORE_MAX_COLUMNS 16
+
+/**
+ * \brief Handle invalide (jamais retourné par rcnet_entity_store_create_entity()).
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_ENTITY_HANDLE_INVALID 0ull
+
+/**
+ * \brief Index retourné pour un handle périmé ou invalide.
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_ENTITY_NO_INDEX 0xFFFFFFFFu
+
+/**
+ * \brief Handle stable d'une entité : (génération << 32) | index.
+ *
+ * L'index est le slot de l'entité dans les colonnes (et son entityId pour les snapshots / l'interest).
+ * La génération est incrémentée à chaque destruction : un handle gardé après la destruction de son
+ * entité ne désigne jamais l'entité qui réutilise le slot.
+ *
+ * \since Ce type est disponible depuis RCNET 1.1.0.
+ */
+typedef uint64_t RCNET_EntityHandle;
+
+/**
+ * \brief Stockage des entités de la simulation en colonnes (SoA).
+ *
+ * - une colonne = un tableau contigu de maxEntities valeurs 32 bits (aligné sur 64 octets),
+ *   indexé par l'index de l'entité : une boucle sur une colonne est vectorisable par le compilateur
+ * - liste dense des entités vivantes (parcours sans trou)
+ * - un bitset "modifié" par colonne + un bitset "créée / détruite", remplis par les setters,
+ *   rcnet_entity_store_integrate() et rcnet_entity_store_mark_dirty() : les consommateurs
+ *   (historique de lag compensation, encodeur de snapshots...) ne traitent que les entités modifiées,
+ *   puis rcnet_entity_store_clear_dirty() en fin de tick
+ *
+ * Module optionnel : le moteur ne l'utilise pas, rcnet_simulation_update() reste libre de son modèle.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_EntityStore RCNET_EntityStore;
+
+/**
+ * \brief Type des valeurs d'une colonne (toujours 32 bits).
+ *
+ * \since Cette énumération est disponible depuis RCNET 1.1.0.
+ */
+typedef enum RCNET_EntityColumnType {
+    RCNET_ENTITY_COLUMN_FLOAT = 0,
+    RCNET_ENTITY_COLUMN_UINT32
+} RCNET_EntityColumnType;
+
+/**
+ * \brief Configuration d'un RCNET_EntityStore.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_EntityStoreConfig {
+    uint32_t maxEntities;    // index dans [0, maxEntities)
+    uint32_t columnCount;    // <= RCNET_ENTITY_STORE_MAX_COLUMNS
+    RCNET_EntityColumnType columnTypes[RCNET_ENTITY_STORE_MAX_COLUMNS];
+} RCNET_EntityStoreConfig;
+
+/**
+ * \brief Statistiques d'un RCNET_EntityStore.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_EntityStoreStats {
+    uint32_t aliveCount;
+    uint64_t created;
+    uint64_t destroyed;
+    uint64_t createFailures;   // store plein ou slot déjà occupé
+    uint64_t staleHandles;     // handle périmé passé à destroy_entity / get_index
+} RCNET_EntityStoreStats;
+
+/**
+ * \brief Configuration par défaut (aucune colonne).
+ *
+ * maxEntities vaut 0 : à renseigner, ainsi que les colonnes.
+ *
+ * \param {RCNET_EntityStoreConfig*} outConfig - Configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_entity_store_get_default_config(RCNET_EntityStoreConfig* outConfig);
+
+/**
+ * \brief Crée un store (colonnes, bitsets et liste dense sont alloués ici, toutes les valeurs à 0).
+ *
+ * \param {const RCNET_EntityStoreConfig*} config - Configuration.
+ * \return {RCNET_EntityStore*} Le store, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_EntityStore* rcnet_entity_store_create(const RCNET_EntityStoreConfig* config);
+
+/**
+ * \brief Détruit un store.
+ *
+ * \param {RCNET_EntityStore*} store - Le store (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_entity_store_destroy(RCNET_EntityStore* store);
+
+/**
+ * \brief Crée une entité dans un slot libre (toutes ses colonnes à 0).
+ *
+ * \param {RCNET_EntityStore*} store - Le store.
+ * \return {RCNET_EntityHandle} Le handle, ou RCNET_ENTITY_HANDLE_INVALID si le store est plein.
+ *
+ * \threadsafety Aucune fonction de ce module n'est thread-safe : un store appartient au thread de simulation.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_EntityHandle rcnet_entity_store_create_entity(RCNET_EntityStore* store);
+
+/**
+ * \brief Crée une entité dans un slot donné (ex: index = clientId pour l'entité d'un joueur).
+ *
+ * \param {RCNET_EntityStore*} store - Le store.
+ * \param {uint32_t} index - Le slot.
+ * \return {RCNET_EntityHandle} Le handle, ou RCNET_ENTITY_HANDLE_INVALID si le slot est hors bornes ou occupé.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_EntityHandle rcnet_entity_store_create_entity_at(RCNET_EntityStore* store, uint32_t index);
+
+/**
+ * \brief Détruit une entité (ses colonnes sont remises à 0, le handle devient périmé).
+ *
+ * \param {RCNET_EntityStore*} store - Le store.
+ * \param {RCNET_EntityHandle} handle - L'entité.
+ * \return {bool} false si le handle est périmé ou invalide.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_entity_store_destroy_entity(RCNET_EntityStore* store, RCNET_EntityHandle handle);
+
+/**
+ * \brief Index (slot) d'une entité.
+ *
+ * \param {RCNET_EntityStore*} store - Le store.
+ * \param {RCNET_EntityHandle} handle - L'entité.
+ * \return {uint32_t} L'index, ou RCNET_ENTITY_NO_INDEX si le handle est périmé ou invalide.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_entity_store_get_index(RCNET_EntityStore* store, RCNET_EntityHandle handle);
+
+/**
+ * \brief Handle de l'entité vivante d'un slot.
+ *
+ * \param {const RCNET_EntityStore*} store - Le store.
+ * \param {uint32_t} index - Le slot.
+ * \return {RCNET_EntityHandle} Le handle, ou RCNET_ENTITY_HANDLE_INVALID si le slot est libre.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_EntityHandle rcnet_entity_store_get_handle(const RCNET_EntityStore* store, uint32_t index);
+
+/**
+ * \brief Entités vivantes en liste dense (ordre non garanti, modifié par create / destroy).
+ *
+ * \param {const RCNET_EntityStore*} store - Le store.
+ * \param {uint32_t*} outCount - Nombre d'entités vivantes.
+ * \return {const uint32_t*} Leurs index.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+const uint32_t* rcnet_entity_store_get_dense(const RCNET_EntityStore* store, uint32_t* outCount);
+
+/**
+ * \brief Borne des boucles sur les colonnes : 1 + plus grand index utilisé depuis la création.
+ *
+ * Une boucle `for (i = 0; i < indexEnd; ++i)` sur une colonne passe aussi sur les slots libres
+ * (valeurs à 0), en échange d'un corps sans branche, vectorisable.
+ *
+ * \param {const RCNET_EntityStore*} store - Le store.
+ * \return {uint32_t} indexEnd.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_entity_store_get_index_end(const RCNET_EntityStore* store);
+
+/**
+ * \brief Colonne de floats (maxEntities valeurs, alignée sur 64 octets).
+ *
+ * Une écriture directe dans la colonne ne marque rien : appeler rcnet_entity_store_mark_dirty()
+ * si les consommateurs doivent la voir.
+ *
+ * \param {RCNET_EntityStore*} store - Le store.
+ * \param {uint32_t} column - La colonne.
+ * \return {float*} La colonne, ou NULL si elle n'existe pas ou n'est pas de type RCNET_ENTITY_COLUMN_FLOAT.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+float* rcnet_entity_store_get_float_column(RCNET_EntityStore* store, uint32_t column);
+
+/**
+ * \brief Colonne d'entiers 32 bits (voir rcnet_entity_store_get_float_column()).
+ *
+ * \param {RCNET_EntityStore*} store - Le store.
+ * \param {uint32_t} column - La colonne.
+ * \return {uint32_t*} La colonne, ou NULL si elle n'existe pas ou n'est pas de type RCNET_ENTITY_COLUMN_UINT32.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t* rcnet_entity_store_get_uint32_column(RCNET_EntityStore* store, uint32_t column);
+
+/**
+ * \brief Ecrit un float et marque la colonne modifiée pour cette entité si la valeur change.
+ *
+ * \param {RCNET_EntityStore*} store - Le store.
+ * \param {uint32_t} index - L'entité.
+ * \param {uint32_t} column - La colonne (type RCNET_ENTITY_COLUMN_FLOAT).
+ * \param {float} value - La valeur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_entity_store_set_float(RCNET_EntityStore* store, uint32_t index, uint32_t column, float value);
+
+/**
+ * \brief Ecrit un entier et marque la colonne modifiée pour cette entité si la valeur change.
+ *
+ * \param {RCNET_EntityStore*} store - Le store.
+ * \param {uint32_t} index - L'entité.
+ * \param {uint32_t} column - La colonne (type RCNET_ENTITY_COLUMN_UINT32).
+ * \param {uint32_t} value - La valeur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_entity_store_set_uint32(RCNET_EntityStore* store, uint32_t index, uint32_t column, uint32_t value);
+
+/**
+ * \brief Marque une colonne modifiée pour une entité (après une écriture directe).
+ *
+ * \param {RCNET_EntityStore*} store - Le store.
+ * \param {uint32_t} index - L'entité.
+ * \param {uint32_t} column - La colonne.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_entity_store_mark_dirty(RCNET_EntityStore* store, uint32_t index, uint32_t column);
+
+/**
+ * \brief Bitset "modifiée depuis le dernier clear" d'une colonne (bit i = entité i).
+ *
+ * \param {const RCNET_EntityStore*} store - Le store.
+ * \param {uint32_t} column - La colonne.
+ * \return {const uint64_t*} rcnet_entity_store_get_mask_words() mots, ou NULL si la colonne n'existe pas.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+const uint64_t* rcnet_entity_store_get_dirty_mask(const RCNET_EntityStore* store, uint32_t column);
+
+/**
+ * \brief Bitset "créée ou détruite depuis le dernier clear" (bit i = entité i).
+ *
+ * Une entité détruite puis recréée dans le même slot a son bit à 1 et est vivante.
+ *
+ * \param {const RCNET_EntityStore*} store - Le store.
+ * \return {const uint64_t*} rcnet_entity_store_get_mask_words() mots.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+const uint64_t* rcnet_entity_store_get_spawn_mask(const RCNET_EntityStore* store);
+
+/**
+ * \brief Bitset des entités vivantes (bit i = entité i).
+ *
+ * \param {const RCNET_EntityStore*} store - Le store.
+ * \return {const uint64_t*} rcnet_entity_store_get_mask_words() mots.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+const uint64_t* rcnet_entity_store_get_alive_mask(const RCNET_EntityStore* store);
+
+/**
+ * \brief Nombre de mots 64 bits des bitsets (maxEntities / 64 arrondi au supérieur).
+ *
+ * \param {const RCNET_EntityStore*} store - Le store.
+ * \return {uint32_t} Nombre de mots.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_entity_store_get_mask_words(const RCNET_EntityStore* store);
+
+/**
+ * \brief Remet à 0 tous les bitsets "modifiée" et "créée / détruite" (fin de tick, après les consommateurs).
+ *
+ * \param {RCNET_EntityStore*} store - Le store.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_entity_store_clear_dirty(RCNET_EntityStore* store);
+
+/**
+ * \brief position += velocity * dt, bornée à [minValue, maxValue], sur toutes les entités.
+ *
+ * Boucle vectorisée par blocs de 64 entités, qui marque la colonne position modifiée pour chaque
+ * entité dont la valeur change. Un slot libre a une vitesse nulle et n'est jamais marqué.
+ *
+ * \param {RCNET_EntityStore*} store - Le store.
+ * \param {uint32_t} positionColumn - Colonne position (float).
+ * \param {uint32_t} velocityColumn - Colonne vitesse (float).
+ * \param {float} dt - Pas de temps.
+ * \param {float} minValue - Borne basse.
+ * \param {float} maxValue - Borne haute.
+ * \return {uint32_t} Nombre d'entités dont la position a changé.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_entity_store_integrate(RCNET_EntityStore* store, uint32_t positionColumn, uint32_t velocityColumn, float dt,
+                                      float minValue, float maxValue);
+
+/**
+ * \brief Statistiques du store.
+ *
+ * \param {const RCNET_EntityStore*} store - Le store.
+ * \param {RCNET_EntityStoreStats*} outStats - Statistiques à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_entity_store_get_stats(const RCNET_EntityStore* store, RCNET_EntityStoreStats* outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_ENTITY_STORE_H
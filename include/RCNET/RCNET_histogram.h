@@ -0,0 +1,114 @@
+#ifndef RCNET_HISTOGRAM_H
+#define RCNET_HISTOGRAM_H
+
+// Standard C/C++ Libraries
+#include <stdint.h> // uint64_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Histogramme log-linéaire (style HDR) de valeurs uint64 (typiquement des durées en ns).
+ *
+ * Valeurs 0..31 exactes, au-delà 32 sous-buckets par puissance de 2 : erreur relative <= ~3 %.
+ * Taille fixe (~15 Ko), aucune allocation à l'enregistrement.
+ * Enregistrement et lecture lock-free : un thread peut enregistrer pendant qu'un autre lit les percentiles
+ * (la lecture est alors approximative de quelques échantillons, jamais incohérente).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_Histogram RCNET_Histogram;
+
+/**
+ * \brief Résumé d'un histogramme (valeurs dans l'unité enregistrée).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_HistogramSummary {
+    uint64_t count;
+    uint64_t min;
+    uint64_t max;
+    uint64_t mean;
+    uint64_t p50;
+    uint64_t p90;
+    uint64_t p99;
+    uint64_t p999;
+} RCNET_HistogramSummary;
+
+/**
+ * \brief Crée un histogramme vide.
+ *
+ * \return {RCNET_Histogram*} L'histogramme, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_Histogram* rcnet_histogram_create(void);
+
+/**
+ * \brief Détruit un histogramme.
+ *
+ * \param {RCNET_Histogram*} histogram - L'histogramme (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_histogram_destroy(RCNET_Histogram* histogram);
+
+/**
+ * \brief Enregistre une valeur.
+ *
+ * \param {RCNET_Histogram*} histogram - L'histogramme.
+ * \param {uint64_t} value - Valeur (ex: durée en ns).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_histogram_record(RCNET_Histogram* histogram, uint64_t value);
+
+/**
+ * \brief Remet l'histogramme à zéro.
+ *
+ * \threadsafety Les enregistrements concurrents pendant le reset peuvent être perdus.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_histogram_reset(RCNET_Histogram* histogram);
+
+/**
+ * \brief Nombre de valeurs enregistrées.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint64_t rcnet_histogram_get_count(const RCNET_Histogram* histogram);
+
+/**
+ * \brief Valeur au percentile demandé (borne haute du bucket, bornée par le max observé).
+ *
+ * \param {const RCNET_Histogram*} histogram - L'histogramme.
+ * \param {double} percentile - Percentile dans [0, 100] (ex: 99.9).
+ * \return {uint64_t} La valeur, 0 si l'histogramme est vide.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint64_t rcnet_histogram_get_percentile(const RCNET_Histogram* histogram, double percentile);
+
+/**
+ * \brief Calcule count / min / max / moyenne / p50 / p90 / p99 / p999 en un seul parcours.
+ *
+ * \param {const RCNET_Histogram*} histogram - L'histogramme.
+ * \param {RCNET_HistogramSummary*} outSummary - Résumé (tout à 0 si l'histogramme est vide ou NULL).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_histogram_get_summary(const RCNET_Histogram* histogram, RCNET_HistogramSummary* outSummary);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_HISTOGRAM_H
@@ -0,0 +1,167 @@
+#ifndef RCNET_INPUT_BUFFER_H
+#define RCNET_INPUT_BUFFER_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stdint.h>  // uint32_t, uint64_t
+
+#include <RCNET/RCNET_codec.h> // RCNET_ClientInput
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Buffer d'inputs planifiés par tick serveur ("tick-scheduled input buffer").
+ *
+ * Ring de windowTicks slots, chaque slot possède un tableau contigu préalloué de maxClients inputs
+ * et un index dense clientId -> position. Un client a donc au plus un input par tick.
+ *
+ * Toute la mémoire est allouée à la création : placer et consommer des inputs n'alloue jamais.
+ *
+ * Fenêtre valide : un input peut viser un tick T tel que lastTick < T <= lastTick + windowTicks,
+ * où lastTick est le dernier tick consommé via rcnet_input_buffer_take_tick().
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_InputBuffer RCNET_InputBuffer;
+
+/**
+ * \brief Résultat du placement d'un input dans un RCNET_InputBuffer.
+ *
+ * \since Cette enum est disponible depuis RCNET 1.1.0.
+ */
+typedef enum RCNET_InputBufferPlaceResult {
+    /**
+     * Premier input de ce client pour ce tick.
+     */
+    RCNET_INPUT_BUFFER_PLACED,
+
+    /**
+     * Remplace l'input déjà présent pour ce client/tick (clientInputSeq plus récent).
+     */
+    RCNET_INPUT_BUFFER_REPLACED,
+
+    /**
+     * Ignoré : un input avec un clientInputSeq égal ou plus récent est déjà présent.
+     */
+    RCNET_INPUT_BUFFER_DUPLICATE,
+
+    /**
+     * Rejeté : le tick cible a déjà été consommé.
+     */
+    RCNET_INPUT_BUFFER_LATE,
+
+    /**
+     * Rejeté : le tick cible est au-delà de la fenêtre (écraserait un slot vivant).
+     */
+    RCNET_INPUT_BUFFER_TOO_FAR,
+
+    /**
+     * Rejeté : clientId >= maxClients.
+     */
+    RCNET_INPUT_BUFFER_INVALID_CLIENT
+} RCNET_InputBufferPlaceResult;
+
+/**
+ * \brief Compteurs cumulés d'un RCNET_InputBuffer.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_InputBufferStats {
+    uint64_t placed;
+    uint64_t replaced;
+    uint64_t duplicates;
+    uint64_t late;
+    uint64_t tooFar;
+    uint64_t invalidClient;
+} RCNET_InputBufferStats;
+
+/**
+ * \brief Crée un buffer d'inputs planifiés.
+ *
+ * \param {uint32_t} windowTicks - Nombre de ticks futurs acceptés (ex: 256), arrondi à la puissance de 2 supérieure.
+ * \param {uint32_t} maxClients - Nombre maximum de clients (ex: kMaxServerClients).
+ * \return {RCNET_InputBuffer*} Le buffer, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_InputBuffer* rcnet_input_buffer_create(uint32_t windowTicks, uint32_t maxClients);
+
+/**
+ * \brief Détruit un buffer créé par rcnet_input_buffer_create().
+ *
+ * \param {RCNET_InputBuffer*} buffer - Le buffer (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_input_buffer_destroy(RCNET_InputBuffer* buffer);
+
+/**
+ * \brief Vide tous les slots et remet le dernier tick consommé à 0 (les compteurs sont conservés).
+ *
+ * \param {RCNET_InputBuffer*} buffer - Le buffer.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_input_buffer_reset(RCNET_InputBuffer* buffer);
+
+/**
+ * \brief Place un input pour un tick serveur cible.
+ *
+ * Politique de dédoublonnage : un seul input par client et par tick, le clientInputSeq
+ * le plus récent gagne (comparaison tolérante au wrap-around 32 bits).
+ *
+ * \param {RCNET_InputBuffer*} buffer - Le buffer.
+ * \param {uint64_t} targetTick - Tick serveur auquel l'input doit être appliqué.
+ * \param {const RCNET_ClientInput*} input - Input (copié).
+ * \return {RCNET_InputBufferPlaceResult} Le résultat du placement.
+ *
+ * \threadsafety Un seul thread (typiquement la simulation).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_InputBufferPlaceResult rcnet_input_buffer_place(RCNET_InputBuffer* buffer, uint64_t targetTick, const RCNET_ClientInput* input);
+
+/**
+ * \brief Consomme les inputs planifiés pour un tick.
+ *
+ * Retourne un tableau dense (parcours linéaire) des inputs de ce tick.
+ * Après l'appel, tout input visant un tick <= tick est rejeté (RCNET_INPUT_BUFFER_LATE).
+ *
+ * \param {RCNET_InputBuffer*} buffer - Le buffer.
+ * \param {uint64_t} tick - Tick serveur courant (strictement croissant d'un appel à l'autre).
+ * \param {uint32_t*} outCount - Nombre d'inputs retournés.
+ * \return {const RCNET_ClientInput*} Les inputs du tick. Valide jusqu'au prochain appel à rcnet_input_buffer_place().
+ *
+ * \threadsafety Un seul thread (typiquement la simulation).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+const RCNET_ClientInput* rcnet_input_buffer_take_tick(RCNET_InputBuffer* buffer, uint64_t tick, uint32_t* outCount);
+
+/**
+ * \brief Retourne le nombre de ticks de la fenêtre (puissance de 2).
+ *
+ * \param {const RCNET_InputBuffer*} buffer - Le buffer.
+ * \return {uint32_t} La taille de la fenêtre.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_input_buffer_get_window_ticks(const RCNET_InputBuffer* buffer);
+
+/**
+ * \brief Récupère les compteurs cumulés du buffer.
+ *
+ * \param {const RCNET_InputBuffer*} buffer - Le buffer.
+ * \param {RCNET_InputBufferStats*} outStats - Compteurs (sortie).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_input_buffer_get_stats(const RCNET_InputBuffer* buffer, RCNET_InputBufferStats* outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_INPUT_BUFFER_H
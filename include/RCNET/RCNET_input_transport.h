@@ -0,0 +1,248 @@
+#ifndef RCNET_INPUT_TRANSPORT_H
+#define RCNET_INPUT_TRANSPORT_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint32_t, uint64_t
+
+#include <RCNET/RCNET_codec.h> // RCNET_ClientInput, RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Côté client : garde les derniers inputs non ackés et les renvoie dans chaque packet.
+ *
+ * Chaque packet RCNET_PACKET_TYPE_CLIENT_INPUT_BATCH contient les redundancy derniers inputs dont
+ * le serveur n'a pas encore confirmé la réception (RCNET_SnapshotHeader::ackRecv) : un packet perdu
+ * est rattrapé par le suivant, sans channel reliable. Avec inputsPerPacket = 2, le client n'envoie
+ * qu'un packet toutes les deux frames (moitié moins de datagrammes et d'en-têtes UDP / ENet).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_InputSender RCNET_InputSender;
+
+/**
+ * \brief Configuration d'un RCNET_InputSender.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_InputSenderConfig {
+    uint32_t redundancy;       // inputs max par packet (1..RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS)
+    uint32_t inputsPerPacket;  // un packet tous les inputsPerPacket inputs (>= 1)
+} RCNET_InputSenderConfig;
+
+/**
+ * \brief Côté serveur : dédoublonne les inputs redondants et calcule leur tick serveur cible.
+ *
+ * Par client : dernier clientInputSeq reçu (seuls les inputs plus récents sont retournés) et écart
+ * entre ticks client et ticks serveur, fixé au premier input (tick courant + inputDelayTicks) puis
+ * conservé : les inputs d'un même packet gardent leur espacement. Si un input rattrapé par redondance
+ * arrive après son tick, l'écart augmente juste assez pour l'appliquer au tick suivant (le buffer
+ * s'adapte aux pertes) ; il est recalé vers le bas si l'avance dépasse inputDelayTicks + maxDriftTicks.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_InputReceiver RCNET_InputReceiver;
+
+/**
+ * \brief Configuration d'un RCNET_InputReceiver.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_InputReceiverConfig {
+    uint32_t maxClients;       // clientId dans [0, maxClients)
+    uint32_t inputsPerPacket;  // RCNET_InputSenderConfig::inputsPerPacket des clients (compteur recovered)
+    uint32_t inputDelayTicks;  // ticks serveur entre la réception et l'application d'un input
+    uint32_t maxDriftTicks;    // avance tolérée au-delà de inputDelayTicks avant recalage
+} RCNET_InputReceiverConfig;
+
+/**
+ * \brief Input décodé et son tick serveur cible (à passer à rcnet_input_buffer_place()).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_ScheduledInput {
+    uint64_t targetServerTick;
+    RCNET_ClientInput input;
+} RCNET_ScheduledInput;
+
+/**
+ * \brief Compteurs cumulés d'un RCNET_InputReceiver (tous clients).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_InputReceiverStats {
+    uint64_t packets;          // packets décodés
+    uint64_t invalidPackets;   // packets rejetés (version, type, taille, clientId)
+    uint64_t inputs;           // inputs décodés (redondants compris)
+    uint64_t accepted;         // inputs nouveaux retournés
+    uint64_t redundant;        // inputs déjà reçus (ignorés)
+    uint64_t recovered;        // inputs nouveaux au-delà de inputsPerPacket par packet (packet précédent perdu)
+    uint64_t late;             // packets dont un input nouveau visait un tick passé (écart décalé vers l'avant)
+    uint64_t resyncs;          // recalages vers le bas de l'écart tick client / tick serveur
+} RCNET_InputReceiverStats;
+
+/**
+ * \brief Configuration par défaut (8 inputs par packet, un packet toutes les 2 frames).
+ *
+ * \param {RCNET_InputSenderConfig*} outConfig - Configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_input_sender_get_default_config(RCNET_InputSenderConfig* outConfig);
+
+/**
+ * \brief Crée un sender d'inputs.
+ *
+ * \param {const RCNET_InputSenderConfig*} config - Configuration (NULL pour la configuration par défaut).
+ * \return {RCNET_InputSender*} Le sender, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_InputSender* rcnet_input_sender_create(const RCNET_InputSenderConfig* config);
+
+/**
+ * \brief Détruit un sender.
+ *
+ * \param {RCNET_InputSender*} sender - Le sender (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_input_sender_destroy(RCNET_InputSender* sender);
+
+/**
+ * \brief Oublie tous les inputs (nouvelle connexion).
+ *
+ * \param {RCNET_InputSender*} sender - Le sender.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_input_sender_reset(RCNET_InputSender* sender);
+
+/**
+ * \brief Ajoute l'input d'une frame (clientInputSeq croissant d'une frame à l'autre).
+ *
+ * \param {RCNET_InputSender*} sender - Le sender.
+ * \param {const RCNET_ClientInput*} input - Input (copié).
+ * \return {bool} true si un packet doit être envoyé maintenant (rcnet_input_sender_encode()).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_input_sender_add(RCNET_InputSender* sender, const RCNET_ClientInput* input);
+
+/**
+ * \brief Encode un packet avec les derniers inputs non ackés (au moins le plus récent).
+ *
+ * \param {RCNET_InputSender*} sender - Le sender.
+ * \param {void*} outBuffer - Buffer de sortie.
+ * \param {size_t} outCapacity - Capacité (RCNET_CLIENT_INPUT_BATCH_MAX_PACKET_SIZE suffit toujours).
+ * \return {size_t} Nombre d'octets écrits, 0 si aucun input ou buffer trop petit.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_input_sender_encode(RCNET_InputSender* sender, void* outBuffer, size_t outCapacity);
+
+/**
+ * \brief Confirme la réception par le serveur des inputs jusqu'à ackedSeq (RCNET_SnapshotHeader::ackRecv).
+ *
+ * Les inputs ackés ne sont plus renvoyés.
+ *
+ * \param {RCNET_InputSender*} sender - Le sender.
+ * \param {uint32_t} ackedSeq - Dernier clientInputSeq reçu par le serveur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_input_sender_ack(RCNET_InputSender* sender, uint32_t ackedSeq);
+
+/**
+ * \brief Configuration par défaut (2 inputs par packet, délai de 2 ticks, 8 ticks de dérive).
+ *
+ * maxClients vaut 0 : à renseigner.
+ *
+ * \param {RCNET_InputReceiverConfig*} outConfig - Configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_input_receiver_get_default_config(RCNET_InputReceiverConfig* outConfig);
+
+/**
+ * \brief Crée un receiver d'inputs (toute la mémoire est allouée ici).
+ *
+ * \param {const RCNET_InputReceiverConfig*} config - Configuration.
+ * \return {RCNET_InputReceiver*} Le receiver, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_InputReceiver* rcnet_input_receiver_create(const RCNET_InputReceiverConfig* config);
+
+/**
+ * \brief Détruit un receiver.
+ *
+ * \param {RCNET_InputReceiver*} receiver - Le receiver (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_input_receiver_destroy(RCNET_InputReceiver* receiver);
+
+/**
+ * \brief Oublie l'état d'un client (nouvelle connexion).
+ *
+ * \param {RCNET_InputReceiver*} receiver - Le receiver.
+ * \param {uint32_t} clientId - Le client.
+ *
+ * \threadsafety Depuis le thread qui reçoit les packets de ce client (ex: on_connect de son shard).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_input_receiver_reset_client(RCNET_InputReceiver* receiver, uint32_t clientId);
+
+/**
+ * \brief Décode un packet RCNET_PACKET_TYPE_CLIENT_INPUT_BATCH et retourne ses inputs nouveaux.
+ *
+ * \param {RCNET_InputReceiver*} receiver - Le receiver.
+ * \param {uint32_t} clientId - Client émetteur (déduit du peer).
+ * \param {const void*} bytes - Données du packet.
+ * \param {size_t} size - Taille des données.
+ * \param {uint64_t} currentServerTick - Tick serveur courant.
+ * \param {RCNET_ScheduledInput*} outInputs - Inputs nouveaux, du plus ancien au plus récent
+ *                                            (RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS places).
+ * \return {uint32_t} Nombre d'inputs retournés (0 : packet invalide ou rien de nouveau).
+ *
+ * \threadsafety Plusieurs clients en parallèle (ex: un thread par shard), un seul thread par client.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_input_receiver_accept(RCNET_InputReceiver* receiver, uint32_t clientId, const void* bytes, size_t size,
+                                     uint64_t currentServerTick, RCNET_ScheduledInput* outInputs);
+
+/**
+ * \brief Dernier clientInputSeq reçu d'un client (0 si aucun).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_input_receiver_get_last_seq(const RCNET_InputReceiver* receiver, uint32_t clientId);
+
+/**
+ * \brief Récupère les compteurs cumulés du receiver.
+ *
+ * Chaque client a ses propres compteurs (écrits par le thread de son shard) : ils sont sommés ici, en O(maxClients).
+ *
+ * \param {const RCNET_InputReceiver*} receiver - Le receiver.
+ * \param {RCNET_InputReceiverStats*} outStats - Compteurs à remplir.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_input_receiver_get_stats(const RCNET_InputReceiver* receiver, RCNET_InputReceiverStats* outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_INPUT_TRANSPORT_H
@@ -0,0 +1,193 @@
+#ifndef RCNET_INTEREST_H
+#define RCNET_INTEREST_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint32_t, uint64_t
+
+#include <RCNET/RCNET_snapshot.h> // RCNET_SnapshotInterest
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Valeur de rcnet_interest_set_peer_entity() : le peer ne contrôle aucune entité.
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_INTEREST_NO_ENTITY 0xFFFFFFFFu
+
+/**
+ * \brief Interest management : quelles entités chaque peer doit recevoir, et dans quel ordre.
+ *
+ * - index spatial en grille uniforme, mis à jour incrémentalement (une entité ne change de liste
+ *   que quand elle change de cellule)
+ * - visibilité par peer avec hystérésis : une entité entre sous enterRadius et ne sort qu'au-delà
+ *   de exitRadius (pas de clignotement en bordure)
+ * - accumulateurs de priorité par peer et par entité : chaque tick sans envoi, l'entité gagne
+ *   priority * (plus proche = plus vite) ; l'envoi remet son accumulateur à 0. Avec le budget
+ *   d'octets de rcnet_snapshot_history_encode_interest(), les entités lointaines sont envoyées
+ *   moins souvent au lieu de faire déborder le snapshot.
+ *
+ * Le coût par peer (bande passante et CPU d'encodage) dépend donc de la densité locale, pas du
+ * nombre total d'entités.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_Interest RCNET_Interest;
+
+/**
+ * \brief Configuration d'un RCNET_Interest.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_InterestConfig {
+    uint32_t maxEntities;    // entityId dans [0, maxEntities) (même valeur que RCNET_SnapshotSchema::maxEntities)
+    uint32_t maxPeers;       // peerId dans [0, maxPeers) (ex: clientId)
+    float worldMinX;         // Bornes du monde (les positions hors bornes sont rangées dans les cellules du bord)
+    float worldMinY;
+    float worldMaxX;
+    float worldMaxY;
+    float cellSize;          // Taille d'une cellule (de l'ordre de enterRadius / 2)
+    float enterRadius;       // Distance sous laquelle une entité devient visible
+    float exitRadius;        // Distance au-delà de laquelle une entité visible ne l'est plus (>= enterRadius)
+    size_t peerByteBudget;   // Budget de payload par peer et par snapshot (0 : illimité)
+} RCNET_InterestConfig;
+
+/**
+ * \brief Configuration par défaut (monde [-512, 512]², cellules de 64, entrée 200 / sortie 240, budget 1200 octets).
+ *
+ * maxEntities et maxPeers valent 0 : à renseigner.
+ *
+ * \param {RCNET_InterestConfig*} outConfig - Configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_interest_get_default_config(RCNET_InterestConfig* outConfig);
+
+/**
+ * \brief Crée l'index spatial et l'état de chaque peer (toute la mémoire est allouée ici).
+ *
+ * \param {const RCNET_InterestConfig*} config - Configuration.
+ * \return {RCNET_Interest*} L'interest, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_Interest* rcnet_interest_create(const RCNET_InterestConfig* config);
+
+/**
+ * \brief Détruit un RCNET_Interest.
+ *
+ * \param {RCNET_Interest*} interest - L'interest (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_interest_destroy(RCNET_Interest* interest);
+
+/**
+ * \brief Ajoute ou déplace une entité.
+ *
+ * Une position hors du monde est ramenée dans la cellule du bord ; une position NaN est ignorée.
+ *
+ * \param {RCNET_Interest*} interest - L'interest.
+ * \param {uint32_t} entityId - L'entité.
+ * \param {float} x - Position X.
+ * \param {float} y - Position Y.
+ * \param {float} priority - Priorité gagnée par tick sans envoi (ex: 1.0, plus pour les joueurs).
+ *
+ * \threadsafety Pas en même temps que rcnet_interest_update_peer().
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_interest_set_entity(RCNET_Interest* interest, uint32_t entityId, float x, float y, float priority);
+
+/**
+ * \brief Retire une entité de l'index (elle sort de la visibilité de tous les peers au prochain update).
+ *
+ * \param {RCNET_Interest*} interest - L'interest.
+ * \param {uint32_t} entityId - L'entité (absente acceptée).
+ *
+ * \threadsafety Pas en même temps que rcnet_interest_update_peer().
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_interest_remove_entity(RCNET_Interest* interest, uint32_t entityId);
+
+/**
+ * \brief Entité contrôlée par le peer : toujours visible et toujours envoyée en premier.
+ *
+ * \param {RCNET_Interest*} interest - L'interest.
+ * \param {uint32_t} peerId - Le peer.
+ * \param {uint32_t} entityId - L'entité, ou RCNET_INTEREST_NO_ENTITY.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_interest_set_peer_entity(RCNET_Interest* interest, uint32_t peerId, uint32_t entityId);
+
+/**
+ * \brief Budget de payload d'un peer (remplace peerByteBudget, ex: selon son débit mesuré).
+ *
+ * \param {RCNET_Interest*} interest - L'interest.
+ * \param {uint32_t} peerId - Le peer.
+ * \param {size_t} maxPayloadBytes - Budget (0 : illimité).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_interest_set_peer_budget(RCNET_Interest* interest, uint32_t peerId, size_t maxPayloadBytes);
+
+/**
+ * \brief Oublie la visibilité et les accumulateurs d'un peer (nouvelle connexion).
+ *
+ * \param {RCNET_Interest*} interest - L'interest.
+ * \param {uint32_t} peerId - Le peer.
+ *
+ * \threadsafety Pas en même temps qu'un rcnet_interest_update_peer() sur ce peer.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_interest_reset_peer(RCNET_Interest* interest, uint32_t peerId);
+
+/**
+ * \brief Recalcule la visibilité d'un peer et sa liste de priorité pour le tick.
+ *
+ * outFilter pointe vers la mémoire du peer : valide jusqu'au prochain update de ce peer.
+ *
+ * \param {RCNET_Interest*} interest - L'interest.
+ * \param {uint32_t} peerId - Le peer.
+ * \param {float} viewerX - Position X du point de vue (ex: l'entité du joueur).
+ * \param {float} viewerY - Position Y du point de vue.
+ * \param {RCNET_SnapshotInterest*} outFilter - Filtre pour rcnet_snapshot_history_encode_interest().
+ *
+ * \threadsafety Plusieurs peers différents peuvent être mis à jour en parallèle (ex: un job par peer).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_interest_update_peer(RCNET_Interest* interest, uint32_t peerId, float viewerX, float viewerY, RCNET_SnapshotInterest* outFilter);
+
+/**
+ * \brief Remet à 0 les accumulateurs des entités envoyées (les writtenCount premières de la liste).
+ *
+ * \param {RCNET_Interest*} interest - L'interest.
+ * \param {uint32_t} peerId - Le peer.
+ * \param {uint32_t} writtenCount - outWrittenCount de rcnet_snapshot_history_encode_interest().
+ *
+ * \threadsafety Même règle que rcnet_interest_update_peer().
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_interest_commit_peer(RCNET_Interest* interest, uint32_t peerId, uint32_t writtenCount);
+
+/**
+ * \brief Nombre d'entités visibles par un peer (dernier update).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_interest_get_visible_count(const RCNET_Interest* interest, uint32_t peerId);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_INTEREST_H
@@ -3,6 +3,8 @@
 
 // Standard C/C++ Libraries
 #include <stdarg.h> // Required for : ... (va_list, va_start, va_end)
+#include <stdbool.h> // bool
+#include <stdint.h>  // uint32_t, uint64_t
 
 #include <SDL3/SDL_assert.h>
 
@@ -117,6 +119,69 @@ void rcnet_logger_set_priority(const RCNET_LogLevel logLevel);
  */
 void rcnet_logger_log(RCNET_LogLevel logLevel, const char* file, int line, const char* function, const char* format, ...);
 
+/**
+ * \brief Taille max d'un message (hors préfixe [niveau:fichier:ligne:fonction]), au-delà il est tronqué.
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_LOGGER_MAX_MESSAGE 1024
+
+/**
+ * \brief Configuration du mode de log asynchrone.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_LoggerAsyncConfig {
+    uint32_t ringCapacity;     // Messages en attente max par thread (arrondi à une puissance de 2, 65536 max)
+    uint32_t flushIntervalMs;  // Attente max du thread d'écriture quand les buffers sont vides
+} RCNET_LoggerAsyncConfig;
+
+/**
+ * \brief Configuration asynchrone par défaut (256 messages par thread, écriture toutes les 5 ms).
+ *
+ * \param {RCNET_LoggerAsyncConfig*} outConfig - Configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_logger_get_default_async_config(RCNET_LoggerAsyncConfig* outConfig);
+
+/**
+ * \brief Active le mode asynchrone : rcnet_logger_log() ne fait plus d'I/O.
+ *
+ * Chaque thread qui log écrit son message dans son propre ring buffer (sans verrou, une seule passe
+ * de formatage) ; un thread d'arrière-plan construit le préfixe et écrit les messages via SDL_LogMessage.
+ * Quand le ring buffer d'un thread est plein, le message est perdu et compté (rcnet_logger_get_dropped_count) :
+ * le thread appelant n'est jamais bloqué.
+ *
+ * \param {const RCNET_LoggerAsyncConfig*} config - Configuration (NULL pour la configuration par défaut).
+ * \return {bool} true si le mode asynchrone est actif.
+ *
+ * \threadsafety Ne pas appeler en même temps que rcnet_logger_stop_async().
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_logger_start_async(const RCNET_LoggerAsyncConfig* config);
+
+/**
+ * \brief Ecrit les messages en attente, arrête le thread d'écriture et revient au mode synchrone.
+ *
+ * \threadsafety Ne pas appeler en même temps que rcnet_logger_start_async().
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_logger_stop_async(void);
+
+/**
+ * \brief Nombre de messages perdus car le ring buffer de leur thread était plein (depuis le démarrage).
+ *
+ * \return {uint64_t} Le nombre de messages perdus.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint64_t rcnet_logger_get_dropped_count(void);
+
 #ifdef __cplusplus
 }
 #endif
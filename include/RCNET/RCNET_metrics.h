@@ -0,0 +1,337 @@
+#ifndef RCNET_METRICS_H
+#define RCNET_METRICS_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint16_t, uint32_t, int64_t, uint64_t
+
+#include <RCNET/RCNET_histogram.h> // RCNET_HistogramSummary
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Export des métriques runtime au format texte Prometheus / OpenMetrics (libwebsockets).
+ *
+ * Le serveur sert GET <path> depuis son propre thread (service libwebsockets). Rien n'est poussé par
+ * les boucles du moteur : à chaque scrape, le serveur appelle ses collectors, qui lisent les compteurs
+ * déjà tenus par les modules (rcnet_*_get_stats : atomics relaxed ou compteurs par thread), et somme
+ * ses compteurs par thread (RCNET_MetricsCounter). Un scrape n'ajoute donc aucune écriture partagée ni
+ * aucun verrou aux chemins chauds de la simulation et du réseau.
+ *
+ * Les échantillons d'une même métrique (même nom) sont regroupés dans la sortie, quel que soit le
+ * collector qui les écrit : plusieurs instances d'un même module s'exportent avec des labels distincts
+ * (ex: pool="snapshots").
+ *
+ * \since Ce module est disponible depuis RCNET 1.1.0.
+ */
+
+/**
+ * \brief Serveur de métriques (registre des collectors / compteurs + endpoint HTTP).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_MetricsServer RCNET_MetricsServer;
+
+/**
+ * \brief Sortie d'un scrape en cours, passée aux collectors.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_MetricsWriter RCNET_MetricsWriter;
+
+/**
+ * \brief Compteur par thread : chaque thread écrit dans son propre slot (cache line), la somme n'est
+ *        calculée qu'à la lecture.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_MetricsCounter RCNET_MetricsCounter;
+
+/**
+ * \brief Type d'une métrique (ligne # TYPE).
+ *
+ * \since Cette énumération est disponible depuis RCNET 1.1.0.
+ */
+typedef enum RCNET_MetricType {
+    /**
+     * Valeur cumulée, ne décroît jamais (nom suffixé par _total).
+     */
+    RCNET_METRIC_COUNTER,
+
+    /**
+     * Valeur instantanée.
+     */
+    RCNET_METRIC_GAUGE,
+
+    /**
+     * Quantiles + _sum + _count (rcnet_metrics_write_summary).
+     */
+    RCNET_METRIC_SUMMARY
+} RCNET_MetricType;
+
+/**
+ * \brief Collector appelé à chaque scrape, depuis le thread du serveur.
+ *
+ * Ne doit lire que des valeurs lisibles depuis n'importe quel thread.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef void (*RCNET_MetricsCollectFn)(RCNET_MetricsWriter* writer, void* userdata);
+
+/**
+ * \brief Configuration d'un serveur.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_MetricsServerConfig {
+    const char* bindAddress;  // adresse ou interface d'écoute (copiée), NULL = toutes
+    uint16_t port;            // port HTTP, 0 = pas d'endpoint (rcnet_metrics_server_render uniquement)
+    const char* path;         // chemin servi (copié), ex: "/metrics"
+} RCNET_MetricsServerConfig;
+
+/**
+ * \brief Compteurs d'un serveur (depuis sa création).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_MetricsServerStats {
+    uint64_t scrapes;                // rendus (requêtes HTTP + rcnet_metrics_server_render)
+    uint64_t notFound;               // requêtes HTTP hors path
+    uint64_t bytesSent;              // octets de métriques envoyés en HTTP
+    uint32_t collectors;
+    uint32_t counters;
+    RCNET_HistogramSummary renderNs; // durée d'un rendu (collectors compris)
+} RCNET_MetricsServerStats;
+
+/**
+ * \brief Configuration par défaut (toutes les interfaces, port 9464, "/metrics").
+ *
+ * \param {RCNET_MetricsServerConfig*} outConfig - Configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_metrics_server_get_default_config(RCNET_MetricsServerConfig* outConfig);
+
+/**
+ * \brief Crée le serveur et démarre son thread HTTP (si port != 0).
+ *
+ * Les logs de libwebsockets (erreurs et warnings) sont redirigés vers RCNET_log.
+ *
+ * \param {const RCNET_MetricsServerConfig*} config - Configuration (NULL pour la configuration par défaut).
+ * \return {RCNET_MetricsServer*} Le serveur, ou NULL en cas d'erreur (port déjà utilisé, ...).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_MetricsServer* rcnet_metrics_server_create(const RCNET_MetricsServerConfig* config);
+
+/**
+ * \brief Arrête le thread HTTP et détruit le serveur (les objets des collectors et compteurs enregistrés
+ *        ne sont pas détruits).
+ *
+ * \param {RCNET_MetricsServer*} server - Le serveur (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_metrics_server_destroy(RCNET_MetricsServer* server);
+
+/**
+ * \brief Ajoute un collector (ex: rcnet_metrics_collect_packet_pool avec le pool en userdata).
+ *
+ * \param {RCNET_MetricsServer*} server - Le serveur.
+ * \param {RCNET_MetricsCollectFn} collect - Le collector.
+ * \param {void*} userdata - Objet lu par le collector (doit rester valide jusqu'au retrait du collector).
+ * \param {const char*} labels - Labels ajoutés à tous ses échantillons (copiés), ex: "pool=\"snapshots\"", NULL accepté.
+ * \return {bool} false si un paramètre est invalide.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread (attend la fin d'un scrape en cours).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_metrics_server_add_collector(RCNET_MetricsServer* server, RCNET_MetricsCollectFn collect, void* userdata,
+                                        const char* labels);
+
+/**
+ * \brief Retire un collector (à appeler avant de détruire l'objet qu'il lit).
+ *
+ * \param {RCNET_MetricsServer*} server - Le serveur.
+ * \param {RCNET_MetricsCollectFn} collect - Le collector.
+ * \param {void*} userdata - Sa donnée.
+ * \return {bool} false si le collector n'est pas enregistré.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread : au retour, le collector n'est plus appelé.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_metrics_server_remove_collector(RCNET_MetricsServer* server, RCNET_MetricsCollectFn collect, void* userdata);
+
+/**
+ * \brief Exporte un compteur par thread sous le nom donné.
+ *
+ * \param {RCNET_MetricsServer*} server - Le serveur.
+ * \param {RCNET_MetricsCounter*} counter - Le compteur (valide jusqu'à son retrait).
+ * \param {RCNET_MetricType} type - RCNET_METRIC_COUNTER ou RCNET_METRIC_GAUGE.
+ * \param {const char*} name - Nom de la métrique (copié), ex: "game_inputs_dropped_total".
+ * \param {const char*} help - Description (copiée), NULL accepté.
+ * \param {const char*} labels - Labels (copiés), NULL accepté.
+ * \return {bool} false si un paramètre est invalide.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_metrics_server_add_counter(RCNET_MetricsServer* server, RCNET_MetricsCounter* counter, RCNET_MetricType type,
+                                      const char* name, const char* help, const char* labels);
+
+/**
+ * \brief Retire un compteur exporté.
+ *
+ * \param {RCNET_MetricsServer*} server - Le serveur.
+ * \param {RCNET_MetricsCounter*} counter - Le compteur.
+ * \return {bool} false si le compteur n'est pas exporté.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_metrics_server_remove_counter(RCNET_MetricsServer* server, RCNET_MetricsCounter* counter);
+
+/**
+ * \brief Rend toutes les métriques comme pour un scrape HTTP (ex: export par un autre canal, debug).
+ *
+ * \param {RCNET_MetricsServer*} server - Le serveur.
+ * \param {char*} outBuffer - Texte (terminé par '\0', tronqué à capacity - 1), NULL accepté si capacity == 0.
+ * \param {size_t} capacity - Taille du buffer.
+ * \return {size_t} Taille du texte complet (sans '\0') : le rendu est tronqué si elle est >= capacity.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_metrics_server_render(RCNET_MetricsServer* server, char* outBuffer, size_t capacity);
+
+/**
+ * \brief Récupère les compteurs du serveur.
+ *
+ * \param {const RCNET_MetricsServer*} server - Le serveur.
+ * \param {RCNET_MetricsServerStats*} outStats - Compteurs à remplir.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_metrics_server_get_stats(const RCNET_MetricsServer* server, RCNET_MetricsServerStats* outStats);
+
+/**
+ * \brief Ecrit un échantillon (depuis un collector).
+ *
+ * Les lignes # HELP / # TYPE sont écrites une fois par nom ; un nom déjà écrit avec un autre type
+ * est ignoré.
+ *
+ * \param {RCNET_MetricsWriter*} writer - La sortie.
+ * \param {RCNET_MetricType} type - RCNET_METRIC_COUNTER ou RCNET_METRIC_GAUGE.
+ * \param {const char*} name - Nom de la métrique ([a-zA-Z_:][a-zA-Z0-9_:]*).
+ * \param {const char*} help - Description (utilisée au premier échantillon du nom), NULL accepté.
+ * \param {const char*} labels - Labels de l'échantillon, ex: "client=\"12\"", NULL accepté.
+ * \param {double} value - Valeur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_metrics_write(RCNET_MetricsWriter* writer, RCNET_MetricType type, const char* name, const char* help,
+                         const char* labels, double value);
+
+/**
+ * \brief Ecrit le résumé d'un RCNET_Histogram en summary (quantiles 0.5 / 0.9 / 0.99 / 0.999, _sum, _count).
+ *
+ * \param {RCNET_MetricsWriter*} writer - La sortie.
+ * \param {const char*} name - Nom de la métrique (ex: "rcnet_engine_sim_update_seconds").
+ * \param {const char*} help - Description, NULL accepté.
+ * \param {const char*} labels - Labels, NULL accepté.
+ * \param {const RCNET_HistogramSummary*} summary - Le résumé.
+ * \param {double} scale - Facteur appliqué aux valeurs (ex: 1e-9 pour des ns exportées en secondes).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_metrics_write_summary(RCNET_MetricsWriter* writer, const char* name, const char* help, const char* labels,
+                                 const RCNET_HistogramSummary* summary, double scale);
+
+/**
+ * \brief Crée un compteur par thread (à zéro).
+ *
+ * \return {RCNET_MetricsCounter*} Le compteur, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_MetricsCounter* rcnet_metrics_counter_create(void);
+
+/**
+ * \brief Détruit un compteur (à retirer d'abord du serveur qui l'exporte).
+ *
+ * \param {RCNET_MetricsCounter*} counter - Le compteur (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_metrics_counter_destroy(RCNET_MetricsCounter* counter);
+
+/**
+ * \brief Ajoute delta au slot du thread appelant (négatif accepté pour une gauge).
+ *
+ * Les 64 premiers threads qui écrivent dans un compteur RCNET ont leur propre slot (une lecture et
+ * une écriture relaxed, aucune opération atomique partagée) ; les suivants partagent un slot commun.
+ *
+ * \param {RCNET_MetricsCounter*} counter - Le compteur.
+ * \param {int64_t} delta - Valeur à ajouter.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_metrics_counter_add(RCNET_MetricsCounter* counter, int64_t delta);
+
+/**
+ * \brief Somme des slots de tous les threads.
+ *
+ * \param {const RCNET_MetricsCounter*} counter - Le compteur.
+ * \return {int64_t} La valeur (peut manquer les ajouts concurrents à la lecture).
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+int64_t rcnet_metrics_counter_get(const RCNET_MetricsCounter* counter);
+
+/**
+ * \brief Collectors des modules RCNET (userdata : l'objet à lire).
+ *
+ * - engine        : boucle du moteur, userdata ignoré (rcnet_engine_get_stats : ticks, histogrammes de
+ *                   durée des ticks, rattrapage, agrégats des peers).
+ * - net_shards    : RCNET_NetShards*, par client connecté (label client) : RTT, perte, commandes en
+ *                   attente, octets reliable en vol, débit envoyé / estimé, congestion.
+ * - input_receiver: RCNET_InputReceiver*, packets / inputs reçus, redondants, récupérés, en retard.
+ * - ring_queue    : RCNET_RingQueue*, profondeur, capacité, poussés / consommés / refusés (ex: la queue
+ *                   des inputs réseau -> simulation).
+ * - nats_publisher: RCNET_NATSAsyncPublisher*, publiés / acquittés / en échec, acks en attente, latence
+ *                   publication -> accusé de réception.
+ * - redis_cache   : RCNET_RedisCache*, hits / misses (et ratio), évictions, entrées, octets.
+ * - packet_pool   : RCNET_PacketPool*, buffers pris / rendus / en vol, allocations heap, octets gardés.
+ *
+ * \param {RCNET_MetricsWriter*} writer - La sortie.
+ * \param {void*} userdata - L'objet lu.
+ *
+ * \since Ces fonctions sont disponibles depuis RCNET 1.1.0.
+ */
+void rcnet_metrics_collect_engine(RCNET_MetricsWriter* writer, void* userdata);
+void rcnet_metrics_collect_net_shards(RCNET_MetricsWriter* writer, void* userdata);
+void rcnet_metrics_collect_input_receiver(RCNET_MetricsWriter* writer, void* userdata);
+void rcnet_metrics_collect_ring_queue(RCNET_MetricsWriter* writer, void* userdata);
+void rcnet_metrics_collect_nats_publisher(RCNET_MetricsWriter* writer, void* userdata);
+void rcnet_metrics_collect_redis_cache(RCNET_MetricsWriter* writer, void* userdata);
+void rcnet_metrics_collect_packet_pool(RCNET_MetricsWriter* writer, void* userdata);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_METRICS_H
@@ -3,10 +3,13 @@
 
 // Standard C/C++ Libraries
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #include <nats.h>
 
+#include <RCNET/RCNET_histogram.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -18,18 +21,44 @@ extern "C" {
  * Cette structure encapsule les composants essentiels d'un client NATS,
  * notamment la connexion au serveur, les abonnements, et le contexte JetStream.
  *
+ * Les abonnements sont rangés dans un registre à slots : la capacité double quand elle est pleine,
+ * un désabonnement libère son slot en O(1) et le slot est réutilisé par l'abonnement suivant.
+ * Un serveur qui s'abonne / se désabonne en continu (un sujet par match) garde donc une mémoire stable.
+ *
+ * Le registre n'a pas de verrou : les abonnements et désabonnements d'un même client (subscribe,
+ * jetstream_subscribe, unsubscribe, fanin_create / fanin_destroy, et les modules qui les appellent :
+ * réplication, cache Redis, ...) doivent être faits depuis un seul thread à la fois.
+ *
  * @property {natsConnection*} connection - Pointeur vers la connexion NATS active.
- * @property {natsSubscription**} subscriptions - Tableau des abonnements NATS actifs.
- * @property {size_t} subscriptionCount - Nombre d'abonnements NATS actifs.
+ * @property {natsSubscription**} subscriptions - Slots des abonnements (NULL pour un slot libre).
+ * @property {size_t} subscriptionCount - Nombre de slots utilisés au moins une fois (à parcourir en ignorant les NULL).
  * @property {jsCtx*} jetStreamContext - Pointeur vers le contexte JetStream associé.
+ * @property {size_t} subscriptionCapacity - Interne : nombre de slots alloués.
+ * @property {uint32_t*} subscriptionGenerations - Interne : génération de chaque slot (invalide les anciens handles).
+ * @property {uint32_t*} freeSubscriptionSlots - Interne : pile des slots libres.
+ * @property {size_t} freeSubscriptionSlotCount - Interne : nombre de slots libres.
  */
 typedef struct {
     natsConnection *connection;
     natsSubscription **subscriptions;
     size_t subscriptionCount;
     jsCtx *jetStreamContext;
+    size_t subscriptionCapacity;
+    uint32_t *subscriptionGenerations;
+    uint32_t *freeSubscriptionSlots;
+    size_t freeSubscriptionSlotCount;
 } RCNET_NATSClient;
 
+/**
+ * @typedef {uint64_t} RCNET_NATSSubscriptionHandle
+ * @brief Handle d'un abonnement (slot + génération). 0 = handle invalide.
+ *
+ * Un handle désabonné ne désigne jamais l'abonnement qui réutilise son slot.
+ */
+typedef uint64_t RCNET_NATSSubscriptionHandle;
+
+#define RCNET_NATS_INVALID_SUBSCRIPTION ((RCNET_NATSSubscriptionHandle)0)
+
 /**
  * @typedef {struct} RCNET_JetStreamPublishOptions
  * @brief Options de configuration pour la publication JetStream.
@@ -62,6 +91,25 @@ typedef struct {
     int maxAckPending;
 } RCNET_JetStreamSubscribeOptions;
 
+/**
+ * @typedef {struct} RCNET_JetStreamPullSubscribeOptions
+ * @brief Options de configuration d'un consumer JetStream en mode pull (rcnet_nats_jetstream_fetch).
+ *
+ * @property {int} maxDeliver - Nombre maximum de tentatives de livraison d'un message. 0 pour aucune limite.
+ * @property {int} ackWait - Durée maximale d'attente (en millisecondes) pour l'accusé de réception d'un message. 0 pour la valeur du serveur.
+ * @property {bool} ackAll - Si vrai, le consumer utilise AckAll : acquitter un message acquitte aussi tous les précédents
+ *                           (un seul ack par batch avec rcnet_nats_jetstream_ack_batch()).
+ * @property {int} maxAckPending - Nombre maximum de messages livrés non acquittés. 0 pour la valeur du serveur.
+ * @property {int} maxRequestBatch - Taille max d'un batch accepté par le serveur. 0 pour aucune limite.
+ */
+typedef struct {
+    int maxDeliver;
+    int ackWait;
+    bool ackAll;
+    int maxAckPending;
+    int maxRequestBatch;
+} RCNET_JetStreamPullSubscribeOptions;
+
 /**
  * @typedef {struct} RCNET_JetStreamStreamOptions
  * @brief Options de configuration pour un stream JetStream.
@@ -118,18 +166,157 @@ void rcnet_nats_cleanup(RCNET_NATSClient *client);
  */
 int rcnet_nats_publish(RCNET_NATSClient *client, const char *subject, const void* data, int dataLength);
 
+/**
+ * @brief Publie un message compressé en LZ4 sur un sujet spécifique via NATS.
+ * 
+ * Le payload est écrit au format de rcnet_compression_compress_block() : les abonnés
+ * le restaurent avec rcnet_compression_decompress_block(). Les payloads de moins de
+ * minCompressSize octets, ou incompressibles, sont publiés bruts (1 octet d'en-tête).
+ * 
+ * @param {RCNET_NATSClient*} client - Pointeur vers le client NATS.
+ * @param {const char*} subject - Sujet sur lequel publier le message.
+ * @param {const void*} data - Pointeur vers les données à envoyer.
+ * @param {int} dataLength - Longueur des données à envoyer.
+ * @param {size_t} minCompressSize - Taille en dessous de laquelle le payload n'est pas compressé.
+ * @return {int} 0 en cas de succès, -1 en cas d'erreur.
+ */
+int rcnet_nats_publish_compressed(RCNET_NATSClient *client, const char *subject, const void* data, int dataLength, size_t minCompressSize);
+
 /**
  * @brief S'abonne à un sujet spécifique via NATS.
  * 
  * Cette fonction crée une subscription NATS pour écouter les messages envoyés sur le sujet spécifié.
  * 
  * @param {RCNET_NATSClient*} client - Pointeur vers le client NATS.
- * @param {const char*} subject - Sujet auquel s'abonner.
+ * @param {const char*} subject - Sujet auquel s'abonner (wildcards NATS acceptées : '*' pour un token, '>' pour la fin du sujet).
  * @param {natsMsgHandler} messageHandler - Fonction de rappel pour gérer les messages reçus.
  * @param {void*} closure - Données utilisateur optionnelles passées à la fonction de rappel.
+ * @param {RCNET_NATSSubscriptionHandle*} outHandle - Handle pour rcnet_nats_unsubscribe() (NULL accepté).
+ * @return {int} 0 en cas de succès, -1 en cas d'erreur.
+ */
+int rcnet_nats_subscribe(RCNET_NATSClient *client, const char *subject, natsMsgHandler messageHandler, void *closure, RCNET_NATSSubscriptionHandle *outHandle);
+
+/**
+ * @brief Se désabonne et libère le slot de l'abonnement (O(1), le slot est réutilisé).
+ * 
+ * Fonctionne pour les abonnements NATS et JetStream. Un handle déjà désabonné est refusé.
+ * 
+ * @param {RCNET_NATSClient*} client - Pointeur vers le client NATS.
+ * @param {RCNET_NATSSubscriptionHandle} handle - Handle retourné par rcnet_nats_subscribe() / rcnet_nats_jetstream_subscribe().
+ * @return {int} 0 en cas de succès, -1 si le handle est invalide.
+ */
+int rcnet_nats_unsubscribe(RCNET_NATSClient *client, RCNET_NATSSubscriptionHandle handle);
+
+// Attente par défaut de rcnet_nats_unsubscribe_and_wait() (au-delà, connexion considérée bloquée)
+#define RCNET_NATS_UNSUBSCRIBE_WAIT_TIMEOUT_MS 5000
+
+/**
+ * @brief Se désabonne puis attend qu'aucun handler de l'abonnement ne puisse plus s'exécuter.
+ * 
+ * natsSubscription_Unsubscribe n'attend pas un handler déjà en cours sur le thread de livraison :
+ * après rcnet_nats_unsubscribe(), la closure passée à rcnet_nats_subscribe() peut encore être
+ * utilisée. Cette fonction attend le callback de complétion NATS (après le dernier message) :
+ * sur un retour 0, la closure peut être libérée.
+ * 
+ * Ne pas appeler depuis un handler de l'abonnement lui-même (l'attente expirerait).
+ * 
+ * @param {RCNET_NATSClient*} client - Pointeur vers le client NATS.
+ * @param {RCNET_NATSSubscriptionHandle} handle - Handle retourné par rcnet_nats_subscribe() / rcnet_nats_jetstream_subscribe().
+ * @param {int} timeoutMs - Attente maximale du callback de complétion (ex: RCNET_NATS_UNSUBSCRIBE_WAIT_TIMEOUT_MS).
+ * @return {int} 0 en cas de succès, -1 si le handle est invalide (rien n'est abonné), -2 si la fin de
+ * l'abonnement n'a pas pu être confirmée : un handler peut encore tourner, la closure ne doit pas être libérée.
+ */
+int rcnet_nats_unsubscribe_and_wait(RCNET_NATSClient *client, RCNET_NATSSubscriptionHandle handle, int timeoutMs);
+
+/**
+ * @brief Nombre d'abonnements actifs dans le registre du client.
+ * 
+ * @param {const RCNET_NATSClient*} client - Pointeur vers le client NATS.
+ * @return {size_t} Nombre d'abonnements actifs.
+ */
+size_t rcnet_nats_get_subscription_count(const RCNET_NATSClient *client);
+
+/**
+ * @typedef {struct} RCNET_NATSFanIn
+ * @brief Un seul abonnement wildcard NATS, routé localement vers un handler par valeur de token.
+ *
+ * Exemple : "match.*.events" avec routeTokenIndex = 1 ; chaque match ajoute une route pour son id.
+ * Ajouter / retirer un match ne fait aucun aller-retour avec le serveur NATS (pas de SUB / UNSUB)
+ * et ne crée aucun abonnement supplémentaire.
+ *
+ * Les handlers sont appelés sur le thread de la librairie NATS, comme avec rcnet_nats_subscribe().
+ */
+typedef struct RCNET_NATSFanIn RCNET_NATSFanIn;
+
+/**
+ * @brief Crée un fan-in sur un sujet wildcard.
+ * 
+ * @param {RCNET_NATSClient*} client - Pointeur vers le client NATS.
+ * @param {const char*} wildcardSubject - Sujet NATS avec wildcards (ex: "match.*.events").
+ * @param {int} routeTokenIndex - Index (à partir de 0) du token du sujet reçu servant de clé de routage.
+ * @return {RCNET_NATSFanIn*} Le fan-in, ou NULL en cas d'erreur.
+ */
+RCNET_NATSFanIn* rcnet_nats_fanin_create(RCNET_NATSClient *client, const char *wildcardSubject, int routeTokenIndex);
+
+/**
+ * @brief Se désabonne et détruit le fan-in (ses routes sont supprimées).
+ * 
+ * Attend qu'un handler en cours sur le thread NATS soit terminé avant de libérer le fan-in :
+ * ne pas l'appeler depuis un handler de ce fan-in.
+ * 
+ * @param {RCNET_NATSFanIn*} fanIn - Le fan-in (NULL accepté).
+ */
+void rcnet_nats_fanin_destroy(RCNET_NATSFanIn *fanIn);
+
+/**
+ * @brief Ajoute (ou remplace) la route d'un token.
+ * 
+ * Le handler reçoit la propriété du message (natsMsg_Destroy), comme un natsMsgHandler classique.
+ * Peut être appelée depuis n'importe quel thread.
+ * 
+ * @param {RCNET_NATSFanIn*} fanIn - Le fan-in.
+ * @param {const char*} token - Valeur du token de routage (ex: l'id du match).
+ * @param {natsMsgHandler} messageHandler - Fonction de rappel pour les messages de ce token.
+ * @param {void*} closure - Données utilisateur passées à la fonction de rappel.
  * @return {int} 0 en cas de succès, -1 en cas d'erreur.
  */
-int rcnet_nats_subscribe(RCNET_NATSClient *client, const char *subject, natsMsgHandler messageHandler, void *closure);
+int rcnet_nats_fanin_add_route(RCNET_NATSFanIn *fanIn, const char *token, natsMsgHandler messageHandler, void *closure);
+
+/**
+ * @brief Retire la route d'un token (les messages suivants pour ce token sont ignorés).
+ * 
+ * Un message déjà en cours de traitement sur le thread NATS peut encore atteindre l'ancien handler
+ * (voir rcnet_nats_fanin_remove_route_and_wait() avant de libérer sa closure).
+ * Peut être appelée depuis n'importe quel thread.
+ * 
+ * @param {RCNET_NATSFanIn*} fanIn - Le fan-in.
+ * @param {const char*} token - Valeur du token de routage.
+ * @return {int} 0 en cas de succès, -1 si la route n'existe pas.
+ */
+int rcnet_nats_fanin_remove_route(RCNET_NATSFanIn *fanIn, const char *token);
+
+/**
+ * @brief Retire la route d'un token puis attend qu'aucun handler ne l'utilise plus.
+ * 
+ * Sur un retour 0, la closure de la route peut être libérée. Appelée depuis le handler de la route
+ * elle-même, retourne sans attendre (le handler en cours est l'appelant). Peut être appelée depuis
+ * n'importe quel autre thread.
+ * 
+ * @param {RCNET_NATSFanIn*} fanIn - Le fan-in.
+ * @param {const char*} token - Valeur du token de routage.
+ * @param {int} timeoutMs - Attente maximale du handler en cours (ex: RCNET_NATS_UNSUBSCRIBE_WAIT_TIMEOUT_MS).
+ * @return {int} 0 en cas de succès, -1 si la route n'existe pas, -2 si le handler tourne encore
+ * après timeoutMs : la closure ne doit pas être libérée.
+ */
+int rcnet_nats_fanin_remove_route_and_wait(RCNET_NATSFanIn *fanIn, const char *token, int timeoutMs);
+
+/**
+ * @brief Nombre de messages reçus sans route correspondante (détruits sans être traités).
+ * 
+ * @param {const RCNET_NATSFanIn*} fanIn - Le fan-in.
+ * @return {uint64_t} Nombre de messages non routés.
+ */
+uint64_t rcnet_nats_fanin_get_unrouted_count(const RCNET_NATSFanIn *fanIn);
 
 /**
  * @brief Publie un message sur un sujet spécifique via JetStream.
@@ -153,9 +340,68 @@ int rcnet_nats_jetstream_publish(RCNET_NATSClient *client, const char *subject,
  * @param {const char*} subject - Sujet auquel s'abonner.
  * @param {natsMsgHandler} messageHandler - Fonction de rappel pour gérer les messages reçus.
  * @param {void*} closure - Données utilisateur optionnelles passées à la fonction de rappel.
+ * @param {RCNET_JetStreamSubscribeOptions*} options - Options de l'abonnement (NULL accepté).
+ * @param {RCNET_NATSSubscriptionHandle*} outHandle - Handle pour rcnet_nats_unsubscribe() (NULL accepté).
  * @return {int} 0 en cas de succès, -1 en cas d'erreur.
  */
-int rcnet_nats_jetstream_subscribe(RCNET_NATSClient *client, const char *subject, natsMsgHandler messageHandler, void *closure, RCNET_JetStreamSubscribeOptions *options);
+int rcnet_nats_jetstream_subscribe(RCNET_NATSClient *client, const char *subject, natsMsgHandler messageHandler, void *closure, RCNET_JetStreamSubscribeOptions *options, RCNET_NATSSubscriptionHandle *outHandle);
+
+/**
+ * @brief Crée un consumer JetStream en mode pull, consommé par batchs avec rcnet_nats_jetstream_fetch().
+ * 
+ * Contrairement à rcnet_nats_jetstream_subscribe(), aucun callback n'est appelé sur le thread de la
+ * librairie NATS : c'est l'appelant qui récupère les messages, sur son propre thread
+ * (un aller-retour avec le serveur par batch, voir rcnet_nats_jetstream_fetch()).
+ * 
+ * @param {RCNET_NATSClient*} client - Pointeur vers le client NATS.
+ * @param {const char*} subject - Sujet JetStream (filtre du consumer).
+ * @param {const char*} durable - Nom du consumer durable (partagé entre les instances qui se répartissent la charge).
+ * @param {RCNET_JetStreamPullSubscribeOptions*} options - Options du consumer (NULL accepté).
+ * @param {RCNET_NATSSubscriptionHandle*} outHandle - Handle pour rcnet_nats_jetstream_fetch() / rcnet_nats_unsubscribe().
+ * @return {int} 0 en cas de succès, -1 en cas d'erreur.
+ */
+int rcnet_nats_jetstream_pull_subscribe(RCNET_NATSClient *client, const char *subject, const char *durable, RCNET_JetStreamPullSubscribeOptions *options, RCNET_NATSSubscriptionHandle *outHandle);
+
+/**
+ * @brief Récupère un batch de messages d'un consumer pull (natsSubscription_Fetch).
+ * 
+ * L'appel est synchrone : même avec timeoutMs = 0 (requête NoWait, seuls les messages déjà
+ * disponibles sont retournés), il attend la réponse du serveur, soit au moins un aller-retour
+ * avec le broker. Sinon l'appel attend jusqu'à timeoutMs que le batch soit complet.
+ * Appelé depuis rcnet_simulation_update, ce RTT s'ajoute à la durée du tick : à réserver aux
+ * ticks qui peuvent l'absorber, ou à appeler depuis un thread dédié qui transmet les messages
+ * à la simulation.
+ * Les messages sont à acquitter avec rcnet_nats_jetstream_ack_batch() puis à libérer avec
+ * rcnet_nats_jetstream_release_batch().
+ * 
+ * @param {RCNET_NATSClient*} client - Pointeur vers le client NATS.
+ * @param {RCNET_NATSSubscriptionHandle} handle - Handle retourné par rcnet_nats_jetstream_pull_subscribe().
+ * @param {int} batchSize - Nombre maximum de messages à récupérer.
+ * @param {int} timeoutMs - Attente maximale en millisecondes (0 pour ne pas attendre).
+ * @param {natsMsgList*} outMessages - Liste des messages reçus (vide si aucun message).
+ * @return {int} Nombre de messages reçus, ou -1 en cas d'erreur.
+ */
+int rcnet_nats_jetstream_fetch(RCNET_NATSClient *client, RCNET_NATSSubscriptionHandle handle, int batchSize, int timeoutMs, natsMsgList *outMessages);
+
+/**
+ * @brief Acquitte un batch de messages récupéré par rcnet_nats_jetstream_fetch().
+ * 
+ * En mode cumulatif (consumer créé avec ackAll), seul le dernier message est acquitté : le serveur
+ * acquitte alors tous les messages précédents du consumer en un seul aller-retour.
+ * Sinon, chaque message est acquitté individuellement.
+ * 
+ * @param {natsMsgList*} messages - Batch à acquitter.
+ * @param {bool} cumulative - Vrai si le consumer a été créé avec ackAll.
+ * @return {int} 0 en cas de succès, -1 si au moins un acquittement a échoué.
+ */
+int rcnet_nats_jetstream_ack_batch(natsMsgList *messages, bool cumulative);
+
+/**
+ * @brief Libère un batch de messages (les messages non acquittés seront relivrés après ackWait).
+ * 
+ * @param {natsMsgList*} messages - Batch à libérer.
+ */
+void rcnet_nats_jetstream_release_batch(natsMsgList *messages);
 
 /**
  * @brief Vérifie l'existence d'un stream JetStream et le crée si nécessaire.
@@ -191,6 +437,173 @@ int rcnet_nats_check_and_create_stream(RCNET_NATSClient *client, const char *str
  */
 int rcnet_nats_update_stream_subjects(RCNET_NATSClient *client, const char *streamName, const char *newSubjects[], int newSubjectsCount);
 
+/**
+ * @typedef {struct} RCNET_NATSAsyncPublisher
+ * @brief Publication JetStream asynchrone, bufferisée et sans blocage du tick.
+ *
+ * rcnet_nats_async_publish() ne fait que copier le message dans un buffer (aucun appel réseau,
+ * aucun log). rcnet_nats_async_publisher_flush(), appelée une fois par tick réseau, envoie le buffer
+ * via js_PublishMsgAsync() dans la limite de la fenêtre de messages en vol (le reste attend le tick
+ * suivant), puis appelle les callbacks des messages acquittés (ou en échec) sur le thread appelant.
+ *
+ * Le publisher a son propre contexte JetStream sur la connexion de RCNET_NATSClient.
+ */
+typedef struct RCNET_NATSAsyncPublisher RCNET_NATSAsyncPublisher;
+
+/**
+ * @typedef {struct} RCNET_NATSAsyncPublisherConfig
+ * @brief Configuration d'un RCNET_NATSAsyncPublisher.
+ *
+ * @property {uint32_t} maxInFlight - Nombre max de messages JetStream envoyés en attente d'accusé de réception.
+ * @property {uint32_t} maxQueued - Nombre max de messages dans le buffer (au-delà, la publication est refusée).
+ * @property {int} stallWaitMs - Attente max de js_PublishMsgAsync() si la librairie NATS atteint sa propre limite.
+ * @property {uint32_t} ackTimeoutMs - Délai au-delà duquel un message en vol sans accusé est compté en échec
+ * et libère sa place dans la fenêtre (0 = attente illimitée).
+ */
+typedef struct {
+    uint32_t maxInFlight;
+    uint32_t maxQueued;
+    int stallWaitMs;
+    uint32_t ackTimeoutMs;
+} RCNET_NATSAsyncPublisherConfig;
+
+/**
+ * @typedef {struct} RCNET_NATSPublishResult
+ * @brief Résultat d'une publication asynchrone, passé au callback de complétion.
+ *
+ * @property {bool} success - Vrai si le message a été acquitté par JetStream.
+ * @property {uint64_t} sequence - Séquence du message dans le stream (si success).
+ * @property {bool} duplicate - Vrai si JetStream a détecté un doublon (si success).
+ * @property {int} errorCode - Code d'erreur JetStream (si échec, 0 si inconnu).
+ * @property {const char*} errorText - Texte de l'erreur (si échec, valide pendant le callback uniquement).
+ * @property {uint64_t} latencyNs - Temps entre rcnet_nats_async_publish() et l'accusé de réception.
+ */
+typedef struct {
+    bool success;
+    uint64_t sequence;
+    bool duplicate;
+    int errorCode;
+    const char *errorText;
+    uint64_t latencyNs;
+} RCNET_NATSPublishResult;
+
+/**
+ * @brief Callback de complétion d'une publication asynchrone (appelé par rcnet_nats_async_publisher_flush()).
+ */
+typedef void (*RCNET_NATSPublishCallback)(const RCNET_NATSPublishResult *result, void *userdata);
+
+/**
+ * @typedef {struct} RCNET_NATSAsyncPublisherStats
+ * @brief Compteurs d'un RCNET_NATSAsyncPublisher (depuis sa création).
+ *
+ * @property {uint64_t} published - Messages acceptés par rcnet_nats_async_publish() / rcnet_nats_async_publish_core().
+ * @property {uint64_t} acked - Messages JetStream acquittés.
+ * @property {uint64_t} failed - Messages en échec (envoi refusé, erreur JetStream, accusé expiré, non acquittés à la destruction).
+ * @property {uint64_t} dropped - Messages refusés car le buffer était plein.
+ * @property {uint64_t} expired - Messages sans accusé de réception après ackTimeoutMs (inclus dans failed).
+ * @property {uint32_t} inFlight - Messages JetStream envoyés en attente d'accusé de réception.
+ * @property {uint32_t} queued - Messages dans le buffer, pas encore envoyés.
+ * @property {RCNET_HistogramSummary} ackLatencyNs - Latence publication -> accusé de réception.
+ */
+typedef struct {
+    uint64_t published;
+    uint64_t acked;
+    uint64_t failed;
+    uint64_t dropped;
+    uint64_t expired;
+    uint32_t inFlight;
+    uint32_t queued;
+    RCNET_HistogramSummary ackLatencyNs;
+} RCNET_NATSAsyncPublisherStats;
+
+/**
+ * @brief Configuration par défaut (256 messages en vol, buffer de 8192 messages, 1 ms de stall max, accusés expirés après 5 s).
+ *
+ * @param {RCNET_NATSAsyncPublisherConfig*} outConfig - Configuration à remplir.
+ */
+void rcnet_nats_async_publisher_get_default_config(RCNET_NATSAsyncPublisherConfig *outConfig);
+
+/**
+ * @brief Crée un publisher asynchrone sur un client NATS initialisé.
+ *
+ * @param {RCNET_NATSClient*} client - Client NATS (doit rester valide jusqu'à la destruction du publisher).
+ * @param {const RCNET_NATSAsyncPublisherConfig*} config - Configuration (NULL pour la configuration par défaut).
+ * @return {RCNET_NATSAsyncPublisher*} Le publisher, ou NULL en cas d'erreur.
+ */
+RCNET_NATSAsyncPublisher* rcnet_nats_async_publisher_create(RCNET_NATSClient *client, const RCNET_NATSAsyncPublisherConfig *config);
+
+/**
+ * @brief Envoie les messages restants, attend les accusés de réception puis détruit le publisher.
+ *
+ * Les messages non acquittés après timeoutMs sont comptés en échec ; tous les callbacks restants
+ * sont appelés sur le thread appelant avant le retour.
+ *
+ * @param {RCNET_NATSAsyncPublisher*} publisher - Le publisher (NULL accepté).
+ * @param {int} timeoutMs - Attente max (en millisecondes) pour vider le buffer et recevoir les accusés de réception.
+ */
+void rcnet_nats_async_publisher_destroy(RCNET_NATSAsyncPublisher *publisher, int timeoutMs);
+
+/**
+ * @brief Met un message JetStream dans le buffer du publisher (copie, aucun appel réseau).
+ *
+ * Peut être appelée depuis n'importe quel thread (ex: depuis rcnet_simulation_update).
+ *
+ * @param {RCNET_NATSAsyncPublisher*} publisher - Le publisher.
+ * @param {const char*} subject - Sujet JetStream.
+ * @param {const void*} data - Données à envoyer.
+ * @param {int} dataLength - Longueur des données.
+ * @param {RCNET_NATSPublishCallback} callback - Callback de complétion (NULL accepté).
+ * @param {void*} userdata - Donnée passée au callback.
+ * @return {int} 0 en cas de succès, -1 si le buffer est plein ou les paramètres invalides.
+ */
+int rcnet_nats_async_publish(RCNET_NATSAsyncPublisher *publisher, const char *subject, const void* data, int dataLength, RCNET_NATSPublishCallback callback, void *userdata);
+
+/**
+ * @brief Met un message NATS core (sans accusé de réception) dans le buffer du publisher.
+ *
+ * Envoyé par natsConnection_Publish() au prochain flush, hors fenêtre de messages en vol.
+ * Peut être appelée depuis n'importe quel thread.
+ *
+ * @param {RCNET_NATSAsyncPublisher*} publisher - Le publisher.
+ * @param {const char*} subject - Sujet NATS.
+ * @param {const void*} data - Données à envoyer.
+ * @param {int} dataLength - Longueur des données.
+ * @return {int} 0 en cas de succès, -1 si le buffer est plein ou les paramètres invalides.
+ */
+int rcnet_nats_async_publish_core(RCNET_NATSAsyncPublisher *publisher, const char *subject, const void* data, int dataLength);
+
+/**
+ * @brief Envoie le buffer (dans la limite de la fenêtre) et appelle les callbacks des messages terminés.
+ *
+ * A appeler une fois par tick réseau (rcnet_network_update), toujours depuis le même thread.
+ *
+ * @param {RCNET_NATSAsyncPublisher*} publisher - Le publisher.
+ * @return {uint32_t} Nombre de messages envoyés pendant cet appel.
+ */
+uint32_t rcnet_nats_async_publisher_flush(RCNET_NATSAsyncPublisher *publisher);
+
+/**
+ * @brief Retire les callbacks de complétion associés à un userdata (les messages sont toujours envoyés).
+ *
+ * Attend la fin d'un rcnet_nats_async_publisher_flush() en cours : au retour, plus aucun callback ne
+ * sera appelé avec ce userdata, qui peut être libéré. Permet à un propriétaire d'un publisher partagé
+ * de se détacher sans attendre ses accusés de réception.
+ * Peut être appelée depuis n'importe quel thread, sauf depuis un callback de complétion.
+ *
+ * @param {RCNET_NATSAsyncPublisher*} publisher - Le publisher.
+ * @param {void*} userdata - Userdata passé à rcnet_nats_async_publish().
+ * @return {uint32_t} Nombre de callbacks retirés.
+ */
+uint32_t rcnet_nats_async_publisher_cancel_callbacks(RCNET_NATSAsyncPublisher *publisher, void *userdata);
+
+/**
+ * @brief Récupère les compteurs du publisher (peut être appelée depuis n'importe quel thread).
+ *
+ * @param {const RCNET_NATSAsyncPublisher*} publisher - Le publisher.
+ * @param {RCNET_NATSAsyncPublisherStats*} outStats - Compteurs à remplir.
+ */
+void rcnet_nats_async_publisher_get_stats(const RCNET_NATSAsyncPublisher *publisher, RCNET_NATSAsyncPublisherStats *outStats);
+
 #ifdef __cplusplus
 }
 #endif
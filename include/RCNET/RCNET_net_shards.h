@@ -0,0 +1,294 @@
+#ifndef RCNET_NET_SHARDS_H
+#define RCNET_NET_SHARDS_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint8_t, uint16_t, uint32_t, uint64_t
+
+#include <rcenet/RCENET_enet.h>
+
+#include <RCNET/RCNET_arena.h>
+#include <RCNET/RCNET_secure_channel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Couche réseau ENet shardée : N ENetHost, chacun servi par son propre thread.
+ *
+ * - Linux : tous les hosts sont bindés sur le même port avec SO_REUSEPORT,
+ *   le kernel répartit les clients entre les sockets (hash de l'adresse source).
+ * - Windows / macOS / BSD : le shard i écoute sur port + i, la répartition des clients entre
+ *   les ports est à la charge du matchmaking (Windows n'a pas de SO_REUSEPORT pour UDP, celui de
+ *   macOS / BSD livre tous les datagrammes au même socket au lieu de les répartir).
+ *
+ * Chaque thread de shard est le seul à toucher son ENetHost : les envois depuis d'autres threads
+ * passent par une queue lock-free par shard (rcnet_net_shards_send), vidée puis flushée par le shard.
+ *
+ * Les clientId sont globalement uniques : clientId = shardIndex * peersPerShard + incomingPeerID,
+ * donc 0 <= clientId < rcnet_net_shards_get_max_clients().
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_NetShards RCNET_NetShards;
+
+/**
+ * \brief Callbacks appelés depuis les threads de shard (plusieurs threads en parallèle).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_NetShardsCallbacks {
+    /**
+     * \brief Un client vient de se connecter.
+     */
+    void (*on_connect)(uint32_t clientId, void* userdata);
+
+    /**
+     * \brief Un client s'est déconnecté (timedOut = true si ENET_EVENT_TYPE_DISCONNECT_TIMEOUT).
+     */
+    void (*on_disconnect)(uint32_t clientId, bool timedOut, void* userdata);
+
+    /**
+     * \brief Packet reçu. Les données ne sont valides que pendant l'appel.
+     */
+    void (*on_receive)(uint32_t clientId, uint8_t channelId, const uint8_t* data, size_t dataLength, void* userdata);
+} RCNET_NetShardsCallbacks;
+
+/**
+ * \brief Adaptation du débit par peer, évaluée par le thread du shard à chaque échantillon des stats ENet.
+ *
+ * Un peer est congestionné si sa perte dépasse maxPacketLoss, si sa queue d'envoi ENet dépasse
+ * maxQueuedCommands ou si son RTT dépasse son RTT minimal de la connexion de plus de maxRttInflationMs.
+ * - congestionné : budget * 0.7 (au moins minPayloadBytes) et un tick réseau de plus entre deux snapshots
+ * - sinon : d'abord revenir à un snapshot par tick, puis budget + maxPayloadBytes / 16 (au plus maxPayloadBytes)
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_NetPeerRateConfig {
+    uint32_t sampleIntervalMs;    // période d'échantillonnage des stats ENet (ex: 100 ms, 0 = désactivé)
+    uint32_t minPayloadBytes;     // budget minimal par snapshot
+    uint32_t maxPayloadBytes;     // budget maximal (et initial) par snapshot
+    uint32_t maxSendInterval;     // au plus 1 snapshot tous les maxSendInterval ticks réseau
+    uint32_t maxQueuedCommands;   // commandes en attente dans ENet au-delà desquelles le peer est congestionné
+    uint32_t maxRttInflationMs;   // hausse du RTT (vs RTT minimal) au-delà de laquelle le peer est congestionné
+    float maxPacketLoss;          // perte (0..1) au-delà de laquelle le peer est congestionné
+} RCNET_NetPeerRateConfig;
+
+/**
+ * \brief Etat réseau d'un client (dernier échantillon du thread de son shard).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_NetPeerStats {
+    bool connected;
+    bool congested;                // dernier échantillon congestionné
+    uint32_t roundTripTimeMs;      // RTT lissé par ENet
+    uint32_t roundTripTimeVarianceMs;
+    uint32_t minRoundTripTimeMs;   // plus petit RTT vu depuis la connexion
+    float packetLoss;              // perte estimée par ENet (0..1)
+    uint32_t queuedCommands;       // commandes en attente d'envoi dans ENet (unreliable + reliable)
+    uint32_t reliableBytesInTransit; // octets reliable envoyés et pas encore ackés
+    uint32_t sentBytesPerSecond;   // débit envoyé (moyenne glissante)
+    uint32_t estimatedBytesPerSecond; // débit livré estimé : envoyé * (1 - perte)
+    uint64_t sentBytes;            // total envoyé depuis la connexion
+    uint32_t sendInterval;         // ticks réseau entre deux snapshots recommandés (>= 1)
+    uint32_t payloadBudgetBytes;   // budget recommandé par snapshot
+} RCNET_NetPeerStats;
+
+/**
+ * \brief Configuration d'une RCNET_NetShards.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_NetShardsConfig {
+    uint16_t port;               // port d'écoute (port de base hors Linux)
+    uint32_t shardCount;         // nombre de ENetHost / threads (>= 1)
+    uint32_t peersPerShard;      // nombre max de peers par host
+    uint32_t channelCount;       // nombre de channels ENet
+    uint32_t incomingBandwidth;  // bande passante entrante par host (0 = illimitée)
+    uint32_t outgoingBandwidth;  // bande passante sortante par host (0 = illimitée)
+    uint32_t serviceTimeoutMs;   // timeout de enet_host_service (ex: 1 ms)
+    uint32_t sendQueueCapacity;  // capacité de la queue d'envoi de chaque shard
+    size_t receiveArenaBytes;    // taille initiale de l'arena de réception de chaque shard (voir rcnet_net_shards_get_receive_arena)
+    bool pinThreads;             // épingler le thread du shard i sur le coeur firstCpuCore + i
+    uint32_t firstCpuCore;       // premier coeur utilisé si pinThreads
+    bool wakeEngineOnActivity;   // connexion / packet reçu => rcnet_engine_wake() (sort le moteur du mode idle)
+    RCNET_NetPeerRateConfig peerRate; // stats ENet et adaptation du débit par peer (voir rcnet_net_shards_get_peer_stats)
+    bool secure;                 // payloads chiffrés (RCNET_secure_channel, voir rcnet_net_shards_create)
+    RCNET_SecureKeyPair secureKeys; // clés statiques du serveur si secure (la clé publique est donnée aux clients par le matchmaking)
+    RCNET_NetShardsCallbacks callbacks;
+    void* userdata;              // passé à tous les callbacks
+} RCNET_NetShardsConfig;
+
+/**
+ * \brief Remplit une configuration avec les valeurs par défaut.
+ *
+ * port 7777, 1 shard, 64 peers par shard, 2 channels, timeout 1 ms, queue d'envoi 4096, arena de réception 64 Ko,
+ * pas d'épinglage, réveil du moteur sur activité réseau.
+ * Débit par peer : échantillon toutes les 100 ms, budget de 256 à 1200 octets, jusqu'à 1 snapshot tous les 4 ticks,
+ * congestion au-delà de 64 commandes en attente, de 150 ms de RTT en plus ou de 5 % de perte. Pas de chiffrement.
+ *
+ * \param {RCNET_NetShardsConfig*} outConfig - Configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_net_shards_get_default_config(RCNET_NetShardsConfig* outConfig);
+
+/**
+ * \brief Crée les ENetHost (bind inclus). Les threads ne sont pas encore lancés.
+ *
+ * Avec config->secure, chaque client doit d'abord envoyer son HELLO (rcnet_secure_session_start_client) :
+ * le shard répond par un WELCOME en clair, sur le channel du HELLO (à passer à
+ * rcnet_secure_session_finish_client), et on_connect n'est appelé qu'une fois le HELLO accepté (un HELLO
+ * invalide déconnecte le peer, les autres packets reçus avant lui sont ignorés et comptés dans earlyPackets), puis
+ * les packets reçus sont authentifiés et déchiffrés avant on_receive (les packets rejetés sont ignorés).
+ * Les packets envoyés sont chiffrés en place par le thread du shard : ils doivent réserver
+ * RCNET_SECURE_HEADER_SIZE octets devant le payload et RCNET_SECURE_TAG_SIZE derrière (un packet par
+ * envoi, voir rcnet_net_shards_send).
+ *
+ * \param {const RCNET_NetShardsConfig*} config - Configuration.
+ * \return {RCNET_NetShards*} Les shards, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_NetShards* rcnet_net_shards_create(const RCNET_NetShardsConfig* config);
+
+/**
+ * \brief Lance un thread par shard.
+ *
+ * \param {RCNET_NetShards*} shards - Les shards.
+ * \return {bool} true si tous les threads ont démarré.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_net_shards_start(RCNET_NetShards* shards);
+
+/**
+ * \brief Arrête les threads, détruit les packets en attente et les ENetHost.
+ *
+ * \param {RCNET_NetShards*} shards - Les shards (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_net_shards_destroy(RCNET_NetShards* shards);
+
+/**
+ * \brief Arena de scratch du shard appelant, pour décoder les packets dans on_receive sans malloc.
+ *
+ * L'arena est reset après chaque passe de réception du shard (tous les events reçus depuis le
+ * dernier enet_host_service) : rien de ce qui y est alloué ne doit être gardé après le callback.
+ *
+ * \return {RCNET_Arena*} L'arena, ou NULL si le thread appelant n'est pas un thread de shard.
+ *
+ * \threadsafety Depuis les callbacks des shards uniquement.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_Arena* rcnet_net_shards_get_receive_arena(void);
+
+/**
+ * \brief Nombre de shards.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_net_shards_get_shard_count(const RCNET_NetShards* shards);
+
+/**
+ * \brief Nombre total de clients (shardCount * peersPerShard) : borne des clientId.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_net_shards_get_max_clients(const RCNET_NetShards* shards);
+
+/**
+ * \brief Port réellement écouté par un shard.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint16_t rcnet_net_shards_get_port(const RCNET_NetShards* shards, uint32_t shardIndex);
+
+/**
+ * \brief Indique si les shards partagent le même port (SO_REUSEPORT) ou une plage de ports.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_net_shards_uses_reuseport(const RCNET_NetShards* shards);
+
+/**
+ * \brief Indique si un client est actuellement connecté.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_net_shards_is_connected(const RCNET_NetShards* shards, uint32_t clientId);
+
+/**
+ * \brief Envoie un packet à un client.
+ *
+ * Le packet est placé dans la queue du shard du client, puis envoyé et flushé par le thread du shard.
+ * Si le client s'est déconnecté (ou reconnecté sur le même slot) entre-temps, le packet est détruit.
+ *
+ * La fonction prend toujours possession du packet : en cas d'échec, il est détruit. Un packet par appel :
+ * ne jamais passer le même packet à plusieurs clients ni l'utiliser après l'appel (les shards tournent
+ * sur des threads différents et ENet ne partage pas un packet entre threads). Pour un broadcast, créer
+ * un packet par client.
+ *
+ * \param {RCNET_NetShards*} shards - Les shards.
+ * \param {uint32_t} clientId - Client destinataire.
+ * \param {uint8_t} channelId - Channel ENet.
+ * \param {ENetPacket*} packet - Packet (ex: enet_packet_create).
+ * \return {bool} true si le packet a été mis en queue, false si client déconnecté ou queue pleine.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_net_shards_send(RCNET_NetShards* shards, uint32_t clientId, uint8_t channelId, ENetPacket* packet);
+
+/**
+ * \brief Etat réseau et débit recommandé d'un client.
+ *
+ * Le thread réseau peut s'en servir pour espacer les snapshots (sendInterval) et limiter leur taille
+ * (payloadBudgetBytes, ex: rcnet_interest_set_peer_budget) : un peer sur un mauvais lien garde une
+ * queue ENet courte, donc une latence basse, au lieu d'accumuler des snapshots périmés.
+ *
+ * \param {const RCNET_NetShards*} shards - Les shards.
+ * \param {uint32_t} clientId - Le client.
+ * \param {RCNET_NetPeerStats*} outStats - Etat à remplir (tout à 0 si le client n'est pas connecté).
+ * \return {bool} true si le client est connecté.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_net_shards_get_peer_stats(const RCNET_NetShards* shards, uint32_t clientId, RCNET_NetPeerStats* outStats);
+
+/**
+ * \brief Nombre de packets refusés car la queue d'envoi d'un shard était pleine (tous shards).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint64_t rcnet_net_shards_get_send_overflow_count(const RCNET_NetShards* shards);
+
+/**
+ * \brief Compteurs de chiffrement du slot d'un client (config->secure), cumulés depuis la création des shards.
+ *
+ * \param {const RCNET_NetShards*} shards - Les shards.
+ * \param {uint32_t} clientId - Le client.
+ * \param {RCNET_SecureSessionStats*} outStats - Compteurs à remplir (tout à 0 sans chiffrement).
+ * \return {bool} false si les shards ne chiffrent pas ou si clientId est invalide.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_net_shards_get_secure_stats(const RCNET_NetShards* shards, uint32_t clientId, RCNET_SecureSessionStats* outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_NET_SHARDS_H
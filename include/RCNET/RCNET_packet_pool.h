@@ -0,0 +1,150 @@
+#ifndef RCNET_PACKET_POOL_H
+#define RCNET_PACKET_POOL_H
+
+// Standard C/C++ Libraries
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint32_t, uint64_t
+
+#include <rcenet/RCENET_enet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Pool de buffers pour les données des ENetPacket envoyés.
+ *
+ * Les buffers sont rangés par classes de taille (puissances de 2, de minBufferSize à maxBufferSize).
+ * L'encodeur écrit directement dans un buffer du pool, puis rcnet_packet_pool_create_packet() crée
+ * le packet avec ENET_PACKET_FLAG_NO_ALLOCATE (pas de copie ni de malloc des données) : quand ENet
+ * détruit le packet (envoyé / acké / client parti), son freeCallback rend le buffer au pool.
+ * En régime établi, acquire et release n'allouent donc plus jamais sur le heap.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_PacketPool RCNET_PacketPool;
+
+/**
+ * \brief Configuration d'un RCNET_PacketPool.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_PacketPoolConfig {
+    uint32_t minBufferSize;         // Plus petite classe (arrondie à la puissance de 2 supérieure)
+    uint32_t maxBufferSize;         // Plus grande classe (au-delà : malloc / free à chaque packet)
+    uint32_t preallocatedPerClass;  // Buffers alloués à la création, par classe
+    uint32_t maxFreePerClass;       // Buffers libres gardés par classe (au-delà, rendus au heap)
+} RCNET_PacketPoolConfig;
+
+/**
+ * \brief Compteurs d'un RCNET_PacketPool (depuis sa création).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_PacketPoolStats {
+    uint64_t acquired;          // Buffers pris dans le pool
+    uint64_t released;          // Buffers rendus au pool
+    uint64_t heapAllocations;   // Buffers alloués sur le heap (préallocation comprise) : stable en régime établi
+    uint64_t oversized;         // Demandes plus grandes que maxBufferSize
+    uint32_t outstanding;       // Buffers pris et pas encore rendus (dans des packets en vol)
+    size_t cachedBytes;         // Octets des buffers libres gardés par le pool
+} RCNET_PacketPoolStats;
+
+/**
+ * \brief Configuration par défaut (classes de 64 o à 64 Ko, 32 buffers préalloués et 4096 gardés par classe).
+ *
+ * \param {RCNET_PacketPoolConfig*} outConfig - Configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_packet_pool_get_default_config(RCNET_PacketPoolConfig* outConfig);
+
+/**
+ * \brief Crée un pool de buffers.
+ *
+ * \param {const RCNET_PacketPoolConfig*} config - Configuration (NULL pour la configuration par défaut).
+ * \return {RCNET_PacketPool*} Le pool, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_PacketPool* rcnet_packet_pool_create(const RCNET_PacketPoolConfig* config);
+
+/**
+ * \brief Détruit le pool et ses buffers libres.
+ *
+ * Tous les packets créés avec ce pool doivent avoir été détruits avant (ex: après rcnet_net_shards_destroy).
+ *
+ * \param {RCNET_PacketPool*} pool - Le pool (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_packet_pool_destroy(RCNET_PacketPool* pool);
+
+/**
+ * \brief Prend un buffer d'au moins capacity octets (aligné sur 16 octets).
+ *
+ * \param {RCNET_PacketPool*} pool - Le pool.
+ * \param {size_t} capacity - Taille minimale en octets.
+ * \return {void*} Le buffer, ou NULL si plus de mémoire.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread (ex: jobs d'encodage).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void* rcnet_packet_pool_acquire(RCNET_PacketPool* pool, size_t capacity);
+
+/**
+ * \brief Capacité réelle d'un buffer (>= la taille demandée à rcnet_packet_pool_acquire()).
+ *
+ * \param {const void*} buffer - Buffer retourné par rcnet_packet_pool_acquire().
+ * \return {size_t} La capacité en octets.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_packet_pool_get_buffer_capacity(const void* buffer);
+
+/**
+ * \brief Rend au pool un buffer qui n'a pas été passé à rcnet_packet_pool_create_packet().
+ *
+ * \param {void*} buffer - Buffer retourné par rcnet_packet_pool_acquire() (NULL accepté).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_packet_pool_release(void* buffer);
+
+/**
+ * \brief Crée un ENetPacket qui utilise directement le buffer (ENET_PACKET_FLAG_NO_ALLOCATE).
+ *
+ * La fonction prend toujours possession du buffer : il est rendu au pool à la destruction du packet,
+ * ou immédiatement si la création échoue.
+ *
+ * \param {void*} buffer - Buffer retourné par rcnet_packet_pool_acquire(), contenant les données.
+ * \param {size_t} length - Taille des données (<= capacité du buffer).
+ * \param {enet_uint32} flags - Flags ENet (ex: 0 pour unreliable, ENET_PACKET_FLAG_RELIABLE).
+ * \return {ENetPacket*} Le packet (à passer à rcnet_net_shards_send / enet_peer_send), ou NULL en cas d'erreur.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+ENetPacket* rcnet_packet_pool_create_packet(void* buffer, size_t length, enet_uint32 flags);
+
+/**
+ * \brief Récupère les compteurs du pool.
+ *
+ * \param {const RCNET_PacketPool*} pool - Le pool.
+ * \param {RCNET_PacketPoolStats*} outStats - Compteurs à remplir.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_packet_pool_get_stats(const RCNET_PacketPool* pool, RCNET_PacketPoolStats* outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_PACKET_POOL_H
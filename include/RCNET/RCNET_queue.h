@@ -0,0 +1,148 @@
+#ifndef RCNET_QUEUE_H
+#define RCNET_QUEUE_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint32_t, uint64_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Mode de concurrence d'une RCNET_RingQueue.
+ *
+ * \since Cette enum est disponible depuis RCNET 1.1.0.
+ */
+typedef enum RCNET_RingQueueMode {
+    /**
+     * Un seul producteur, un seul consommateur (ex: un thread réseau -> la simulation).
+     * Le plus rapide : aucune opération CAS.
+     */
+    RCNET_RING_QUEUE_SPSC,
+
+    /**
+     * Plusieurs producteurs, un seul consommateur (ex: plusieurs threads de réception -> la simulation).
+     */
+    RCNET_RING_QUEUE_MPSC
+} RCNET_RingQueueMode;
+
+/**
+ * \brief Queue circulaire bornée, lock-free, avec des éléments de taille fixe copiés par valeur.
+ *
+ * La mémoire est allouée une seule fois à la création : push et pop n'allouent jamais.
+ * Les index producteur / consommateur sont sur des lignes de cache séparées (pas de false sharing).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_RingQueue RCNET_RingQueue;
+
+/**
+ * \brief Compteurs d'une RCNET_RingQueue.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_RingQueueStats {
+    uint32_t capacity;     // capacité réelle (arrondie à la puissance de 2 supérieure)
+    uint32_t size;         // nombre d'éléments en attente (approximatif si des producteurs sont actifs)
+    uint64_t pushed;       // nombre total d'éléments poussés avec succès
+    uint64_t popped;       // nombre total d'éléments consommés
+    uint64_t overflowed;   // nombre de push refusés car la queue était pleine
+} RCNET_RingQueueStats;
+
+/**
+ * \brief Crée une queue circulaire lock-free.
+ *
+ * \param {size_t} elementSize - Taille d'un élément en octets (ex: sizeof(MonInput)).
+ * \param {uint32_t} capacity - Nombre d'éléments maximum, arrondi à la puissance de 2 supérieure.
+ * \param {RCNET_RingQueueMode} mode - SPSC ou MPSC.
+ * \return {RCNET_RingQueue*} La queue, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_RingQueue* rcnet_ring_queue_create(size_t elementSize, uint32_t capacity, RCNET_RingQueueMode mode);
+
+/**
+ * \brief Détruit une queue créée par rcnet_ring_queue_create().
+ *
+ * Aucun producteur ni consommateur ne doit encore utiliser la queue.
+ *
+ * \param {RCNET_RingQueue*} queue - La queue à détruire (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_ring_queue_destroy(RCNET_RingQueue* queue);
+
+/**
+ * \brief Pousse un élément (copié) dans la queue.
+ *
+ * Ne bloque jamais : si la queue est pleine, l'élément est refusé et le compteur overflowed est incrémenté.
+ *
+ * \param {RCNET_RingQueue*} queue - La queue.
+ * \param {const void*} element - Pointeur vers elementSize octets à copier.
+ * \return {bool} true si l'élément a été ajouté, false si la queue est pleine.
+ *
+ * \threadsafety En mode SPSC, un seul thread producteur. En mode MPSC, n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_ring_queue_push(RCNET_RingQueue* queue, const void* element);
+
+/**
+ * \brief Récupère jusqu'à maxCount éléments dans un buffer fourni par l'appelant.
+ *
+ * Aucune allocation : les éléments sont copiés dans outElements, dans l'ordre d'arrivée.
+ *
+ * \param {RCNET_RingQueue*} queue - La queue.
+ * \param {void*} outElements - Buffer de sortie (au moins maxCount * elementSize octets).
+ * \param {uint32_t} maxCount - Nombre maximum d'éléments à récupérer.
+ * \return {uint32_t} Nombre d'éléments effectivement copiés.
+ *
+ * \threadsafety Un seul thread consommateur (SPSC et MPSC).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_ring_queue_pop_batch(RCNET_RingQueue* queue, void* outElements, uint32_t maxCount);
+
+/**
+ * \brief Retourne la capacité réelle de la queue (puissance de 2).
+ *
+ * \param {const RCNET_RingQueue*} queue - La queue.
+ * \return {uint32_t} La capacité.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_ring_queue_get_capacity(const RCNET_RingQueue* queue);
+
+/**
+ * \brief Retourne le nombre de push refusés car la queue était pleine.
+ *
+ * \param {const RCNET_RingQueue*} queue - La queue.
+ * \return {uint64_t} Le compteur d'overflow.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint64_t rcnet_ring_queue_get_overflow_count(const RCNET_RingQueue* queue);
+
+/**
+ * \brief Récupère les compteurs de la queue.
+ *
+ * \param {const RCNET_RingQueue*} queue - La queue.
+ * \param {RCNET_RingQueueStats*} outStats - Compteurs (sortie).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_ring_queue_get_stats(const RCNET_RingQueue* queue, RCNET_RingQueueStats* outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_QUEUE_H
@@ -0,0 +1,186 @@
+#ifndef RCNET_REDIS_H
+#define RCNET_REDIS_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint32_t, uint64_t
+
+#include <hiredis.h>
+
+#include <RCNET/RCNET_histogram.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Client Redis asynchrone (pool de connexions hiredis) piloté par le tick réseau.
+ *
+ * rcnet_redis_command() ne fait que formater la commande dans un buffer : aucun appel réseau,
+ * le tick n'attend jamais Redis. rcnet_redis_update(), appelée une fois par tick réseau, répartit
+ * les commandes sur les connexions du pool (pipelining : toutes les commandes d'un tick partent
+ * en une seule écriture par connexion), lit les réponses disponibles sans bloquer et appelle les
+ * callbacks sur le thread appelant.
+ *
+ * Les connexions perdues sont recréées automatiquement (avec AUTH / SELECT).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_RedisClient RCNET_RedisClient;
+
+/**
+ * \brief Configuration d'un RCNET_RedisClient.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_RedisConfig {
+    const char* host;                  // Adresse du serveur Redis
+    int port;                          // Port du serveur Redis
+    const char* username;              // Utilisateur ACL (NULL : AUTH avec le mot de passe seul)
+    const char* password;              // Mot de passe (NULL : pas d'AUTH)
+    int database;                      // Base sélectionnée à la connexion (SELECT si != 0)
+
+    bool useTLS;                       // Connexion TLS via hiredis_ssl
+    const char* caFile;                // Certificat CA (NULL : magasin système)
+    const char* certFile;              // Certificat client (NULL si pas d'authentification mTLS)
+    const char* keyFile;               // Clé privée client (NULL si pas d'authentification mTLS)
+    const char* serverName;            // Nom SNI / vérification (NULL : host)
+
+    uint32_t poolSize;                 // Nombre de connexions
+    uint32_t maxPendingPerConnection;  // Commandes envoyées sans réponse, par connexion (le reste attend dans le buffer)
+    uint32_t maxQueued;                // Commandes max dans le buffer (au-delà, rcnet_redis_command échoue)
+    int connectTimeoutMs;              // Timeout de connexion
+    int commandTimeoutMs;              // Timeout d'une commande (0 : pas de timeout)
+    int reconnectDelayMs;              // Délai avant de recréer une connexion perdue
+} RCNET_RedisConfig;
+
+/**
+ * \brief Callback d'une commande, appelé par rcnet_redis_update() sur son thread.
+ *
+ * \param {const redisReply*} reply - Réponse (appartient à hiredis, valide pendant le callback uniquement).
+ *                                   NULL si la commande n'a pas abouti (connexion perdue, timeout, client détruit).
+ * \param {void*} userdata - Donnée passée à rcnet_redis_command().
+ *
+ * \since Ce type est disponible depuis RCNET 1.1.0.
+ */
+typedef void (*RCNET_RedisCallback)(const redisReply* reply, void* userdata);
+
+/**
+ * \brief Compteurs d'un RCNET_RedisClient (depuis sa création).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_RedisStats {
+    uint64_t commands;                  // Commandes acceptées par rcnet_redis_command*
+    uint64_t replies;                   // Réponses reçues (y compris les réponses d'erreur Redis)
+    uint64_t errorReplies;              // Réponses de type erreur (-ERR ...)
+    uint64_t failed;                    // Commandes sans réponse (connexion perdue, timeout, destruction)
+    uint64_t dropped;                   // Commandes refusées car le buffer était plein
+    uint64_t reconnects;                // Connexions recréées
+    uint32_t queued;                    // Commandes dans le buffer, pas encore envoyées
+    uint32_t pending;                   // Commandes envoyées en attente de réponse
+    uint32_t connected;                 // Connexions établies
+    RCNET_HistogramSummary latencyNs;   // Latence rcnet_redis_command -> callback
+} RCNET_RedisStats;
+
+/**
+ * \brief Configuration par défaut (127.0.0.1:6379, 2 connexions, 1024 commandes en vol par connexion).
+ *
+ * \param {RCNET_RedisConfig*} outConfig - Configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_redis_get_default_config(RCNET_RedisConfig* outConfig);
+
+/**
+ * \brief Crée un client Redis et lance la connexion de son pool (non bloquant).
+ *
+ * Les commandes envoyées avant l'établissement des connexions attendent dans le buffer.
+ * Les chaînes de la configuration sont copiées.
+ *
+ * \param {const RCNET_RedisConfig*} config - Configuration (NULL pour la configuration par défaut).
+ * \return {RCNET_RedisClient*} Le client, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_RedisClient* rcnet_redis_create(const RCNET_RedisConfig* config);
+
+/**
+ * \brief Ferme les connexions et détruit le client.
+ *
+ * Tous les callbacks restants (commandes en vol ou dans le buffer) sont appelés avec reply = NULL
+ * sur le thread appelant avant le retour, sans verrou interne tenu. Une commande envoyée depuis
+ * un de ces callbacks est refusée (rcnet_redis_command retourne false).
+ *
+ * \param {RCNET_RedisClient*} client - Le client (NULL accepté).
+ *
+ * \threadsafety Même thread que rcnet_redis_update().
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_redis_destroy(RCNET_RedisClient* client);
+
+/**
+ * \brief Met une commande dans le buffer (format hiredis : %s chaîne, %b binaire + taille).
+ *
+ * Exemple : rcnet_redis_command(client, OnProfile, player, "HGETALL player:%s", playerId);
+ *
+ * \param {RCNET_RedisClient*} client - Le client.
+ * \param {RCNET_RedisCallback} callback - Callback de la réponse (NULL accepté).
+ * \param {void*} userdata - Donnée passée au callback.
+ * \param {const char*} format - Commande au format hiredis.
+ * \return {bool} true si la commande est dans le buffer, false si le buffer est plein ou le format invalide.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread (ex: depuis rcnet_simulation_update).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_redis_command(RCNET_RedisClient* client, RCNET_RedisCallback callback, void* userdata, const char* format, ...);
+
+/**
+ * \brief Met une commande dans le buffer à partir de ses arguments (données binaires acceptées).
+ *
+ * \param {RCNET_RedisClient*} client - Le client.
+ * \param {RCNET_RedisCallback} callback - Callback de la réponse (NULL accepté).
+ * \param {void*} userdata - Donnée passée au callback.
+ * \param {int} argc - Nombre d'arguments (commande comprise).
+ * \param {const char**} argv - Arguments.
+ * \param {const size_t*} argvLengths - Taille de chaque argument (NULL : chaînes terminées par '\0').
+ * \return {bool} true si la commande est dans le buffer, false si le buffer est plein ou les paramètres invalides.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_redis_command_argv(RCNET_RedisClient* client, RCNET_RedisCallback callback, void* userdata, int argc, const char** argv, const size_t* argvLengths);
+
+/**
+ * \brief Reconnecte, envoie le buffer, lit les réponses disponibles et appelle leurs callbacks (jamais bloquant).
+ *
+ * A appeler une fois par tick réseau (rcnet_network_update), toujours depuis le même thread.
+ *
+ * \param {RCNET_RedisClient*} client - Le client.
+ * \return {uint32_t} Nombre de callbacks appelés.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_redis_update(RCNET_RedisClient* client);
+
+/**
+ * \brief Récupère les compteurs du client.
+ *
+ * \param {const RCNET_RedisClient*} client - Le client.
+ * \param {RCNET_RedisStats*} outStats - Compteurs à remplir.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_redis_get_stats(const RCNET_RedisClient* client, RCNET_RedisStats* outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_REDIS_H
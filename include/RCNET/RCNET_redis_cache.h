@@ -0,0 +1,185 @@
+#ifndef RCNET_REDIS_CACHE_H
+#define RCNET_REDIS_CACHE_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint32_t, uint64_t
+
+#include <RCNET/RCNET_nats.h>
+#include <RCNET/RCNET_redis.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Cache local read-through devant un RCNET_RedisClient (profils joueurs, sessions...).
+ *
+ * - TTL par clé (défaut de la configuration ou TTL explicite)
+ * - éviction CLOCK bornée en octets (clé + valeur + coût fixe par entrée)
+ * - les miss simultanés sur une même clé sont regroupés en un seul GET Redis
+ * - invalidation par un sujet NATS (payload = "<origine>:clé"), pour les écritures faites par d'autres serveurs
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_RedisCache RCNET_RedisCache;
+
+/**
+ * \brief Configuration d'un RCNET_RedisCache.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_RedisCacheConfig {
+    size_t maxBytes;         // Taille max du cache (clés + valeurs + coût fixe par entrée)
+    uint32_t defaultTtlMs;   // TTL des valeurs lues dans Redis
+    uint32_t negativeTtlMs;  // TTL d'une clé absente de Redis (0 : les absences ne sont pas mises en cache)
+} RCNET_RedisCacheConfig;
+
+/**
+ * \brief Callback d'une lecture.
+ *
+ * \param {const char*} key - La clé demandée.
+ * \param {const void*} value - La valeur (valide pendant le callback uniquement), NULL si absente.
+ * \param {size_t} length - Taille de la valeur.
+ * \param {bool} found - false si la clé n'existe pas ou si Redis n'a pas répondu.
+ * \param {void*} userdata - Donnée passée à rcnet_redis_cache_get().
+ *
+ * \since Ce type est disponible depuis RCNET 1.1.0.
+ */
+typedef void (*RCNET_RedisCacheCallback)(const char* key, const void* value, size_t length, bool found, void* userdata);
+
+/**
+ * \brief Compteurs d'un RCNET_RedisCache (depuis sa création).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_RedisCacheStats {
+    uint64_t hits;           // Lectures servies par le cache
+    uint64_t misses;         // Lectures envoyées à Redis (un GET)
+    uint64_t coalesced;      // Lectures rattachées à un GET déjà en cours
+    uint64_t evictions;      // Entrées évincées pour rester sous maxBytes
+    uint64_t expirations;    // Entrées expirées (TTL)
+    uint64_t invalidations;  // Entrées invalidées (rcnet_redis_cache_invalidate / sujet NATS)
+    uint32_t entries;        // Entrées actuellement en cache
+    size_t bytes;            // Octets actuellement utilisés
+} RCNET_RedisCacheStats;
+
+/**
+ * \brief Configuration par défaut (64 Mo, TTL 30 s, absences en cache 1 s).
+ *
+ * \param {RCNET_RedisCacheConfig*} outConfig - Configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_redis_cache_get_default_config(RCNET_RedisCacheConfig* outConfig);
+
+/**
+ * \brief Crée un cache devant un client Redis.
+ *
+ * \param {RCNET_RedisClient*} redis - Client Redis (doit survivre au cache).
+ * \param {const RCNET_RedisCacheConfig*} config - Configuration (NULL pour la configuration par défaut).
+ * \return {RCNET_RedisCache*} Le cache, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_RedisCache* rcnet_redis_cache_create(RCNET_RedisClient* redis, const RCNET_RedisCacheConfig* config);
+
+/**
+ * \brief Détruit le cache (et son abonnement NATS d'invalidation).
+ *
+ * Les lectures encore en cours reçoivent leur callback quand Redis répond (found = false si le client
+ * Redis est détruit avant) : le client Redis doit être détruit ou mis à jour encore une fois après le cache.
+ * Si une invalidation NATS est attachée, attend la fin de son abonnement (voir rcnet_nats_unsubscribe_and_wait()) :
+ * ne pas appeler depuis un handler NATS, et détruire le client NATS après le cache.
+ *
+ * \param {RCNET_RedisCache*} cache - Le cache (NULL accepté).
+ *
+ * \threadsafety Même thread que rcnet_redis_update().
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_redis_cache_destroy(RCNET_RedisCache* cache);
+
+/**
+ * \brief Lit une clé (GET) : depuis le cache si présente et non expirée, sinon depuis Redis.
+ *
+ * Hit : le callback est appelé immédiatement, sur le thread appelant.
+ * Miss : le callback est appelé par rcnet_redis_update() à la réponse de Redis ; les autres miss
+ * sur la même clé pendant ce temps attendent la même réponse.
+ *
+ * \param {RCNET_RedisCache*} cache - Le cache.
+ * \param {const char*} key - La clé Redis.
+ * \param {RCNET_RedisCacheCallback} callback - Callback du résultat.
+ * \param {void*} userdata - Donnée passée au callback.
+ * \return {bool} true si le callback a été ou sera appelé, false si la requête Redis n'a pas pu être mise en buffer.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_redis_cache_get(RCNET_RedisCache* cache, const char* key, RCNET_RedisCacheCallback callback, void* userdata);
+
+/**
+ * \brief Ecrit une clé dans Redis (SET ... PX ttl) et met à jour le cache local.
+ *
+ * Si un sujet d'invalidation NATS est attaché, la clé y est publiée pour les caches des autres serveurs.
+ *
+ * \param {RCNET_RedisCache*} cache - Le cache.
+ * \param {const char*} key - La clé Redis.
+ * \param {const void*} value - La valeur.
+ * \param {size_t} length - Taille de la valeur.
+ * \param {uint32_t} ttlMs - TTL de la clé dans Redis et dans le cache (0 : defaultTtlMs dans le cache, pas d'expiration dans Redis).
+ * \return {bool} true si la commande Redis a été mise en buffer.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_redis_cache_set(RCNET_RedisCache* cache, const char* key, const void* value, size_t length, uint32_t ttlMs);
+
+/**
+ * \brief Retire une clé du cache local (la prochaine lecture ira dans Redis).
+ *
+ * \param {RCNET_RedisCache*} cache - Le cache.
+ * \param {const char*} key - La clé.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_redis_cache_invalidate(RCNET_RedisCache* cache, const char* key);
+
+/**
+ * \brief Invalide les clés publiées sur un sujet NATS, via rcnet_nats_subscribe().
+ *
+ * rcnet_redis_cache_set publie "<origine>:<clé>", où origine est l'identifiant du cache sur 16 chiffres
+ * hexadécimaux : un cache ignore ses propres invalidations. Un payload sans ce préfixe est une clé seule
+ * (publiée par un autre outil) et invalide la clé dans tous les caches.
+ *
+ * \param {RCNET_RedisCache*} cache - Le cache.
+ * \param {RCNET_NATSClient*} nats - Client NATS initialisé (doit survivre au cache).
+ * \param {const char*} subject - Sujet d'invalidation (ex: "cache.invalidate.players").
+ * \return {bool} true en cas de succès.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_redis_cache_attach_nats_invalidation(RCNET_RedisCache* cache, RCNET_NATSClient* nats, const char* subject);
+
+/**
+ * \brief Récupère les compteurs du cache.
+ *
+ * \param {const RCNET_RedisCache*} cache - Le cache.
+ * \param {RCNET_RedisCacheStats*} outStats - Compteurs à remplir.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_redis_cache_get_stats(const RCNET_RedisCache* cache, RCNET_RedisCacheStats* outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_REDIS_CACHE_H
@@ -0,0 +1,220 @@
+#ifndef RCNET_REPLICATION_H
+#define RCNET_REPLICATION_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint8_t, uint32_t, uint64_t
+
+#include <RCNET/RCNET_nats.h> // RCNET_NATSClient, RCNET_NATSAsyncPublisher
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Réplication d'état clé / valeur entre serveurs de jeu via NATS (présence, handoff de shard, ...).
+ *
+ * Chaque serveur (source) écrit ses clés avec rcnet_replication_set / rcnet_replication_remove : les
+ * écritures d'une même clé entre deux flush sont fusionnées, et rcnet_replication_flush (une fois par
+ * tick réseau) publie au plus un message binaire sur "<subjectPrefix>.<sourceId>.delta", compressé en LZ4
+ * si demandé. Le nombre de messages envoyés au broker suit donc les ticks, pas les changements d'état.
+ *
+ * Chaque message porte un numéro de séquence par source ; tous les snapshotIntervalTicks flush, la source
+ * publie son état complet sur "<subjectPrefix>.<sourceId>.snapshot". Les autres serveurs reçoivent les
+ * messages sur "<subjectPrefix>.*.*" et les appliquent dans rcnet_replication_poll (sur leur thread) : un
+ * trou dans les séquences déclenche une resynchronisation depuis le stream JetStream (créé avec
+ * rcnet_nats_check_and_create_stream), lue sans bloquer le tick à partir du dernier état complet de la
+ * source (jamais depuis le début du stream). Une resynchronisation qui n'apporte rien de plus récent
+ * n'est pas relancée avant resyncTimeoutMs.
+ *
+ * \since Ce module est disponible depuis RCNET 1.1.0.
+ */
+
+/**
+ * \brief Canal de réplication (écriture de l'état local + réplique des autres sources).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_Replication RCNET_Replication;
+
+/**
+ * \brief Changement d'une clé d'une autre source (value NULL : clé supprimée).
+ *
+ * Appelé depuis rcnet_replication_poll ; key et value ne sont valides que pendant l'appel.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef void (*RCNET_ReplicationChangeCallback)(const char* sourceId, const char* key, const uint8_t* value, size_t valueLength,
+                                                void* userdata);
+
+/**
+ * \brief Configuration d'un canal.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_ReplicationConfig {
+    const char* subjectPrefix;        // ex: "rcnet.repl.presence" (copié)
+    const char* sourceId;             // id de ce serveur, un token NATS sans '.' ni wildcard (copié)
+    const char* streamName;           // stream JetStream des messages (resynchronisation), NULL = NATS core sans resync
+    int64_t streamMaxAgeNs;           // âge max des messages du stream (plus long que snapshotIntervalTicks flush, 0 = sans limite)
+    uint32_t snapshotIntervalTicks;   // état complet tous les N flush (0 = seulement au premier flush)
+    bool compress;                    // payload en LZ4 (rcnet_compression_compress_block)
+    size_t minCompressSize;           // taille en dessous de laquelle le payload reste brut
+    uint32_t resyncTimeoutMs;         // durée max d'une resynchronisation
+    size_t maxMessageSize;            // corps reçu max après décompression (au-delà : ignoré, compté dans decodeErrors)
+    RCNET_NATSAsyncPublisher* publisher; // publisher partagé (flushé par l'appelant), NULL = publisher propre au canal
+    RCNET_ReplicationChangeCallback on_change;
+    void* userdata;
+} RCNET_ReplicationConfig;
+
+/**
+ * \brief Compteurs d'un canal (depuis sa création).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_ReplicationStats {
+    uint64_t updates;             // appels à set / remove
+    uint64_t coalesced;           // updates fusionnés avec un update de la même clé avant flush
+    uint64_t batchesPublished;    // messages publiés (un par flush avec des changements)
+    uint64_t snapshotsPublished;  // dont états complets
+    uint64_t entriesPublished;
+    uint64_t bytesPublished;      // après compression
+    uint64_t bytesUncompressed;
+    uint64_t publishFailures;
+
+    uint64_t batchesReceived;
+    uint64_t entriesApplied;
+    uint64_t duplicates;          // séquence déjà appliquée (ex: rejouée par une resynchronisation)
+    uint64_t gaps;                // trous de séquence détectés
+    uint64_t resyncs;             // resynchronisations terminées
+    uint64_t resyncFailures;      // resynchronisations abandonnées (timeout, stream indisponible)
+    uint64_t decodeErrors;        // messages invalides ou plus gros que maxMessageSize (ignorés)
+    uint32_t sources;             // sources connues
+} RCNET_ReplicationStats;
+
+/**
+ * \brief Configuration par défaut (sans stream, état complet tous les 600 flush, LZ4 au-delà de 256 octets,
+ *        resynchronisation de 2 s max, messages de 4 Mo max, publisher propre au canal).
+ *
+ * subjectPrefix et sourceId restent à renseigner.
+ *
+ * \param {RCNET_ReplicationConfig*} outConfig - Configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_replication_get_default_config(RCNET_ReplicationConfig* outConfig);
+
+/**
+ * \brief Crée le canal, le stream (si streamName) et l'abonnement "<subjectPrefix>.*".
+ *
+ * \param {RCNET_NATSClient*} client - Client NATS initialisé (valide jusqu'à la destruction du canal).
+ * \param {const RCNET_ReplicationConfig*} config - Configuration.
+ * \return {RCNET_Replication*} Le canal, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_Replication* rcnet_replication_create(RCNET_NATSClient* client, const RCNET_ReplicationConfig* config);
+
+/**
+ * \brief Se désabonne et détruit le canal (les changements non flushés sont perdus).
+ *
+ * Attend la fin de l'abonnement (voir rcnet_nats_unsubscribe_and_wait()) : ne pas appeler depuis
+ * un handler NATS. Avec un publisher partagé, les callbacks d'accusé de réception du canal sont
+ * retirés (rcnet_nats_async_publisher_cancel_callbacks()) : ne pas appeler depuis un callback de
+ * ce publisher.
+ *
+ * \param {RCNET_Replication*} replication - Le canal (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_replication_destroy(RCNET_Replication* replication);
+
+/**
+ * \brief Ecrit une clé de l'état local (copie, publiée au prochain flush).
+ *
+ * \param {RCNET_Replication*} replication - Le canal.
+ * \param {const char*} key - La clé (65535 octets max).
+ * \param {const void*} value - La valeur.
+ * \param {size_t} valueLength - Sa taille.
+ * \return {bool} false si un paramètre est invalide.
+ *
+ * \threadsafety set / remove peuvent être appelées depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_replication_set(RCNET_Replication* replication, const char* key, const void* value, size_t valueLength);
+
+/**
+ * \brief Supprime une clé de l'état local (publiée au prochain flush).
+ *
+ * \param {RCNET_Replication*} replication - Le canal.
+ * \param {const char*} key - La clé.
+ * \return {bool} false si la clé n'existe pas.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_replication_remove(RCNET_Replication* replication, const char* key);
+
+/**
+ * \brief Publie les changements depuis le flush précédent (ou l'état complet) en un seul message.
+ *
+ * A appeler une fois par tick réseau, toujours depuis le même thread. Flushe aussi le publisher du
+ * canal s'il lui est propre. Si la publication échoue, sa séquence est tout de même consommée (les
+ * autres serveurs voient le trou) et le flush suivant publie l'état complet.
+ *
+ * \param {RCNET_Replication*} replication - Le canal.
+ * \return {uint32_t} Nombre d'entrées publiées.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_replication_flush(RCNET_Replication* replication);
+
+/**
+ * \brief Applique les messages reçus des autres sources (on_change) et avance les resynchronisations.
+ *
+ * Ne bloque pas : une resynchronisation lit les messages déjà arrivés du stream à chaque appel.
+ *
+ * \param {RCNET_Replication*} replication - Le canal.
+ * \return {uint32_t} Nombre d'entrées appliquées.
+ *
+ * \threadsafety A appeler toujours depuis le même thread (celui qui lit la réplique).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_replication_poll(RCNET_Replication* replication);
+
+/**
+ * \brief Valeur répliquée d'une clé d'une autre source.
+ *
+ * \param {const RCNET_Replication*} replication - Le canal.
+ * \param {const char*} sourceId - La source.
+ * \param {const char*} key - La clé.
+ * \param {const uint8_t**} outValue - Valeur (valide jusqu'au prochain rcnet_replication_poll).
+ * \param {size_t*} outValueLength - Sa taille.
+ * \return {bool} false si la clé n'est pas connue.
+ *
+ * \threadsafety Depuis le thread de rcnet_replication_poll.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_replication_get(const RCNET_Replication* replication, const char* sourceId, const char* key, const uint8_t** outValue,
+                           size_t* outValueLength);
+
+/**
+ * \brief Récupère les compteurs du canal.
+ *
+ * \param {const RCNET_Replication*} replication - Le canal.
+ * \param {RCNET_ReplicationStats*} outStats - Compteurs à remplir.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_replication_get_stats(const RCNET_Replication* replication, RCNET_ReplicationStats* outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_REPLICATION_H
@@ -0,0 +1,263 @@
+#ifndef RCNET_SECURE_CHANNEL_H
+#define RCNET_SECURE_CHANNEL_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint8_t, uint32_t, uint64_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Chiffrement authentifié des payloads ENet (libsodium : crypto_kx + ChaCha20-Poly1305 IETF).
+ *
+ * Handshake : le client connaît la clé publique statique du serveur (transmise par le matchmaking) et
+ * envoie un HELLO avec une clé publique éphémère. Le serveur répond par un WELCOME portant un nonce
+ * aléatoire tiré pour cette connexion ; les clés de session (une par sens) sont les clés crypto_kx
+ * mêlées à ce nonce (BLAKE2b). Un HELLO capturé puis rejoué sur une nouvelle connexion donne donc
+ * d'autres clés : les packets capturés avec lui sont rejetés. Seul le détenteur de la clé secrète du
+ * serveur peut lire le trafic ou produire un WELCOME valide : le serveur est authentifié, le client
+ * l'est par le jeu (token de session, ...).
+ *
+ * Format d'un packet : compteur (4 octets, poids faibles du compteur 64 bits du channel) | payload
+ * chiffré | tag (16 octets). Le nonce n'est jamais transmis : il est reconstruit à partir du channel
+ * et du compteur, ce dernier servant aussi à la fenêtre anti-rejeu (64 packets par channel).
+ * Chiffrement et déchiffrement se font en place dans le buffer du packet (pas de copie).
+ *
+ * \since Ce module est disponible depuis RCNET 1.1.0.
+ */
+
+/**
+ * \brief Tailles du format (octets).
+ *
+ * Un payload de n octets est écrit à RCNET_SECURE_HEADER_SIZE dans un buffer d'au moins
+ * n + RCNET_SECURE_OVERHEAD octets.
+ *
+ * \since Ces macros sont disponibles depuis RCNET 1.1.0.
+ */
+#define RCNET_SECURE_PUBLIC_KEY_SIZE 32u
+#define RCNET_SECURE_SECRET_KEY_SIZE 32u
+#define RCNET_SECURE_HEADER_SIZE     4u
+#define RCNET_SECURE_TAG_SIZE        16u
+#define RCNET_SECURE_OVERHEAD        (RCNET_SECURE_HEADER_SIZE + RCNET_SECURE_TAG_SIZE)
+#define RCNET_SECURE_SERVER_NONCE_SIZE 32u
+#define RCNET_SECURE_HELLO_SIZE      (4u + RCNET_SECURE_PUBLIC_KEY_SIZE)
+#define RCNET_SECURE_WELCOME_SIZE    (4u + RCNET_SECURE_SERVER_NONCE_SIZE + RCNET_SECURE_TAG_SIZE)
+#define RCNET_SECURE_MAX_CHANNELS    16u
+
+/**
+ * \brief Paire de clés crypto_kx (clé statique du serveur).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_SecureKeyPair {
+    uint8_t publicKey[RCNET_SECURE_PUBLIC_KEY_SIZE];
+    uint8_t secretKey[RCNET_SECURE_SECRET_KEY_SIZE];
+} RCNET_SecureKeyPair;
+
+/**
+ * \brief Session chiffrée avec un peer (clés dérivées, compteurs et fenêtres anti-rejeu par channel).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_SecureSession RCNET_SecureSession;
+
+/**
+ * \brief Compteurs d'une session (depuis sa création, conservés par rcnet_secure_session_reset).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_SecureSessionStats {
+    uint64_t sealed;            // packets chiffrés
+    uint64_t opened;            // packets déchiffrés et authentifiés
+    uint64_t authFailures;      // tag invalide / packet trop court / session non établie
+    uint64_t replays;           // compteur déjà vu
+    uint64_t tooOld;            // compteur sorti de la fenêtre anti-rejeu
+    uint64_t handshakeFailures; // HELLO (clé publique invalide) ou WELCOME (tag invalide) non authentifié
+    uint64_t earlyPackets;      // packets qui ne sont pas un HELLO / WELCOME reçus avant l'établissement (ignorés)
+} RCNET_SecureSessionStats;
+
+/**
+ * \brief Génère une paire de clés (clé statique d'un serveur).
+ *
+ * \param {RCNET_SecureKeyPair*} outKeys - Les clés.
+ * \return {bool} false si libsodium n'a pas pu être initialisé.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_secure_generate_keypair(RCNET_SecureKeyPair* outKeys);
+
+/**
+ * \brief Efface une zone mémoire (clés) sans que le compilateur puisse supprimer l'écriture.
+ *
+ * \param {void*} data - La zone.
+ * \param {size_t} size - Sa taille.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_secure_wipe(void* data, size_t size);
+
+/**
+ * \brief Crée une session non établie (à préallouer par slot de peer : aucune allocation à la connexion).
+ *
+ * \param {uint32_t} channelCount - Nombre de channels (1..RCNET_SECURE_MAX_CHANNELS).
+ * \return {RCNET_SecureSession*} La session, ou NULL en cas d'erreur.
+ *
+ * \threadsafety Une session est utilisée par un seul thread à la fois (ex: le thread du shard de son peer).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_SecureSession* rcnet_secure_session_create(uint32_t channelCount);
+
+/**
+ * \brief Détruit une session (clés effacées).
+ *
+ * \param {RCNET_SecureSession*} session - La session (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_secure_session_destroy(RCNET_SecureSession* session);
+
+/**
+ * \brief Revient à l'état non établi (clés effacées, compteurs remis à zéro), ex: à la déconnexion du peer.
+ *
+ * \param {RCNET_SecureSession*} session - La session.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_secure_session_reset(RCNET_SecureSession* session);
+
+/**
+ * \brief Côté client : prépare le HELLO à envoyer (en reliable) au serveur.
+ *
+ * La session n'est établie qu'après le WELCOME du serveur (rcnet_secure_session_finish_client) :
+ * rien ne peut être chiffré avant.
+ *
+ * \param {RCNET_SecureSession*} session - La session.
+ * \param {const uint8_t*} serverPublicKey - Clé publique du serveur (RCNET_SECURE_PUBLIC_KEY_SIZE octets).
+ * \param {uint8_t*} outHello - HELLO (RCNET_SECURE_HELLO_SIZE octets, en clair).
+ * \return {bool} false si la clé du serveur est invalide.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_secure_session_start_client(RCNET_SecureSession* session, const uint8_t* serverPublicKey, uint8_t* outHello);
+
+/**
+ * \brief Côté client : valide le WELCOME du serveur et établit la session.
+ *
+ * \param {RCNET_SecureSession*} session - La session (après rcnet_secure_session_start_client).
+ * \param {const uint8_t*} welcome - Packet reçu.
+ * \param {size_t} welcomeLength - Sa taille.
+ * \return {bool} false si le packet n'est pas un WELCOME (earlyPackets incrémenté, à ignorer) ou si le
+ *         WELCOME n'est pas authentifié (handshakeFailures incrémenté, session remise à zéro).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_secure_session_finish_client(RCNET_SecureSession* session, const uint8_t* welcome, size_t welcomeLength);
+
+/**
+ * \brief Côté serveur : valide le HELLO d'un client, tire le nonce de la connexion et dérive les clés de session.
+ *
+ * Le WELCOME est à envoyer en clair (reliable) au client avant tout packet chiffré.
+ *
+ * \param {RCNET_SecureSession*} session - La session (non établie).
+ * \param {const RCNET_SecureKeyPair*} serverKeys - Clés statiques du serveur.
+ * \param {const uint8_t*} hello - Packet reçu.
+ * \param {size_t} helloLength - Sa taille.
+ * \param {uint8_t*} outWelcome - WELCOME (RCNET_SECURE_WELCOME_SIZE octets), écrit si la fonction réussit.
+ * \return {bool} false si le packet n'est pas un HELLO (earlyPackets incrémenté) ou si le HELLO n'est
+ *         pas authentifié (handshakeFailures incrémenté, voir rcnet_secure_is_hello).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_secure_session_accept_client(RCNET_SecureSession* session, const RCNET_SecureKeyPair* serverKeys, const uint8_t* hello,
+                                        size_t helloLength, uint8_t* outWelcome);
+
+/**
+ * \brief Indique si un packet a la forme d'un HELLO (taille et en-tête), sans le valider.
+ *
+ * Permet au serveur de distinguer un HELLO invalide (peer à déconnecter) d'un packet chiffré parti
+ * après le HELLO mais arrivé avant lui (à ignorer).
+ *
+ * \param {const uint8_t*} data - Packet reçu.
+ * \param {size_t} length - Sa taille.
+ * \return {bool} true si le packet est un HELLO.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_secure_is_hello(const uint8_t* data, size_t length);
+
+/**
+ * \brief Indique si un packet a la forme d'un WELCOME (taille et en-tête), sans le valider.
+ *
+ * \param {const uint8_t*} data - Packet reçu.
+ * \param {size_t} length - Sa taille.
+ * \return {bool} true si le packet est un WELCOME.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_secure_is_welcome(const uint8_t* data, size_t length);
+
+/**
+ * \brief Indique si les clés de session sont dérivées.
+ *
+ * \param {const RCNET_SecureSession*} session - La session.
+ * \return {bool} true si seal / open sont utilisables.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_secure_session_is_established(const RCNET_SecureSession* session);
+
+/**
+ * \brief Chiffre en place un payload écrit à buffer + RCNET_SECURE_HEADER_SIZE.
+ *
+ * \param {RCNET_SecureSession*} session - La session (établie).
+ * \param {uint8_t} channelId - Channel ENet du packet (< channelCount).
+ * \param {uint8_t*} buffer - Buffer du packet (compteur écrit devant le payload, tag derrière).
+ * \param {size_t} payloadLength - Taille du payload.
+ * \param {size_t} capacity - Taille du buffer (>= payloadLength + RCNET_SECURE_OVERHEAD).
+ * \return {size_t} Taille du packet (payloadLength + RCNET_SECURE_OVERHEAD), 0 en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_secure_session_seal(RCNET_SecureSession* session, uint8_t channelId, uint8_t* buffer, size_t payloadLength,
+                                 size_t capacity);
+
+/**
+ * \brief Authentifie puis déchiffre en place un packet reçu.
+ *
+ * La fenêtre anti-rejeu n'avance qu'après authentification : un packet forgé ne peut pas faire
+ * rejeter les packets légitimes.
+ *
+ * \param {RCNET_SecureSession*} session - La session (établie).
+ * \param {uint8_t} channelId - Channel ENet de réception.
+ * \param {uint8_t*} data - Données du packet (modifiées).
+ * \param {size_t} length - Taille du packet.
+ * \param {const uint8_t**} outPayload - Payload en clair (dans data).
+ * \param {size_t*} outPayloadLength - Sa taille.
+ * \return {bool} false si le packet est rejeté (tag invalide, rejeu, trop ancien).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_secure_session_open(RCNET_SecureSession* session, uint8_t channelId, uint8_t* data, size_t length,
+                               const uint8_t** outPayload, size_t* outPayloadLength);
+
+/**
+ * \brief Récupère les compteurs d'une session.
+ *
+ * \param {const RCNET_SecureSession*} session - La session.
+ * \param {RCNET_SecureSessionStats*} outStats - Compteurs à remplir.
+ *
+ * \threadsafety Peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_secure_session_get_stats(const RCNET_SecureSession* session, RCNET_SecureSessionStats* outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_SECURE_CHANNEL_H
@@ -0,0 +1,191 @@
+#ifndef RCNET_SIMD_H
+#define RCNET_SIMD_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint32_t, uint64_t, uint8_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Kernels vectorisés de sérialisation des snapshots (quantification, delta varint, diff XOR).
+ *
+ * Chaque kernel a une implémentation scalaire et des implémentations SSE4.1 / AVX2 (x86-64) et NEON
+ * (arm64). Le backend est choisi une fois, au premier appel, selon le CPU (cpuid) : un binaire
+ * x86-64 générique profite d'AVX2 sans être compilé avec -mavx2. Tous les backends produisent
+ * exactement les mêmes octets que le scalaire (pour la quantification : tant que le compilateur ne
+ * fusionne pas mul + add en FMA dans rcnet_quantize_float(), ex: -mfma ou arm64 avec -ffp-contract=fast ;
+ * l'écart est alors d'1 unité au plus, sur les valeurs à mi-chemin entre deux pas).
+ *
+ * \since Ce module est disponible depuis RCNET 1.1.0.
+ */
+
+/**
+ * \brief Taille maximale de rcnet_simd_encode_delta_varint() pour count valeurs (5 octets par valeur).
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_SIMD_VARINT_MAX_SIZE(count) ((size_t)(count) * 5u)
+
+/**
+ * \brief Implémentation des kernels.
+ *
+ * \since Cette énumération est disponible depuis RCNET 1.1.0.
+ */
+typedef enum RCNET_SimdBackend {
+    /**
+     * Meilleur backend supporté par le CPU (valeur acceptée par rcnet_simd_set_backend() uniquement).
+     */
+    RCNET_SIMD_BACKEND_AUTO = 0,
+
+    /**
+     * C++ portable (toujours disponible).
+     */
+    RCNET_SIMD_BACKEND_SCALAR,
+
+    /**
+     * x86-64, 4 valeurs par itération.
+     */
+    RCNET_SIMD_BACKEND_SSE41,
+
+    /**
+     * x86-64, 8 valeurs par itération.
+     */
+    RCNET_SIMD_BACKEND_AVX2,
+
+    /**
+     * arm64 (toujours disponible sur cette architecture), 4 valeurs par itération.
+     */
+    RCNET_SIMD_BACKEND_NEON
+} RCNET_SimdBackend;
+
+/**
+ * \brief Backend utilisé par les kernels.
+ *
+ * \return {RCNET_SimdBackend} Le backend (jamais AUTO).
+ *
+ * \threadsafety Toutes les fonctions de ce module peuvent être appelées depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_SimdBackend rcnet_simd_get_backend(void);
+
+/**
+ * \brief Force un backend (benchmarks, comparaison avec le scalaire). AUTO revient à la détection.
+ *
+ * \param {RCNET_SimdBackend} backend - Le backend.
+ * \return {bool} false si le backend n'est pas supporté par ce CPU / ce build (backend inchangé).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_simd_set_backend(RCNET_SimdBackend backend);
+
+/**
+ * \brief Indique si un backend est supporté par ce CPU / ce build.
+ *
+ * \param {RCNET_SimdBackend} backend - Le backend.
+ * \return {bool} true si supporté (AUTO et SCALAR le sont toujours).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_simd_is_backend_supported(RCNET_SimdBackend backend);
+
+/**
+ * \brief Nom d'un backend ("scalar", "sse4.1", "avx2", "neon", "auto").
+ *
+ * \param {RCNET_SimdBackend} backend - Le backend.
+ * \return {const char*} Le nom (chaîne statique).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+const char* rcnet_simd_get_backend_name(RCNET_SimdBackend backend);
+
+/**
+ * \brief rcnet_quantize_float() sur un tableau (même résultat, valeur par valeur).
+ *
+ * \param {const float*} values - Valeurs à quantifier.
+ * \param {uint32_t} count - Nombre de valeurs.
+ * \param {float} minValue - Borne basse.
+ * \param {float} maxValue - Borne haute.
+ * \param {uint32_t} bitCount - Bits par valeur (1..24).
+ * \param {uint32_t*} outQuantized - count valeurs quantifiées.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_simd_quantize_floats(const float* values, uint32_t count, float minValue, float maxValue, uint32_t bitCount,
+                                uint32_t* outQuantized);
+
+/**
+ * \brief Diff XOR d'une colonne contre sa baseline, compacté.
+ *
+ * Bit i de outChangedMask = (current[i] != baseline[i]) ; outPacked reçoit current[i] ^ baseline[i]
+ * des seules valeurs modifiées, dans l'ordre des index.
+ *
+ * \param {const uint32_t*} current - Colonne courante.
+ * \param {const uint32_t*} baseline - Colonne de référence.
+ * \param {uint32_t} count - Nombre de valeurs.
+ * \param {uint64_t*} outChangedMask - (count + 63) / 64 mots.
+ * \param {uint32_t*} outPacked - Jusqu'à count valeurs.
+ * \return {uint32_t} Nombre de valeurs modifiées (écrites dans outPacked).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_simd_xor_diff(const uint32_t* current, const uint32_t* baseline, uint32_t count, uint64_t* outChangedMask,
+                             uint32_t* outPacked);
+
+/**
+ * \brief Inverse de rcnet_simd_xor_diff() (scalaire, côté réception).
+ *
+ * \param {const uint32_t*} baseline - Colonne de référence.
+ * \param {uint32_t} count - Nombre de valeurs.
+ * \param {const uint64_t*} changedMask - Masque produit par rcnet_simd_xor_diff().
+ * \param {const uint32_t*} packed - Valeurs produites par rcnet_simd_xor_diff().
+ * \param {uint32_t*} outCurrent - count valeurs reconstruites (peut être baseline).
+ * \return {uint32_t} Nombre de valeurs de packed consommées.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_simd_xor_apply(const uint32_t* baseline, uint32_t count, const uint64_t* changedMask, const uint32_t* packed,
+                              uint32_t* outCurrent);
+
+/**
+ * \brief Delta contre la baseline, zig-zag puis varint LEB128 (1 octet par valeur qui bouge de moins de ±64).
+ *
+ * Les blocs dont toutes les valeurs tiennent sur un octet sont écrits directement depuis les
+ * registres vectoriels.
+ *
+ * \param {const uint32_t*} current - Valeurs courantes.
+ * \param {const uint32_t*} baseline - Valeurs de référence.
+ * \param {uint32_t} count - Nombre de valeurs.
+ * \param {uint8_t*} out - Buffer de sortie.
+ * \param {size_t} capacity - Taille du buffer (RCNET_SIMD_VARINT_MAX_SIZE(count) suffit toujours).
+ * \return {size_t} Octets écrits, 0 si le buffer est trop petit (ou count == 0).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_simd_encode_delta_varint(const uint32_t* current, const uint32_t* baseline, uint32_t count, uint8_t* out,
+                                      size_t capacity);
+
+/**
+ * \brief Inverse de rcnet_simd_encode_delta_varint() (scalaire, côté réception).
+ *
+ * \param {const uint8_t*} data - Données encodées.
+ * \param {size_t} length - Taille des données.
+ * \param {const uint32_t*} baseline - Valeurs de référence.
+ * \param {uint32_t} count - Nombre de valeurs attendues.
+ * \param {uint32_t*} outCurrent - count valeurs reconstruites.
+ * \return {size_t} Octets consommés, 0 si les données sont tronquées ou invalides.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_simd_decode_delta_varint(const uint8_t* data, size_t length, const uint32_t* baseline, uint32_t count,
+                                      uint32_t* outCurrent);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_SIMD_H
@@ -0,0 +1,432 @@
+#ifndef RCNET_SNAPSHOT_H
+#define RCNET_SNAPSHOT_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint8_t, uint32_t, uint64_t
+
+#include <RCNET/RCNET_codec.h> // RCNET_PacketWriter, RCNET_PacketReader
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Nombre maximum de champs par entité dans un RCNET_SnapshotSchema.
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_SNAPSHOT_MAX_FIELDS 32
+
+/**
+ * \brief Nombre maximum d'états conservés par un RCNET_SnapshotHistory.
+ *
+ * \since Cette macro est disponible depuis RCNET 1.1.0.
+ */
+#define RCNET_SNAPSHOT_MAX_HISTORY 4096
+
+// ============================================================
+// Bit packing (inline : utilisé sur le hot path réseau)
+// ============================================================
+
+/**
+ * \brief Writer de bits (LSB first) sur un buffer fourni par l'appelant (aucune allocation).
+ *
+ * Si une écriture dépasse la capacité, overflow passe à true ; il suffit de le vérifier à la fin.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_BitWriter {
+    uint8_t* data;
+    size_t capacity;     // en octets
+    size_t size;         // octets complets écrits
+    uint64_t scratch;    // bits en attente
+    uint32_t scratchBits;
+    bool overflow;
+} RCNET_BitWriter;
+
+/**
+ * \brief Reader de bits (LSB first) sur un buffer existant.
+ *
+ * Si une lecture dépasse la taille, la valeur lue vaut 0 et overflow passe à true.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_BitReader {
+    const uint8_t* data;
+    size_t size;         // en octets
+    size_t offset;       // octets consommés
+    uint64_t scratch;
+    uint32_t scratchBits;
+    bool overflow;
+} RCNET_BitReader;
+
+static inline void rcnet_bit_writer_init(RCNET_BitWriter* writer, void* buffer, size_t capacity)
+{
+    writer->data = (uint8_t*)buffer;
+    writer->capacity = capacity;
+    writer->size = 0;
+    writer->scratch = 0;
+    writer->scratchBits = 0;
+    writer->overflow = false;
+}
+
+// Ecrit les bitCount bits de poids faible de value (1 <= bitCount <= 32)
+static inline void rcnet_bit_write(RCNET_BitWriter* writer, uint32_t value, uint32_t bitCount)
+{
+    uint64_t masked = (bitCount >= 32) ? (uint64_t)value : ((uint64_t)value & ((1ull << bitCount) - 1));
+    writer->scratch |= masked << writer->scratchBits;
+    writer->scratchBits += bitCount;
+
+    while (writer->scratchBits >= 8)
+    {
+        if (writer->size >= writer->capacity)
+        {
+            writer->overflow = true;
+            writer->scratchBits = 0;
+            writer->scratch = 0;
+            return;
+        }
+        writer->data[writer->size++] = (uint8_t)writer->scratch;
+        writer->scratch >>= 8;
+        writer->scratchBits -= 8;
+    }
+}
+
+// Ecrit les bits restants (octet partiel complété par des 0). Retourne la taille totale en octets.
+static inline size_t rcnet_bit_writer_flush(RCNET_BitWriter* writer)
+{
+    if (writer->scratchBits > 0)
+    {
+        if (writer->size >= writer->capacity)
+            writer->overflow = true;
+        else
+            writer->data[writer->size++] = (uint8_t)writer->scratch;
+        writer->scratch = 0;
+        writer->scratchBits = 0;
+    }
+    return writer->size;
+}
+
+static inline void rcnet_bit_reader_init(RCNET_BitReader* reader, const void* bytes, size_t size)
+{
+    reader->data = (const uint8_t*)bytes;
+    reader->size = size;
+    reader->offset = 0;
+    reader->scratch = 0;
+    reader->scratchBits = 0;
+    reader->overflow = false;
+}
+
+// Lit bitCount bits (1 <= bitCount <= 32)
+static inline uint32_t rcnet_bit_read(RCNET_BitReader* reader, uint32_t bitCount)
+{
+    while (reader->scratchBits < bitCount)
+    {
+        if (reader->offset >= reader->size)
+        {
+            reader->overflow = true;
+            return 0;
+        }
+        reader->scratch |= (uint64_t)reader->data[reader->offset++] << reader->scratchBits;
+        reader->scratchBits += 8;
+    }
+
+    uint64_t mask = (bitCount >= 32) ? 0xFFFFFFFFull : ((1ull << bitCount) - 1);
+    uint32_t value = (uint32_t)(reader->scratch & mask);
+    reader->scratch >>= bitCount;
+    reader->scratchBits -= bitCount;
+    return value;
+}
+
+// ============================================================
+// Quantification (inline)
+// ============================================================
+
+/**
+ * \brief Quantifie un float de [minValue, maxValue] sur bitCount bits (1..24), avec clamp.
+ *
+ * Précision = (maxValue - minValue) / (2^bitCount - 1). NaN -> minValue.
+ * Ex : position [-512, 512] sur 16 bits => ~1.6 cm ; axe [-1, 1] sur 8 bits => ~0.008.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+static inline uint32_t rcnet_quantize_float(float value, float minValue, float maxValue, uint32_t bitCount)
+{
+    uint32_t maxQuantized = (1u << bitCount) - 1u;
+    if (!(value > minValue))
+        return 0;
+    if (value >= maxValue)
+        return maxQuantized;
+
+    float normalized = (value - minValue) / (maxValue - minValue);
+    return (uint32_t)(normalized * (float)maxQuantized + 0.5f);
+}
+
+/**
+ * \brief Inverse de rcnet_quantize_float().
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+static inline float rcnet_dequantize_float(uint32_t quantized, float minValue, float maxValue, uint32_t bitCount)
+{
+    uint32_t maxQuantized = (1u << bitCount) - 1u;
+    return minValue + (maxValue - minValue) * ((float)quantized / (float)maxQuantized);
+}
+
+// ============================================================
+// Historique de snapshots + deltas
+// ============================================================
+
+/**
+ * \brief Description des entités d'un snapshot : chaque entité a fieldCount champs entiers
+ * (déjà quantifiés), le champ i est transmis sur fieldBits[i] bits.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_SnapshotSchema {
+    uint32_t maxEntities;                        // entityId dans [0, maxEntities)
+    uint32_t fieldCount;                         // 1..RCNET_SNAPSHOT_MAX_FIELDS
+    uint8_t fieldBits[RCNET_SNAPSHOT_MAX_FIELDS]; // 1..32 bits par champ
+} RCNET_SnapshotSchema;
+
+/**
+ * \brief Ring des K derniers états du monde + dernier tick acké par chaque client.
+ *
+ * Serveur : à chaque tick réseau, begin_frame / write_entity / commit_frame, puis
+ * rcnet_snapshot_history_encode() par client : delta bit-packé contre le dernier état acké
+ * par ce client, ou snapshot complet si cet état a été évincé du ring (ou jamais acké).
+ *
+ * Client : même schéma, rcnet_snapshot_history_decode() reconstruit chaque état à partir
+ * de sa baseline locale, puis le client renvoie le tick décodé (RCNET_PACKET_TYPE_SNAPSHOT_ACK).
+ *
+ * Format du payload (bits, LSB first) :
+ * [isDelta 1][baselineOffset 16 si delta]
+ * puis pour chaque entité modifiée : [1][entityId idBits][removed 1][pour chaque champ : changed 1 (+ valeur)]
+ * et enfin [0].
+ * Un snapshot complet est un delta contre un état vide (tous les champs à 0).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_SnapshotHistory RCNET_SnapshotHistory;
+
+/**
+ * \brief Compteurs cumulés d'un RCNET_SnapshotHistory.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_SnapshotHistoryStats {
+    uint64_t fullEncoded;      // snapshots complets encodés (pas de baseline valide)
+    uint64_t deltaEncoded;     // deltas encodés
+    uint64_t encodedBytes;     // total des octets de payload encodés
+    uint64_t decoded;          // snapshots décodés avec succès
+    uint64_t decodeFailures;   // payload invalide / baseline absente / snapshot trop ancien
+} RCNET_SnapshotHistoryStats;
+
+/**
+ * \brief Crée un historique de snapshots.
+ *
+ * \param {const RCNET_SnapshotSchema*} schema - Schéma des entités (copié).
+ * \param {uint32_t} historySize - Nombre d'états conservés (K, 2..RCNET_SNAPSHOT_MAX_HISTORY), en ticks.
+ * \param {uint32_t} maxClients - Nombre de clients suivis (acks), 0 côté client.
+ * \return {RCNET_SnapshotHistory*} L'historique, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_SnapshotHistory* rcnet_snapshot_history_create(const RCNET_SnapshotSchema* schema, uint32_t historySize, uint32_t maxClients);
+
+/**
+ * \brief Détruit un historique.
+ *
+ * \param {RCNET_SnapshotHistory*} history - L'historique (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_snapshot_history_destroy(RCNET_SnapshotHistory* history);
+
+/**
+ * \brief Commence l'état du monde du tick donné (toutes les entités absentes).
+ *
+ * \param {RCNET_SnapshotHistory*} history - L'historique.
+ * \param {uint64_t} tick - Tick de l'état (>= 1, strictement croissant).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_snapshot_history_begin_frame(RCNET_SnapshotHistory* history, uint64_t tick);
+
+/**
+ * \brief Ecrit une entité dans l'état en cours.
+ *
+ * \param {RCNET_SnapshotHistory*} history - L'historique.
+ * \param {uint32_t} entityId - Id de l'entité (< maxEntities).
+ * \param {const uint32_t*} fields - fieldCount valeurs quantifiées.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_snapshot_history_write_entity(RCNET_SnapshotHistory* history, uint32_t entityId, const uint32_t* fields);
+
+/**
+ * \brief Termine l'état en cours : il devient l'état encodé par rcnet_snapshot_history_encode().
+ *
+ * \param {RCNET_SnapshotHistory*} history - L'historique.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_snapshot_history_commit_frame(RCNET_SnapshotHistory* history);
+
+/**
+ * \brief Tick du dernier état terminé (commit ou décodé), 0 si aucun.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint64_t rcnet_snapshot_history_get_latest_tick(const RCNET_SnapshotHistory* history);
+
+/**
+ * \brief Enregistre l'ack d'un client (garde le tick le plus récent).
+ *
+ * \param {RCNET_SnapshotHistory*} history - L'historique.
+ * \param {uint32_t} clientId - Client (< maxClients).
+ * \param {uint64_t} tick - Tick du snapshot décodé par le client.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread (ex: threads réseau).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_snapshot_history_ack(RCNET_SnapshotHistory* history, uint32_t clientId, uint64_t tick);
+
+/**
+ * \brief Oublie l'ack d'un client (nouvelle connexion : le prochain snapshot sera complet).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_snapshot_history_reset_client(RCNET_SnapshotHistory* history, uint32_t clientId);
+
+/**
+ * \brief Dernier tick acké par un client (0 si aucun).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint64_t rcnet_snapshot_history_get_client_ack(const RCNET_SnapshotHistory* history, uint32_t clientId);
+
+/**
+ * \brief Taille maximale (en octets) d'un payload encodé : snapshot complet avec toutes les entités.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+size_t rcnet_snapshot_history_get_max_encoded_size(const RCNET_SnapshotHistory* history);
+
+/**
+ * \brief Encode le dernier état terminé pour un client, à la suite des données du writer.
+ *
+ * \param {RCNET_SnapshotHistory*} history - L'historique.
+ * \param {uint32_t} clientId - Client destinataire (< maxClients).
+ * \param {RCNET_PacketWriter*} writer - Writer (ex: après rcnet_codec_write_snapshot_header()).
+ * \param {uint64_t*} outBaselineTick - Tick de la baseline utilisée, 0 si snapshot complet (NULL accepté).
+ * \return {bool} true si OK, false si aucun état ou writer trop petit (writer->overflow).
+ *
+ * \threadsafety Plusieurs clients peuvent être encodés en parallèle, tant qu'aucun begin/commit_frame
+ * n'est en cours.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_snapshot_history_encode(RCNET_SnapshotHistory* history, uint32_t clientId, RCNET_PacketWriter* writer, uint64_t* outBaselineTick);
+
+/**
+ * \brief Filtre d'intérêt d'un client pour rcnet_snapshot_history_encode_interest() (voir RCNET_interest.h).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_SnapshotInterest {
+    const uint64_t* visibleMask;    // bitset maxEntities : entités que le client doit connaître
+    const uint32_t* priorityList;   // entités visibles à envoyer, par priorité décroissante (sans doublon)
+    uint32_t priorityCount;         // taille de priorityList
+    size_t maxPayloadBytes;         // budget du payload (0 : illimité), hors suppressions
+} RCNET_SnapshotInterest;
+
+/**
+ * \brief Active l'encodage filtré par intérêt (alloue une vue par client et par état conservé).
+ *
+ * Mémoire : maxClients * historySize * (maxEntities * 4 + maxEntities / 8) octets.
+ *
+ * \param {RCNET_SnapshotHistory*} history - L'historique (côté serveur, maxClients > 0).
+ * \return {bool} true si OK.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_snapshot_history_enable_interest(RCNET_SnapshotHistory* history);
+
+/**
+ * \brief Encode le dernier état terminé pour un client, limité à ce qu'il doit voir et à un budget d'octets.
+ *
+ * Le serveur garde la vue de chaque client pour chaque état encodé (entités connues + état global
+ * d'où vient leur valeur), et encode le delta contre la vue de son dernier état acké :
+ * - entités connues du client mais détruites ou plus visibles : supprimées (toujours, hors budget)
+ * - priorityList dans l'ordre, tant que le budget le permet : nouvelles entités ou champs modifiés
+ * - entités visibles déjà connues mais pas envoyées faute de budget : le client garde leur valeur
+ * Le format du payload est celui de rcnet_snapshot_history_encode() : le client décode sans changement.
+ *
+ * Un seul encodage par client et par état : si l'état courant a déjà été encodé pour ce client,
+ * la fonction retourne false (rien à envoyer).
+ *
+ * \param {RCNET_SnapshotHistory*} history - L'historique (rcnet_snapshot_history_enable_interest() appelée).
+ * \param {uint32_t} clientId - Client destinataire (< maxClients).
+ * \param {RCNET_PacketWriter*} writer - Writer (ex: après rcnet_codec_write_snapshot_header()).
+ * \param {const RCNET_SnapshotInterest*} interest - Filtre du client.
+ * \param {uint32_t*} outWrittenCount - Nombre d'entrées de priorityList traitées (envoyées ou inchangées),
+ *                                      les suivantes n'ont pas tenu dans le budget (NULL accepté).
+ * \param {uint64_t*} outBaselineTick - Tick de la baseline utilisée, 0 si snapshot complet (NULL accepté).
+ * \return {bool} true si OK, false si rien à envoyer, aucun état ou writer trop petit (writer->overflow).
+ *
+ * \threadsafety Plusieurs clients peuvent être encodés en parallèle, tant qu'aucun begin/commit_frame
+ * n'est en cours.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_snapshot_history_encode_interest(RCNET_SnapshotHistory* history, uint32_t clientId, RCNET_PacketWriter* writer,
+                                            const RCNET_SnapshotInterest* interest, uint32_t* outWrittenCount, uint64_t* outBaselineTick);
+
+/**
+ * \brief Décode un payload (côté client) et l'ajoute comme état du tick donné.
+ *
+ * Echoue si le snapshot n'est pas plus récent que le dernier état décodé (réordonnancement UDP),
+ * si la baseline n'est plus dans l'historique local, ou si le payload est invalide.
+ *
+ * \param {RCNET_SnapshotHistory*} history - L'historique local du client.
+ * \param {uint64_t} tick - Tick du snapshot (RCNET_SnapshotHeader::serverTick).
+ * \param {RCNET_PacketReader*} reader - Reader positionné au début du payload (consommé entièrement).
+ * \return {bool} true si l'état a été reconstruit (à acker), false sinon.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_snapshot_history_decode(RCNET_SnapshotHistory* history, uint64_t tick, RCNET_PacketReader* reader);
+
+/**
+ * \brief Lit une entité d'un état conservé.
+ *
+ * \param {const RCNET_SnapshotHistory*} history - L'historique.
+ * \param {uint64_t} tick - Tick de l'état (ex: rcnet_snapshot_history_get_latest_tick()).
+ * \param {uint32_t} entityId - Id de l'entité.
+ * \param {uint32_t*} outFields - fieldCount valeurs quantifiées (sortie).
+ * \return {bool} true si l'entité est présente dans cet état.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_snapshot_history_read_entity(const RCNET_SnapshotHistory* history, uint64_t tick, uint32_t entityId, uint32_t* outFields);
+
+/**
+ * \brief Récupère les compteurs cumulés.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_snapshot_history_get_stats(const RCNET_SnapshotHistory* history, RCNET_SnapshotHistoryStats* outStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_SNAPSHOT_H
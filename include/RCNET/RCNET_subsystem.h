@@ -0,0 +1,125 @@
+#ifndef RCNET_SUBSYSTEM_H
+#define RCNET_SUBSYSTEM_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stdint.h>  // uint32_t, uint64_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Initialisation à la demande et comptée des dépendances (OpenSSL, libsodium, RCENet).
+ *
+ * Chaque module acquiert les sous-systèmes qu'il utilise (RCNET_NetShards : RCENet, client Redis TLS :
+ * OpenSSL, etc.) et les relâche à sa destruction : seul ce qui sert est initialisé, une seule fois
+ * même si plusieurs modules / matchs l'utilisent.
+ *
+ * OpenSSL (>= 1.1) et libsodium ont une init process-wide idempotente et se libèrent seuls à la fin du
+ * process : la dernière libération ne fait rien, une nouvelle acquisition est alors gratuite.
+ * RCENet est désinitialisé à la dernière libération (WSACleanup sous Windows).
+ *
+ * \since Ce module est disponible depuis RCNET 1.1.0.
+ */
+
+/**
+ * \brief Dépendance initialisée par ce module.
+ *
+ * \since Cette énumération est disponible depuis RCNET 1.1.0.
+ */
+typedef enum RCNET_Subsystem {
+    RCNET_SUBSYSTEM_OPENSSL = 0,
+    RCNET_SUBSYSTEM_LIBSODIUM,
+    RCNET_SUBSYSTEM_RCENET,
+    RCNET_SUBSYSTEM_COUNT
+} RCNET_Subsystem;
+
+/**
+ * \brief Masques pour rcnet_subsystem_acquire_flags() / rcnet_engine_set_subsystems().
+ *
+ * \since Ces macros sont disponibles depuis RCNET 1.1.0.
+ */
+#define RCNET_SUBSYSTEM_FLAG_OPENSSL   (1u << RCNET_SUBSYSTEM_OPENSSL)
+#define RCNET_SUBSYSTEM_FLAG_LIBSODIUM (1u << RCNET_SUBSYSTEM_LIBSODIUM)
+#define RCNET_SUBSYSTEM_FLAG_RCENET    (1u << RCNET_SUBSYSTEM_RCENET)
+#define RCNET_SUBSYSTEM_FLAGS_ALL      ((1u << RCNET_SUBSYSTEM_COUNT) - 1u)
+
+/**
+ * \brief Etat d'un sous-système.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_SubsystemStats {
+    bool initialized;     // init réussie et non défaite (toujours vrai après la première init d'OpenSSL / libsodium)
+    uint32_t refCount;    // acquisitions en cours
+    uint32_t initCount;   // inits réellement exécutées
+    uint64_t initNs;      // durée cumulée des inits
+} RCNET_SubsystemStats;
+
+/**
+ * \brief Acquiert un sous-système (init au premier appel, sinon simple incrément).
+ *
+ * \param {RCNET_Subsystem} subsystem - Le sous-système.
+ * \return {bool} true si le sous-système est prêt (à relâcher avec rcnet_subsystem_release()), false si l'init a échoué.
+ *
+ * \threadsafety Toutes les fonctions de ce module peuvent être appelées depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_subsystem_acquire(RCNET_Subsystem subsystem);
+
+/**
+ * \brief Relâche une acquisition (sans effet si le compteur est déjà à 0).
+ *
+ * \param {RCNET_Subsystem} subsystem - Le sous-système.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_subsystem_release(RCNET_Subsystem subsystem);
+
+/**
+ * \brief Acquiert plusieurs sous-systèmes (tout ou rien : en cas d'échec, ceux déjà acquis sont relâchés).
+ *
+ * \param {uint32_t} flags - Combinaison de RCNET_SUBSYSTEM_FLAG_*.
+ * \return {bool} true si tous sont prêts.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_subsystem_acquire_flags(uint32_t flags);
+
+/**
+ * \brief Relâche plusieurs sous-systèmes.
+ *
+ * \param {uint32_t} flags - Combinaison de RCNET_SUBSYSTEM_FLAG_* (celle passée à rcnet_subsystem_acquire_flags()).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_subsystem_release_flags(uint32_t flags);
+
+/**
+ * \brief Etat d'un sous-système (durée d'init pour le profil de démarrage).
+ *
+ * \param {RCNET_Subsystem} subsystem - Le sous-système.
+ * \param {RCNET_SubsystemStats*} outStats - Etat à remplir.
+ * \return {bool} false si un paramètre est invalide.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_subsystem_get_stats(RCNET_Subsystem subsystem, RCNET_SubsystemStats* outStats);
+
+/**
+ * \brief Nom d'un sous-système ("openssl", "libsodium", "rcenet").
+ *
+ * \param {RCNET_Subsystem} subsystem - Le sous-système.
+ * \return {const char*} Le nom (chaîne statique, "unknown" si invalide).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+const char* rcnet_subsystem_get_name(RCNET_Subsystem subsystem);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_SUBSYSTEM_H
@@ -0,0 +1,131 @@
+#ifndef RCNET_TIMER_H
+#define RCNET_TIMER_H
+
+// Standard C/C++ Libraries
+#include <stdint.h> // uint64_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Backend utilisé par un RCNET_Timer pour dormir.
+ *
+ * \since Cette enum est disponible depuis RCNET 1.1.0.
+ */
+typedef enum RCNET_TimerBackend {
+    /**
+     * RCNET_TIMER_BACKEND_PLATFORM si disponible, sinon RCNET_TIMER_BACKEND_PORTABLE.
+     */
+    RCNET_TIMER_BACKEND_AUTO = 0,
+
+    /**
+     * std::condition_variable (précision de l'ordonnanceur de l'OS, marge de spin plus grande).
+     */
+    RCNET_TIMER_BACKEND_PORTABLE,
+
+    /**
+     * Timer haute résolution de l'OS :
+     * - Windows : waitable timer CREATE_WAITABLE_TIMER_HIGH_RESOLUTION + event de réveil
+     * - Linux   : timerfd CLOCK_MONOTONIC en échéance absolue + eventfd de réveil (poll)
+     * Non disponible sur les autres plateformes (AUTO retombe sur PORTABLE).
+     */
+    RCNET_TIMER_BACKEND_PLATFORM
+} RCNET_TimerBackend;
+
+/**
+ * \brief Raison de la fin d'une attente.
+ *
+ * \since Cette enum est disponible depuis RCNET 1.1.0.
+ */
+typedef enum RCNET_TimerWaitResult {
+    RCNET_TIMER_WAIT_DEADLINE = 0, // échéance atteinte
+    RCNET_TIMER_WAIT_WOKEN         // réveil anticipé par rcnet_timer_wake()
+} RCNET_TimerWaitResult;
+
+/**
+ * \brief Timer d'attente précis à faible coût CPU.
+ *
+ * L'attente se fait en deux temps : sommeil de l'OS jusqu'à (échéance - marge), puis spin court
+ * jusqu'à l'échéance. La marge s'adapte au retard de réveil observé de l'OS : elle grandit
+ * immédiatement après un réveil trop tardif et redescend lentement sinon, ce qui limite le spin
+ * au strict nécessaire sur chaque machine.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_Timer RCNET_Timer;
+
+/**
+ * \brief Horloge monotone utilisée par les timers, en nanosecondes.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint64_t rcnet_timer_get_time_ns(void);
+
+/**
+ * \brief Crée un timer.
+ *
+ * \param {RCNET_TimerBackend} backend - Backend demandé (AUTO recommandé).
+ * \return {RCNET_Timer*} Le timer, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_Timer* rcnet_timer_create(RCNET_TimerBackend backend);
+
+/**
+ * \brief Détruit un timer.
+ *
+ * \param {RCNET_Timer*} timer - Le timer (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_timer_destroy(RCNET_Timer* timer);
+
+/**
+ * \brief Backend effectivement utilisé (PORTABLE ou PLATFORM).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_TimerBackend rcnet_timer_get_backend(const RCNET_Timer* timer);
+
+/**
+ * \brief Attend jusqu'à deadlineNs (horloge rcnet_timer_get_time_ns()) ou un rcnet_timer_wake().
+ *
+ * \param {RCNET_Timer*} timer - Le timer.
+ * \param {uint64_t} deadlineNs - Echéance absolue.
+ * \param {uint64_t*} outSpinNs - Temps passé en spin (NULL accepté).
+ * \return {RCNET_TimerWaitResult} DEADLINE, ou WOKEN si réveillé avant l'échéance.
+ *
+ * \threadsafety Un seul thread attend sur un timer donné.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_TimerWaitResult rcnet_timer_sleep_until(RCNET_Timer* timer, uint64_t deadlineNs, uint64_t* outSpinNs);
+
+/**
+ * \brief Réveille l'attente en cours (ou la prochaine, qui retourne alors immédiatement).
+ *
+ * \param {RCNET_Timer*} timer - Le timer.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread (ex: thread réseau à la réception d'un packet).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_timer_wake(RCNET_Timer* timer);
+
+/**
+ * \brief Marge de spin courante en nanosecondes (apprise à partir du retard de réveil de l'OS).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint64_t rcnet_timer_get_spin_margin_ns(const RCNET_Timer* timer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_TIMER_H
@@ -0,0 +1,110 @@
+#ifndef RCNET_TRIPLE_BUFFER_H
+#define RCNET_TRIPLE_BUFFER_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stddef.h>  // size_t
+#include <stdint.h>  // uint64_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Triple buffer lock-free à un écrivain et un lecteur (ex: état du monde simulation -> réseau).
+ *
+ * Trois slots de taille fixe : l'écrivain remplit toujours son propre slot puis le publie en l'échangeant
+ * avec le slot du milieu ; le lecteur récupère le slot du milieu s'il est plus récent que le sien.
+ * Ni l'écrivain ni le lecteur n'attendent jamais : le lecteur lit une copie immuable pendant que
+ * l'écrivain continue, et les états intermédiaires non lus sont simplement remplacés.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_TripleBuffer RCNET_TripleBuffer;
+
+/**
+ * \brief Crée un triple buffer (les trois slots sont mis à zéro).
+ *
+ * \param {size_t} slotSize - Taille d'un slot en octets (ex: sizeof(MonEtatDuMonde)).
+ * \return {RCNET_TripleBuffer*} Le triple buffer, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_TripleBuffer* rcnet_triple_buffer_create(size_t slotSize);
+
+/**
+ * \brief Détruit un triple buffer.
+ *
+ * \param {RCNET_TripleBuffer*} buffer - Le triple buffer (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_triple_buffer_destroy(RCNET_TripleBuffer* buffer);
+
+/**
+ * \brief Slot de l'écrivain, à remplir avant rcnet_triple_buffer_publish().
+ *
+ * Après une publication, le slot rendu contient un état plus ancien (déjà publié ou jamais lu) :
+ * il doit être entièrement réécrit.
+ *
+ * \param {RCNET_TripleBuffer*} buffer - Le triple buffer.
+ * \return {void*} Le slot (aligné sur 64 octets).
+ *
+ * \threadsafety Thread écrivain uniquement.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void* rcnet_triple_buffer_get_write_slot(RCNET_TripleBuffer* buffer);
+
+/**
+ * \brief Publie le slot de l'écrivain (il devient le plus récent pour le lecteur).
+ *
+ * \param {RCNET_TripleBuffer*} buffer - Le triple buffer.
+ *
+ * \threadsafety Thread écrivain uniquement.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_triple_buffer_publish(RCNET_TripleBuffer* buffer);
+
+/**
+ * \brief Récupère le dernier état publié, s'il y en a un nouveau depuis le dernier appel.
+ *
+ * \param {RCNET_TripleBuffer*} buffer - Le triple buffer.
+ * \return {bool} true si le slot de lecture a changé, false s'il contient toujours le même état.
+ *
+ * \threadsafety Thread lecteur uniquement.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_triple_buffer_acquire(RCNET_TripleBuffer* buffer);
+
+/**
+ * \brief Slot du lecteur (état récupéré par le dernier rcnet_triple_buffer_acquire()).
+ *
+ * Le contenu ne change pas tant que le lecteur n'appelle pas rcnet_triple_buffer_acquire().
+ * Avant la première publication, le slot est rempli de zéros.
+ *
+ * \param {const RCNET_TripleBuffer*} buffer - Le triple buffer.
+ * \return {const void*} Le slot.
+ *
+ * \threadsafety Thread lecteur uniquement.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+const void* rcnet_triple_buffer_get_read_slot(const RCNET_TripleBuffer* buffer);
+
+/**
+ * \brief Nombre de publications depuis la création (pour mesurer les états jamais lus).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint64_t rcnet_triple_buffer_get_publish_count(const RCNET_TripleBuffer* buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_TRIPLE_BUFFER_H
@@ -0,0 +1,105 @@
+#ifndef RCNET_WORKER_POOL_H
+#define RCNET_WORKER_POOL_H
+
+// Standard C/C++ Libraries
+#include <stddef.h> // size_t
+#include <stdint.h> // uint32_t
+
+#include <RCNET/RCNET_arena.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Pool de threads workers pour découper un travail en jobs indépendants (rcnet_worker_pool_parallel_for).
+ *
+ * Le thread appelant participe au travail : workerCount = threadCount + 1,
+ * le worker 0 est toujours le thread qui appelle rcnet_worker_pool_parallel_for().
+ * Chaque worker possède sa propre arena de scratch (aucun partage, aucun lock).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_WorkerPool RCNET_WorkerPool;
+
+/**
+ * \brief Fonction exécutée pour chaque index d'un parallel_for.
+ *
+ * \param {uint32_t} index - Index du job (0 <= index < count).
+ * \param {uint32_t} workerIndex - Worker qui exécute le job (0 <= workerIndex < workerCount).
+ * \param {void*} userdata - Donnée utilisateur passée au parallel_for.
+ *
+ * \since Ce type est disponible depuis RCNET 1.1.0.
+ */
+typedef void (*RCNET_ParallelForFn)(uint32_t index, uint32_t workerIndex, void* userdata);
+
+/**
+ * \brief Crée un pool de workers.
+ *
+ * \param {uint32_t} threadCount - Nombre de threads en plus du thread appelant (0 = tout en série).
+ * \param {size_t} arenaBytesPerWorker - Taille initiale de l'arena de chaque worker.
+ * \return {RCNET_WorkerPool*} Le pool, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_WorkerPool* rcnet_worker_pool_create(uint32_t threadCount, size_t arenaBytesPerWorker);
+
+/**
+ * \brief Arrête les threads et détruit le pool (et ses arenas).
+ *
+ * \param {RCNET_WorkerPool*} pool - Le pool (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_worker_pool_destroy(RCNET_WorkerPool* pool);
+
+/**
+ * \brief Nombre de workers (threads du pool + thread appelant).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_worker_pool_get_worker_count(const RCNET_WorkerPool* pool);
+
+/**
+ * \brief Exécute fn(index, workerIndex, userdata) pour index dans [0, count), en parallèle.
+ *
+ * Bloque jusqu'à ce que tous les jobs soient terminés. Les index sont distribués par petits blocs
+ * (compteur atomique), l'ordre d'exécution n'est pas garanti.
+ * Un appel imbriqué (depuis un job) est exécuté en série sur le worker courant.
+ *
+ * \param {RCNET_WorkerPool*} pool - Le pool.
+ * \param {uint32_t} count - Nombre de jobs.
+ * \param {RCNET_ParallelForFn} fn - Fonction à exécuter.
+ * \param {void*} userdata - Donnée utilisateur.
+ *
+ * \threadsafety Un seul thread appelant à la fois (typiquement le thread du moteur).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_worker_pool_parallel_for(RCNET_WorkerPool* pool, uint32_t count, RCNET_ParallelForFn fn, void* userdata);
+
+/**
+ * \brief Arena de scratch d'un worker.
+ *
+ * \param {RCNET_WorkerPool*} pool - Le pool.
+ * \param {uint32_t} workerIndex - Index du worker (celui reçu par RCNET_ParallelForFn).
+ * \return {RCNET_Arena*} L'arena, ou NULL si workerIndex est invalide.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_Arena* rcnet_worker_pool_get_arena(RCNET_WorkerPool* pool, uint32_t workerIndex);
+
+/**
+ * \brief Reset les arenas de tous les workers (à appeler hors parallel_for).
+ *
+ * \param {RCNET_WorkerPool*} pool - Le pool.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_worker_pool_reset_arenas(RCNET_WorkerPool* pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_WORKER_POOL_H
@@ -0,0 +1,232 @@
+#ifndef RCNET_WORLD_HISTORY_H
+#define RCNET_WORLD_HISTORY_H
+
+// Standard C/C++ Libraries
+#include <stdbool.h> // bool
+#include <stdint.h>  // uint32_t, uint64_t
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Historique côté serveur de l'état des entités sur les N derniers ticks (lag compensation).
+ *
+ * Ring de capacityTicks = simTickRateHz * maxRewindMs / 1000 + 1 états, tout alloué à la création.
+ * Chaque état est rangé en SoA (posX[], posY[], halfWidth[], halfHeight[] + bitset de présence) :
+ * un test de hitbox sur toutes les entités parcourt des tableaux contigus.
+ *
+ * Ecriture incrémentale : rcnet_world_history_begin_tick() repart de l'état du tick précédent,
+ * seules les entités qui ont bougé sont à réécrire. Lecture O(1) d'un tick passé
+ * (rcnet_world_history_rewind()), avec interpolation entre deux ticks consécutifs pour retrouver
+ * ce qu'un client voyait entre deux snapshots.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_WorldHistory RCNET_WorldHistory;
+
+/**
+ * \brief Configuration d'un RCNET_WorldHistory.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_WorldHistoryConfig {
+    uint32_t maxEntities;    // entityId dans [0, maxEntities)
+    uint32_t simTickRateHz;  // tick rate de la simulation (un état par tick)
+    uint32_t maxRewindMs;    // retour en arrière max (ping du client + délai d'interpolation)
+} RCNET_WorldHistoryConfig;
+
+/**
+ * \brief Etat d'un tick passé (tableaux SoA de maxEntities éléments, valides jusqu'au prochain commit).
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_WorldHistoryView {
+    uint64_t tick;
+    uint32_t maxEntities;
+    const uint64_t* presentMask;  // bitset : entité présente à ce tick
+    const float* posX;
+    const float* posY;
+    const float* halfWidth;       // hitbox AABB centrée sur la position
+    const float* halfHeight;
+} RCNET_WorldHistoryView;
+
+/**
+ * \brief Etat (éventuellement interpolé) d'une entité.
+ *
+ * \since Cette structure est disponible depuis RCNET 1.1.0.
+ */
+typedef struct RCNET_WorldHistoryEntity {
+    float posX;
+    float posY;
+    float halfWidth;
+    float halfHeight;
+} RCNET_WorldHistoryEntity;
+
+/**
+ * \brief Configuration par défaut (60 Hz, 250 ms de retour en arrière).
+ *
+ * maxEntities vaut 0 : à renseigner.
+ *
+ * \param {RCNET_WorldHistoryConfig*} outConfig - Configuration à remplir.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_world_history_get_default_config(RCNET_WorldHistoryConfig* outConfig);
+
+/**
+ * \brief Crée un historique (toute la mémoire est allouée ici).
+ *
+ * Mémoire : capacityTicks * (maxEntities * 16 + maxEntities / 8) octets.
+ *
+ * \param {const RCNET_WorldHistoryConfig*} config - Configuration.
+ * \return {RCNET_WorldHistory*} L'historique, ou NULL en cas d'erreur.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+RCNET_WorldHistory* rcnet_world_history_create(const RCNET_WorldHistoryConfig* config);
+
+/**
+ * \brief Détruit un historique.
+ *
+ * \param {RCNET_WorldHistory*} history - L'historique (NULL accepté).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_world_history_destroy(RCNET_WorldHistory* history);
+
+/**
+ * \brief Nombre de ticks conservés.
+ *
+ * \param {const RCNET_WorldHistory*} history - L'historique.
+ * \return {uint32_t} capacityTicks.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint32_t rcnet_world_history_get_capacity_ticks(const RCNET_WorldHistory* history);
+
+/**
+ * \brief Commence l'état d'un nouveau tick, initialisé avec l'état du dernier tick validé.
+ *
+ * \param {RCNET_WorldHistory*} history - L'historique.
+ * \param {uint64_t} tick - Tick simulation (strictement croissant, des ticks peuvent manquer).
+ * \return {bool} false si tick n'est pas plus récent que le dernier tick validé.
+ *
+ * \threadsafety Thread de simulation uniquement (comme toutes les fonctions de ce module).
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_world_history_begin_tick(RCNET_WorldHistory* history, uint64_t tick);
+
+/**
+ * \brief Ajoute ou met à jour une entité dans le tick en cours.
+ *
+ * \param {RCNET_WorldHistory*} history - L'historique.
+ * \param {uint32_t} entityId - L'entité.
+ * \param {float} posX - Position X.
+ * \param {float} posY - Position Y.
+ * \param {float} halfWidth - Demi-largeur de la hitbox.
+ * \param {float} halfHeight - Demi-hauteur de la hitbox.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_world_history_set_entity(RCNET_WorldHistory* history, uint32_t entityId, float posX, float posY,
+                                    float halfWidth, float halfHeight);
+
+/**
+ * \brief Retire une entité du tick en cours.
+ *
+ * \param {RCNET_WorldHistory*} history - L'historique.
+ * \param {uint32_t} entityId - L'entité.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_world_history_remove_entity(RCNET_WorldHistory* history, uint32_t entityId);
+
+/**
+ * \brief Valide le tick en cours : il devient consultable et sert de base au tick suivant.
+ *
+ * \param {RCNET_WorldHistory*} history - L'historique.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+void rcnet_world_history_commit_tick(RCNET_WorldHistory* history);
+
+/**
+ * \brief Dernier tick validé (0 si aucun).
+ *
+ * \param {const RCNET_WorldHistory*} history - L'historique.
+ * \return {uint64_t} Le tick.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint64_t rcnet_world_history_get_latest_tick(const RCNET_WorldHistory* history);
+
+/**
+ * \brief Plus ancien tick encore dans le ring (0 si aucun).
+ *
+ * Un tick entre get_oldest_tick et get_latest_tick peut manquer si la simulation a sauté des ticks.
+ *
+ * \param {const RCNET_WorldHistory*} history - L'historique.
+ * \return {uint64_t} Le tick.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+uint64_t rcnet_world_history_get_oldest_tick(const RCNET_WorldHistory* history);
+
+/**
+ * \brief Accès O(1) à l'état d'un tick passé.
+ *
+ * \param {const RCNET_WorldHistory*} history - L'historique.
+ * \param {uint64_t} tick - Tick voulu.
+ * \param {RCNET_WorldHistoryView*} outView - Vue à remplir.
+ * \return {bool} false si le tick est trop ancien, pas encore validé ou n'a pas été écrit.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_world_history_rewind(const RCNET_WorldHistory* history, uint64_t tick, RCNET_WorldHistoryView* outView);
+
+/**
+ * \brief Etat d'une entité entre tick et tick + 1 (interpolation linéaire).
+ *
+ * Si tick + 1 n'est pas disponible ou si l'entité n'y est pas présente, l'état de tick est retourné.
+ *
+ * \param {const RCNET_WorldHistory*} history - L'historique.
+ * \param {uint64_t} tick - Tick de départ.
+ * \param {float} alpha - Fraction entre tick (0) et tick + 1 (1).
+ * \param {uint32_t} entityId - L'entité.
+ * \param {RCNET_WorldHistoryEntity*} outEntity - Etat à remplir.
+ * \return {bool} false si tick n'est pas disponible ou si l'entité n'y est pas présente.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_world_history_sample_entity(const RCNET_WorldHistory* history, uint64_t tick, float alpha, uint32_t entityId,
+                                       RCNET_WorldHistoryEntity* outEntity);
+
+/**
+ * \brief Première hitbox touchée par le segment (x0, y0) -> (x1, y1), dans l'état interpolé de tick + alpha.
+ *
+ * Validation d'un tir hitscan contre ce que le tireur voyait.
+ *
+ * \param {const RCNET_WorldHistory*} history - L'historique.
+ * \param {uint64_t} tick - Tick de départ.
+ * \param {float} alpha - Fraction entre tick (0) et tick + 1 (1).
+ * \param {float} x0 - Origine X.
+ * \param {float} y0 - Origine Y.
+ * \param {float} x1 - Fin X.
+ * \param {float} y1 - Fin Y.
+ * \param {uint32_t} ignoreEntityId - Entité ignorée (le tireur), UINT32_MAX pour aucune.
+ * \param {uint32_t*} outEntityId - Entité touchée.
+ * \param {float*} outFraction - Position du point d'impact sur le segment, dans [0, 1] (NULL accepté).
+ * \return {bool} true si une hitbox est touchée.
+ *
+ * \since Cette fonction est disponible depuis RCNET 1.1.0.
+ */
+bool rcnet_world_history_raycast(const RCNET_WorldHistory* history, uint64_t tick, float alpha, float x0, float y0,
+                                 float x1, float y1, uint32_t ignoreEntityId, uint32_t* outEntityId, float* outFraction);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RCNET_WORLD_HISTORY_H
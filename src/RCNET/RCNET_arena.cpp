@@ -0,0 +1,159 @@
+#include "RCNET/RCNET_arena.h"
+#include "RCNET/RCNET_logger.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+// Un bloc de mémoire (les données suivent directement l'en-tête)
+struct RCNET_ArenaBlock
+{
+    RCNET_ArenaBlock* previous; // bloc précédent (NULL pour le premier)
+    size_t capacity;
+    size_t offset;
+};
+
+struct RCNET_Arena
+{
+    RCNET_ArenaBlock* current = nullptr; // dernier bloc (le seul utilisé pour allouer)
+    size_t usedBytes = 0;                // depuis le dernier reset, tous blocs
+    size_t totalCapacity = 0;            // somme des capacités des blocs
+};
+
+static inline uint8_t* rcnet_arena_blockData(RCNET_ArenaBlock* block)
+{
+    return reinterpret_cast<uint8_t*>(block + 1);
+}
+
+static RCNET_ArenaBlock* rcnet_arena_createBlock(size_t capacity, RCNET_ArenaBlock* previous)
+{
+    RCNET_ArenaBlock* block = static_cast<RCNET_ArenaBlock*>(std::malloc(sizeof(RCNET_ArenaBlock) + capacity));
+    if (block == NULL)
+        return NULL;
+
+    block->previous = previous;
+    block->capacity = capacity;
+    block->offset = 0;
+    return block;
+}
+
+static void rcnet_arena_freeBlocks(RCNET_ArenaBlock* block)
+{
+    while (block != NULL)
+    {
+        RCNET_ArenaBlock* previous = block->previous;
+        std::free(block);
+        block = previous;
+    }
+}
+
+RCNET_Arena* rcnet_arena_create(size_t capacity)
+{
+    if (capacity == 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_arena_create: invalid capacity=0\n");
+        return NULL;
+    }
+
+    RCNET_Arena* arena = new (std::nothrow) RCNET_Arena();
+    if (arena == NULL)
+        return NULL;
+
+    arena->current = rcnet_arena_createBlock(capacity, NULL);
+    if (arena->current == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_arena_create: out of memory (%zu bytes)\n", capacity);
+        delete arena;
+        return NULL;
+    }
+
+    arena->totalCapacity = capacity;
+    return arena;
+}
+
+void rcnet_arena_destroy(RCNET_Arena* arena)
+{
+    if (arena == NULL)
+        return;
+
+    rcnet_arena_freeBlocks(arena->current);
+    delete arena;
+}
+
+void* rcnet_arena_alloc(RCNET_Arena* arena, size_t size, size_t alignment)
+{
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+        return NULL;
+
+    RCNET_ArenaBlock* block = arena->current;
+    uintptr_t base = reinterpret_cast<uintptr_t>(rcnet_arena_blockData(block));
+    uintptr_t aligned = (base + block->offset + (alignment - 1)) & ~static_cast<uintptr_t>(alignment - 1);
+    size_t newOffset = static_cast<size_t>(aligned - base) + size;
+
+    if (newOffset > block->capacity)
+    {
+        // Débordement : nouveau bloc (au moins aussi grand que le précédent), fusionné au prochain reset
+        size_t blockCapacity = block->capacity;
+        if (blockCapacity < size + alignment)
+            blockCapacity = size + alignment;
+
+        RCNET_ArenaBlock* overflowBlock = rcnet_arena_createBlock(blockCapacity, block);
+        if (overflowBlock == NULL)
+        {
+            RCNET_log(RCNET_LOG_ERROR, "rcnet_arena_alloc: out of memory (%zu bytes)\n", blockCapacity);
+            return NULL;
+        }
+
+        // Le padding perdu en fin de bloc précédent reste compté dans usedBytes
+        arena->usedBytes += block->capacity - block->offset;
+        arena->totalCapacity += blockCapacity;
+        arena->current = overflowBlock;
+
+        block = overflowBlock;
+        base = reinterpret_cast<uintptr_t>(rcnet_arena_blockData(block));
+        aligned = (base + (alignment - 1)) & ~static_cast<uintptr_t>(alignment - 1);
+        newOffset = static_cast<size_t>(aligned - base) + size;
+    }
+
+    arena->usedBytes += newOffset - block->offset;
+    block->offset = newOffset;
+
+    return reinterpret_cast<void*>(aligned);
+}
+
+void rcnet_arena_reset(RCNET_Arena* arena)
+{
+    if (arena->current->previous != NULL)
+    {
+        // Plusieurs blocs : on les remplace par un seul bloc de la taille totale,
+        // pour que les prochains ticks tiennent sans débordement.
+        RCNET_ArenaBlock* merged = rcnet_arena_createBlock(arena->totalCapacity, NULL);
+        if (merged != NULL)
+        {
+            rcnet_arena_freeBlocks(arena->current);
+            arena->current = merged;
+        }
+        else
+        {
+            // Pas de mémoire : on garde la chaîne, on la vide simplement
+            for (RCNET_ArenaBlock* block = arena->current; block != NULL; block = block->previous)
+                block->offset = 0;
+        }
+    }
+
+    arena->current->offset = 0;
+    arena->usedBytes = 0;
+}
+
+size_t rcnet_arena_get_used(const RCNET_Arena* arena)
+{
+    return arena->usedBytes;
+}
+
+size_t rcnet_arena_get_capacity(const RCNET_Arena* arena)
+{
+    return arena->totalCapacity;
+}
@@ -0,0 +1,246 @@
+#include "RCNET/RCNET_codec.h"
+#include "RCNET/RCNET_snapshot.h" // RCNET_BitWriter, RCNET_BitReader, rcnet_quantize_float
+
+// Inputs groupés : en-tête [count u8][newestSeq u32][newestClientTick u32]
+static constexpr size_t kInputBatchHeaderSize = RCNET_PACKET_HEADER_SIZE + 9;
+static constexpr uint32_t kInputBatchGapBits = 8;
+
+RCNET_PacketType rcnet_codec_peek_type(const void* bytes, size_t size)
+{
+    if (bytes == NULL || size < RCNET_PACKET_HEADER_SIZE)
+        return RCNET_PACKET_TYPE_INVALID;
+
+    const uint8_t* p = static_cast<const uint8_t*>(bytes);
+
+    // Version inconnue (ou packet JSON de debug qui commence par '{')
+    if (p[0] != RCNET_CODEC_VERSION)
+        return RCNET_PACKET_TYPE_INVALID;
+
+    switch (p[1])
+    {
+        case RCNET_PACKET_TYPE_CLIENT_INPUT:       return RCNET_PACKET_TYPE_CLIENT_INPUT;
+        case RCNET_PACKET_TYPE_SNAPSHOT:           return RCNET_PACKET_TYPE_SNAPSHOT;
+        case RCNET_PACKET_TYPE_SNAPSHOT_ACK:       return RCNET_PACKET_TYPE_SNAPSHOT_ACK;
+        case RCNET_PACKET_TYPE_CLIENT_INPUT_BATCH: return RCNET_PACKET_TYPE_CLIENT_INPUT_BATCH;
+        default:                                   return RCNET_PACKET_TYPE_INVALID;
+    }
+}
+
+void rcnet_codec_write_header(RCNET_PacketWriter* writer, RCNET_PacketType type)
+{
+    rcnet_packet_write_u8(writer, RCNET_CODEC_VERSION);
+    rcnet_packet_write_u8(writer, static_cast<uint8_t>(type));
+}
+
+size_t rcnet_codec_encode_client_input(const RCNET_ClientInput* input, void* outBuffer, size_t outCapacity)
+{
+    RCNET_PacketWriter writer;
+    rcnet_packet_writer_init(&writer, outBuffer, outCapacity);
+
+    rcnet_codec_write_header(&writer, RCNET_PACKET_TYPE_CLIENT_INPUT);
+    rcnet_packet_write_u32(&writer, input->clientTickId);
+    rcnet_packet_write_u32(&writer, input->clientInputSeq);
+    rcnet_packet_write_u32(&writer, input->buttonsMask);
+    rcnet_packet_write_f32(&writer, input->axisX);
+    rcnet_packet_write_f32(&writer, input->axisY);
+
+    return writer.overflow ? 0 : writer.size;
+}
+
+bool rcnet_codec_decode_client_input(const void* bytes, size_t size, uint32_t clientId, RCNET_ClientInput* outInput)
+{
+    // Taille fixe : tout autre taille est un packet corrompu ou d'une autre version
+    if (size != RCNET_CLIENT_INPUT_PACKET_SIZE)
+        return false;
+
+    if (rcnet_codec_peek_type(bytes, size) != RCNET_PACKET_TYPE_CLIENT_INPUT)
+        return false;
+
+    RCNET_PacketReader reader;
+    rcnet_packet_reader_init(&reader, bytes, size);
+    reader.offset = RCNET_PACKET_HEADER_SIZE;
+
+    outInput->clientId       = clientId;
+    outInput->clientTickId   = rcnet_packet_read_u32(&reader);
+    outInput->clientInputSeq = rcnet_packet_read_u32(&reader);
+    outInput->buttonsMask    = rcnet_packet_read_u32(&reader);
+    outInput->axisX          = rcnet_packet_read_f32(&reader);
+    outInput->axisY          = rcnet_packet_read_f32(&reader);
+
+    return !reader.overflow;
+}
+
+size_t rcnet_codec_encode_client_input_batch(const RCNET_ClientInput* inputs, uint32_t count, void* outBuffer, size_t outCapacity)
+{
+    if (inputs == NULL || count == 0 || count > RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS || outCapacity < kInputBatchHeaderSize)
+        return 0;
+
+    // Inputs encodables : on s'arrête au premier écart qui ne tient pas sur kInputBatchGapBits
+    uint32_t encodedCount = 1;
+    while (encodedCount < count)
+    {
+        uint32_t seqGap = inputs[encodedCount - 1].clientInputSeq - inputs[encodedCount].clientInputSeq;
+        uint32_t tickGap = inputs[encodedCount - 1].clientTickId - inputs[encodedCount].clientTickId;
+        if (seqGap == 0 || seqGap - 1 >= (1u << kInputBatchGapBits) || tickGap >= (1u << kInputBatchGapBits))
+            break;
+        encodedCount++;
+    }
+
+    RCNET_PacketWriter writer;
+    rcnet_packet_writer_init(&writer, outBuffer, outCapacity);
+    rcnet_codec_write_header(&writer, RCNET_PACKET_TYPE_CLIENT_INPUT_BATCH);
+    rcnet_packet_write_u8(&writer, static_cast<uint8_t>(encodedCount));
+    rcnet_packet_write_u32(&writer, inputs[0].clientInputSeq);
+    rcnet_packet_write_u32(&writer, inputs[0].clientTickId);
+
+    RCNET_BitWriter bits;
+    rcnet_bit_writer_init(&bits, writer.data + writer.size, writer.capacity - writer.size);
+
+    const uint32_t axisBits = RCNET_CLIENT_INPUT_BATCH_AXIS_BITS;
+    uint32_t previousAxisX = rcnet_quantize_float(inputs[0].axisX, -1.0f, 1.0f, axisBits);
+    uint32_t previousAxisY = rcnet_quantize_float(inputs[0].axisY, -1.0f, 1.0f, axisBits);
+    rcnet_bit_write(&bits, inputs[0].buttonsMask, 32);
+    rcnet_bit_write(&bits, previousAxisX, axisBits);
+    rcnet_bit_write(&bits, previousAxisY, axisBits);
+
+    for (uint32_t i = 1; i < encodedCount; ++i)
+    {
+        const RCNET_ClientInput& newer = inputs[i - 1];
+        const RCNET_ClientInput& input = inputs[i];
+
+        // Cas courant : seq et tick consécutifs, 1 bit chacun
+        uint32_t seqGap = newer.clientInputSeq - input.clientInputSeq;
+        uint32_t tickGap = newer.clientTickId - input.clientTickId;
+        rcnet_bit_write(&bits, seqGap == 1 ? 1u : 0u, 1);
+        if (seqGap != 1)
+            rcnet_bit_write(&bits, seqGap - 1, kInputBatchGapBits);
+        rcnet_bit_write(&bits, tickGap == seqGap ? 1u : 0u, 1);
+        if (tickGap != seqGap)
+            rcnet_bit_write(&bits, tickGap, kInputBatchGapBits);
+
+        bool buttonsChanged = input.buttonsMask != newer.buttonsMask;
+        rcnet_bit_write(&bits, buttonsChanged ? 1u : 0u, 1);
+        if (buttonsChanged)
+            rcnet_bit_write(&bits, input.buttonsMask, 32);
+
+        uint32_t axisX = rcnet_quantize_float(input.axisX, -1.0f, 1.0f, axisBits);
+        uint32_t axisY = rcnet_quantize_float(input.axisY, -1.0f, 1.0f, axisBits);
+        bool axesChanged = axisX != previousAxisX || axisY != previousAxisY;
+        rcnet_bit_write(&bits, axesChanged ? 1u : 0u, 1);
+        if (axesChanged)
+        {
+            rcnet_bit_write(&bits, axisX, axisBits);
+            rcnet_bit_write(&bits, axisY, axisBits);
+        }
+        previousAxisX = axisX;
+        previousAxisY = axisY;
+    }
+
+    size_t bitBytes = rcnet_bit_writer_flush(&bits);
+    if (writer.overflow || bits.overflow)
+        return 0;
+
+    return writer.size + bitBytes;
+}
+
+uint32_t rcnet_codec_decode_client_input_batch(const void* bytes, size_t size, uint32_t clientId, RCNET_ClientInput* outInputs)
+{
+    if (size < kInputBatchHeaderSize || rcnet_codec_peek_type(bytes, size) != RCNET_PACKET_TYPE_CLIENT_INPUT_BATCH)
+        return 0;
+
+    RCNET_PacketReader reader;
+    rcnet_packet_reader_init(&reader, bytes, size);
+    reader.offset = RCNET_PACKET_HEADER_SIZE;
+
+    uint32_t count = rcnet_packet_read_u8(&reader);
+    uint32_t seq = rcnet_packet_read_u32(&reader);
+    uint32_t tick = rcnet_packet_read_u32(&reader);
+    if (reader.overflow || count == 0 || count > RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS)
+        return 0;
+
+    RCNET_BitReader bits;
+    rcnet_bit_reader_init(&bits, reader.data + reader.offset, rcnet_packet_reader_remaining(&reader));
+
+    const uint32_t axisBits = RCNET_CLIENT_INPUT_BATCH_AXIS_BITS;
+    uint32_t buttons = rcnet_bit_read(&bits, 32);
+    uint32_t axisX = rcnet_bit_read(&bits, axisBits);
+    uint32_t axisY = rcnet_bit_read(&bits, axisBits);
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (i > 0)
+        {
+            uint32_t seqGap = rcnet_bit_read(&bits, 1) ? 1u : rcnet_bit_read(&bits, kInputBatchGapBits) + 1;
+            uint32_t tickGap = rcnet_bit_read(&bits, 1) ? seqGap : rcnet_bit_read(&bits, kInputBatchGapBits);
+            seq -= seqGap;
+            tick -= tickGap;
+
+            if (rcnet_bit_read(&bits, 1))
+                buttons = rcnet_bit_read(&bits, 32);
+            if (rcnet_bit_read(&bits, 1))
+            {
+                axisX = rcnet_bit_read(&bits, axisBits);
+                axisY = rcnet_bit_read(&bits, axisBits);
+            }
+        }
+
+        RCNET_ClientInput& input = outInputs[i];
+        input.clientId       = clientId;
+        input.clientTickId   = tick;
+        input.clientInputSeq = seq;
+        input.buttonsMask    = buttons;
+        input.axisX          = rcnet_dequantize_float(axisX, -1.0f, 1.0f, axisBits);
+        input.axisY          = rcnet_dequantize_float(axisY, -1.0f, 1.0f, axisBits);
+    }
+
+    return bits.overflow ? 0 : count;
+}
+
+void rcnet_codec_write_snapshot_header(RCNET_PacketWriter* writer, const RCNET_SnapshotHeader* header)
+{
+    rcnet_codec_write_header(writer, RCNET_PACKET_TYPE_SNAPSHOT);
+    rcnet_packet_write_u64(writer, header->serverTick);
+    rcnet_packet_write_u32(writer, header->ackApplied);
+    rcnet_packet_write_u32(writer, header->ackRecv);
+}
+
+bool rcnet_codec_read_snapshot_header(RCNET_PacketReader* reader, RCNET_SnapshotHeader* outHeader)
+{
+    if (rcnet_codec_peek_type(reader->data + reader->offset, rcnet_packet_reader_remaining(reader)) != RCNET_PACKET_TYPE_SNAPSHOT)
+        return false;
+
+    reader->offset += RCNET_PACKET_HEADER_SIZE;
+
+    outHeader->serverTick = rcnet_packet_read_u64(reader);
+    outHeader->ackApplied = rcnet_packet_read_u32(reader);
+    outHeader->ackRecv    = rcnet_packet_read_u32(reader);
+
+    return !reader->overflow;
+}
+
+size_t rcnet_codec_encode_snapshot_ack(uint64_t snapshotTick, void* outBuffer, size_t outCapacity)
+{
+    RCNET_PacketWriter writer;
+    rcnet_packet_writer_init(&writer, outBuffer, outCapacity);
+
+    rcnet_codec_write_header(&writer, RCNET_PACKET_TYPE_SNAPSHOT_ACK);
+    rcnet_packet_write_u64(&writer, snapshotTick);
+
+    return writer.overflow ? 0 : writer.size;
+}
+
+bool rcnet_codec_decode_snapshot_ack(const void* bytes, size_t size, uint64_t* outSnapshotTick)
+{
+    if (size != RCNET_SNAPSHOT_ACK_PACKET_SIZE)
+        return false;
+
+    if (rcnet_codec_peek_type(bytes, size) != RCNET_PACKET_TYPE_SNAPSHOT_ACK)
+        return false;
+
+    RCNET_PacketReader reader;
+    rcnet_packet_reader_init(&reader, bytes, size);
+    reader.offset = RCNET_PACKET_HEADER_SIZE;
+
+    *outSnapshotTick = rcnet_packet_read_u64(&reader);
+    return !reader.overflow;
+}
@@ -0,0 +1,502 @@
+#include "RCNET/RCNET_compression.h"
+#include "RCNET/RCNET_logger.h"
+
+// ================================
+// External Libraries
+// ================================
+#include <lz4/lz4.h>
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <new>
+
+/**
+ * Format d'un packet sur un channel actif :
+ * - [0xA0][données]                       : packet brut (sous le seuil, ou incompressible en mode bloc)
+ * - [0xA1][originalSize u32 LE][LZ4 bloc] : bloc indépendant
+ * - [0xA2][originalSize u32 LE][LZ4 bloc] : bloc de stream (dépend des packets précédents du channel)
+ */
+static constexpr uint8_t kMarkerRaw    = 0xA0;
+static constexpr uint8_t kMarkerBlock  = 0xA1;
+static constexpr uint8_t kMarkerStream = 0xA2;
+
+// Fenêtre du dictionnaire LZ4
+static constexpr size_t kLz4WindowSize = 64 * 1024;
+
+/**
+ * Etat stream d'un channel.
+ *
+ * L'encodeur recopie chaque packet dans encodeRing (64 Ko de dictionnaire + 1 packet max)
+ * et repart au début quand le packet ne tient plus : les 64 Ko précédents restent en place.
+ * Le décodeur décompresse directement dans decodeRing (taille LZ4_DECODER_RING_BUFFER_SIZE)
+ * et repart au début dès qu'il reste moins de maxPacketSize octets : il n'a pas besoin
+ * de suivre les positions de l'encodeur.
+ */
+struct RCNET_CompressionStream
+{
+    LZ4_stream_t* encoder = nullptr;
+    char* encodeRing = nullptr;
+    size_t encodeRingSize = 0;
+    size_t encodeOffset = 0;
+
+    LZ4_streamDecode_t* decoder = nullptr;
+    char* decodeRing = nullptr;
+    size_t decodeRingSize = 0;
+    size_t decodeOffset = 0;
+};
+
+struct RCNET_Compressor
+{
+    RCNET_CompressionConfig config{};
+
+    // Etat de travail du mode bloc (évite les 16 Ko de LZ4_compress_fast sur la pile à chaque packet)
+    LZ4_stream_t* blockState = nullptr;
+
+    RCNET_CompressionStream streams[RCNET_COMPRESSION_MAX_CHANNELS];
+
+    // Compteurs lisibles depuis un autre thread (ex: stats/metrics)
+    std::atomic<uint64_t> packetsCompressed{0};
+    std::atomic<uint64_t> packetsSkipped{0};
+    std::atomic<uint64_t> inputBytes{0};
+    std::atomic<uint64_t> outputBytes{0};
+    std::atomic<uint64_t> compressTimeNs{0};
+    std::atomic<uint64_t> packetsDecompressed{0};
+    std::atomic<uint64_t> decompressFailures{0};
+    std::atomic<uint64_t> decompressTimeNs{0};
+};
+
+static uint64_t rcnet_compression_nowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static void rcnet_compression_writeHeader(uint8_t* out, uint8_t marker, size_t originalSize)
+{
+    const uint32_t size = static_cast<uint32_t>(originalSize);
+    out[0] = marker;
+    out[1] = static_cast<uint8_t>(size);
+    out[2] = static_cast<uint8_t>(size >> 8);
+    out[3] = static_cast<uint8_t>(size >> 16);
+    out[4] = static_cast<uint8_t>(size >> 24);
+}
+
+static size_t rcnet_compression_readOriginalSize(const uint8_t* in)
+{
+    return static_cast<size_t>(in[1])
+         | (static_cast<size_t>(in[2]) << 8)
+         | (static_cast<size_t>(in[3]) << 16)
+         | (static_cast<size_t>(in[4]) << 24);
+}
+
+static size_t rcnet_compression_writeRaw(const void* input, size_t inputSize, void* output, size_t outputCapacity)
+{
+    if (outputCapacity < RCNET_COMPRESSION_RAW_HEADER_SIZE + inputSize)
+        return 0;
+
+    uint8_t* out = static_cast<uint8_t*>(output);
+    out[0] = kMarkerRaw;
+    if (inputSize > 0)
+        memcpy(out + RCNET_COMPRESSION_RAW_HEADER_SIZE, input, inputSize);
+
+    return RCNET_COMPRESSION_RAW_HEADER_SIZE + inputSize;
+}
+
+/**
+ * Compresse un bloc indépendant, écrit brut si la compression ne fait pas gagner de place.
+ * state peut être NULL (LZ4_compress_fast alloue alors son état sur la pile).
+ */
+static size_t rcnet_compression_compressBlock(void* state, const void* input, size_t inputSize, void* output, size_t outputCapacity, size_t minCompressSize, int acceleration, bool* outCompressed)
+{
+    *outCompressed = false;
+
+    if (inputSize < minCompressSize || inputSize <= RCNET_COMPRESSION_LZ4_HEADER_SIZE || inputSize > LZ4_MAX_INPUT_SIZE
+        || outputCapacity <= RCNET_COMPRESSION_LZ4_HEADER_SIZE)
+        return rcnet_compression_writeRaw(input, inputSize, output, outputCapacity);
+
+    uint8_t* out = static_cast<uint8_t*>(output);
+
+    // Sortie limitée pour que le résultat soit strictement plus petit que le brut (LZ4 abandonne aussi plus tôt)
+    size_t dstCapacity = outputCapacity - RCNET_COMPRESSION_LZ4_HEADER_SIZE;
+    if (dstCapacity > inputSize - RCNET_COMPRESSION_LZ4_HEADER_SIZE)
+        dstCapacity = inputSize - RCNET_COMPRESSION_LZ4_HEADER_SIZE;
+
+    const int written = state != NULL
+        ? LZ4_compress_fast_extState(state, static_cast<const char*>(input), reinterpret_cast<char*>(out + RCNET_COMPRESSION_LZ4_HEADER_SIZE),
+                                     static_cast<int>(inputSize), static_cast<int>(dstCapacity), acceleration)
+        : LZ4_compress_fast(static_cast<const char*>(input), reinterpret_cast<char*>(out + RCNET_COMPRESSION_LZ4_HEADER_SIZE),
+                            static_cast<int>(inputSize), static_cast<int>(dstCapacity), acceleration);
+
+    if (written <= 0)
+        return rcnet_compression_writeRaw(input, inputSize, output, outputCapacity);
+
+    rcnet_compression_writeHeader(out, kMarkerBlock, inputSize);
+    *outCompressed = true;
+    return RCNET_COMPRESSION_LZ4_HEADER_SIZE + static_cast<size_t>(written);
+}
+
+static size_t rcnet_compression_decompressBlock(const uint8_t* in, size_t inputSize, void* output, size_t outputCapacity)
+{
+    if (inputSize < RCNET_COMPRESSION_LZ4_HEADER_SIZE)
+        return 0;
+
+    const size_t originalSize = rcnet_compression_readOriginalSize(in);
+    if (originalSize == 0 || originalSize > outputCapacity || originalSize > LZ4_MAX_INPUT_SIZE)
+        return 0;
+
+    const int decoded = LZ4_decompress_safe(reinterpret_cast<const char*>(in + RCNET_COMPRESSION_LZ4_HEADER_SIZE), static_cast<char*>(output),
+                                            static_cast<int>(inputSize - RCNET_COMPRESSION_LZ4_HEADER_SIZE), static_cast<int>(originalSize));
+
+    return decoded == static_cast<int>(originalSize) ? originalSize : 0;
+}
+
+static void rcnet_compression_destroyStream(RCNET_CompressionStream* stream)
+{
+    if (stream->encoder != nullptr)
+        LZ4_freeStream(stream->encoder);
+    if (stream->decoder != nullptr)
+        LZ4_freeStreamDecode(stream->decoder);
+
+    delete[] stream->encodeRing;
+    delete[] stream->decodeRing;
+
+    *stream = RCNET_CompressionStream{};
+}
+
+static bool rcnet_compression_createStream(RCNET_CompressionStream* stream, size_t maxPacketSize)
+{
+    stream->encodeRingSize = kLz4WindowSize + maxPacketSize;
+    stream->decodeRingSize = static_cast<size_t>(LZ4_DECODER_RING_BUFFER_SIZE(maxPacketSize));
+
+    stream->encoder    = LZ4_createStream();
+    stream->decoder    = LZ4_createStreamDecode();
+    stream->encodeRing = new (std::nothrow) char[stream->encodeRingSize];
+    stream->decodeRing = new (std::nothrow) char[stream->decodeRingSize];
+
+    if (stream->encoder == nullptr || stream->decoder == nullptr || stream->encodeRing == nullptr || stream->decodeRing == nullptr)
+    {
+        rcnet_compression_destroyStream(stream);
+        return false;
+    }
+
+    return true;
+}
+
+void rcnet_compression_get_default_config(RCNET_CompressionConfig* outConfig)
+{
+    if (outConfig == NULL)
+        return;
+
+    *outConfig = RCNET_CompressionConfig{};
+    outConfig->channelCount    = 0;
+    outConfig->minCompressSize = 128;
+    outConfig->maxPacketSize   = 64 * 1024;
+    outConfig->acceleration    = 1;
+}
+
+RCNET_Compressor* rcnet_compressor_create(const RCNET_CompressionConfig* config)
+{
+    if (config == NULL || config->channelCount > RCNET_COMPRESSION_MAX_CHANNELS)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_compressor_create: configuration invalide (channelCount > %d)\n", RCNET_COMPRESSION_MAX_CHANNELS);
+        return NULL;
+    }
+
+    if (config->maxPacketSize == 0 || config->maxPacketSize > LZ4_MAX_INPUT_SIZE)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_compressor_create: maxPacketSize invalide\n");
+        return NULL;
+    }
+
+    RCNET_Compressor* compressor = new (std::nothrow) RCNET_Compressor();
+    if (compressor == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_compressor_create: allocation echouee\n");
+        return NULL;
+    }
+
+    compressor->config = *config;
+    if (compressor->config.acceleration < 1)
+        compressor->config.acceleration = 1;
+
+    bool ok = true;
+    bool needsBlockState = false;
+    for (uint32_t i = 0; i < config->channelCount && ok; ++i)
+    {
+        if (config->channelModes[i] == RCNET_COMPRESSION_MODE_BLOCK)
+            needsBlockState = true;
+        else if (config->channelModes[i] == RCNET_COMPRESSION_MODE_STREAM)
+            ok = rcnet_compression_createStream(&compressor->streams[i], config->maxPacketSize);
+    }
+
+    if (ok && needsBlockState)
+    {
+        compressor->blockState = LZ4_createStream();
+        ok = compressor->blockState != nullptr;
+    }
+
+    if (!ok)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_compressor_create: allocation des etats LZ4 echouee\n");
+        rcnet_compressor_destroy(compressor);
+        return NULL;
+    }
+
+    return compressor;
+}
+
+void rcnet_compressor_destroy(RCNET_Compressor* compressor)
+{
+    if (compressor == NULL)
+        return;
+
+    for (uint32_t i = 0; i < RCNET_COMPRESSION_MAX_CHANNELS; ++i)
+        rcnet_compression_destroyStream(&compressor->streams[i]);
+
+    if (compressor->blockState != nullptr)
+        LZ4_freeStream(compressor->blockState);
+
+    delete compressor;
+}
+
+void rcnet_compressor_reset(RCNET_Compressor* compressor)
+{
+    if (compressor == NULL)
+        return;
+
+    for (uint32_t i = 0; i < RCNET_COMPRESSION_MAX_CHANNELS; ++i)
+    {
+        RCNET_CompressionStream* stream = &compressor->streams[i];
+        if (stream->encoder == nullptr)
+            continue;
+
+        LZ4_resetStream_fast(stream->encoder);
+        LZ4_setStreamDecode(stream->decoder, NULL, 0);
+        stream->encodeOffset = 0;
+        stream->decodeOffset = 0;
+    }
+
+    compressor->packetsCompressed.store(0, std::memory_order_relaxed);
+    compressor->packetsSkipped.store(0, std::memory_order_relaxed);
+    compressor->inputBytes.store(0, std::memory_order_relaxed);
+    compressor->outputBytes.store(0, std::memory_order_relaxed);
+    compressor->compressTimeNs.store(0, std::memory_order_relaxed);
+    compressor->packetsDecompressed.store(0, std::memory_order_relaxed);
+    compressor->decompressFailures.store(0, std::memory_order_relaxed);
+    compressor->decompressTimeNs.store(0, std::memory_order_relaxed);
+}
+
+bool rcnet_compressor_is_channel_enabled(const RCNET_Compressor* compressor, uint8_t channelId)
+{
+    return compressor != NULL
+        && channelId < compressor->config.channelCount
+        && compressor->config.channelModes[channelId] != RCNET_COMPRESSION_MODE_NONE;
+}
+
+size_t rcnet_compression_get_max_output_size(size_t inputSize)
+{
+    if (inputSize > LZ4_MAX_INPUT_SIZE)
+        return 0;
+
+    return RCNET_COMPRESSION_LZ4_HEADER_SIZE + static_cast<size_t>(LZ4_COMPRESSBOUND(inputSize));
+}
+
+size_t rcnet_compressor_compress(RCNET_Compressor* compressor, uint8_t channelId, const void* input, size_t inputSize, void* output, size_t outputCapacity)
+{
+    if (!rcnet_compressor_is_channel_enabled(compressor, channelId) || (input == NULL && inputSize > 0) || output == NULL)
+        return 0;
+
+    if (inputSize > compressor->config.maxPacketSize)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_compressor_compress: packet de %zu octets > maxPacketSize\n", inputSize);
+        return 0;
+    }
+
+    const uint64_t startNs = rcnet_compression_nowNs();
+    size_t written = 0;
+    bool compressed = false;
+
+    if (compressor->config.channelModes[channelId] == RCNET_COMPRESSION_MODE_BLOCK || inputSize < compressor->config.minCompressSize)
+    {
+        // Les packets sous le seuil d'un channel stream sont envoyés bruts sans toucher au stream :
+        // le décodeur fait de même, les deux dictionnaires restent identiques.
+        written = rcnet_compression_compressBlock(compressor->blockState, input, inputSize, output, outputCapacity,
+                                                  compressor->config.minCompressSize, compressor->config.acceleration, &compressed);
+    }
+    else
+    {
+        // Stream : toujours compressé (le packet fait maintenant partie du dictionnaire des deux côtés)
+        RCNET_CompressionStream* stream = &compressor->streams[channelId];
+        const int bound = LZ4_compressBound(static_cast<int>(inputSize));
+        if (outputCapacity < RCNET_COMPRESSION_LZ4_HEADER_SIZE + static_cast<size_t>(bound))
+            return 0;
+
+        if (stream->encodeOffset + inputSize > stream->encodeRingSize)
+            stream->encodeOffset = 0;
+
+        char* src = stream->encodeRing + stream->encodeOffset;
+        memcpy(src, input, inputSize);
+
+        uint8_t* out = static_cast<uint8_t*>(output);
+        const int result = LZ4_compress_fast_continue(stream->encoder, src, reinterpret_cast<char*>(out + RCNET_COMPRESSION_LZ4_HEADER_SIZE),
+                                                      static_cast<int>(inputSize), bound, compressor->config.acceleration);
+        if (result <= 0)
+        {
+            RCNET_log(RCNET_LOG_ERROR, "rcnet_compressor_compress: LZ4_compress_fast_continue a echoue\n");
+            return 0;
+        }
+
+        stream->encodeOffset += inputSize;
+        rcnet_compression_writeHeader(out, kMarkerStream, inputSize);
+        written = RCNET_COMPRESSION_LZ4_HEADER_SIZE + static_cast<size_t>(result);
+        compressed = true;
+    }
+
+    if (written == 0)
+        return 0;
+
+    (compressed ? compressor->packetsCompressed : compressor->packetsSkipped).fetch_add(1, std::memory_order_relaxed);
+    compressor->inputBytes.fetch_add(inputSize, std::memory_order_relaxed);
+    compressor->outputBytes.fetch_add(written, std::memory_order_relaxed);
+    compressor->compressTimeNs.fetch_add(rcnet_compression_nowNs() - startNs, std::memory_order_relaxed);
+
+    return written;
+}
+
+size_t rcnet_compressor_decompress(RCNET_Compressor* compressor, uint8_t channelId, const void* input, size_t inputSize, void* output, size_t outputCapacity)
+{
+    if (!rcnet_compressor_is_channel_enabled(compressor, channelId) || input == NULL || output == NULL || inputSize < RCNET_COMPRESSION_RAW_HEADER_SIZE)
+    {
+        if (compressor != NULL)
+            compressor->decompressFailures.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+    }
+
+    const uint64_t startNs = rcnet_compression_nowNs();
+    const uint8_t* in = static_cast<const uint8_t*>(input);
+    size_t decoded = 0;
+
+    switch (in[0])
+    {
+        case kMarkerRaw:
+        {
+            // Un packet vide est traité comme invalide (0 est réservé à l'erreur)
+            decoded = inputSize - RCNET_COMPRESSION_RAW_HEADER_SIZE;
+            if (decoded > outputCapacity)
+                decoded = 0;
+            else if (decoded > 0)
+                memcpy(output, in + RCNET_COMPRESSION_RAW_HEADER_SIZE, decoded);
+            break;
+        }
+
+        case kMarkerBlock:
+            decoded = rcnet_compression_decompressBlock(in, inputSize, output, outputCapacity);
+            break;
+
+        case kMarkerStream:
+        {
+            RCNET_CompressionStream* stream = &compressor->streams[channelId];
+            if (stream->decoder == nullptr || inputSize < RCNET_COMPRESSION_LZ4_HEADER_SIZE)
+                break;
+
+            const size_t originalSize = rcnet_compression_readOriginalSize(in);
+            if (originalSize == 0 || originalSize > compressor->config.maxPacketSize || originalSize > outputCapacity)
+                break;
+
+            if (stream->decodeOffset + compressor->config.maxPacketSize > stream->decodeRingSize)
+                stream->decodeOffset = 0;
+
+            char* dst = stream->decodeRing + stream->decodeOffset;
+            const int result = LZ4_decompress_safe_continue(stream->decoder, reinterpret_cast<const char*>(in + RCNET_COMPRESSION_LZ4_HEADER_SIZE), dst,
+                                                            static_cast<int>(inputSize - RCNET_COMPRESSION_LZ4_HEADER_SIZE), static_cast<int>(originalSize));
+            if (result != static_cast<int>(originalSize))
+                break;
+
+            memcpy(output, dst, originalSize);
+            stream->decodeOffset += originalSize;
+            decoded = originalSize;
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    if (decoded == 0)
+    {
+        compressor->decompressFailures.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+    }
+
+    compressor->packetsDecompressed.fetch_add(1, std::memory_order_relaxed);
+    compressor->decompressTimeNs.fetch_add(rcnet_compression_nowNs() - startNs, std::memory_order_relaxed);
+    return decoded;
+}
+
+void rcnet_compressor_get_stats(const RCNET_Compressor* compressor, RCNET_CompressionStats* outStats)
+{
+    if (outStats == NULL)
+        return;
+
+    *outStats = RCNET_CompressionStats{};
+    if (compressor == NULL)
+        return;
+
+    outStats->packetsCompressed   = compressor->packetsCompressed.load(std::memory_order_relaxed);
+    outStats->packetsSkipped      = compressor->packetsSkipped.load(std::memory_order_relaxed);
+    outStats->inputBytes          = compressor->inputBytes.load(std::memory_order_relaxed);
+    outStats->outputBytes         = compressor->outputBytes.load(std::memory_order_relaxed);
+    outStats->compressTimeNs      = compressor->compressTimeNs.load(std::memory_order_relaxed);
+    outStats->packetsDecompressed = compressor->packetsDecompressed.load(std::memory_order_relaxed);
+    outStats->decompressFailures  = compressor->decompressFailures.load(std::memory_order_relaxed);
+    outStats->decompressTimeNs    = compressor->decompressTimeNs.load(std::memory_order_relaxed);
+}
+
+size_t rcnet_compression_compress_block(const void* input, size_t inputSize, void* output, size_t outputCapacity, size_t minCompressSize, int acceleration)
+{
+    if ((input == NULL && inputSize > 0) || output == NULL)
+        return 0;
+
+    bool compressed = false;
+    return rcnet_compression_compressBlock(NULL, input, inputSize, output, outputCapacity, minCompressSize, acceleration < 1 ? 1 : acceleration, &compressed);
+}
+
+size_t rcnet_compression_get_block_original_size(const void* input, size_t inputSize)
+{
+    if (input == NULL || inputSize < RCNET_COMPRESSION_RAW_HEADER_SIZE)
+        return 0;
+
+    const uint8_t* in = static_cast<const uint8_t*>(input);
+    if (in[0] == kMarkerRaw)
+        return inputSize - RCNET_COMPRESSION_RAW_HEADER_SIZE;
+    if (in[0] == kMarkerBlock && inputSize >= RCNET_COMPRESSION_LZ4_HEADER_SIZE)
+        return rcnet_compression_readOriginalSize(in);
+
+    return 0;
+}
+
+size_t rcnet_compression_decompress_block(const void* input, size_t inputSize, void* output, size_t outputCapacity)
+{
+    if (input == NULL || output == NULL || inputSize < RCNET_COMPRESSION_RAW_HEADER_SIZE)
+        return 0;
+
+    const uint8_t* in = static_cast<const uint8_t*>(input);
+    if (in[0] == kMarkerRaw)
+    {
+        const size_t size = inputSize - RCNET_COMPRESSION_RAW_HEADER_SIZE;
+        if (size == 0 || size > outputCapacity)
+            return 0;
+
+        memcpy(output, in + RCNET_COMPRESSION_RAW_HEADER_SIZE, size);
+        return size;
+    }
+
+    if (in[0] == kMarkerBlock)
+        return rcnet_compression_decompressBlock(in, inputSize, output, outputCapacity);
+
+    return 0;
+}
@@ -5,28 +5,9 @@
 // ================================
 #include <stdbool.h>
 #include <cstdlib>
-#include <chrono>
 #include <thread>
 #include <atomic>
-
-using namespace std::chrono;
-
-// ================================
-// Dependencies Libraries OpenSSL
-// ================================
-#include <openssl/ssl.h>
-#include <openssl/bio.h>
-#include <openssl/err.h>
-
-// ================================
-// Dependencies Libraries libsodium
-// ================================
-#include <sodium.h>
-
-// ================================
-// Dependencies Libraries RCENet
-// ================================
-#include <rcenet/RCENET_enet.h>
+#include <exception>
 
 // ======================================================
 // 1) Etat global serveur (thread-safe)
@@ -77,108 +58,157 @@ RCNET_Callbacks callbacksServerEngine = {
 };
 
 // ======================================================
-// 6) RCENet init/cleanup
+// 5.B) Pool de workers (parallel_for + arenas de scratch)
 // ======================================================
 
-static bool rcnet_engine_initRCENet(void)
-{
-    if (enet_initialize() < 0)
-    {
-        RCNET_log(RCNET_LOG_CRITICAL, "Erreur lors de l'initialisation de RCEnet.");
-        return false;
-    }
-    RCNET_log(RCNET_LOG_INFO, "RCENet initialiser avec succes.");
-    return true;
-}
+// Nombre de threads workers demandé (< 0 = auto)
+static int workerThreadsRequested = -1;
 
-static void rcnet_engine_cleanupRCENet(void)
-{
-    enet_deinitialize();
-    RCNET_log(RCNET_LOG_INFO, "RCENet nettoyer avec succes.");
-}
+// Limite du mode auto (au-delà, le gain sur l'encodage des snapshots devient marginal)
+static constexpr uint32_t kMaxAutoWorkerThreads = 8;
+
+// Taille initiale de l'arena de chaque worker (grandit toute seule si besoin)
+static constexpr size_t kWorkerArenaBytes = 256 * 1024;
+
+static RCNET_WorkerPool* workerPool = NULL;
+
+// Mode de threading demandé (lu au démarrage de rcnet_engine_run)
+static RCNET_EngineThreadingMode threadingMode = RCNET_ENGINE_THREADING_SINGLE;
 
 // ======================================================
-// 7) OpenSSL init/cleanup
+// 5.D) Timers des boucles + idle
 // ======================================================
 
-static bool rcnet_engine_initOpenssl(void)
+// Backend demandé (appliqué à la création des timers, au premier rcnet_engine_init)
+static RCNET_TimerBackend timerBackendRequested = RCNET_TIMER_BACKEND_AUTO;
+
+// Un timer par boucle (boucle principale / simulation, et thread réseau en mode SPLIT).
+// Jamais détruits : rcnet_engine_wake() peut être appelée depuis un thread réseau à tout moment.
+static std::atomic<RCNET_Timer*> simLoopTimer{NULL};
+static std::atomic<RCNET_Timer*> netLoopTimer{NULL};
+
+// Ticks suspendus (plus aucun client par exemple)
+static std::atomic<bool> engineIdle{false};
+static std::atomic<uint64_t> engineIdleWakeups{0};
+
+// Durée max d'une attente en idle (vérifie serverIsRunning au moins à ce rythme)
+static constexpr uint64_t kIdleMaxWaitNs = 1'000'000'000ull;
+
+static void rcnet_engine_wakeLoopTimers(void)
 {
-    if (OPENSSL_init_ssl(OPENSSL_INIT_LOAD_SSL_STRINGS | OPENSSL_INIT_LOAD_CRYPTO_STRINGS, NULL) == 0)
-    {
-        RCNET_log(RCNET_LOG_ERROR, "Erreur lors de l'initialisation d'OpenSSL : %s",
-                  ERR_error_string(ERR_get_error(), NULL));
-        return false;
-    }
-    RCNET_log(RCNET_LOG_INFO, "OpenSSL initialisé avec succès.");
-    return true;
+    rcnet_timer_wake(simLoopTimer.load(std::memory_order_acquire));
+    rcnet_timer_wake(netLoopTimer.load(std::memory_order_acquire));
 }
 
-static void rcnet_engine_cleanupOpenssl(void)
+// Shards réseau dont les peers sont agrégés dans les stats (rcnet_engine_set_net_shards)
+static std::atomic<RCNET_NetShards*> engineNetShards{NULL};
+
+// Lecteurs en cours des shards attachés : rcnet_engine_set_net_shards attend qu'il n'y en ait plus,
+// l'appelant peut alors détruire les anciens shards
+static std::atomic<uint32_t> engineNetShardsReaders{0};
+
+// Compteur incrémenté avant la lecture du pointeur (seq_cst) : un lecteur qui a vu les anciens
+// shards est forcément compté quand rcnet_engine_set_net_shards relit engineNetShardsReaders
+static RCNET_NetShards* rcnet_engine_acquireNetShards(void)
 {
-    ERR_free_strings();
-    EVP_cleanup();
-    CRYPTO_cleanup_all_ex_data();
-    SSL_COMP_free_compression_methods();
-    RCNET_log(RCNET_LOG_INFO, "OpenSSL nettoyé avec succès.");
+    engineNetShardsReaders.fetch_add(1);
+    return engineNetShards.load();
 }
 
+static void rcnet_engine_releaseNetShards(void)
+{
+    engineNetShardsReaders.fetch_sub(1, std::memory_order_release);
+}
+
+// Thread simulation en mode SPLIT : le pool appartient au thread réseau, la simulation exécute en série
+static std::atomic<std::thread::id> splitSimulationThread{std::thread::id()};
+
 // ======================================================
-// 8) libsodium init
+// 5.C) Profiler de la boucle (histogrammes lock-free)
 // ======================================================
-
-static bool rcnet_engine_initLibSodium(void)
+//
+// Créé au premier rcnet_engine_init et jamais détruit : rcnet_engine_get_stats()
+// peut être appelée depuis n'importe quel thread, y compris pendant / après rcnet_engine_quit().
+struct RCNET_EngineProfiler
 {
-    if (sodium_init() < 0)
-    {
-        RCNET_log(RCNET_LOG_ERROR, "Erreur lors de l'initialisation de libsodium.");
-        return false;
-    }
-    RCNET_log(RCNET_LOG_INFO, "libsodium initialisé avec succès.");
-    return true;
-}
+    RCNET_Histogram* simUpdateNs = NULL;
+    RCNET_Histogram* netUpdateNs = NULL;
+    RCNET_Histogram* simTicksPerLoop = NULL;
+    RCNET_Histogram* sleepOvershootNs = NULL;
+    RCNET_Histogram* sleepSpinNs = NULL;
+
+    std::atomic<uint64_t> simCatchUpTicks{0};
+    std::atomic<uint64_t> netCatchUpTicks{0};
+    std::atomic<uint64_t> simBacklogDrops{0};
+    std::atomic<uint64_t> netBacklogDrops{0};
+    std::atomic<uint64_t> simBacklogDroppedNs{0};
+    std::atomic<uint64_t> netBacklogDroppedNs{0};
+};
+
+static RCNET_EngineProfiler engineProfiler;
+static std::atomic<bool> engineProfilerReady{false};
 
 // ======================================================
-// 9) Timing helpers
+// 6) Dépendances (RCNET_subsystem) + prewarm
 // ======================================================
 
-// Retourne un temps monotone en ns (steady_clock ne recule jamais)
+// Sous-systèmes demandés par l'application (les modules RCNET acquièrent eux-mêmes ceux qu'ils utilisent)
+static uint32_t engineSubsystemsRequested = 0;
+
+// Acquis par rcnet_engine_init, relâchés par rcnet_engine_quit
+static uint32_t engineSubsystemsAcquired = 0;
+
+// rcnet_engine_prewarm() : dépendances, pool, profiler et timers déjà prêts au prochain rcnet_engine_run.
+// Remis à false par rcnet_engine_quit (le pool est détruit), le prewarm suivant le recrée.
+static bool enginePrewarmed = false;
+
+// Acquis par rcnet_engine_prewarm, une seule fois par sous-système, jamais relâchés (ni par rcnet_engine_quit)
+static uint32_t enginePrewarmSubsystems = 0;
+
+// Profil du dernier démarrage (rcnet_engine_get_stats)
+static std::atomic<uint64_t> engineStartupInitNs{0};
+static std::atomic<uint64_t> engineStartupLoadNs{0};
+
+// ======================================================
+// 7) Timing helpers
+// ======================================================
+
+// Retourne un temps monotone en ns (même horloge que les timers des boucles)
 static uint64_t rcnet_engine_getCurrentTimeNs(void)
 {
-    auto now = steady_clock::now();
-    return static_cast<uint64_t>(duration_cast<nanoseconds>(now.time_since_epoch()).count());
+    return rcnet_timer_get_time_ns();
 }
 
-// Sleep "semi précis" :
-// - on dort une grosse partie du temps
-// - on finit en petit spin pour éviter l'oversleep
-static inline void rcnet_sleep_until_ns(uint64_t targetTimeNs)
+// Sleep précis à faible coût CPU (voir RCNET_timer.h) :
+// - sommeil de l'OS (timer haute résolution si disponible) jusqu'à l'échéance moins une marge apprise
+// - petit spin pour finir précisément
+static inline void rcnet_engine_sleepUntil(RCNET_Timer* timer, uint64_t targetTimeNs)
 {
-    // marge finale (spin) en ns. Plus tu augmentes, plus tu consommes CPU.
-    constexpr uint64_t kSpinMarginNs = 200'000; // 200 µs
+    uint64_t spinNs = 0;
+    if (rcnet_timer_sleep_until(timer, targetTimeNs, &spinNs) != RCNET_TIMER_WAIT_DEADLINE)
+        return;
+
+    // Oversleep = retard au réveil, spin = temps CPU brûlé pour tenir l'échéance
+    uint64_t now = rcnet_engine_getCurrentTimeNs();
+    rcnet_histogram_record(engineProfiler.sleepOvershootNs, (now > targetTimeNs) ? now - targetTimeNs : 0);
+    rcnet_histogram_record(engineProfiler.sleepSpinNs, spinNs);
+}
 
-    while (true)
-    {
-        uint64_t now = rcnet_engine_getCurrentTimeNs();
-        if (now >= targetTimeNs)
-            return;
+// Idle : dormir jusqu'à une activité (rcnet_engine_wake / set_idle(false) / eventQuit).
+// Retourne true si la boucle a dormi en idle (elle doit alors repartir de zéro, sans rattrapage).
+static bool rcnet_engine_waitWhileIdle(RCNET_Timer* timer)
+{
+    if (!engineIdle.load(std::memory_order_acquire))
+        return false;
 
-        uint64_t remaining = targetTimeNs - now;
+    while (engineIdle.load(std::memory_order_acquire) && serverIsRunning.load(std::memory_order_relaxed))
+        rcnet_timer_sleep_until(timer, rcnet_engine_getCurrentTimeNs() + kIdleMaxWaitNs, NULL);
 
-        if (remaining > kSpinMarginNs)
-        {
-            // Sleep sur le gros du temps restant.
-            std::this_thread::sleep_for(std::chrono::nanoseconds(remaining - kSpinMarginNs));
-        }
-        else
-        {
-            // Spin court (boucle vide) pour terminer précisément.
-            // Alternative: std::this_thread::yield();
-        }
-    }
+    return true;
 }
 
 // ======================================================
-// 10) Paramètres robustesse boucle
+// 8) Paramètres robustesse boucle
 // ======================================================
 
 // Limite de rattrapage (anti "spirale de la mort").
@@ -191,7 +221,7 @@ static constexpr uint32_t kMaxCatchUpTicks = 5;
 static constexpr uint64_t kMaxFrameClampNs = 250'000'000ull;
 
 // ======================================================
-// 11) Set callbacks
+// 9) Set callbacks
 // ======================================================
 
 static void rcnet_engine_setCallbacks(RCNET_Callbacks* callbacksUser)
@@ -210,15 +240,99 @@ static void rcnet_engine_setCallbacks(RCNET_Callbacks* callbacksUser)
 }
 
 // ======================================================
-// 12) Init moteur + calcule durées de ticks réseau/simulation
+// 10) Init moteur + calcule durées de ticks réseau/simulation
 // ======================================================
 
+static bool rcnet_engine_initWorkerPool(void)
+{
+    uint32_t threadCount = 0;
+    if (workerThreadsRequested >= 0)
+    {
+        threadCount = static_cast<uint32_t>(workerThreadsRequested);
+    }
+    else
+    {
+        uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        threadCount = (hardwareThreads > 1) ? hardwareThreads - 1 : 0;
+        if (threadCount > kMaxAutoWorkerThreads)
+            threadCount = kMaxAutoWorkerThreads;
+    }
+
+    workerPool = rcnet_worker_pool_create(threadCount, kWorkerArenaBytes);
+    if (workerPool == NULL)
+    {
+        RCNET_log(RCNET_LOG_CRITICAL, "Erreur lors de la creation du pool de workers.");
+        return false;
+    }
+    RCNET_log(RCNET_LOG_INFO, "Pool de workers initialise (%u threads).", threadCount);
+    return true;
+}
+
+static bool rcnet_engine_initProfiler(void)
+{
+    if (engineProfilerReady.load(std::memory_order_acquire))
+    {
+        rcnet_engine_reset_stats();
+        return true;
+    }
+
+    engineProfiler.simUpdateNs      = rcnet_histogram_create();
+    engineProfiler.netUpdateNs      = rcnet_histogram_create();
+    engineProfiler.simTicksPerLoop  = rcnet_histogram_create();
+    engineProfiler.sleepOvershootNs = rcnet_histogram_create();
+    engineProfiler.sleepSpinNs      = rcnet_histogram_create();
+
+    if (engineProfiler.simUpdateNs == NULL || engineProfiler.netUpdateNs == NULL || engineProfiler.simTicksPerLoop == NULL
+        || engineProfiler.sleepOvershootNs == NULL || engineProfiler.sleepSpinNs == NULL)
+    {
+        rcnet_histogram_destroy(engineProfiler.simUpdateNs);
+        rcnet_histogram_destroy(engineProfiler.netUpdateNs);
+        rcnet_histogram_destroy(engineProfiler.simTicksPerLoop);
+        rcnet_histogram_destroy(engineProfiler.sleepOvershootNs);
+        rcnet_histogram_destroy(engineProfiler.sleepSpinNs);
+        engineProfiler.simUpdateNs = engineProfiler.netUpdateNs = engineProfiler.simTicksPerLoop = NULL;
+        engineProfiler.sleepOvershootNs = engineProfiler.sleepSpinNs = NULL;
+
+        RCNET_log(RCNET_LOG_CRITICAL, "Erreur lors de la creation du profiler du moteur.");
+        return false;
+    }
+
+    engineProfilerReady.store(true, std::memory_order_release);
+    return true;
+}
+
+static bool rcnet_engine_initTimers(void)
+{
+    if (simLoopTimer.load(std::memory_order_acquire) != NULL)
+        return true;
+
+    RCNET_Timer* simTimer = rcnet_timer_create(timerBackendRequested);
+    RCNET_Timer* netTimer = rcnet_timer_create(timerBackendRequested);
+    if (simTimer == NULL || netTimer == NULL)
+    {
+        rcnet_timer_destroy(simTimer);
+        rcnet_timer_destroy(netTimer);
+        RCNET_log(RCNET_LOG_CRITICAL, "Erreur lors de la creation des timers du moteur.");
+        return false;
+    }
+
+    netLoopTimer.store(netTimer, std::memory_order_release);
+    simLoopTimer.store(simTimer, std::memory_order_release);
+
+    RCNET_log(RCNET_LOG_INFO, "Timers du moteur initialises (backend %s).",
+              rcnet_timer_get_backend(simTimer) == RCNET_TIMER_BACKEND_PLATFORM ? "haute resolution" : "portable");
+    return true;
+}
+
 static bool rcnet_engine_init(void)
 {
-    // 1) Dépendances
-    if (!rcnet_engine_initOpenssl())   return false;
-    if (!rcnet_engine_initRCENet())   return false;
-    if (!rcnet_engine_initLibSodium()) return false;
+    // 1) Dépendances demandées (comptées : déjà prêtes après rcnet_engine_prewarm ou un run précédent)
+    if (!rcnet_subsystem_acquire_flags(engineSubsystemsRequested)) return false;
+    engineSubsystemsAcquired = engineSubsystemsRequested;
+
+    if (workerPool == NULL && !rcnet_engine_initWorkerPool()) return false;
+    if (!rcnet_engine_initProfiler()) return false;
+    if (!rcnet_engine_initTimers()) return false;
 
     // 2) Calcul tick simulation
     simTickDurationNs = static_cast<uint64_t>(1'000'000'000ull) / static_cast<uint64_t>(simTickRateHz);
@@ -232,8 +346,37 @@ static bool rcnet_engine_init(void)
 
 static void rcnet_engine_quit(void)
 {
-    rcnet_engine_cleanupOpenssl();
-    rcnet_engine_cleanupRCENet();
+    splitSimulationThread.store(std::thread::id(), std::memory_order_relaxed);
+    rcnet_worker_pool_destroy(workerPool);
+    workerPool = NULL;
+    enginePrewarmed = false;
+
+    rcnet_subsystem_release_flags(engineSubsystemsAcquired);
+    engineSubsystemsAcquired = 0;
+}
+
+void rcnet_engine_set_subsystems(uint32_t flags)
+{
+    engineSubsystemsRequested = flags & RCNET_SUBSYSTEM_FLAGS_ALL;
+}
+
+bool rcnet_engine_prewarm(void)
+{
+    if (enginePrewarmed)
+        return true;
+
+    // Référence gardée jusqu'à la fin du processus : les runs suivants trouvent les dépendances prêtes.
+    // rcnet_engine_quit ne relâche que celle de rcnet_engine_init ; un prewarm après un run n'en reprend pas.
+    const uint32_t missingSubsystems = engineSubsystemsRequested & ~enginePrewarmSubsystems;
+    if (!rcnet_subsystem_acquire_flags(missingSubsystems))
+        return false;
+    enginePrewarmSubsystems |= missingSubsystems;
+
+    if ((workerPool == NULL && !rcnet_engine_initWorkerPool()) || !rcnet_engine_initProfiler() || !rcnet_engine_initTimers())
+        return false;
+
+    enginePrewarmed = true;
+    return true;
 }
 
 // ======================================================
@@ -249,7 +392,9 @@ static inline void rcnet_engine_simulationTick(void)
     // Appel callback utilisateur (si défini)
     if (callbacksServerEngine.rcnet_simulation_update != NULL)
     {
+        uint64_t startNs = rcnet_engine_getCurrentTimeNs();
         callbacksServerEngine.rcnet_simulation_update(simFixedDt);
+        rcnet_histogram_record(engineProfiler.simUpdateNs, rcnet_engine_getCurrentTimeNs() - startNs);
     }
 }
 
@@ -259,11 +404,19 @@ static inline void rcnet_engine_networkTick(void)
     // Incrémente tickId réseau
     netTickId++;
 
+    uint64_t startNs = rcnet_engine_getCurrentTimeNs();
+
+    // Les buffers de scratch du tick réseau précédent ne sont plus utilisés
+    if (workerPool != NULL)
+        rcnet_worker_pool_reset_arenas(workerPool);
+
     // Appel callback utilisateur (si défini)
     if (callbacksServerEngine.rcnet_network_update != NULL)
     {
         callbacksServerEngine.rcnet_network_update();
     }
+
+    rcnet_histogram_record(engineProfiler.netUpdateNs, rcnet_engine_getCurrentTimeNs() - startNs);
 }
 
 // ======================================================
@@ -272,6 +425,286 @@ static inline void rcnet_engine_networkTick(void)
 void rcnet_engine_eventQuit(void)
 {
     serverIsRunning.store(false, std::memory_order_relaxed);
+
+    // Sortir tout de suite d'une attente (idle ou sleep jusqu'au prochain tick)
+    rcnet_engine_wakeLoopTimers();
+}
+
+// ======================================================
+// 14.A) Timer + idle
+// ======================================================
+void rcnet_engine_set_timer_backend(RCNET_TimerBackend backend)
+{
+    timerBackendRequested = backend;
+}
+
+void rcnet_engine_set_idle(bool idle)
+{
+    engineIdle.store(idle, std::memory_order_release);
+    if (!idle)
+        rcnet_engine_wakeLoopTimers();
+}
+
+void rcnet_engine_wake(void)
+{
+    // Chemin rapide (chaque packet reçu) : rien à faire si le moteur tourne
+    if (!engineIdle.load(std::memory_order_relaxed))
+        return;
+
+    if (engineIdle.exchange(false, std::memory_order_acq_rel))
+    {
+        engineIdleWakeups.fetch_add(1, std::memory_order_relaxed);
+        rcnet_engine_wakeLoopTimers();
+    }
+}
+
+// ======================================================
+// 14.B) Workers (parallel_for + arenas)
+// ======================================================
+void rcnet_engine_set_threading_mode(RCNET_EngineThreadingMode mode)
+{
+    threadingMode = mode;
+}
+
+// true si le thread appelant peut utiliser le pool (et les arenas) de workers
+static inline bool rcnet_engine_ownsWorkerPool(void)
+{
+    return workerPool != NULL && std::this_thread::get_id() != splitSimulationThread.load(std::memory_order_relaxed);
+}
+
+void rcnet_engine_set_worker_threads(int threadCount)
+{
+    workerThreadsRequested = threadCount;
+}
+
+void rcnet_engine_parallel_for(uint32_t count, RCNET_ParallelForFn fn, void* userdata)
+{
+    if (rcnet_engine_ownsWorkerPool())
+    {
+        rcnet_worker_pool_parallel_for(workerPool, count, fn, userdata);
+        return;
+    }
+
+    // Moteur pas démarré (ou thread simulation en mode SPLIT) : tout en série sur le thread appelant
+    for (uint32_t index = 0; index < count; ++index)
+        fn(index, 0, userdata);
+}
+
+uint32_t rcnet_engine_get_worker_count(void)
+{
+    return rcnet_engine_ownsWorkerPool() ? rcnet_worker_pool_get_worker_count(workerPool) : 1;
+}
+
+RCNET_Arena* rcnet_engine_get_worker_arena(uint32_t workerIndex)
+{
+    return rcnet_engine_ownsWorkerPool() ? rcnet_worker_pool_get_arena(workerPool, workerIndex) : NULL;
+}
+
+// ======================================================
+// 14.C) Statistiques de la boucle
+// ======================================================
+bool rcnet_engine_get_stats(RCNET_EngineStats* outStats)
+{
+    if (outStats == NULL)
+        return false;
+
+    *outStats = RCNET_EngineStats{};
+    if (!engineProfilerReady.load(std::memory_order_acquire))
+        return false;
+
+    outStats->simCatchUpTicks     = engineProfiler.simCatchUpTicks.load(std::memory_order_relaxed);
+    outStats->netCatchUpTicks     = engineProfiler.netCatchUpTicks.load(std::memory_order_relaxed);
+    outStats->simBacklogDrops     = engineProfiler.simBacklogDrops.load(std::memory_order_relaxed);
+    outStats->netBacklogDrops     = engineProfiler.netBacklogDrops.load(std::memory_order_relaxed);
+    outStats->simBacklogDroppedNs = engineProfiler.simBacklogDroppedNs.load(std::memory_order_relaxed);
+    outStats->netBacklogDroppedNs = engineProfiler.netBacklogDroppedNs.load(std::memory_order_relaxed);
+
+    rcnet_histogram_get_summary(engineProfiler.simUpdateNs, &outStats->simUpdateNs);
+    rcnet_histogram_get_summary(engineProfiler.netUpdateNs, &outStats->netUpdateNs);
+    rcnet_histogram_get_summary(engineProfiler.simTicksPerLoop, &outStats->simTicksPerLoop);
+    rcnet_histogram_get_summary(engineProfiler.sleepOvershootNs, &outStats->sleepOvershootNs);
+    rcnet_histogram_get_summary(engineProfiler.sleepSpinNs, &outStats->sleepSpinNs);
+
+    RCNET_Timer* timer = simLoopTimer.load(std::memory_order_acquire);
+    outStats->timerBackend = rcnet_timer_get_backend(timer);
+    outStats->spinMarginNs = rcnet_timer_get_spin_margin_ns(timer);
+    outStats->idleWakeups  = engineIdleWakeups.load(std::memory_order_relaxed);
+    outStats->startupInitNs = engineStartupInitNs.load(std::memory_order_relaxed);
+    outStats->startupLoadNs = engineStartupLoadNs.load(std::memory_order_relaxed);
+
+    // Chaque tick enregistre exactement une durée
+    outStats->simTickCount = outStats->simUpdateNs.count;
+    outStats->netTickCount = outStats->netUpdateNs.count;
+
+    // Peers : un seul passage, valeurs du dernier échantillon de chaque shard
+    RCNET_NetShards* shards = rcnet_engine_acquireNetShards();
+    if (shards != NULL)
+    {
+        uint64_t rttSum = 0;
+        uint32_t maxClients = rcnet_net_shards_get_max_clients(shards);
+        for (uint32_t clientId = 0; clientId < maxClients; ++clientId)
+        {
+            RCNET_NetPeerStats peer;
+            if (!rcnet_net_shards_get_peer_stats(shards, clientId, &peer))
+                continue;
+
+            outStats->peerCount++;
+            if (peer.congested)
+                outStats->congestedPeerCount++;
+            rttSum += peer.roundTripTimeMs;
+            if (peer.roundTripTimeMs > outStats->peerRttMaxMs)
+                outStats->peerRttMaxMs = peer.roundTripTimeMs;
+            outStats->peerSentBytesPerSecond += peer.sentBytesPerSecond;
+            outStats->peerEstimatedBytesPerSecond += peer.estimatedBytesPerSecond;
+        }
+        if (outStats->peerCount > 0)
+            outStats->peerRttAvgMs = static_cast<uint32_t>(rttSum / outStats->peerCount);
+    }
+    rcnet_engine_releaseNetShards();
+
+    return true;
+}
+
+void rcnet_engine_set_net_shards(RCNET_NetShards* shards)
+{
+    engineNetShards.store(shards);
+
+    // Un get_stats / get_peer_stats peut encore lire les shards précédents : au retour, plus aucun
+    // lecteur ne les utilise (les lectures sont courtes, l'attente aussi)
+    while (engineNetShardsReaders.load(std::memory_order_acquire) != 0)
+        std::this_thread::yield();
+}
+
+bool rcnet_engine_get_peer_stats(uint32_t clientId, RCNET_NetPeerStats* outStats)
+{
+    RCNET_NetShards* shards = rcnet_engine_acquireNetShards();
+    if (shards == NULL)
+    {
+        rcnet_engine_releaseNetShards();
+        if (outStats != NULL)
+            *outStats = RCNET_NetPeerStats{};
+        return false;
+    }
+
+    bool connected = rcnet_net_shards_get_peer_stats(shards, clientId, outStats);
+    rcnet_engine_releaseNetShards();
+    return connected;
+}
+
+void rcnet_engine_reset_stats(void)
+{
+    if (!engineProfilerReady.load(std::memory_order_acquire))
+        return;
+
+    engineProfiler.simCatchUpTicks.store(0, std::memory_order_relaxed);
+    engineProfiler.netCatchUpTicks.store(0, std::memory_order_relaxed);
+    engineProfiler.simBacklogDrops.store(0, std::memory_order_relaxed);
+    engineProfiler.netBacklogDrops.store(0, std::memory_order_relaxed);
+    engineProfiler.simBacklogDroppedNs.store(0, std::memory_order_relaxed);
+    engineProfiler.netBacklogDroppedNs.store(0, std::memory_order_relaxed);
+
+    rcnet_histogram_reset(engineProfiler.simUpdateNs);
+    rcnet_histogram_reset(engineProfiler.netUpdateNs);
+    rcnet_histogram_reset(engineProfiler.simTicksPerLoop);
+    rcnet_histogram_reset(engineProfiler.sleepOvershootNs);
+    rcnet_histogram_reset(engineProfiler.sleepSpinNs);
+    engineIdleWakeups.store(0, std::memory_order_relaxed);
+}
+
+// ======================================================
+// 14.D) Boucle dédiée (mode SPLIT)
+// ======================================================
+//
+// Même ordonnanceur que la boucle principale (accumulateur, rattrapage limité, drop de backlog),
+// mais pour un seul type de tick : chaque thread suit sa propre fréquence.
+static void rcnet_engine_runDedicatedLoop(bool simulation)
+{
+    const uint64_t tickDurationNs = simulation ? simTickDurationNs : netTickDurationNs;
+    RCNET_Timer* timer = simulation ? simLoopTimer.load(std::memory_order_acquire) : netLoopTimer.load(std::memory_order_acquire);
+
+    uint64_t lastTimeNs = rcnet_engine_getCurrentTimeNs();
+    uint64_t accNs = 0;
+
+    while (serverIsRunning.load(std::memory_order_relaxed))
+    {
+        if (rcnet_engine_waitWhileIdle(timer))
+        {
+            lastTimeNs = rcnet_engine_getCurrentTimeNs();
+            accNs = 0;
+            continue;
+        }
+
+        uint64_t nowNs = rcnet_engine_getCurrentTimeNs();
+        uint64_t frameNs = nowNs - lastTimeNs;
+        lastTimeNs = nowNs;
+
+        if (frameNs > kMaxFrameClampNs)
+            frameNs = kMaxFrameClampNs;
+
+        accNs += frameNs;
+
+        uint32_t catchUp = 0;
+        while (accNs >= tickDurationNs && catchUp < kMaxCatchUpTicks)
+        {
+            if (simulation)
+                rcnet_engine_simulationTick();
+            else
+                rcnet_engine_networkTick();
+
+            accNs -= tickDurationNs;
+            catchUp++;
+        }
+
+        if (simulation && catchUp > 0)
+            rcnet_histogram_record(engineProfiler.simTicksPerLoop, catchUp);
+        if (catchUp > 1)
+            (simulation ? engineProfiler.simCatchUpTicks : engineProfiler.netCatchUpTicks).fetch_add(catchUp - 1, std::memory_order_relaxed);
+
+        if (accNs >= tickDurationNs)
+        {
+            (simulation ? engineProfiler.simBacklogDrops : engineProfiler.netBacklogDrops).fetch_add(1, std::memory_order_relaxed);
+            (simulation ? engineProfiler.simBacklogDroppedNs : engineProfiler.netBacklogDroppedNs).fetch_add(accNs - tickDurationNs, std::memory_order_relaxed);
+
+            RCNET_log(RCNET_LOG_WARN,
+                      simulation ? "Backlog SIM trop grand: catch-up atteint (%u). Drop backlog."
+                                 : "Backlog NET trop grand: catch-up atteint (%u). Drop backlog.",
+                      kMaxCatchUpTicks);
+
+            accNs = tickDurationNs;
+        }
+
+        if (accNs < tickDurationNs)
+            rcnet_engine_sleepUntil(timer, rcnet_engine_getCurrentTimeNs() + (tickDurationNs - accNs));
+    }
+}
+
+static void rcnet_engine_networkThreadMain(void)
+{
+    rcnet_engine_runDedicatedLoop(false);
+}
+
+// Mode SPLIT : réseau sur un thread dédié, simulation sur le thread appelant
+static bool rcnet_engine_runSplit(void)
+{
+    // Avant de lancer le thread réseau : la simulation ne touche jamais au pool
+    splitSimulationThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+    std::thread networkThread;
+    try
+    {
+        networkThread = std::thread(rcnet_engine_networkThreadMain);
+    }
+    catch (const std::exception&)
+    {
+        RCNET_log(RCNET_LOG_CRITICAL, "Erreur lors de la creation du thread reseau.");
+        return false;
+    }
+
+    rcnet_engine_runDedicatedLoop(true);
+
+    // La simulation ne sort que sur rcnet_engine_eventQuit() : le thread réseau sort aussi
+    networkThread.join();
+    return true;
 }
 
 // ======================================================
@@ -302,11 +735,13 @@ bool rcnet_engine_run(RCNET_Callbacks* callbacksUser, int simTickRateArg, int ne
     // -----------------------
     // C) Init moteur
     // -----------------------
+    uint64_t startupNs = rcnet_engine_getCurrentTimeNs();
     if (!rcnet_engine_init())
     {
         rcnet_engine_quit();
         return false;
     }
+    uint64_t initDoneNs = rcnet_engine_getCurrentTimeNs();
 
     // -----------------------
     // D) Callback load
@@ -314,8 +749,31 @@ bool rcnet_engine_run(RCNET_Callbacks* callbacksUser, int simTickRateArg, int ne
     if (callbacksServerEngine.rcnet_load != NULL)
         callbacksServerEngine.rcnet_load();
 
+    uint64_t loadDoneNs = rcnet_engine_getCurrentTimeNs();
+    engineStartupInitNs.store(initDoneNs - startupNs, std::memory_order_relaxed);
+    engineStartupLoadNs.store(loadDoneNs - initDoneNs, std::memory_order_relaxed);
+    RCNET_log(RCNET_LOG_INFO, "Moteur pret en %.3f ms (init %.3f ms, rcnet_load %.3f ms).",
+              static_cast<double>(loadDoneNs - startupNs) / 1e6, static_cast<double>(initDoneNs - startupNs) / 1e6,
+              static_cast<double>(loadDoneNs - initDoneNs) / 1e6);
+
     // -----------------------
-    // E) Init boucle timing
+    // E) Mode SPLIT : boucles dédiées
+    // -----------------------
+    if (threadingMode == RCNET_ENGINE_THREADING_SPLIT)
+    {
+        RCNET_log(RCNET_LOG_INFO, "Moteur en mode SPLIT (simulation %d Hz + thread reseau %d Hz).", simTickRateHz, netTickRateHz);
+
+        bool splitOk = rcnet_engine_runSplit();
+
+        if (callbacksServerEngine.rcnet_unload != NULL)
+            callbacksServerEngine.rcnet_unload();
+
+        rcnet_engine_quit();
+        return splitOk;
+    }
+
+    // -----------------------
+    // E.B) Init boucle timing
     // -----------------------
 
     // lastTimeNs = dernier timestamp (réel)
@@ -327,11 +785,22 @@ bool rcnet_engine_run(RCNET_Callbacks* callbacksUser, int simTickRateArg, int ne
     // accumulateur réseau: quantité de "temps" à traiter réseau
     uint64_t accNetNs = 0;
 
+    RCNET_Timer* loopTimer = simLoopTimer.load(std::memory_order_acquire);
+
     // -----------------------
     // F) Boucle principale
     // -----------------------
     while (serverIsRunning.load(std::memory_order_relaxed))
     {
+        // 0) Idle : aucun tick jusqu'à une activité, puis reprise sans rattrapage
+        if (rcnet_engine_waitWhileIdle(loopTimer))
+        {
+            lastTimeNs = rcnet_engine_getCurrentTimeNs();
+            accSimNs = 0;
+            accNetNs = 0;
+            continue;
+        }
+
         // 1) Mesure temps réel
         uint64_t nowNs = rcnet_engine_getCurrentTimeNs();
 
@@ -358,9 +827,19 @@ bool rcnet_engine_run(RCNET_Callbacks* callbacksUser, int simTickRateArg, int ne
             catchUpSim++;
         }
 
+        if (catchUpSim > 0)
+        {
+            rcnet_histogram_record(engineProfiler.simTicksPerLoop, catchUpSim);
+            if (catchUpSim > 1)
+                engineProfiler.simCatchUpTicks.fetch_add(catchUpSim - 1, std::memory_order_relaxed);
+        }
+
         // Si backlog simulation encore trop grand => drop contrôlé
         if (accSimNs >= simTickDurationNs)
         {
+            engineProfiler.simBacklogDrops.fetch_add(1, std::memory_order_relaxed);
+            engineProfiler.simBacklogDroppedNs.fetch_add(accSimNs - simTickDurationNs, std::memory_order_relaxed);
+
             RCNET_log(RCNET_LOG_WARN,
                       "Backlog SIM trop grand: catch-up atteint (%u). Drop backlog.",
                       kMaxCatchUpTicks);
@@ -380,9 +859,15 @@ bool rcnet_engine_run(RCNET_Callbacks* callbacksUser, int simTickRateArg, int ne
             catchUpNet++;
         }
 
+        if (catchUpNet > 1)
+            engineProfiler.netCatchUpTicks.fetch_add(catchUpNet - 1, std::memory_order_relaxed);
+
         // Si backlog réseau encore trop grand => drop contrôlé
         if (accNetNs >= netTickDurationNs)
         {
+            engineProfiler.netBacklogDrops.fetch_add(1, std::memory_order_relaxed);
+            engineProfiler.netBacklogDroppedNs.fetch_add(accNetNs - netTickDurationNs, std::memory_order_relaxed);
+
             RCNET_log(RCNET_LOG_WARN,
                       "Backlog NET trop grand: catch-up atteint (%u). Drop backlog.",
                       kMaxCatchUpTicks);
@@ -423,7 +908,7 @@ bool rcnet_engine_run(RCNET_Callbacks* callbacksUser, int simTickRateArg, int ne
         if (sleepNs > 0)
         {
             uint64_t targetWakeNs = rcnet_engine_getCurrentTimeNs() + sleepNs;
-            rcnet_sleep_until_ns(targetWakeNs);
+            rcnet_engine_sleepUntil(loopTimer, targetWakeNs);
         }
     }
 
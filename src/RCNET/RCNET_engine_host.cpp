@@ -0,0 +1,736 @@
+#include "RCNET/RCNET_engine_host.h"
+#include "RCNET/RCNET_logger.h"
+#include "RCNET/RCNET_subsystem.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <thread>
+
+// Même politique de boucle que rcnet_engine_run (RCNET_engine.cpp)
+static constexpr uint32_t kMaxCatchUpTicks = 5;
+
+static constexpr uint32_t kDefaultMaxEngines = 1024;
+static constexpr size_t kDefaultArenaBytes = 256 * 1024;
+
+// Un match échu n'est volé qu'à un worker occupé, ou s'il attend depuis plus de cette marge
+// (le worker propriétaire est réveillé à l'échéance : inutile de migrer le match et son cache).
+static constexpr uint64_t kStealGraceNs = 200'000ull;
+
+// Un worker sans match échu se réveille au moins à ce rythme tant qu'un autre worker est occupé
+// (pour lui voler un match qui devient échu pendant un callback long).
+static constexpr uint64_t kStealPollNs = 1'000'000ull;
+
+// Attente max d'un worker sans aucun match (vérifie l'arrêt du host au moins à ce rythme)
+static constexpr uint64_t kIdleMaxWaitNs = 1'000'000'000ull;
+
+static constexpr size_t kEngineNameSize = 32;
+
+struct RCNET_EngineHostWorker
+{
+    // File de matchs : tas binaire sur deadlineNs (plus petite échéance en tête), capacité maxEngines
+    std::mutex mutex;
+    RCNET_Engine** heap = nullptr;
+    uint32_t heapSize = 0;
+
+    RCNET_Timer* timer = nullptr;
+    RCNET_Arena* arena = nullptr;
+    std::thread thread;
+
+    std::atomic<bool> running{false};       // exécute un match
+    std::atomic<uint64_t> sleepUntilNs{0};  // 0 = éveillé
+};
+
+struct RCNET_Engine
+{
+    RCNET_EngineHost* host = nullptr;
+    RCNET_EngineCallbacks callbacks{};
+    void* userdata = nullptr;
+    char name[kEngineNameSize] = {};
+
+    uint64_t simTickDurationNs = 0;
+    uint64_t netTickDurationNs = 0;
+    double simFixedDt = 0.0;
+
+    // Ordonnancement : écrit par le worker qui exécute le match, lu sous le mutex de la file qui le contient
+    uint64_t deadlineNs = 0;
+    uint64_t nextSimNs = 0;
+    uint64_t nextNetNs = 0;
+    bool loaded = false;
+
+    // Arena du worker courant pendant l'exécution (NULL sinon)
+    RCNET_Arena* currentArena = nullptr;
+
+    std::atomic<bool> stopRequested{false};
+
+    // Protégés par host->enginesMutex
+    bool stopped = false;
+    bool destroyPending = false;
+    RCNET_Engine* prev = nullptr;
+    RCNET_Engine* next = nullptr;
+
+    std::atomic<uint64_t> simTickId{0};
+    std::atomic<uint64_t> netTickId{0};
+    std::atomic<uint64_t> simCatchUpTicks{0};
+    std::atomic<uint64_t> netCatchUpTicks{0};
+    std::atomic<uint64_t> simBacklogDrops{0};
+    std::atomic<uint64_t> netBacklogDrops{0};
+    std::atomic<uint64_t> lateRuns{0};
+    std::atomic<uint64_t> maxLatenessNs{0};
+    std::atomic<uint64_t> migrations{0};
+
+    RCNET_Histogram* simUpdateNs = nullptr;
+    RCNET_Histogram* netUpdateNs = nullptr;
+};
+
+struct RCNET_EngineHost
+{
+    uint32_t workerCount = 0;
+    uint32_t maxEngines = 0;
+    RCNET_EngineHostWorker* workers = nullptr;
+    uint32_t startedThreads = 0;
+    uint32_t subsystems = 0;         // acquis (relâchés par rcnet_engine_host_destroy)
+
+    std::atomic<bool> stopping{false};
+
+    // Registre des matchs (liste intrusive) + attente de fin de rcnet_unload
+    mutable std::mutex enginesMutex;
+    std::condition_variable stoppedCondition;
+    RCNET_Engine* engines = nullptr;
+    uint32_t engineCount = 0;
+    uint64_t nextEngineId = 0;
+
+    std::atomic<uint64_t> runs{0};
+    std::atomic<uint64_t> steals{0};
+    std::atomic<uint64_t> sleeps{0};
+    RCNET_Histogram* latenessNs = nullptr;
+};
+
+// Worker courant (rcnet_engine_destroy ne doit pas attendre depuis un worker du host)
+static thread_local const RCNET_EngineHost* tlsCurrentHost = nullptr;
+
+// ======================================================
+// Files des workers (tas binaire, plus petite échéance en tête)
+// ======================================================
+static bool rcnet_engine_host_laterDeadline(const RCNET_Engine* a, const RCNET_Engine* b)
+{
+    return a->deadlineNs > b->deadlineNs;
+}
+
+// A appeler sous worker->mutex
+static void rcnet_engine_host_pushLocked(RCNET_EngineHostWorker* worker, RCNET_Engine* engine)
+{
+    worker->heap[worker->heapSize++] = engine;
+    std::push_heap(worker->heap, worker->heap + worker->heapSize, rcnet_engine_host_laterDeadline);
+}
+
+// A appeler sous worker->mutex, file non vide
+static RCNET_Engine* rcnet_engine_host_popLocked(RCNET_EngineHostWorker* worker)
+{
+    std::pop_heap(worker->heap, worker->heap + worker->heapSize, rcnet_engine_host_laterDeadline);
+    return worker->heap[--worker->heapSize];
+}
+
+static void rcnet_engine_host_push(RCNET_EngineHostWorker* worker, RCNET_Engine* engine)
+{
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    rcnet_engine_host_pushLocked(worker, engine);
+}
+
+// Match échu en tête de la file locale. outNextDeadlineNs = échéance de la nouvelle tête (UINT64_MAX si vide).
+static RCNET_Engine* rcnet_engine_host_popReady(RCNET_EngineHostWorker* worker, uint64_t nowNs, uint64_t* outNextDeadlineNs)
+{
+    std::lock_guard<std::mutex> lock(worker->mutex);
+
+    RCNET_Engine* engine = NULL;
+    if (worker->heapSize > 0 && worker->heap[0]->deadlineNs <= nowNs)
+        engine = rcnet_engine_host_popLocked(worker);
+
+    *outNextDeadlineNs = (worker->heapSize > 0) ? worker->heap[0]->deadlineNs : UINT64_MAX;
+    return engine;
+}
+
+// Vol : le match le plus en retard parmi les têtes des autres files, s'il est volable
+static RCNET_Engine* rcnet_engine_host_steal(RCNET_EngineHost* host, uint32_t thiefIndex, uint64_t nowNs)
+{
+    uint32_t victimIndex = UINT32_MAX;
+    uint64_t victimDeadlineNs = UINT64_MAX;
+
+    for (uint32_t i = 0; i < host->workerCount; ++i)
+    {
+        if (i == thiefIndex)
+            continue;
+
+        RCNET_EngineHostWorker* victim = &host->workers[i];
+        std::unique_lock<std::mutex> lock(victim->mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim->heapSize == 0)
+            continue;
+
+        uint64_t deadlineNs = victim->heap[0]->deadlineNs;
+        if (deadlineNs > nowNs)
+            continue;
+
+        bool victimBusy = victim->running.load(std::memory_order_relaxed);
+        if (!victimBusy && nowNs - deadlineNs < kStealGraceNs)
+            continue;
+
+        if (deadlineNs < victimDeadlineNs)
+        {
+            victimDeadlineNs = deadlineNs;
+            victimIndex = i;
+        }
+    }
+
+    if (victimIndex == UINT32_MAX)
+        return NULL;
+
+    // La tête a pu changer depuis le scan : on reprend la tête actuelle si elle est toujours échue
+    RCNET_EngineHostWorker* victim = &host->workers[victimIndex];
+    std::lock_guard<std::mutex> lock(victim->mutex);
+    if (victim->heapSize == 0 || victim->heap[0]->deadlineNs > nowNs)
+        return NULL;
+
+    RCNET_Engine* engine = rcnet_engine_host_popLocked(victim);
+    host->steals.fetch_add(1, std::memory_order_relaxed);
+    engine->migrations.fetch_add(1, std::memory_order_relaxed);
+    return engine;
+}
+
+// Une file a encore un match échu après un pop : réveille un worker endormi pour qu'il le vole
+static void rcnet_engine_host_wakeThief(RCNET_EngineHost* host, uint32_t ownerIndex, uint64_t nowNs)
+{
+    for (uint32_t i = 0; i < host->workerCount; ++i)
+    {
+        if (i == ownerIndex)
+            continue;
+
+        if (host->workers[i].sleepUntilNs.load(std::memory_order_relaxed) > nowNs)
+        {
+            rcnet_timer_wake(host->workers[i].timer);
+            return;
+        }
+    }
+}
+
+static bool rcnet_engine_host_otherWorkerBusy(const RCNET_EngineHost* host, uint32_t workerIndex)
+{
+    for (uint32_t i = 0; i < host->workerCount; ++i)
+    {
+        if (i != workerIndex && host->workers[i].running.load(std::memory_order_relaxed))
+            return true;
+    }
+    return false;
+}
+
+// ======================================================
+// Exécution d'un match
+// ======================================================
+static void rcnet_engine_host_freeEngine(RCNET_Engine* engine)
+{
+    rcnet_histogram_destroy(engine->simUpdateNs);
+    rcnet_histogram_destroy(engine->netUpdateNs);
+    delete engine;
+}
+
+// A appeler sous host->enginesMutex
+static void rcnet_engine_host_unlinkLocked(RCNET_EngineHost* host, RCNET_Engine* engine)
+{
+    if (engine->prev != NULL)
+        engine->prev->next = engine->next;
+    else
+        host->engines = engine->next;
+    if (engine->next != NULL)
+        engine->next->prev = engine->prev;
+
+    engine->prev = engine->next = NULL;
+    host->engineCount--;
+}
+
+// Dernière exécution du match : rcnet_unload puis signalement (ou libération si rcnet_engine_destroy l'attend)
+static void rcnet_engine_host_finishEngine(RCNET_EngineHost* host, RCNET_Engine* engine)
+{
+    if (engine->loaded && engine->callbacks.rcnet_unload != NULL)
+        engine->callbacks.rcnet_unload(engine, engine->userdata);
+    engine->loaded = false;
+
+    RCNET_log(RCNET_LOG_INFO, "Match %s arrete.", engine->name);
+
+    bool freeEngine = false;
+    {
+        std::lock_guard<std::mutex> lock(host->enginesMutex);
+        engine->stopped = true;
+        if (engine->destroyPending)
+        {
+            rcnet_engine_host_unlinkLocked(host, engine);
+            freeEngine = true;
+        }
+    }
+    host->stoppedCondition.notify_all();
+
+    if (freeEngine)
+        rcnet_engine_host_freeEngine(engine);
+}
+
+static void rcnet_engine_host_runEngine(RCNET_EngineHost* host, RCNET_EngineHostWorker* worker, RCNET_Engine* engine, uint64_t nowNs)
+{
+    uint64_t latenessNs = nowNs - engine->deadlineNs;
+    host->runs.fetch_add(1, std::memory_order_relaxed);
+    rcnet_histogram_record(host->latenessNs, latenessNs);
+    if (latenessNs > engine->maxLatenessNs.load(std::memory_order_relaxed))
+        engine->maxLatenessNs.store(latenessNs, std::memory_order_relaxed);
+    if (latenessNs > engine->simTickDurationNs)
+        engine->lateRuns.fetch_add(1, std::memory_order_relaxed);
+
+    if (engine->stopRequested.load(std::memory_order_acquire))
+    {
+        rcnet_engine_host_finishEngine(host, engine);
+        return;
+    }
+
+    engine->currentArena = worker->arena;
+
+    if (!engine->loaded)
+    {
+        // Premier passage : chargement, puis premiers ticks une durée de tick plus tard (comme rcnet_engine_run)
+        if (engine->callbacks.rcnet_load != NULL)
+            engine->callbacks.rcnet_load(engine, engine->userdata);
+        engine->loaded = true;
+
+        uint64_t loadedNs = rcnet_timer_get_time_ns();
+        engine->nextSimNs = loadedNs + engine->simTickDurationNs;
+        engine->nextNetNs = loadedNs + engine->netTickDurationNs;
+    }
+    else
+    {
+        // Ticks simulation : rattrapage limité, puis drop du backlog (un tick reste dû)
+        uint32_t catchUpSim = 0;
+        while (engine->nextSimNs <= nowNs && catchUpSim < kMaxCatchUpTicks && !engine->stopRequested.load(std::memory_order_relaxed))
+        {
+            engine->simTickId.fetch_add(1, std::memory_order_relaxed);
+            if (engine->callbacks.rcnet_simulation_update != NULL)
+            {
+                uint64_t startNs = rcnet_timer_get_time_ns();
+                engine->callbacks.rcnet_simulation_update(engine, engine->simFixedDt, engine->userdata);
+                rcnet_histogram_record(engine->simUpdateNs, rcnet_timer_get_time_ns() - startNs);
+            }
+            engine->nextSimNs += engine->simTickDurationNs;
+            catchUpSim++;
+        }
+        if (catchUpSim > 1)
+            engine->simCatchUpTicks.fetch_add(catchUpSim - 1, std::memory_order_relaxed);
+        if (catchUpSim == kMaxCatchUpTicks && engine->nextSimNs <= nowNs)
+        {
+            engine->simBacklogDrops.fetch_add(1, std::memory_order_relaxed);
+            engine->nextSimNs = nowNs;
+        }
+
+        // Ticks réseau : même politique, arena du worker reset avant chaque tick
+        uint32_t catchUpNet = 0;
+        while (engine->nextNetNs <= nowNs && catchUpNet < kMaxCatchUpTicks && !engine->stopRequested.load(std::memory_order_relaxed))
+        {
+            engine->netTickId.fetch_add(1, std::memory_order_relaxed);
+            uint64_t startNs = rcnet_timer_get_time_ns();
+            rcnet_arena_reset(worker->arena);
+            if (engine->callbacks.rcnet_network_update != NULL)
+                engine->callbacks.rcnet_network_update(engine, engine->userdata);
+            rcnet_histogram_record(engine->netUpdateNs, rcnet_timer_get_time_ns() - startNs);
+
+            engine->nextNetNs += engine->netTickDurationNs;
+            catchUpNet++;
+        }
+        if (catchUpNet > 1)
+            engine->netCatchUpTicks.fetch_add(catchUpNet - 1, std::memory_order_relaxed);
+        if (catchUpNet == kMaxCatchUpTicks && engine->nextNetNs <= nowNs)
+        {
+            engine->netBacklogDrops.fetch_add(1, std::memory_order_relaxed);
+            engine->nextNetNs = nowNs;
+        }
+    }
+
+    engine->currentArena = NULL;
+
+    // Arrêt demandé pendant les callbacks (ex: fin du match) : pas de réinsertion
+    if (engine->stopRequested.load(std::memory_order_acquire))
+    {
+        rcnet_engine_host_finishEngine(host, engine);
+        return;
+    }
+
+    // Réinsertion dans la file du worker qui l'a exécuté (cache chaud, le vol le déplacera si besoin)
+    engine->deadlineNs = std::min(engine->nextSimNs, engine->nextNetNs);
+    rcnet_engine_host_push(worker, engine);
+}
+
+// ======================================================
+// Boucle d'un worker
+// ======================================================
+static void rcnet_engine_host_threadMain(RCNET_EngineHost* host, uint32_t workerIndex)
+{
+    tlsCurrentHost = host;
+    RCNET_EngineHostWorker* worker = &host->workers[workerIndex];
+
+    while (!host->stopping.load(std::memory_order_acquire))
+    {
+        uint64_t nowNs = rcnet_timer_get_time_ns();
+
+        // 1) Match local échu le plus en retard, sinon 2) vol
+        uint64_t localDeadlineNs = UINT64_MAX;
+        RCNET_Engine* engine = rcnet_engine_host_popReady(worker, nowNs, &localDeadlineNs);
+        if (engine != NULL && localDeadlineNs <= nowNs)
+            rcnet_engine_host_wakeThief(host, workerIndex, nowNs);
+        if (engine == NULL)
+            engine = rcnet_engine_host_steal(host, workerIndex, nowNs);
+
+        if (engine != NULL)
+        {
+            worker->running.store(true, std::memory_order_relaxed);
+            rcnet_engine_host_runEngine(host, worker, engine, nowNs);
+            worker->running.store(false, std::memory_order_relaxed);
+            continue;
+        }
+
+        // 3) Rien d'échu : dormir jusqu'à la prochaine échéance locale (ou un vol possible)
+        uint64_t wakeNs = std::min(localDeadlineNs, nowNs + kIdleMaxWaitNs);
+        if (rcnet_engine_host_otherWorkerBusy(host, workerIndex))
+            wakeNs = std::min(wakeNs, nowNs + kStealPollNs);
+
+        worker->sleepUntilNs.store(wakeNs, std::memory_order_relaxed);
+        host->sleeps.fetch_add(1, std::memory_order_relaxed);
+        rcnet_timer_sleep_until(worker->timer, wakeNs, NULL);
+        worker->sleepUntilNs.store(0, std::memory_order_relaxed);
+    }
+}
+
+// ======================================================
+// API host
+// ======================================================
+void rcnet_engine_host_get_default_config(RCNET_EngineHostConfig* outConfig)
+{
+    if (outConfig == NULL)
+        return;
+
+    outConfig->threadCount = 0;
+    outConfig->maxEngines = kDefaultMaxEngines;
+    outConfig->subsystems = RCNET_SUBSYSTEM_FLAGS_ALL;
+    outConfig->timerBackend = RCNET_TIMER_BACKEND_AUTO;
+    outConfig->arenaBytesPerWorker = kDefaultArenaBytes;
+}
+
+RCNET_EngineHost* rcnet_engine_host_create(const RCNET_EngineHostConfig* config)
+{
+    RCNET_EngineHostConfig hostConfig;
+    rcnet_engine_host_get_default_config(&hostConfig);
+    if (config != NULL)
+        hostConfig = *config;
+
+    if (hostConfig.threadCount == 0)
+    {
+        uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        hostConfig.threadCount = (hardwareThreads > 0) ? hardwareThreads : 1;
+    }
+    if (hostConfig.maxEngines == 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_engine_host_create: maxEngines must be > 0\n");
+        return NULL;
+    }
+
+    RCNET_EngineHost* host = new (std::nothrow) RCNET_EngineHost();
+    if (host == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_engine_host_create: out of memory\n");
+        return NULL;
+    }
+
+    host->workerCount = hostConfig.threadCount;
+    host->maxEngines = hostConfig.maxEngines;
+    host->workers = new (std::nothrow) RCNET_EngineHostWorker[host->workerCount];
+    host->latenessNs = rcnet_histogram_create();
+    if (host->workers == NULL || host->latenessNs == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_engine_host_create: out of memory\n");
+        rcnet_engine_host_destroy(host);
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < host->workerCount; ++i)
+    {
+        RCNET_EngineHostWorker* worker = &host->workers[i];
+        worker->heap = new (std::nothrow) RCNET_Engine*[host->maxEngines];
+        worker->timer = rcnet_timer_create(hostConfig.timerBackend);
+        worker->arena = rcnet_arena_create(hostConfig.arenaBytesPerWorker);
+        if (worker->heap == NULL || worker->timer == NULL || worker->arena == NULL)
+        {
+            RCNET_log(RCNET_LOG_ERROR, "rcnet_engine_host_create: failed to create worker %u\n", i);
+            rcnet_engine_host_destroy(host);
+            return NULL;
+        }
+    }
+
+    // Dépendances : une fois pour tous les matchs du host (RCNET_subsystem)
+    if (!rcnet_subsystem_acquire_flags(hostConfig.subsystems))
+    {
+        rcnet_engine_host_destroy(host);
+        return NULL;
+    }
+    host->subsystems = hostConfig.subsystems;
+
+    for (uint32_t i = 0; i < host->workerCount; ++i)
+    {
+        try
+        {
+            host->workers[i].thread = std::thread(rcnet_engine_host_threadMain, host, i);
+        }
+        catch (const std::exception&)
+        {
+            RCNET_log(RCNET_LOG_ERROR, "rcnet_engine_host_create: failed to start worker thread %u\n", i);
+            rcnet_engine_host_destroy(host);
+            return NULL;
+        }
+        host->startedThreads++;
+    }
+
+    RCNET_log(RCNET_LOG_INFO, "Host de matchs initialise (%u workers, %u matchs max).", host->workerCount, host->maxEngines);
+    return host;
+}
+
+void rcnet_engine_host_destroy(RCNET_EngineHost* host)
+{
+    if (host == NULL)
+        return;
+
+    host->stopping.store(true, std::memory_order_release);
+    if (host->workers != NULL)
+    {
+        for (uint32_t i = 0; i < host->workerCount; ++i)
+            rcnet_timer_wake(host->workers[i].timer);
+        for (uint32_t i = 0; i < host->workerCount; ++i)
+        {
+            if (host->workers[i].thread.joinable())
+                host->workers[i].thread.join();
+        }
+    }
+
+    // Plus aucun worker : les matchs restants sont déchargés ici
+    RCNET_Engine* engine = host->engines;
+    while (engine != NULL)
+    {
+        RCNET_Engine* next = engine->next;
+        if (!engine->stopped && engine->loaded && engine->callbacks.rcnet_unload != NULL)
+            engine->callbacks.rcnet_unload(engine, engine->userdata);
+        rcnet_engine_host_freeEngine(engine);
+        engine = next;
+    }
+
+    if (host->workers != NULL)
+    {
+        for (uint32_t i = 0; i < host->workerCount; ++i)
+        {
+            delete[] host->workers[i].heap;
+            rcnet_timer_destroy(host->workers[i].timer);
+            rcnet_arena_destroy(host->workers[i].arena);
+        }
+        delete[] host->workers;
+    }
+
+    rcnet_subsystem_release_flags(host->subsystems);
+
+    rcnet_histogram_destroy(host->latenessNs);
+    delete host;
+}
+
+uint32_t rcnet_engine_host_get_worker_count(const RCNET_EngineHost* host)
+{
+    return (host != NULL) ? host->workerCount : 0;
+}
+
+bool rcnet_engine_host_get_stats(const RCNET_EngineHost* host, RCNET_EngineHostStats* outStats)
+{
+    if (host == NULL || outStats == NULL)
+        return false;
+
+    *outStats = RCNET_EngineHostStats{};
+    outStats->workerCount = host->workerCount;
+    {
+        std::lock_guard<std::mutex> lock(host->enginesMutex);
+        outStats->engineCount = host->engineCount;
+    }
+    outStats->runs = host->runs.load(std::memory_order_relaxed);
+    outStats->steals = host->steals.load(std::memory_order_relaxed);
+    outStats->sleeps = host->sleeps.load(std::memory_order_relaxed);
+    rcnet_histogram_get_summary(host->latenessNs, &outStats->latenessNs);
+    return true;
+}
+
+// ======================================================
+// API match
+// ======================================================
+void rcnet_engine_get_default_config(RCNET_EngineConfig* outConfig)
+{
+    if (outConfig == NULL)
+        return;
+
+    *outConfig = RCNET_EngineConfig{};
+    outConfig->simTickRateHz = 60;
+    outConfig->netTickRateHz = 20;
+}
+
+RCNET_Engine* rcnet_engine_create(RCNET_EngineHost* host, const RCNET_EngineConfig* config)
+{
+    if (host == NULL || config == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_engine_create: host and config are required\n");
+        return NULL;
+    }
+
+    RCNET_Engine* engine = new (std::nothrow) RCNET_Engine();
+    if (engine == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_engine_create: out of memory\n");
+        return NULL;
+    }
+
+    engine->simUpdateNs = rcnet_histogram_create();
+    engine->netUpdateNs = rcnet_histogram_create();
+    if (engine->simUpdateNs == NULL || engine->netUpdateNs == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_engine_create: out of memory\n");
+        rcnet_engine_host_freeEngine(engine);
+        return NULL;
+    }
+
+    int simTickRateHz = (config->simTickRateHz > 0) ? config->simTickRateHz : 60;
+    int netTickRateHz = (config->netTickRateHz > 0) ? config->netTickRateHz : 20;
+
+    engine->host = host;
+    engine->callbacks = config->callbacks;
+    engine->userdata = config->userdata;
+    engine->simTickDurationNs = 1'000'000'000ull / static_cast<uint64_t>(simTickRateHz);
+    engine->netTickDurationNs = 1'000'000'000ull / static_cast<uint64_t>(netTickRateHz);
+    engine->simFixedDt = 1.0 / static_cast<double>(simTickRateHz);
+
+    // Enregistrement (la capacité des files garantit qu'un push ne déborde jamais)
+    {
+        std::lock_guard<std::mutex> lock(host->enginesMutex);
+        if (host->engineCount >= host->maxEngines)
+        {
+            RCNET_log(RCNET_LOG_ERROR, "rcnet_engine_create: host is full (%u engines)\n", host->maxEngines);
+            rcnet_engine_host_freeEngine(engine);
+            return NULL;
+        }
+
+        if (config->name != NULL)
+            snprintf(engine->name, sizeof(engine->name), "%s", config->name);
+        else
+            snprintf(engine->name, sizeof(engine->name), "#%llu", static_cast<unsigned long long>(host->nextEngineId));
+        host->nextEngineId++;
+
+        engine->next = host->engines;
+        if (host->engines != NULL)
+            host->engines->prev = engine;
+        host->engines = engine;
+        host->engineCount++;
+    }
+
+    // Worker le moins chargé, réveillé pour appeler rcnet_load tout de suite
+    uint32_t targetIndex = 0;
+    uint32_t targetSize = UINT32_MAX;
+    for (uint32_t i = 0; i < host->workerCount; ++i)
+    {
+        std::lock_guard<std::mutex> lock(host->workers[i].mutex);
+        uint32_t size = host->workers[i].heapSize + (host->workers[i].running.load(std::memory_order_relaxed) ? 1u : 0u);
+        if (size < targetSize)
+        {
+            targetSize = size;
+            targetIndex = i;
+        }
+    }
+
+    engine->deadlineNs = rcnet_timer_get_time_ns();
+    rcnet_engine_host_push(&host->workers[targetIndex], engine);
+    rcnet_timer_wake(host->workers[targetIndex].timer);
+
+    RCNET_log(RCNET_LOG_INFO, "Match %s cree (simulation %d Hz, reseau %d Hz, worker %u).", engine->name, simTickRateHz,
+              netTickRateHz, targetIndex);
+    return engine;
+}
+
+void rcnet_engine_stop(RCNET_Engine* engine)
+{
+    if (engine == NULL)
+        return;
+
+    engine->stopRequested.store(true, std::memory_order_release);
+}
+
+bool rcnet_engine_is_stopped(const RCNET_Engine* engine)
+{
+    if (engine == NULL)
+        return true;
+
+    std::lock_guard<std::mutex> lock(engine->host->enginesMutex);
+    return engine->stopped;
+}
+
+bool rcnet_engine_destroy(RCNET_Engine* engine)
+{
+    if (engine == NULL)
+        return true;
+
+    RCNET_EngineHost* host = engine->host;
+    rcnet_engine_stop(engine);
+
+    std::unique_lock<std::mutex> lock(host->enginesMutex);
+
+    // Depuis un worker : pas d'attente (le match peut être celui qui appelle, ou dans la file de ce worker)
+    if (tlsCurrentHost == host && !engine->stopped)
+    {
+        engine->destroyPending = true;
+        return false;
+    }
+
+    host->stoppedCondition.wait(lock, [&] { return engine->stopped; });
+    rcnet_engine_host_unlinkLocked(host, engine);
+    lock.unlock();
+
+    rcnet_engine_host_freeEngine(engine);
+    return true;
+}
+
+void* rcnet_engine_get_userdata(const RCNET_Engine* engine)
+{
+    return (engine != NULL) ? engine->userdata : NULL;
+}
+
+RCNET_Arena* rcnet_engine_get_scratch_arena(RCNET_Engine* engine)
+{
+    return (engine != NULL) ? engine->currentArena : NULL;
+}
+
+bool rcnet_engine_get_instance_stats(const RCNET_Engine* engine, RCNET_EngineInstanceStats* outStats)
+{
+    if (engine == NULL || outStats == NULL)
+        return false;
+
+    *outStats = RCNET_EngineInstanceStats{};
+    outStats->simTickId       = engine->simTickId.load(std::memory_order_relaxed);
+    outStats->netTickId       = engine->netTickId.load(std::memory_order_relaxed);
+    outStats->simCatchUpTicks = engine->simCatchUpTicks.load(std::memory_order_relaxed);
+    outStats->netCatchUpTicks = engine->netCatchUpTicks.load(std::memory_order_relaxed);
+    outStats->simBacklogDrops = engine->simBacklogDrops.load(std::memory_order_relaxed);
+    outStats->netBacklogDrops = engine->netBacklogDrops.load(std::memory_order_relaxed);
+    outStats->lateRuns        = engine->lateRuns.load(std::memory_order_relaxed);
+    outStats->maxLatenessNs   = engine->maxLatenessNs.load(std::memory_order_relaxed);
+    outStats->migrations      = engine->migrations.load(std::memory_order_relaxed);
+
+    rcnet_histogram_get_summary(engine->simUpdateNs, &outStats->simUpdateNs);
+    rcnet_histogram_get_summary(engine->netUpdateNs, &outStats->netUpdateNs);
+    return true;
+}
@@ -0,0 +1,398 @@
+#include "RCNET/RCNET_entity_store.h"
+#include "RCNET/RCNET_logger.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <cstring>
+#include <new>
+
+// Colonnes alignées et espacées sur une ligne de cache (16 valeurs 32 bits)
+static constexpr size_t kColumnAlignment = 64;
+static constexpr uint32_t kColumnStrideValues = 16;
+
+struct RCNET_EntityStore
+{
+    RCNET_EntityStoreConfig config;
+    uint32_t words = 0;
+    uint32_t columnStride = 0;         // maxEntities arrondi à kColumnStrideValues
+
+    uint8_t* columnStorage = nullptr;  // allocation brute (colonnes alignées à l'intérieur)
+    uint32_t* columns = nullptr;       // column * columnStride + index (float ou uint32 selon le type)
+
+    uint64_t* dirtyMasks = nullptr;    // column * words
+    uint64_t* spawnMask = nullptr;
+    uint64_t* aliveMask = nullptr;
+
+    uint32_t* generations = nullptr;   // génération courante de chaque slot (>= 1)
+    uint32_t* dense = nullptr;         // index des entités vivantes
+    uint32_t* denseSlot = nullptr;     // position de chaque entité vivante dans dense
+    uint32_t aliveCount = 0;
+    uint32_t* freeList = nullptr;      // pile des slots libres (plus petit index au sommet à la création)
+    uint32_t* freeSlot = nullptr;      // position de chaque slot libre dans freeList
+    uint32_t freeCount = 0;
+    uint32_t indexEnd = 0;
+
+    uint64_t created = 0;
+    uint64_t destroyed = 0;
+    uint64_t createFailures = 0;
+    uint64_t staleHandles = 0;
+};
+
+static inline RCNET_EntityHandle rcnet_entity_store_makeHandle(uint32_t generation, uint32_t index)
+{
+    return (static_cast<uint64_t>(generation) << 32) | index;
+}
+
+static inline bool rcnet_entity_store_isAlive(const RCNET_EntityStore* store, uint32_t index)
+{
+    return (store->aliveMask[index >> 6] >> (index & 63)) & 1u;
+}
+
+static inline void rcnet_entity_store_setBit(uint64_t* mask, uint32_t index)
+{
+    mask[index >> 6] |= (1ull << (index & 63));
+}
+
+static inline uint32_t* rcnet_entity_store_column(const RCNET_EntityStore* store, uint32_t column)
+{
+    return store->columns + static_cast<size_t>(column) * store->columnStride;
+}
+
+// Index d'un handle vivant, RCNET_ENTITY_NO_INDEX sinon
+static uint32_t rcnet_entity_store_resolve(const RCNET_EntityStore* store, RCNET_EntityHandle handle)
+{
+    uint32_t index = static_cast<uint32_t>(handle & 0xFFFFFFFFu);
+    uint32_t generation = static_cast<uint32_t>(handle >> 32);
+
+    if (handle == RCNET_ENTITY_HANDLE_INVALID || index >= store->config.maxEntities
+        || store->generations[index] != generation || !rcnet_entity_store_isAlive(store, index))
+        return RCNET_ENTITY_NO_INDEX;
+
+    return index;
+}
+
+static RCNET_EntityHandle rcnet_entity_store_spawn(RCNET_EntityStore* store, uint32_t index)
+{
+    // Retrait de la pile des slots libres : le sommet prend la place
+    uint32_t freePosition = store->freeSlot[index];
+    uint32_t top = store->freeList[--store->freeCount];
+    store->freeList[freePosition] = top;
+    store->freeSlot[top] = freePosition;
+
+    rcnet_entity_store_setBit(store->aliveMask, index);
+    rcnet_entity_store_setBit(store->spawnMask, index);
+
+    store->denseSlot[index] = store->aliveCount;
+    store->dense[store->aliveCount++] = index;
+    if (index + 1 > store->indexEnd)
+        store->indexEnd = index + 1;
+
+    store->created++;
+    return rcnet_entity_store_makeHandle(store->generations[index], index);
+}
+
+void rcnet_entity_store_get_default_config(RCNET_EntityStoreConfig* outConfig)
+{
+    if (outConfig == NULL)
+        return;
+
+    std::memset(outConfig, 0, sizeof(*outConfig));
+}
+
+RCNET_EntityStore* rcnet_entity_store_create(const RCNET_EntityStoreConfig* config)
+{
+    if (config == NULL || config->maxEntities == 0 || config->maxEntities == RCNET_ENTITY_NO_INDEX
+        || config->columnCount == 0 || config->columnCount > RCNET_ENTITY_STORE_MAX_COLUMNS)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_entity_store_create: invalid configuration\n");
+        return NULL;
+    }
+
+    RCNET_EntityStore* store = new (std::nothrow) RCNET_EntityStore();
+    if (store == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_entity_store_create: out of memory\n");
+        return NULL;
+    }
+
+    store->config = *config;
+    store->words = (config->maxEntities + 63) / 64;
+    store->columnStride = (config->maxEntities + kColumnStrideValues - 1) / kColumnStrideValues * kColumnStrideValues;
+
+    size_t columnBytes = static_cast<size_t>(store->columnStride) * config->columnCount * sizeof(uint32_t);
+    store->columnStorage = new (std::nothrow) uint8_t[columnBytes + kColumnAlignment]();
+    store->dirtyMasks = new (std::nothrow) uint64_t[static_cast<size_t>(store->words) * config->columnCount]();
+    store->spawnMask = new (std::nothrow) uint64_t[store->words]();
+    store->aliveMask = new (std::nothrow) uint64_t[store->words]();
+    store->generations = new (std::nothrow) uint32_t[config->maxEntities];
+    store->dense = new (std::nothrow) uint32_t[config->maxEntities];
+    store->denseSlot = new (std::nothrow) uint32_t[config->maxEntities];
+    store->freeList = new (std::nothrow) uint32_t[config->maxEntities];
+    store->freeSlot = new (std::nothrow) uint32_t[config->maxEntities];
+
+    if (store->columnStorage == NULL || store->dirtyMasks == NULL || store->spawnMask == NULL || store->aliveMask == NULL
+        || store->generations == NULL || store->dense == NULL || store->denseSlot == NULL || store->freeList == NULL
+        || store->freeSlot == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_entity_store_create: out of memory (%u entities x %u columns)\n",
+                  config->maxEntities, config->columnCount);
+        rcnet_entity_store_destroy(store);
+        return NULL;
+    }
+
+    uintptr_t base = reinterpret_cast<uintptr_t>(store->columnStorage);
+    store->columns = reinterpret_cast<uint32_t*>((base + kColumnAlignment - 1) & ~static_cast<uintptr_t>(kColumnAlignment - 1));
+
+    for (uint32_t i = 0; i < config->maxEntities; ++i)
+    {
+        store->generations[i] = 1;
+        store->freeList[i] = config->maxEntities - 1 - i;
+        store->freeSlot[config->maxEntities - 1 - i] = i;
+    }
+    store->freeCount = config->maxEntities;
+
+    return store;
+}
+
+void rcnet_entity_store_destroy(RCNET_EntityStore* store)
+{
+    if (store == NULL)
+        return;
+
+    delete[] store->columnStorage;
+    delete[] store->dirtyMasks;
+    delete[] store->spawnMask;
+    delete[] store->aliveMask;
+    delete[] store->generations;
+    delete[] store->dense;
+    delete[] store->denseSlot;
+    delete[] store->freeList;
+    delete[] store->freeSlot;
+    delete store;
+}
+
+RCNET_EntityHandle rcnet_entity_store_create_entity(RCNET_EntityStore* store)
+{
+    if (store->freeCount == 0)
+    {
+        store->createFailures++;
+        return RCNET_ENTITY_HANDLE_INVALID;
+    }
+
+    return rcnet_entity_store_spawn(store, store->freeList[store->freeCount - 1]);
+}
+
+RCNET_EntityHandle rcnet_entity_store_create_entity_at(RCNET_EntityStore* store, uint32_t index)
+{
+    if (index >= store->config.maxEntities || rcnet_entity_store_isAlive(store, index))
+    {
+        store->createFailures++;
+        return RCNET_ENTITY_HANDLE_INVALID;
+    }
+
+    return rcnet_entity_store_spawn(store, index);
+}
+
+bool rcnet_entity_store_destroy_entity(RCNET_EntityStore* store, RCNET_EntityHandle handle)
+{
+    uint32_t index = rcnet_entity_store_resolve(store, handle);
+    if (index == RCNET_ENTITY_NO_INDEX)
+    {
+        if (handle != RCNET_ENTITY_HANDLE_INVALID)
+            store->staleHandles++;
+        return false;
+    }
+
+    // Colonnes à 0 (vitesse nulle : un slot libre ne bouge jamais dans integrate)
+    for (uint32_t column = 0; column < store->config.columnCount; ++column)
+        rcnet_entity_store_column(store, column)[index] = 0;
+
+    store->aliveMask[index >> 6] &= ~(1ull << (index & 63));
+    rcnet_entity_store_setBit(store->spawnMask, index);
+
+    // Retrait de la liste dense : le dernier prend la place
+    uint32_t slot = store->denseSlot[index];
+    uint32_t last = store->dense[--store->aliveCount];
+    store->dense[slot] = last;
+    store->denseSlot[last] = slot;
+
+    // Génération suivante (0 est réservé à RCNET_ENTITY_HANDLE_INVALID)
+    if (++store->generations[index] == 0)
+        store->generations[index] = 1;
+
+    store->freeSlot[index] = store->freeCount;
+    store->freeList[store->freeCount++] = index;
+
+    store->destroyed++;
+    return true;
+}
+
+uint32_t rcnet_entity_store_get_index(RCNET_EntityStore* store, RCNET_EntityHandle handle)
+{
+    uint32_t index = rcnet_entity_store_resolve(store, handle);
+    if (index == RCNET_ENTITY_NO_INDEX && handle != RCNET_ENTITY_HANDLE_INVALID)
+        store->staleHandles++;
+    return index;
+}
+
+RCNET_EntityHandle rcnet_entity_store_get_handle(const RCNET_EntityStore* store, uint32_t index)
+{
+    if (index >= store->config.maxEntities || !rcnet_entity_store_isAlive(store, index))
+        return RCNET_ENTITY_HANDLE_INVALID;
+
+    return rcnet_entity_store_makeHandle(store->generations[index], index);
+}
+
+const uint32_t* rcnet_entity_store_get_dense(const RCNET_EntityStore* store, uint32_t* outCount)
+{
+    *outCount = store->aliveCount;
+    return store->dense;
+}
+
+uint32_t rcnet_entity_store_get_index_end(const RCNET_EntityStore* store)
+{
+    return store->indexEnd;
+}
+
+float* rcnet_entity_store_get_float_column(RCNET_EntityStore* store, uint32_t column)
+{
+    if (column >= store->config.columnCount || store->config.columnTypes[column] != RCNET_ENTITY_COLUMN_FLOAT)
+        return NULL;
+
+    return reinterpret_cast<float*>(rcnet_entity_store_column(store, column));
+}
+
+uint32_t* rcnet_entity_store_get_uint32_column(RCNET_EntityStore* store, uint32_t column)
+{
+    if (column >= store->config.columnCount || store->config.columnTypes[column] != RCNET_ENTITY_COLUMN_UINT32)
+        return NULL;
+
+    return rcnet_entity_store_column(store, column);
+}
+
+void rcnet_entity_store_set_float(RCNET_EntityStore* store, uint32_t index, uint32_t column, float value)
+{
+    float* values = rcnet_entity_store_get_float_column(store, column);
+    if (values == NULL || index >= store->config.maxEntities || values[index] == value)
+        return;
+
+    values[index] = value;
+    rcnet_entity_store_setBit(store->dirtyMasks + static_cast<size_t>(column) * store->words, index);
+}
+
+void rcnet_entity_store_set_uint32(RCNET_EntityStore* store, uint32_t index, uint32_t column, uint32_t value)
+{
+    uint32_t* values = rcnet_entity_store_get_uint32_column(store, column);
+    if (values == NULL || index >= store->config.maxEntities || values[index] == value)
+        return;
+
+    values[index] = value;
+    rcnet_entity_store_setBit(store->dirtyMasks + static_cast<size_t>(column) * store->words, index);
+}
+
+void rcnet_entity_store_mark_dirty(RCNET_EntityStore* store, uint32_t index, uint32_t column)
+{
+    if (column >= store->config.columnCount || index >= store->config.maxEntities)
+        return;
+
+    rcnet_entity_store_setBit(store->dirtyMasks + static_cast<size_t>(column) * store->words, index);
+}
+
+const uint64_t* rcnet_entity_store_get_dirty_mask(const RCNET_EntityStore* store, uint32_t column)
+{
+    if (column >= store->config.columnCount)
+        return NULL;
+
+    return store->dirtyMasks + static_cast<size_t>(column) * store->words;
+}
+
+const uint64_t* rcnet_entity_store_get_spawn_mask(const RCNET_EntityStore* store)
+{
+    return store->spawnMask;
+}
+
+const uint64_t* rcnet_entity_store_get_alive_mask(const RCNET_EntityStore* store)
+{
+    return store->aliveMask;
+}
+
+uint32_t rcnet_entity_store_get_mask_words(const RCNET_EntityStore* store)
+{
+    return store->words;
+}
+
+void rcnet_entity_store_clear_dirty(RCNET_EntityStore* store)
+{
+    std::memset(store->dirtyMasks, 0, sizeof(uint64_t) * store->words * store->config.columnCount);
+    std::memset(store->spawnMask, 0, sizeof(uint64_t) * store->words);
+}
+
+uint32_t rcnet_entity_store_integrate(RCNET_EntityStore* store, uint32_t positionColumn, uint32_t velocityColumn, float dt,
+                                      float minValue, float maxValue)
+{
+    float* position = rcnet_entity_store_get_float_column(store, positionColumn);
+    const float* velocity = rcnet_entity_store_get_float_column(store, velocityColumn);
+    if (position == NULL || velocity == NULL)
+        return 0;
+
+    uint64_t* dirty = store->dirtyMasks + static_cast<size_t>(positionColumn) * store->words;
+    uint32_t changedCount = 0;
+
+    // Blocs de 64 entités = un mot de bitset. Le calcul est une boucle sans branche sur des tableaux
+    // contigus (min / max en ternaires : vectorisé même sans -ffast-math), la comparaison avec
+    // l'ancienne valeur produit le mot "modifié".
+    for (uint32_t blockStart = 0; blockStart < store->indexEnd; blockStart += 64)
+    {
+        uint32_t blockCount = store->indexEnd - blockStart < 64 ? store->indexEnd - blockStart : 64;
+        float* blockPosition = position + blockStart;
+        const float* blockVelocity = velocity + blockStart;
+
+        float previous[64];
+        std::memcpy(previous, blockPosition, sizeof(float) * blockCount);
+
+        for (uint32_t i = 0; i < blockCount; ++i)
+        {
+            float value = blockPosition[i] + blockVelocity[i] * dt;
+            value = value < minValue ? minValue : value;
+            value = value > maxValue ? maxValue : value;
+            blockPosition[i] = value;
+        }
+
+        uint64_t changed = 0;
+        for (uint32_t i = 0; i < blockCount; ++i)
+            changed |= static_cast<uint64_t>(blockPosition[i] != previous[i]) << i;
+
+        // Slots libres (colonnes à 0) : ramenés dans [minValue, maxValue] si 0 n'y est pas. On les remet
+        // à leur valeur (un spawn repart de 0) et ils ne comptent ni dans dirty ni dans le retour.
+        const uint64_t alive = store->aliveMask[blockStart >> 6];
+        const uint64_t deadChanged = changed & ~alive;
+        if (deadChanged != 0)
+        {
+            for (uint32_t i = 0; i < blockCount; ++i)
+            {
+                if ((deadChanged >> i) & 1u)
+                    blockPosition[i] = previous[i];
+            }
+        }
+        changed &= alive;
+
+        dirty[blockStart >> 6] |= changed;
+        while (changed != 0)
+        {
+            changed &= changed - 1;
+            ++changedCount;
+        }
+    }
+
+    return changedCount;
+}
+
+void rcnet_entity_store_get_stats(const RCNET_EntityStore* store, RCNET_EntityStoreStats* outStats)
+{
+    outStats->aliveCount = store->aliveCount;
+    outStats->created = store->created;
+    outStats->destroyed = store->destroyed;
+    outStats->createFailures = store->createFailures;
+    outStats->staleHandles = store->staleHandles;
+}
@@ -0,0 +1,209 @@
+#include "RCNET/RCNET_histogram.h"
+#include "RCNET/RCNET_logger.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+/**
+ * Layout des buckets :
+ * - [0, 32)            : valeurs exactes 0..31
+ * - ensuite 32 buckets par exposant e (5..63) : v >> (e - 5) dans [32, 64) donne le sous-bucket
+ */
+static constexpr uint32_t kSubBucketBits = 5;
+static constexpr uint32_t kSubBucketCount = 1u << kSubBucketBits;
+static constexpr uint32_t kBucketCount = kSubBucketCount + (64 - kSubBucketBits) * kSubBucketCount;
+
+struct RCNET_Histogram
+{
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> min{UINT64_MAX};
+    std::atomic<uint64_t> max{0};
+    std::atomic<uint64_t> buckets[kBucketCount];
+};
+
+static inline uint32_t rcnet_histogram_highestBit(uint64_t value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return 63u - static_cast<uint32_t>(__builtin_clzll(value));
+#endif
+}
+
+static inline uint32_t rcnet_histogram_bucketIndex(uint64_t value)
+{
+    if (value < kSubBucketCount)
+        return static_cast<uint32_t>(value);
+
+    const uint32_t exponent = rcnet_histogram_highestBit(value);
+    const uint32_t shift = exponent - kSubBucketBits;
+    const uint32_t subBucket = static_cast<uint32_t>(value >> shift) - kSubBucketCount;
+    return kSubBucketCount + shift * kSubBucketCount + subBucket;
+}
+
+// Plus grande valeur qui tombe dans le bucket
+static inline uint64_t rcnet_histogram_bucketUpperBound(uint32_t index)
+{
+    if (index < kSubBucketCount)
+        return index;
+
+    const uint32_t shift = (index - kSubBucketCount) / kSubBucketCount;
+    const uint64_t subBucket = (index - kSubBucketCount) % kSubBucketCount;
+    const uint64_t lower = (kSubBucketCount + subBucket) << shift;
+    return lower + ((uint64_t(1) << shift) - 1);
+}
+
+RCNET_Histogram* rcnet_histogram_create(void)
+{
+    RCNET_Histogram* histogram = new (std::nothrow) RCNET_Histogram();
+    if (histogram == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_histogram_create: allocation echouee\n");
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < kBucketCount; ++i)
+        histogram->buckets[i].store(0, std::memory_order_relaxed);
+
+    return histogram;
+}
+
+void rcnet_histogram_destroy(RCNET_Histogram* histogram)
+{
+    delete histogram;
+}
+
+void rcnet_histogram_record(RCNET_Histogram* histogram, uint64_t value)
+{
+    if (histogram == NULL)
+        return;
+
+    histogram->buckets[rcnet_histogram_bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    histogram->sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t currentMin = histogram->min.load(std::memory_order_relaxed);
+    while (value < currentMin && !histogram->min.compare_exchange_weak(currentMin, value, std::memory_order_relaxed))
+    {
+    }
+
+    uint64_t currentMax = histogram->max.load(std::memory_order_relaxed);
+    while (value > currentMax && !histogram->max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed))
+    {
+    }
+
+    // En dernier : un lecteur qui voit count a au moins autant d'échantillons dans les buckets
+    histogram->count.fetch_add(1, std::memory_order_release);
+}
+
+void rcnet_histogram_reset(RCNET_Histogram* histogram)
+{
+    if (histogram == NULL)
+        return;
+
+    histogram->count.store(0, std::memory_order_relaxed);
+    histogram->sum.store(0, std::memory_order_relaxed);
+    histogram->min.store(UINT64_MAX, std::memory_order_relaxed);
+    histogram->max.store(0, std::memory_order_relaxed);
+
+    for (uint32_t i = 0; i < kBucketCount; ++i)
+        histogram->buckets[i].store(0, std::memory_order_relaxed);
+}
+
+uint64_t rcnet_histogram_get_count(const RCNET_Histogram* histogram)
+{
+    return (histogram != NULL) ? histogram->count.load(std::memory_order_acquire) : 0;
+}
+
+/**
+ * Parcourt les buckets une seule fois et remplit les percentiles demandés (triés par ordre croissant).
+ * Les rangs sont calculés sur le nombre d'échantillons effectivement lus dans les buckets,
+ * pour rester cohérent si un autre thread enregistre pendant la lecture.
+ */
+static void rcnet_histogram_computePercentiles(const RCNET_Histogram* histogram, const double* percentiles, uint64_t* outValues, uint32_t percentileCount)
+{
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < kBucketCount; ++i)
+        total += histogram->buckets[i].load(std::memory_order_relaxed);
+
+    const uint64_t maxValue = histogram->max.load(std::memory_order_relaxed);
+
+    for (uint32_t p = 0; p < percentileCount; ++p)
+        outValues[p] = 0;
+
+    if (total == 0)
+        return;
+
+    uint32_t current = 0;
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < kBucketCount && current < percentileCount; ++i)
+    {
+        seen += histogram->buckets[i].load(std::memory_order_relaxed);
+
+        while (current < percentileCount)
+        {
+            double clamped = percentiles[current] < 0.0 ? 0.0 : (percentiles[current] > 100.0 ? 100.0 : percentiles[current]);
+            uint64_t rank = static_cast<uint64_t>(clamped / 100.0 * static_cast<double>(total) + 0.5);
+            if (rank == 0)
+                rank = 1;
+
+            if (seen < rank)
+                break;
+
+            const uint64_t upper = rcnet_histogram_bucketUpperBound(i);
+            outValues[current++] = (upper < maxValue) ? upper : maxValue;
+        }
+    }
+
+    // Buckets modifiés pendant la lecture : les percentiles restants prennent le max
+    while (current < percentileCount)
+        outValues[current++] = maxValue;
+}
+
+uint64_t rcnet_histogram_get_percentile(const RCNET_Histogram* histogram, double percentile)
+{
+    if (histogram == NULL)
+        return 0;
+
+    uint64_t value = 0;
+    rcnet_histogram_computePercentiles(histogram, &percentile, &value, 1);
+    return value;
+}
+
+void rcnet_histogram_get_summary(const RCNET_Histogram* histogram, RCNET_HistogramSummary* outSummary)
+{
+    if (outSummary == NULL)
+        return;
+
+    *outSummary = RCNET_HistogramSummary{};
+    if (histogram == NULL)
+        return;
+
+    const uint64_t count = histogram->count.load(std::memory_order_acquire);
+    if (count == 0)
+        return;
+
+    outSummary->count = count;
+    outSummary->min   = histogram->min.load(std::memory_order_relaxed);
+    outSummary->max   = histogram->max.load(std::memory_order_relaxed);
+    outSummary->mean  = histogram->sum.load(std::memory_order_relaxed) / count;
+
+    static const double kPercentiles[4] = { 50.0, 90.0, 99.0, 99.9 };
+    uint64_t values[4];
+    rcnet_histogram_computePercentiles(histogram, kPercentiles, values, 4);
+
+    outSummary->p50  = values[0];
+    outSummary->p90  = values[1];
+    outSummary->p99  = values[2];
+    outSummary->p999 = values[3];
+}
@@ -0,0 +1,194 @@
+#include "RCNET/RCNET_input_buffer.h"
+#include "RCNET/RCNET_logger.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <new>
+
+// Position "vide" dans l'index dense clientId -> position
+static constexpr uint32_t kNoInputIndex = UINT32_MAX;
+
+// Un slot = "tous les inputs à appliquer pour ce tick"
+struct RCNET_InputBufferSlot
+{
+    uint64_t tick;            // tick que ce slot représente réellement
+    uint32_t count;           // nombre d'inputs (packés au début de inputs)
+    RCNET_ClientInput* inputs; // maxClients inputs contigus (vue sur RCNET_InputBuffer::inputStorage)
+    uint32_t* indexByClient;   // maxClients index (vue sur RCNET_InputBuffer::indexStorage)
+};
+
+struct RCNET_InputBuffer
+{
+    uint32_t windowTicks;
+    uint64_t windowMask;
+    uint32_t maxClients;
+
+    // Dernier tick consommé (tout tick <= lastTakenTick est "late")
+    uint64_t lastTakenTick;
+
+    RCNET_InputBufferSlot* slots;
+    RCNET_ClientInput* inputStorage; // windowTicks * maxClients
+    uint32_t* indexStorage;          // windowTicks * maxClients
+
+    RCNET_InputBufferStats stats;
+};
+
+// Vrai si seqA est plus récent que seqB (tolère le wrap-around 32 bits)
+static inline bool rcnet_input_buffer_isSeqNewer(uint32_t seqA, uint32_t seqB)
+{
+    return static_cast<int32_t>(seqA - seqB) > 0;
+}
+
+// Vide un slot en O(count) : on ne remet à "vide" que les entrées utilisées de l'index
+static inline void rcnet_input_buffer_clearSlot(RCNET_InputBufferSlot& slot)
+{
+    for (uint32_t i = 0; i < slot.count; ++i)
+        slot.indexByClient[slot.inputs[i].clientId] = kNoInputIndex;
+    slot.count = 0;
+}
+
+RCNET_InputBuffer* rcnet_input_buffer_create(uint32_t windowTicks, uint32_t maxClients)
+{
+    if (windowTicks == 0 || windowTicks > (1u << 20) || maxClients == 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_input_buffer_create: invalid windowTicks=%u or maxClients=%u\n", windowTicks, maxClients);
+        return NULL;
+    }
+
+    uint32_t realWindow = 1;
+    while (realWindow < windowTicks)
+        realWindow <<= 1;
+
+    RCNET_InputBuffer* buffer = new (std::nothrow) RCNET_InputBuffer();
+    if (buffer == NULL)
+        return NULL;
+
+    size_t cellCount = static_cast<size_t>(realWindow) * maxClients;
+    buffer->slots        = new (std::nothrow) RCNET_InputBufferSlot[realWindow];
+    buffer->inputStorage = new (std::nothrow) RCNET_ClientInput[cellCount];
+    buffer->indexStorage = new (std::nothrow) uint32_t[cellCount];
+    if (buffer->slots == NULL || buffer->inputStorage == NULL || buffer->indexStorage == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_input_buffer_create: out of memory (%u ticks x %u clients)\n", realWindow, maxClients);
+        rcnet_input_buffer_destroy(buffer);
+        return NULL;
+    }
+
+    buffer->windowTicks = realWindow;
+    buffer->windowMask = static_cast<uint64_t>(realWindow) - 1;
+    buffer->maxClients = maxClients;
+
+    for (uint32_t s = 0; s < realWindow; ++s)
+    {
+        RCNET_InputBufferSlot& slot = buffer->slots[s];
+        slot.tick = 0;
+        slot.count = 0;
+        slot.inputs = buffer->inputStorage + static_cast<size_t>(s) * maxClients;
+        slot.indexByClient = buffer->indexStorage + static_cast<size_t>(s) * maxClients;
+    }
+    for (size_t i = 0; i < cellCount; ++i)
+        buffer->indexStorage[i] = kNoInputIndex;
+
+    buffer->lastTakenTick = 0;
+    buffer->stats = RCNET_InputBufferStats{};
+    return buffer;
+}
+
+void rcnet_input_buffer_destroy(RCNET_InputBuffer* buffer)
+{
+    if (buffer == NULL)
+        return;
+
+    delete[] buffer->slots;
+    delete[] buffer->inputStorage;
+    delete[] buffer->indexStorage;
+    delete buffer;
+}
+
+void rcnet_input_buffer_reset(RCNET_InputBuffer* buffer)
+{
+    for (uint32_t s = 0; s < buffer->windowTicks; ++s)
+    {
+        rcnet_input_buffer_clearSlot(buffer->slots[s]);
+        buffer->slots[s].tick = 0;
+    }
+    buffer->lastTakenTick = 0;
+}
+
+RCNET_InputBufferPlaceResult rcnet_input_buffer_place(RCNET_InputBuffer* buffer, uint64_t targetTick, const RCNET_ClientInput* input)
+{
+    // 1) Validation (jamais d'écrasement d'un slot vivant)
+    if (input->clientId >= buffer->maxClients)
+    {
+        buffer->stats.invalidClient++;
+        return RCNET_INPUT_BUFFER_INVALID_CLIENT;
+    }
+    if (targetTick <= buffer->lastTakenTick)
+    {
+        buffer->stats.late++;
+        return RCNET_INPUT_BUFFER_LATE;
+    }
+    if (targetTick - buffer->lastTakenTick > buffer->windowTicks)
+    {
+        buffer->stats.tooFar++;
+        return RCNET_INPUT_BUFFER_TOO_FAR;
+    }
+
+    // 2) Slot cible : s'il représente un ancien tick (déjà consommé), on le recycle
+    RCNET_InputBufferSlot& slot = buffer->slots[targetTick & buffer->windowMask];
+    if (slot.tick != targetTick)
+    {
+        rcnet_input_buffer_clearSlot(slot);
+        slot.tick = targetTick;
+    }
+
+    // 3) Un input par client et par tick : dédoublonnage par clientInputSeq
+    uint32_t existingIndex = slot.indexByClient[input->clientId];
+    if (existingIndex != kNoInputIndex)
+    {
+        if (!rcnet_input_buffer_isSeqNewer(input->clientInputSeq, slot.inputs[existingIndex].clientInputSeq))
+        {
+            buffer->stats.duplicates++;
+            return RCNET_INPUT_BUFFER_DUPLICATE;
+        }
+
+        slot.inputs[existingIndex] = *input;
+        buffer->stats.replaced++;
+        return RCNET_INPUT_BUFFER_REPLACED;
+    }
+
+    // 4) Ajout en fin de tableau packé (count < maxClients garanti par l'index dense)
+    slot.indexByClient[input->clientId] = slot.count;
+    slot.inputs[slot.count++] = *input;
+    buffer->stats.placed++;
+    return RCNET_INPUT_BUFFER_PLACED;
+}
+
+const RCNET_ClientInput* rcnet_input_buffer_take_tick(RCNET_InputBuffer* buffer, uint64_t tick, uint32_t* outCount)
+{
+    if (tick > buffer->lastTakenTick)
+        buffer->lastTakenTick = tick;
+
+    RCNET_InputBufferSlot& slot = buffer->slots[tick & buffer->windowMask];
+    if (slot.tick != tick)
+    {
+        // Aucun input planifié pour ce tick
+        *outCount = 0;
+        return NULL;
+    }
+
+    // Le slot reste intact jusqu'à son recyclage par un futur rcnet_input_buffer_place()
+    *outCount = slot.count;
+    return slot.inputs;
+}
+
+uint32_t rcnet_input_buffer_get_window_ticks(const RCNET_InputBuffer* buffer)
+{
+    return buffer->windowTicks;
+}
+
+void rcnet_input_buffer_get_stats(const RCNET_InputBuffer* buffer, RCNET_InputBufferStats* outStats)
+{
+    *outStats = buffer->stats;
+}
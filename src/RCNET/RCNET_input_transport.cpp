@@ -0,0 +1,326 @@
+#include "RCNET/RCNET_input_transport.h"
+#include "RCNET/RCNET_logger.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <cstring>
+#include <new>
+
+// Comparaison de seq tolérante au wrap-around 32 bits
+static inline bool rcnet_input_transport_isNewer(uint32_t seq, uint32_t reference)
+{
+    return static_cast<int32_t>(seq - reference) > 0;
+}
+
+// ======================================================
+// Sender (client)
+// ======================================================
+
+struct RCNET_InputSender
+{
+    RCNET_InputSenderConfig config;
+
+    // Ring des derniers inputs : inputs[(first + i) % MAX], du plus ancien au plus récent
+    RCNET_ClientInput inputs[RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS];
+    uint32_t first = 0;
+    uint32_t count = 0;
+    uint32_t inputsSincePacket = 0;
+};
+
+void rcnet_input_sender_get_default_config(RCNET_InputSenderConfig* outConfig)
+{
+    if (outConfig == NULL)
+        return;
+
+    outConfig->redundancy = 8;
+    outConfig->inputsPerPacket = 2;
+}
+
+RCNET_InputSender* rcnet_input_sender_create(const RCNET_InputSenderConfig* config)
+{
+    RCNET_InputSenderConfig effective;
+    if (config != NULL)
+        effective = *config;
+    else
+        rcnet_input_sender_get_default_config(&effective);
+
+    if (effective.redundancy == 0 || effective.redundancy > RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS || effective.inputsPerPacket == 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_input_sender_create: invalid configuration (redundancy=%u inputsPerPacket=%u)\n",
+                  effective.redundancy, effective.inputsPerPacket);
+        return NULL;
+    }
+
+    RCNET_InputSender* sender = new (std::nothrow) RCNET_InputSender();
+    if (sender == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_input_sender_create: out of memory\n");
+        return NULL;
+    }
+
+    sender->config = effective;
+    return sender;
+}
+
+void rcnet_input_sender_destroy(RCNET_InputSender* sender)
+{
+    delete sender;
+}
+
+void rcnet_input_sender_reset(RCNET_InputSender* sender)
+{
+    sender->first = 0;
+    sender->count = 0;
+    sender->inputsSincePacket = 0;
+}
+
+bool rcnet_input_sender_add(RCNET_InputSender* sender, const RCNET_ClientInput* input)
+{
+    // Ring plein : le plus ancien (jamais acké) est oublié
+    if (sender->count == RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS)
+    {
+        sender->first = (sender->first + 1) % RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS;
+        sender->count--;
+    }
+
+    sender->inputs[(sender->first + sender->count) % RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS] = *input;
+    sender->count++;
+
+    if (++sender->inputsSincePacket < sender->config.inputsPerPacket)
+        return false;
+
+    sender->inputsSincePacket = 0;
+    return true;
+}
+
+size_t rcnet_input_sender_encode(RCNET_InputSender* sender, void* outBuffer, size_t outCapacity)
+{
+    if (sender->count == 0)
+        return 0;
+
+    // Du plus récent au plus ancien, au plus redundancy inputs
+    RCNET_ClientInput batch[RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS];
+    uint32_t batchCount = sender->count < sender->config.redundancy ? sender->count : sender->config.redundancy;
+    for (uint32_t i = 0; i < batchCount; ++i)
+        batch[i] = sender->inputs[(sender->first + sender->count - 1 - i) % RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS];
+
+    return rcnet_codec_encode_client_input_batch(batch, batchCount, outBuffer, outCapacity);
+}
+
+void rcnet_input_sender_ack(RCNET_InputSender* sender, uint32_t ackedSeq)
+{
+    // Le plus récent reste toujours envoyé (l'ack peut être celui d'un packet plus ancien)
+    while (sender->count > 1 && !rcnet_input_transport_isNewer(sender->inputs[sender->first].clientInputSeq, ackedSeq))
+    {
+        sender->first = (sender->first + 1) % RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS;
+        sender->count--;
+    }
+}
+
+// ======================================================
+// Receiver (serveur)
+// ======================================================
+
+// Compteurs d'un client : écrits par le seul thread du client (pas de read-modify-write partagé entre
+// shards), sommés par rcnet_input_receiver_get_stats
+struct RCNET_InputReceiverCounters
+{
+    std::atomic<uint64_t> packets{0};
+    std::atomic<uint64_t> invalidPackets{0};
+    std::atomic<uint64_t> inputs{0};
+    std::atomic<uint64_t> accepted{0};
+    std::atomic<uint64_t> redundant{0};
+    std::atomic<uint64_t> recovered{0};
+    std::atomic<uint64_t> late{0};
+    std::atomic<uint64_t> resyncs{0};
+};
+
+// Aligné sur 64 octets : deux clients (éventuellement de shards différents) ne partagent jamais une cache line
+struct alignas(64) RCNET_InputReceiverClient
+{
+    std::atomic<uint32_t> lastSeq{0}; // écrit par le thread du client, lu par n'importe quel thread
+    bool hasSeq = false;
+    bool synced = false;
+    int64_t tickOffset = 0;           // tick serveur cible = clientTickId + tickOffset
+    RCNET_InputReceiverCounters counters;
+};
+
+struct RCNET_InputReceiver
+{
+    RCNET_InputReceiverConfig config;
+    RCNET_InputReceiverClient* clients = nullptr;
+
+    // clientId hors limites : pas de client, compteur partagé (cas anormal)
+    std::atomic<uint64_t> invalidClientPackets{0};
+};
+
+// Compteur à écrivain unique : lecture + écriture relaxed
+static inline void rcnet_input_transport_addCounter(std::atomic<uint64_t>& counter, uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+void rcnet_input_receiver_get_default_config(RCNET_InputReceiverConfig* outConfig)
+{
+    if (outConfig == NULL)
+        return;
+
+    outConfig->maxClients = 0;
+    outConfig->inputsPerPacket = 2;
+    outConfig->inputDelayTicks = 2;
+    outConfig->maxDriftTicks = 8;
+}
+
+RCNET_InputReceiver* rcnet_input_receiver_create(const RCNET_InputReceiverConfig* config)
+{
+    if (config == NULL || config->maxClients == 0 || config->inputsPerPacket == 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_input_receiver_create: invalid configuration\n");
+        return NULL;
+    }
+
+    RCNET_InputReceiver* receiver = new (std::nothrow) RCNET_InputReceiver();
+    if (receiver != NULL)
+        receiver->clients = new (std::nothrow) RCNET_InputReceiverClient[config->maxClients];
+
+    if (receiver == NULL || receiver->clients == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_input_receiver_create: out of memory (%u clients)\n", config->maxClients);
+        delete receiver;
+        return NULL;
+    }
+
+    receiver->config = *config;
+    return receiver;
+}
+
+void rcnet_input_receiver_destroy(RCNET_InputReceiver* receiver)
+{
+    if (receiver == NULL)
+        return;
+
+    delete[] receiver->clients;
+    delete receiver;
+}
+
+void rcnet_input_receiver_reset_client(RCNET_InputReceiver* receiver, uint32_t clientId)
+{
+    if (clientId >= receiver->config.maxClients)
+        return;
+
+    RCNET_InputReceiverClient& client = receiver->clients[clientId];
+    client.lastSeq.store(0, std::memory_order_relaxed);
+    client.hasSeq = false;
+    client.synced = false;
+    client.tickOffset = 0;
+}
+
+uint32_t rcnet_input_receiver_accept(RCNET_InputReceiver* receiver, uint32_t clientId, const void* bytes, size_t size,
+                                     uint64_t currentServerTick, RCNET_ScheduledInput* outInputs)
+{
+    if (clientId >= receiver->config.maxClients)
+    {
+        receiver->invalidClientPackets.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+    }
+
+    RCNET_InputReceiverClient& client = receiver->clients[clientId];
+    RCNET_InputReceiverCounters& counters = client.counters;
+
+    RCNET_ClientInput decoded[RCNET_CLIENT_INPUT_BATCH_MAX_INPUTS];
+    uint32_t decodedCount = rcnet_codec_decode_client_input_batch(bytes, size, clientId, decoded);
+    if (decodedCount == 0)
+    {
+        rcnet_input_transport_addCounter(counters.invalidPackets, 1);
+        return 0;
+    }
+
+    rcnet_input_transport_addCounter(counters.packets, 1);
+    rcnet_input_transport_addCounter(counters.inputs, decodedCount);
+
+    uint32_t lastSeq = client.lastSeq.load(std::memory_order_relaxed);
+
+    // Inputs nouveaux : préfixe decoded[0..newCount) (seq strictement décroissants)
+    uint32_t newCount = 0;
+    while (newCount < decodedCount
+           && (!client.hasSeq || rcnet_input_transport_isNewer(decoded[newCount].clientInputSeq, lastSeq)))
+        newCount++;
+
+    rcnet_input_transport_addCounter(counters.redundant, decodedCount - newCount);
+    if (newCount == 0)
+        return 0;
+
+    // Ecart tick client -> tick serveur : fixé au premier input (le plus récent à courant + délai),
+    // recalé vers le bas si l'avance dépasse délai + dérive (horloge client plus rapide)
+    const int64_t current = static_cast<int64_t>(currentServerTick);
+    const int64_t newestTick = static_cast<int64_t>(decoded[0].clientTickId);
+    if (!client.synced || newestTick + client.tickOffset > current + receiver->config.inputDelayTicks + receiver->config.maxDriftTicks)
+    {
+        if (client.synced)
+            rcnet_input_transport_addCounter(counters.resyncs, 1);
+        client.tickOffset = current + receiver->config.inputDelayTicks - newestTick;
+        client.synced = true;
+    }
+
+    // Plus ancien input nouveau déjà en retard (rattrapé par redondance, horloge client plus lente) :
+    // l'écart est décalé juste assez pour qu'il vise le prochain tick, plutôt que de le perdre
+    const int64_t oldestTarget = static_cast<int64_t>(decoded[newCount - 1].clientTickId) + client.tickOffset;
+    if (oldestTarget <= current)
+    {
+        rcnet_input_transport_addCounter(counters.late, 1);
+        client.tickOffset += current + 1 - oldestTarget;
+    }
+
+    // Du plus ancien au plus récent
+    for (uint32_t i = newCount; i-- > 0;)
+    {
+        const RCNET_ClientInput& input = decoded[i];
+        RCNET_ScheduledInput& scheduled = outInputs[newCount - 1 - i];
+        scheduled.targetServerTick = static_cast<uint64_t>(static_cast<int64_t>(input.clientTickId) + client.tickOffset);
+        scheduled.input = input;
+    }
+
+    // Au-delà de inputsPerPacket inputs nouveaux, le packet précédent a été perdu
+    if (client.hasSeq && newCount > receiver->config.inputsPerPacket)
+        rcnet_input_transport_addCounter(counters.recovered, newCount - receiver->config.inputsPerPacket);
+
+    lastSeq = decoded[0].clientInputSeq;
+    client.hasSeq = true;
+
+    client.lastSeq.store(lastSeq, std::memory_order_relaxed);
+    rcnet_input_transport_addCounter(counters.accepted, newCount);
+    return newCount;
+}
+
+uint32_t rcnet_input_receiver_get_last_seq(const RCNET_InputReceiver* receiver, uint32_t clientId)
+{
+    if (clientId >= receiver->config.maxClients)
+        return 0;
+    return receiver->clients[clientId].lastSeq.load(std::memory_order_relaxed);
+}
+
+void rcnet_input_receiver_get_stats(const RCNET_InputReceiver* receiver, RCNET_InputReceiverStats* outStats)
+{
+    if (outStats == NULL)
+        return;
+
+    std::memset(outStats, 0, sizeof(*outStats));
+    if (receiver == NULL)
+        return;
+
+    outStats->invalidPackets = receiver->invalidClientPackets.load(std::memory_order_relaxed);
+    for (uint32_t clientId = 0; clientId < receiver->config.maxClients; ++clientId)
+    {
+        const RCNET_InputReceiverCounters& counters = receiver->clients[clientId].counters;
+        outStats->packets        += counters.packets.load(std::memory_order_relaxed);
+        outStats->invalidPackets += counters.invalidPackets.load(std::memory_order_relaxed);
+        outStats->inputs         += counters.inputs.load(std::memory_order_relaxed);
+        outStats->accepted       += counters.accepted.load(std::memory_order_relaxed);
+        outStats->redundant      += counters.redundant.load(std::memory_order_relaxed);
+        outStats->recovered      += counters.recovered.load(std::memory_order_relaxed);
+        outStats->late           += counters.late.load(std::memory_order_relaxed);
+        outStats->resyncs        += counters.resyncs.load(std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,363 @@
+#include "RCNET/RCNET_interest.h"
+#include "RCNET/RCNET_logger.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <new>
+
+// Cellule / liste vide
+static constexpr int32_t kNoIndex = -1;
+
+// Bonus d'une entité qui vient d'entrer dans la visibilité (apparaît au plus vite chez le client)
+static constexpr float kEnterPriorityBoost = 4.0f;
+
+// Priorité gagnée au bord de exitRadius, relative à une entité collée au point de vue
+static constexpr float kFarPriorityScale = 0.25f;
+
+struct RCNET_InterestPeer
+{
+    uint64_t* visible = nullptr;      // bitset courant (une des deux moitiés de visibleStorage)
+    uint64_t* nextVisible = nullptr;  // bitset en construction
+    float* accumulators = nullptr;    // maxEntities
+    uint32_t* priorityList = nullptr; // maxEntities
+    uint32_t priorityCount = 0;
+    uint32_t visibleCount = 0;
+    uint32_t peerEntity = RCNET_INTEREST_NO_ENTITY;
+    size_t byteBudget = 0;
+};
+
+struct RCNET_Interest
+{
+    RCNET_InterestConfig config;
+    uint32_t words = 0;
+
+    // Grille : liste doublement chaînée d'entités par cellule
+    uint32_t columns = 0;
+    uint32_t rows = 0;
+    float inverseCellSize = 0.0f;
+    int32_t* cellHeads = nullptr;
+
+    // Entités
+    int32_t* entityCell = nullptr;    // kNoIndex = absente
+    int32_t* entityNext = nullptr;
+    int32_t* entityPrev = nullptr;
+    float* entityX = nullptr;
+    float* entityY = nullptr;
+    float* entityPriority = nullptr;
+
+    RCNET_InterestPeer* peers = nullptr;
+    uint64_t* visibleStorage = nullptr;
+    float* accumulatorStorage = nullptr;
+    uint32_t* priorityStorage = nullptr;
+};
+
+static inline uint32_t rcnet_interest_cellCoord(float value, float minValue, float inverseCellSize, uint32_t count)
+{
+    // Borné en float avant la conversion : caster un négatif, un NaN ou une valeur hors uint32_t est indéfini
+    float cell = (value - minValue) * inverseCellSize;
+    if (!(cell > 0.0f))
+        return 0;
+    if (cell >= static_cast<float>(count - 1))
+        return count - 1;
+    return static_cast<uint32_t>(cell);
+}
+
+static inline bool rcnet_interest_testBit(const uint64_t* bits, uint32_t index)
+{
+    return (bits[index >> 6] >> (index & 63)) & 1u;
+}
+
+static void rcnet_interest_unlink(RCNET_Interest* interest, uint32_t entityId)
+{
+    int32_t cell = interest->entityCell[entityId];
+    int32_t next = interest->entityNext[entityId];
+    int32_t prev = interest->entityPrev[entityId];
+
+    if (prev != kNoIndex)
+        interest->entityNext[prev] = next;
+    else
+        interest->cellHeads[cell] = next;
+    if (next != kNoIndex)
+        interest->entityPrev[next] = prev;
+
+    interest->entityCell[entityId] = kNoIndex;
+}
+
+static void rcnet_interest_link(RCNET_Interest* interest, uint32_t entityId, int32_t cell)
+{
+    int32_t head = interest->cellHeads[cell];
+    interest->entityNext[entityId] = head;
+    interest->entityPrev[entityId] = kNoIndex;
+    if (head != kNoIndex)
+        interest->entityPrev[head] = static_cast<int32_t>(entityId);
+    interest->cellHeads[cell] = static_cast<int32_t>(entityId);
+    interest->entityCell[entityId] = cell;
+}
+
+void rcnet_interest_get_default_config(RCNET_InterestConfig* outConfig)
+{
+    if (outConfig == NULL)
+        return;
+
+    outConfig->maxEntities = 0;
+    outConfig->maxPeers = 0;
+    outConfig->worldMinX = -512.0f;
+    outConfig->worldMinY = -512.0f;
+    outConfig->worldMaxX = 512.0f;
+    outConfig->worldMaxY = 512.0f;
+    outConfig->cellSize = 64.0f;
+    outConfig->enterRadius = 200.0f;
+    outConfig->exitRadius = 240.0f;
+    outConfig->peerByteBudget = 1200;
+}
+
+RCNET_Interest* rcnet_interest_create(const RCNET_InterestConfig* config)
+{
+    if (config == NULL || config->maxEntities == 0 || config->maxPeers == 0 || !(config->cellSize > 0.0f)
+        || !(config->worldMaxX > config->worldMinX) || !(config->worldMaxY > config->worldMinY)
+        || !(config->enterRadius > 0.0f) || config->exitRadius < config->enterRadius)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_interest_create: invalid configuration\n");
+        return NULL;
+    }
+
+    RCNET_Interest* interest = new (std::nothrow) RCNET_Interest();
+    if (interest == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_interest_create: out of memory\n");
+        return NULL;
+    }
+
+    interest->config = *config;
+    interest->words = (config->maxEntities + 63) / 64;
+    interest->inverseCellSize = 1.0f / config->cellSize;
+    interest->columns = static_cast<uint32_t>(std::ceil((config->worldMaxX - config->worldMinX) * interest->inverseCellSize));
+    interest->rows = static_cast<uint32_t>(std::ceil((config->worldMaxY - config->worldMinY) * interest->inverseCellSize));
+    if (interest->columns == 0) interest->columns = 1;
+    if (interest->rows == 0) interest->rows = 1;
+
+    const size_t cellCount = static_cast<size_t>(interest->columns) * interest->rows;
+    const size_t entities = config->maxEntities;
+    const size_t peers = config->maxPeers;
+
+    interest->cellHeads = new (std::nothrow) int32_t[cellCount];
+    interest->entityCell = new (std::nothrow) int32_t[entities];
+    interest->entityNext = new (std::nothrow) int32_t[entities];
+    interest->entityPrev = new (std::nothrow) int32_t[entities];
+    interest->entityX = new (std::nothrow) float[entities]();
+    interest->entityY = new (std::nothrow) float[entities]();
+    interest->entityPriority = new (std::nothrow) float[entities]();
+    interest->peers = new (std::nothrow) RCNET_InterestPeer[peers];
+    interest->visibleStorage = new (std::nothrow) uint64_t[peers * 2 * interest->words]();
+    interest->accumulatorStorage = new (std::nothrow) float[peers * entities]();
+    interest->priorityStorage = new (std::nothrow) uint32_t[peers * entities];
+
+    if (interest->cellHeads == NULL || interest->entityCell == NULL || interest->entityNext == NULL || interest->entityPrev == NULL
+        || interest->entityX == NULL || interest->entityY == NULL || interest->entityPriority == NULL || interest->peers == NULL
+        || interest->visibleStorage == NULL || interest->accumulatorStorage == NULL || interest->priorityStorage == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_interest_create: out of memory (%u entities, %u peers)\n", config->maxEntities, config->maxPeers);
+        rcnet_interest_destroy(interest);
+        return NULL;
+    }
+
+    std::fill(interest->cellHeads, interest->cellHeads + cellCount, kNoIndex);
+    std::fill(interest->entityCell, interest->entityCell + entities, kNoIndex);
+
+    for (size_t p = 0; p < peers; ++p)
+    {
+        RCNET_InterestPeer& peer = interest->peers[p];
+        peer.visible = interest->visibleStorage + p * 2 * interest->words;
+        peer.nextVisible = peer.visible + interest->words;
+        peer.accumulators = interest->accumulatorStorage + p * entities;
+        peer.priorityList = interest->priorityStorage + p * entities;
+        peer.byteBudget = config->peerByteBudget;
+    }
+
+    return interest;
+}
+
+void rcnet_interest_destroy(RCNET_Interest* interest)
+{
+    if (interest == NULL)
+        return;
+
+    delete[] interest->cellHeads;
+    delete[] interest->entityCell;
+    delete[] interest->entityNext;
+    delete[] interest->entityPrev;
+    delete[] interest->entityX;
+    delete[] interest->entityY;
+    delete[] interest->entityPriority;
+    delete[] interest->peers;
+    delete[] interest->visibleStorage;
+    delete[] interest->accumulatorStorage;
+    delete[] interest->priorityStorage;
+    delete interest;
+}
+
+void rcnet_interest_set_entity(RCNET_Interest* interest, uint32_t entityId, float x, float y, float priority)
+{
+    if (entityId >= interest->config.maxEntities || std::isnan(x) || std::isnan(y))
+        return;
+
+    const RCNET_InterestConfig& config = interest->config;
+    uint32_t column = rcnet_interest_cellCoord(x, config.worldMinX, interest->inverseCellSize, interest->columns);
+    uint32_t row = rcnet_interest_cellCoord(y, config.worldMinY, interest->inverseCellSize, interest->rows);
+    int32_t cell = static_cast<int32_t>(row * interest->columns + column);
+
+    // Incrémental : la liste de la cellule ne change que si l'entité change de cellule
+    if (interest->entityCell[entityId] != cell)
+    {
+        if (interest->entityCell[entityId] != kNoIndex)
+            rcnet_interest_unlink(interest, entityId);
+        rcnet_interest_link(interest, entityId, cell);
+    }
+
+    interest->entityX[entityId] = x;
+    interest->entityY[entityId] = y;
+    interest->entityPriority[entityId] = priority;
+}
+
+void rcnet_interest_remove_entity(RCNET_Interest* interest, uint32_t entityId)
+{
+    if (entityId >= interest->config.maxEntities || interest->entityCell[entityId] == kNoIndex)
+        return;
+
+    rcnet_interest_unlink(interest, entityId);
+}
+
+void rcnet_interest_set_peer_entity(RCNET_Interest* interest, uint32_t peerId, uint32_t entityId)
+{
+    if (peerId < interest->config.maxPeers)
+        interest->peers[peerId].peerEntity = entityId;
+}
+
+void rcnet_interest_set_peer_budget(RCNET_Interest* interest, uint32_t peerId, size_t maxPayloadBytes)
+{
+    if (peerId < interest->config.maxPeers)
+        interest->peers[peerId].byteBudget = maxPayloadBytes;
+}
+
+void rcnet_interest_reset_peer(RCNET_Interest* interest, uint32_t peerId)
+{
+    if (peerId >= interest->config.maxPeers)
+        return;
+
+    RCNET_InterestPeer& peer = interest->peers[peerId];
+    std::memset(peer.visible, 0, interest->words * sizeof(uint64_t));
+    std::memset(peer.accumulators, 0, interest->config.maxEntities * sizeof(float));
+    peer.priorityCount = 0;
+    peer.visibleCount = 0;
+}
+
+void rcnet_interest_update_peer(RCNET_Interest* interest, uint32_t peerId, float viewerX, float viewerY, RCNET_SnapshotInterest* outFilter)
+{
+    if (peerId >= interest->config.maxPeers || outFilter == NULL)
+        return;
+
+    const RCNET_InterestConfig& config = interest->config;
+    RCNET_InterestPeer& peer = interest->peers[peerId];
+
+    const float enterSq = config.enterRadius * config.enterRadius;
+    const float exitSq = config.exitRadius * config.exitRadius;
+    const float inverseExit = 1.0f / config.exitRadius;
+
+    std::memset(peer.nextVisible, 0, interest->words * sizeof(uint64_t));
+    uint32_t count = 0;
+
+    // 1) Cellules qui recouvrent le carré de rayon exitRadius
+    uint32_t minColumn = rcnet_interest_cellCoord(viewerX - config.exitRadius, config.worldMinX, interest->inverseCellSize, interest->columns);
+    uint32_t maxColumn = rcnet_interest_cellCoord(viewerX + config.exitRadius, config.worldMinX, interest->inverseCellSize, interest->columns);
+    uint32_t minRow = rcnet_interest_cellCoord(viewerY - config.exitRadius, config.worldMinY, interest->inverseCellSize, interest->rows);
+    uint32_t maxRow = rcnet_interest_cellCoord(viewerY + config.exitRadius, config.worldMinY, interest->inverseCellSize, interest->rows);
+
+    for (uint32_t row = minRow; row <= maxRow; ++row)
+    {
+        for (uint32_t column = minColumn; column <= maxColumn; ++column)
+        {
+            for (int32_t e = interest->cellHeads[row * interest->columns + column]; e != kNoIndex; e = interest->entityNext[e])
+            {
+                uint32_t entityId = static_cast<uint32_t>(e);
+                if (entityId == peer.peerEntity)
+                    continue;
+
+                float dx = interest->entityX[entityId] - viewerX;
+                float dy = interest->entityY[entityId] - viewerY;
+                float distanceSq = dx * dx + dy * dy;
+
+                // 2) Hystérésis : entrée sous enterRadius, sortie au-delà de exitRadius
+                bool wasVisible = rcnet_interest_testBit(peer.visible, entityId);
+                if (distanceSq > (wasVisible ? exitSq : enterSq))
+                    continue;
+
+                // 3) Accumulateur : plus proche = priorité qui monte plus vite
+                float distanceRatio = std::sqrt(distanceSq) * inverseExit;
+                float gain = interest->entityPriority[entityId] * (1.0f - (1.0f - kFarPriorityScale) * std::min(distanceRatio, 1.0f));
+                peer.accumulators[entityId] += wasVisible ? gain : gain * kEnterPriorityBoost;
+
+                peer.nextVisible[entityId >> 6] |= 1ull << (entityId & 63);
+                peer.priorityList[count++] = entityId;
+            }
+        }
+    }
+
+    // Entités sorties : leur accumulateur repart de 0 si elles reviennent
+    for (uint32_t word = 0; word < interest->words; ++word)
+    {
+        uint64_t left = peer.visible[word] & ~peer.nextVisible[word];
+        while (left != 0)
+        {
+            uint32_t bit = 0;
+            while (((left >> bit) & 1u) == 0)
+                bit++;
+            left &= left - 1;
+            peer.accumulators[word * 64 + bit] = 0.0f;
+        }
+    }
+
+    // 4) Ordre d'envoi : accumulateur décroissant
+    const float* accumulators = peer.accumulators;
+    std::sort(peer.priorityList, peer.priorityList + count, [accumulators](uint32_t a, uint32_t b) {
+        return accumulators[a] > accumulators[b];
+    });
+
+    // 5) Entité du peer : toujours visible, toujours en tête
+    uint32_t own = peer.peerEntity;
+    if (own < config.maxEntities && interest->entityCell[own] != kNoIndex)
+    {
+        std::memmove(peer.priorityList + 1, peer.priorityList, count * sizeof(uint32_t));
+        peer.priorityList[0] = own;
+        peer.nextVisible[own >> 6] |= 1ull << (own & 63);
+        count++;
+    }
+
+    std::swap(peer.visible, peer.nextVisible);
+    peer.priorityCount = count;
+    peer.visibleCount = count;
+
+    outFilter->visibleMask = peer.visible;
+    outFilter->priorityList = peer.priorityList;
+    outFilter->priorityCount = count;
+    outFilter->maxPayloadBytes = peer.byteBudget;
+}
+
+void rcnet_interest_commit_peer(RCNET_Interest* interest, uint32_t peerId, uint32_t writtenCount)
+{
+    if (peerId >= interest->config.maxPeers)
+        return;
+
+    RCNET_InterestPeer& peer = interest->peers[peerId];
+    uint32_t count = std::min(writtenCount, peer.priorityCount);
+    for (uint32_t i = 0; i < count; ++i)
+        peer.accumulators[peer.priorityList[i]] = 0.0f;
+}
+
+uint32_t rcnet_interest_get_visible_count(const RCNET_Interest* interest, uint32_t peerId)
+{
+    return peerId < interest->config.maxPeers ? interest->peers[peerId].visibleCount : 0;
+}
@@ -2,11 +2,77 @@
 
 #include <SDL3/SDL_log.h>
 
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+
 /**
  * Définities le niveau de log par défaut à RCNET_LOG_DEBUG
  * Cela peut être modifié par l'utilisateur via la fonction : rcnet_logger_set_priority()
+ * Atomique : lu par tous les threads avant tout formatage.
  */
-static RCNET_LogLevel currentLogLevel = RCNET_LOG_DEBUG;
+static std::atomic<int> currentLogLevel{ RCNET_LOG_DEBUG };
+
+// ======================================================
+// Mode asynchrone : un ring buffer SPSC par thread producteur, vidé par un thread d'écriture
+// ======================================================
+static constexpr uint32_t kMaxLogRings = 256;
+static constexpr uint32_t kMaxLogRingCapacity = 1u << 16;  // ~64 Mo de messages par thread
+
+struct RCNET_LogRecord
+{
+    RCNET_LogLevel level;
+    int line;
+    const char* file;      // SDL_FILE / SDL_FUNCTION : chaînes littérales, valides après le retour de l'appelant
+    const char* function;
+    char message[RCNET_LOGGER_MAX_MESSAGE];
+};
+
+struct RCNET_LogRing
+{
+    alignas(64) std::atomic<uint64_t> head{0};  // écrit par le thread propriétaire
+    alignas(64) std::atomic<uint64_t> tail{0};  // écrit par le thread d'écriture
+    uint32_t mask = 0;
+    RCNET_LogRecord* records = nullptr;
+    std::atomic<bool> owned{false};             // false : thread terminé, ring réutilisable
+};
+
+// Rend le ring à la fin du thread (ses messages restants sont tout de même écrits)
+struct RCNET_LogRingOwner
+{
+    RCNET_LogRing* ring = nullptr;
+    ~RCNET_LogRingOwner()
+    {
+        if (ring != nullptr)
+            ring->owned.store(false, std::memory_order_release);
+    }
+};
+
+static std::atomic<bool> asyncEnabled{false};
+static std::atomic<bool> asyncRunning{false};
+static std::atomic<uint64_t> droppedCount{0};
+static RCNET_LoggerAsyncConfig asyncConfig;
+static std::thread asyncThread;
+// asyncWakeMutex n'est pris que par le thread d'écriture (et rcnet_logger_stop_async) : un producteur
+// lève asyncWakeRequested et notifie sans verrou, il ne peut donc jamais bloquer. Une notification qui
+// tombe entre le test du prédicat et la mise en attente est perdue : le réveil arrive alors au plus
+// tard après flushIntervalMs, comme sans notification.
+static std::mutex asyncWakeMutex;
+static std::condition_variable asyncWakeCv;
+static std::atomic<bool> asyncWakeRequested{false};  // remis à false par le thread d'écriture
+
+// Les rings ne sont jamais libérés : un producteur peut encore écrire pendant rcnet_logger_stop_async()
+static std::mutex ringsMutex;
+static std::atomic<RCNET_LogRing*> rings[kMaxLogRings];
+static std::atomic<uint32_t> ringCount{0};
+
+static thread_local RCNET_LogRingOwner tlsRingOwner;
 
 /**
  * Convertit le niveau de log RCNET en chaîne de caractères.
@@ -33,76 +99,259 @@ static const char* rcnet_logger_log_level_to_string(RCNET_LogLevel level)
     }
 }
 
-RCNET_LogLevel rcnet_logger_get_priority(void)
+/**
+ * Convertit le niveau de log RCNET en priorité SDL correspondante.
+ */
+static SDL_LogPriority rcnet_logger_toSdlPriority(RCNET_LogLevel level)
 {
-    return currentLogLevel;
+    switch (level)
+    {
+        case RCNET_LOG_TRACE:     return SDL_LOG_PRIORITY_TRACE;
+        case RCNET_LOG_VERBOSE:   return SDL_LOG_PRIORITY_VERBOSE;
+        case RCNET_LOG_DEBUG:     return SDL_LOG_PRIORITY_DEBUG;
+        case RCNET_LOG_INFO:      return SDL_LOG_PRIORITY_INFO;
+        case RCNET_LOG_WARN:      return SDL_LOG_PRIORITY_WARN;
+        case RCNET_LOG_ERROR:     return SDL_LOG_PRIORITY_ERROR;
+        case RCNET_LOG_CRITICAL:  return SDL_LOG_PRIORITY_CRITICAL;
+        default:                 return SDL_LOG_PRIORITY_INFO;
+    }
 }
 
-void rcnet_logger_set_priority(const RCNET_LogLevel logLevel) 
+/**
+ * Ecrit un message déjà formaté, avec son préfixe [niveau:fichier:ligne:fonction].
+ */
+static void rcnet_logger_writeMessage(RCNET_LogLevel level, const char* file, int line, const char* function, const char* message)
 {
-    // Enregistre le niveau de log actuel
-    currentLogLevel = logLevel;
+    const char* filename = SDL_strrchr(file, '/');
+    if (!filename) filename = SDL_strrchr(file, '\\');
+    filename = filename ? filename + 1 : file;
 
-    // Convertit le niveau de log de RCNET en priorite SDL correspondante.
-    SDL_LogPriority logPriority;
-    switch(logLevel) 
+    SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, rcnet_logger_toSdlPriority(level), "[%s:%s:%d:%s] %s",
+                   rcnet_logger_log_level_to_string(level), filename, line, function, message);
+}
+
+/**
+ * Ring du thread appelant (créé ou réutilisé au premier message du thread). NULL si la limite de rings est atteinte.
+ */
+static RCNET_LogRing* rcnet_logger_acquireRing(void)
+{
+    if (tlsRingOwner.ring != nullptr)
+        return tlsRingOwner.ring;
+
+    std::lock_guard<std::mutex> lock(ringsMutex);
+
+    const uint32_t count = ringCount.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < count; ++i)
     {
-        case RCNET_LOG_TRACE:     logPriority = SDL_LOG_PRIORITY_TRACE;     break;
-        case RCNET_LOG_VERBOSE:   logPriority = SDL_LOG_PRIORITY_VERBOSE;   break;
-        case RCNET_LOG_DEBUG:     logPriority = SDL_LOG_PRIORITY_DEBUG;     break;
-        case RCNET_LOG_INFO:      logPriority = SDL_LOG_PRIORITY_INFO;      break;
-        case RCNET_LOG_WARN:      logPriority = SDL_LOG_PRIORITY_WARN;      break;
-        case RCNET_LOG_ERROR:     logPriority = SDL_LOG_PRIORITY_ERROR;     break;
-        case RCNET_LOG_CRITICAL:  logPriority = SDL_LOG_PRIORITY_CRITICAL;  break;
-        default:                 logPriority = SDL_LOG_PRIORITY_INFO;       break;
+        RCNET_LogRing* ring = rings[i].load(std::memory_order_relaxed);
+        bool expected = false;
+        if (ring->owned.compare_exchange_strong(expected, true, std::memory_order_acquire))
+        {
+            tlsRingOwner.ring = ring;
+            return ring;
+        }
     }
 
-    // Definit la priorite de log pour toutes les categories
-    SDL_SetLogPriorities(logPriority);
+    if (count == kMaxLogRings)
+        return nullptr;
+
+    uint32_t capacity = 1;
+    while (capacity < asyncConfig.ringCapacity)
+        capacity <<= 1;
+
+    RCNET_LogRing* ring = new (std::nothrow) RCNET_LogRing();
+    if (ring == nullptr)
+        return nullptr;
+
+    ring->records = new (std::nothrow) RCNET_LogRecord[capacity];
+    if (ring->records == nullptr)
+    {
+        delete ring;
+        return nullptr;
+    }
+
+    ring->mask = capacity - 1;
+    ring->owned.store(true, std::memory_order_relaxed);
+    rings[count].store(ring, std::memory_order_relaxed);
+    ringCount.store(count + 1, std::memory_order_release);
+
+    tlsRingOwner.ring = ring;
+    return ring;
 }
 
-void rcnet_logger_log(const RCNET_LogLevel logLevel, const char* file, int line, const char* function, const char* format, ...)
+static void rcnet_logger_pushAsync(RCNET_LogLevel level, const char* file, int line, const char* function, const char* format, va_list args)
 {
-    /**
-     * Vérifie si le niveau de log est inférieur au niveau actuel
-     * Si oui, on ne fait rien
-     */
-    if (logLevel < currentLogLevel) return;
+    RCNET_LogRing* ring = rcnet_logger_acquireRing();
+    if (ring == nullptr)
+    {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
 
-    // Convertit le niveau de log de RCNET en priorite SDL correspondante.
-    SDL_LogPriority sdlPriority;
-    switch (logLevel) 
+    const uint64_t head = ring->head.load(std::memory_order_relaxed);
+    const uint64_t pending = head - ring->tail.load(std::memory_order_acquire);
+    if (pending > ring->mask)
     {
-        case RCNET_LOG_TRACE:     sdlPriority = SDL_LOG_PRIORITY_TRACE;     break;
-        case RCNET_LOG_VERBOSE:   sdlPriority = SDL_LOG_PRIORITY_VERBOSE;   break;
-        case RCNET_LOG_DEBUG:     sdlPriority = SDL_LOG_PRIORITY_DEBUG;     break;
-        case RCNET_LOG_INFO:      sdlPriority = SDL_LOG_PRIORITY_INFO;      break;
-        case RCNET_LOG_WARN:      sdlPriority = SDL_LOG_PRIORITY_WARN;      break;
-        case RCNET_LOG_ERROR:     sdlPriority = SDL_LOG_PRIORITY_ERROR;     break;
-        case RCNET_LOG_CRITICAL:  sdlPriority = SDL_LOG_PRIORITY_CRITICAL;  break;
-        default:                 sdlPriority = SDL_LOG_PRIORITY_INFO;       break;
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
     }
 
-    // Convertit le niveau de log de RCNET en chaîne de caractères
-    const char* levelStr = rcnet_logger_log_level_to_string(logLevel);
+    // Une seule passe de formatage, directement dans le slot
+    RCNET_LogRecord& record = ring->records[head & ring->mask];
+    record.level = level;
+    record.line = line;
+    record.file = file;
+    record.function = function;
+    SDL_vsnprintf(record.message, sizeof(record.message), format, args);
 
-    // Préparer le message de log
-    const char* filename = SDL_strrchr(file, '/');
-    if (!filename) filename = SDL_strrchr(file, '\\');
-    filename = filename ? filename + 1 : file;
+    ring->head.store(head + 1, std::memory_order_release);
+
+    // Ring à moitié plein : réveille le thread d'écriture sans attendre flushIntervalMs
+    if (pending + 1 == (ring->mask + 1) / 2 && !asyncWakeRequested.exchange(true, std::memory_order_release))
+        asyncWakeCv.notify_one();
+}
 
-    char prefix[256];
-    SDL_snprintf(prefix, sizeof(prefix), "[%s:%s:%d:%s] ", levelStr, filename, line, function);
+/**
+ * Ecrit les messages de tous les rings (thread d'écriture).
+ */
+static uint32_t rcnet_logger_drainRings(void)
+{
+    uint32_t written = 0;
+    const uint32_t count = ringCount.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        RCNET_LogRing* ring = rings[i].load(std::memory_order_relaxed);
+
+        uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+        const uint64_t head = ring->head.load(std::memory_order_acquire);
+        while (tail != head)
+        {
+            const RCNET_LogRecord& record = ring->records[tail & ring->mask];
+            rcnet_logger_writeMessage(record.level, record.file, record.line, record.function, record.message);
+            ring->tail.store(++tail, std::memory_order_release);
+            written++;
+        }
+    }
+    return written;
+}
+
+static void rcnet_logger_asyncThreadMain(void)
+{
+    while (asyncRunning.load(std::memory_order_acquire))
+    {
+        if (rcnet_logger_drainRings() > 0)
+            continue;
+
+        std::unique_lock<std::mutex> lock(asyncWakeMutex);
+        asyncWakeCv.wait_for(lock, std::chrono::milliseconds(asyncConfig.flushIntervalMs), [] {
+            return asyncWakeRequested.exchange(false, std::memory_order_acquire) || !asyncRunning.load(std::memory_order_acquire);
+        });
+    }
+
+    rcnet_logger_drainRings();
+}
+
+void rcnet_logger_get_default_async_config(RCNET_LoggerAsyncConfig* outConfig)
+{
+    if (outConfig == NULL)
+        return;
+
+    outConfig->ringCapacity = 256;
+    outConfig->flushIntervalMs = 5;
+}
+
+bool rcnet_logger_start_async(const RCNET_LoggerAsyncConfig* config)
+{
+    if (asyncEnabled.load(std::memory_order_acquire))
+        return true;
+
+    if (config != NULL)
+        asyncConfig = *config;
+    else
+        rcnet_logger_get_default_async_config(&asyncConfig);
+
+    if (asyncConfig.ringCapacity == 0)
+        asyncConfig.ringCapacity = 1;
+    else if (asyncConfig.ringCapacity > kMaxLogRingCapacity)
+        asyncConfig.ringCapacity = kMaxLogRingCapacity;
+
+    asyncRunning.store(true, std::memory_order_release);
+    try
+    {
+        asyncThread = std::thread(rcnet_logger_asyncThreadMain);
+    }
+    catch (const std::exception&)
+    {
+        asyncRunning.store(false, std::memory_order_release);
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_logger_start_async: impossible de creer le thread d'ecriture\n");
+        return false;
+    }
+
+    asyncEnabled.store(true, std::memory_order_release);
+    return true;
+}
+
+void rcnet_logger_stop_async(void)
+{
+    if (!asyncEnabled.exchange(false, std::memory_order_acq_rel))
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(asyncWakeMutex);
+        asyncRunning.store(false, std::memory_order_release);
+    }
+    asyncWakeCv.notify_one();
+
+    if (asyncThread.joinable())
+        asyncThread.join();
+}
+
+uint64_t rcnet_logger_get_dropped_count(void)
+{
+    return droppedCount.load(std::memory_order_relaxed);
+}
+
+RCNET_LogLevel rcnet_logger_get_priority(void)
+{
+    return static_cast<RCNET_LogLevel>(currentLogLevel.load(std::memory_order_relaxed));
+}
+
+void rcnet_logger_set_priority(const RCNET_LogLevel logLevel) 
+{
+    // Enregistre le niveau de log actuel
+    currentLogLevel.store(logLevel, std::memory_order_relaxed);
+
+    // Definit la priorite de log pour toutes les categories
+    SDL_SetLogPriorities(rcnet_logger_toSdlPriority(logLevel));
+}
+
+void rcnet_logger_log(const RCNET_LogLevel logLevel, const char* file, int line, const char* function, const char* format, ...)
+{
+    /**
+     * Vérifie si le niveau de log est inférieur au niveau actuel
+     * Si oui, on ne fait rien (aucun formatage)
+     */
+    if (logLevel < currentLogLevel.load(std::memory_order_relaxed)) return;
 
-    char message[1024];
     va_list args;
     va_start(args, format);
+
+    if (asyncEnabled.load(std::memory_order_acquire))
+    {
+        rcnet_logger_pushAsync(logLevel, file, line, function, format, args);
+        va_end(args);
+        return;
+    }
+
+    char message[RCNET_LOGGER_MAX_MESSAGE];
     SDL_vsnprintf(message, sizeof(message), format, args);
     va_end(args);
 
-    char fullMessage[1280];
-    SDL_snprintf(fullMessage, sizeof(fullMessage), "%s%s", prefix, message);
+    rcnet_logger_writeMessage(logLevel, file, line, function, message);
+}
 
-    // Utiliser SDL_LogMessageV pour les plateformes natives
-    SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, sdlPriority, "%s", fullMessage);
-}
\ No newline at end of file
+// Arrêt du thread d'écriture à la fin du programme si rcnet_logger_stop_async() n'a pas été appelée
+static struct RCNET_LoggerAsyncGuard
+{
+    ~RCNET_LoggerAsyncGuard() { rcnet_logger_stop_async(); }
+} asyncGuard;
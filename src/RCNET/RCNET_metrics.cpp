@@ -0,0 +1,844 @@
+#include "RCNET/RCNET_metrics.h"
+#include "RCNET/RCNET_engine.h"
+#include "RCNET/RCNET_input_transport.h"
+#include "RCNET/RCNET_logger.h"
+#include "RCNET/RCNET_nats.h"
+#include "RCNET/RCNET_net_shards.h"
+#include "RCNET/RCNET_packet_pool.h"
+#include "RCNET/RCNET_queue.h"
+#include "RCNET/RCNET_redis_cache.h"
+#include "RCNET/RCNET_timer.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// ================================
+// Dependencies Libraries libwebsockets
+// ================================
+#include <libwebsockets.h>
+
+// Content-Type du format texte Prometheus (accepté tel quel par les scrapers OpenMetrics)
+static constexpr const char* kContentType = "text/plain; version=0.0.4; charset=utf-8";
+
+// Taille des morceaux du body envoyés à chaque LWS_CALLBACK_HTTP_WRITEABLE
+static constexpr size_t kHttpChunkBytes = 4096;
+
+// Buffer des en-têtes de la réponse
+static constexpr size_t kHttpHeaderBytes = 512;
+
+// Threads ayant leur propre slot dans chaque RCNET_MetricsCounter (les suivants partagent kCounterThreadSlots)
+static constexpr uint32_t kCounterThreadSlots = 64;
+
+// ======================================================
+// Compteurs par thread
+// ======================================================
+
+// Une cache line par slot : deux threads n'écrivent jamais sur la même ligne
+struct alignas(64) RCNET_MetricsCounterSlot
+{
+    std::atomic<int64_t> value{0};
+};
+
+struct RCNET_MetricsCounter
+{
+    RCNET_MetricsCounterSlot slots[kCounterThreadSlots + 1]; // dernier slot : partagé (fetch_add)
+};
+
+// Index attribué au premier ajout d'un thread, commun à tous les compteurs
+static std::atomic<uint32_t> metricsNextThreadSlot{0};
+static thread_local uint32_t metricsThreadSlot = UINT32_MAX;
+
+static inline uint32_t rcnet_metrics_getThreadSlot(void)
+{
+    uint32_t slot = metricsThreadSlot;
+    if (slot == UINT32_MAX)
+    {
+        slot = std::min(metricsNextThreadSlot.fetch_add(1, std::memory_order_relaxed), kCounterThreadSlots);
+        metricsThreadSlot = slot;
+    }
+    return slot;
+}
+
+RCNET_MetricsCounter* rcnet_metrics_counter_create(void)
+{
+    RCNET_MetricsCounter* counter = new (std::nothrow) RCNET_MetricsCounter();
+    if (counter == NULL)
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_metrics_counter_create: out of memory\n");
+    return counter;
+}
+
+void rcnet_metrics_counter_destroy(RCNET_MetricsCounter* counter)
+{
+    delete counter;
+}
+
+void rcnet_metrics_counter_add(RCNET_MetricsCounter* counter, int64_t delta)
+{
+    uint32_t slot = rcnet_metrics_getThreadSlot();
+    std::atomic<int64_t>& value = counter->slots[slot].value;
+
+    // Slot propre au thread : seul écrivain, pas besoin d'un read-modify-write atomique
+    if (slot < kCounterThreadSlots)
+        value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    else
+        value.fetch_add(delta, std::memory_order_relaxed);
+}
+
+int64_t rcnet_metrics_counter_get(const RCNET_MetricsCounter* counter)
+{
+    int64_t total = 0;
+    for (const RCNET_MetricsCounterSlot& slot : counter->slots)
+        total += slot.value.load(std::memory_order_relaxed);
+    return total;
+}
+
+// ======================================================
+// Writer (format texte Prometheus)
+// ======================================================
+
+struct RCNET_MetricsFamily
+{
+    std::string name;
+    std::string help;
+    RCNET_MetricType type = RCNET_METRIC_GAUGE;
+    std::string samples; // lignes "name{labels} value\n"
+};
+
+// Réutilisé d'un scrape à l'autre (les strings gardent leur capacité)
+struct RCNET_MetricsWriter
+{
+    std::vector<RCNET_MetricsFamily> families; // dans l'ordre de première écriture
+    size_t familyCount = 0;
+    std::unordered_map<std::string, size_t> familyIndex;
+    const char* collectorLabels = nullptr;     // labels du collector en cours
+};
+
+static const char* rcnet_metrics_getTypeName(RCNET_MetricType type)
+{
+    switch (type)
+    {
+        case RCNET_METRIC_COUNTER: return "counter";
+        case RCNET_METRIC_SUMMARY: return "summary";
+        default:                   return "gauge";
+    }
+}
+
+static void rcnet_metrics_beginWrite(RCNET_MetricsWriter& writer)
+{
+    writer.familyCount = 0;
+    writer.familyIndex.clear();
+    writer.collectorLabels = nullptr;
+}
+
+// Famille du nom (créée au premier échantillon), NULL si le nom existe déjà avec un autre type
+static RCNET_MetricsFamily* rcnet_metrics_getFamily(RCNET_MetricsWriter& writer, RCNET_MetricType type, const char* name,
+                                                    const char* help)
+{
+    auto it = writer.familyIndex.find(name);
+    if (it != writer.familyIndex.end())
+    {
+        RCNET_MetricsFamily& family = writer.families[it->second];
+        return (family.type == type) ? &family : NULL;
+    }
+
+    if (writer.familyCount == writer.families.size())
+        writer.families.emplace_back();
+
+    RCNET_MetricsFamily& family = writer.families[writer.familyCount];
+    family.name = name;
+    family.help = (help != NULL) ? help : "";
+    family.type = type;
+    family.samples.clear();
+    writer.familyIndex.emplace(family.name, writer.familyCount++);
+    return &family;
+}
+
+static void rcnet_metrics_appendValue(std::string& out, double value)
+{
+    if (std::isnan(value))
+    {
+        out += "NaN";
+        return;
+    }
+    if (std::isinf(value))
+    {
+        out += (value > 0) ? "+Inf" : "-Inf";
+        return;
+    }
+
+    char text[32];
+    // Entiers (compteurs) écrits sans exposant tant qu'ils sont exacts en double
+    if (value == std::floor(value) && std::fabs(value) < 9007199254740992.0)
+        std::snprintf(text, sizeof(text), "%.0f", value);
+    else
+        std::snprintf(text, sizeof(text), "%.10g", value);
+    out += text;
+}
+
+// name{collectorLabels,labels,extra} value
+static void rcnet_metrics_appendSample(std::string& out, const std::string& name, const char* suffix, const char* collectorLabels,
+                                       const char* labels, const char* extraLabel, double value)
+{
+    out += name;
+    if (suffix != NULL)
+        out += suffix;
+
+    const char* parts[3] = { collectorLabels, labels, extraLabel };
+    bool opened = false;
+    for (const char* part : parts)
+    {
+        if (part == NULL || part[0] == '\0')
+            continue;
+        out += opened ? ',' : '{';
+        out += part;
+        opened = true;
+    }
+    if (opened)
+        out += '}';
+
+    out += ' ';
+    rcnet_metrics_appendValue(out, value);
+    out += '\n';
+}
+
+// HELP : '\' et saut de ligne échappés
+static void rcnet_metrics_appendHelp(std::string& out, const std::string& help)
+{
+    for (char c : help)
+    {
+        if (c == '\\')
+            out += "\\\\";
+        else if (c == '\n')
+            out += "\\n";
+        else
+            out += c;
+    }
+}
+
+static void rcnet_metrics_endWrite(RCNET_MetricsWriter& writer, std::string& out)
+{
+    out.clear();
+    for (size_t i = 0; i < writer.familyCount; ++i)
+    {
+        const RCNET_MetricsFamily& family = writer.families[i];
+        if (!family.help.empty())
+        {
+            out += "# HELP ";
+            out += family.name;
+            out += ' ';
+            rcnet_metrics_appendHelp(out, family.help);
+            out += '\n';
+        }
+        out += "# TYPE ";
+        out += family.name;
+        out += ' ';
+        out += rcnet_metrics_getTypeName(family.type);
+        out += '\n';
+        out += family.samples;
+    }
+}
+
+void rcnet_metrics_write(RCNET_MetricsWriter* writer, RCNET_MetricType type, const char* name, const char* help,
+                         const char* labels, double value)
+{
+    if (writer == NULL || name == NULL || type == RCNET_METRIC_SUMMARY)
+        return;
+
+    RCNET_MetricsFamily* family = rcnet_metrics_getFamily(*writer, type, name, help);
+    if (family != NULL)
+        rcnet_metrics_appendSample(family->samples, family->name, NULL, writer->collectorLabels, labels, NULL, value);
+}
+
+void rcnet_metrics_write_summary(RCNET_MetricsWriter* writer, const char* name, const char* help, const char* labels,
+                                 const RCNET_HistogramSummary* summary, double scale)
+{
+    if (writer == NULL || name == NULL || summary == NULL)
+        return;
+
+    RCNET_MetricsFamily* family = rcnet_metrics_getFamily(*writer, RCNET_METRIC_SUMMARY, name, help);
+    if (family == NULL)
+        return;
+
+    const char* collectorLabels = writer->collectorLabels;
+    std::string& out = family->samples;
+    rcnet_metrics_appendSample(out, family->name, NULL, collectorLabels, labels, "quantile=\"0.5\"", summary->p50 * scale);
+    rcnet_metrics_appendSample(out, family->name, NULL, collectorLabels, labels, "quantile=\"0.9\"", summary->p90 * scale);
+    rcnet_metrics_appendSample(out, family->name, NULL, collectorLabels, labels, "quantile=\"0.99\"", summary->p99 * scale);
+    rcnet_metrics_appendSample(out, family->name, NULL, collectorLabels, labels, "quantile=\"0.999\"", summary->p999 * scale);
+
+    // L'histogramme ne garde pas la somme exacte : moyenne * count
+    double sum = static_cast<double>(summary->mean) * static_cast<double>(summary->count) * scale;
+    rcnet_metrics_appendSample(out, family->name, "_sum", collectorLabels, labels, NULL, sum);
+    rcnet_metrics_appendSample(out, family->name, "_count", collectorLabels, labels, NULL, static_cast<double>(summary->count));
+}
+
+// ======================================================
+// Serveur
+// ======================================================
+
+struct RCNET_MetricsCollector
+{
+    RCNET_MetricsCollectFn collect;
+    void* userdata;
+    std::string labels;
+};
+
+struct RCNET_MetricsCounterEntry
+{
+    RCNET_MetricsCounter* counter;
+    RCNET_MetricType type;
+    std::string name;
+    std::string help;
+    std::string labels;
+};
+
+struct RCNET_MetricsServer
+{
+    std::string bindAddress;
+    std::string path;
+    uint16_t port = 0;
+
+    // Registre + writer : un rendu à la fois (thread HTTP ou rcnet_metrics_server_render)
+    mutable std::mutex mutex;
+    std::vector<RCNET_MetricsCollector> collectors;
+    std::vector<RCNET_MetricsCounterEntry> counters;
+    RCNET_MetricsWriter writer;
+    std::string renderBuffer; // sortie de rcnet_metrics_server_render
+
+    struct lws_context* context = nullptr;
+    std::thread thread;
+    std::atomic<bool> running{false};
+
+    RCNET_Histogram* renderNs = nullptr;
+    std::atomic<uint64_t> scrapes{0};
+    std::atomic<uint64_t> notFound{0};
+    std::atomic<uint64_t> bytesSent{0};
+};
+
+// Mutex du serveur tenu
+static void rcnet_metrics_renderLocked(RCNET_MetricsServer* server, std::string& out)
+{
+    uint64_t startNs = rcnet_timer_get_time_ns();
+    RCNET_MetricsWriter& writer = server->writer;
+    rcnet_metrics_beginWrite(writer);
+
+    for (const RCNET_MetricsCollector& collector : server->collectors)
+    {
+        writer.collectorLabels = collector.labels.empty() ? nullptr : collector.labels.c_str();
+        collector.collect(&writer, collector.userdata);
+    }
+    writer.collectorLabels = nullptr;
+
+    for (const RCNET_MetricsCounterEntry& entry : server->counters)
+        rcnet_metrics_write(&writer, entry.type, entry.name.c_str(), entry.help.empty() ? NULL : entry.help.c_str(),
+                            entry.labels.empty() ? NULL : entry.labels.c_str(),
+                            static_cast<double>(rcnet_metrics_counter_get(entry.counter)));
+
+    uint64_t scrapes = server->scrapes.fetch_add(1, std::memory_order_relaxed) + 1;
+    rcnet_metrics_write(&writer, RCNET_METRIC_COUNTER, "rcnet_metrics_scrapes_total", "Metrics renders", NULL,
+                        static_cast<double>(scrapes));
+
+    rcnet_metrics_endWrite(writer, out);
+    rcnet_histogram_record(server->renderNs, rcnet_timer_get_time_ns() - startNs);
+}
+
+// ======================================================
+// Endpoint HTTP (libwebsockets)
+// ======================================================
+
+// Données par connexion (allouées à zéro par libwebsockets)
+struct RCNET_MetricsHttpSession
+{
+    std::string* body; // réutilisé par les requêtes keep-alive de la connexion
+    size_t sent;
+    bool sending;
+};
+
+static int rcnet_metrics_httpCallback(struct lws* wsi, enum lws_callback_reasons reason, void* user, void* in, size_t len)
+{
+    RCNET_MetricsHttpSession* session = static_cast<RCNET_MetricsHttpSession*>(user);
+
+    switch (reason)
+    {
+        case LWS_CALLBACK_HTTP:
+        {
+            RCNET_MetricsServer* server = static_cast<RCNET_MetricsServer*>(lws_context_user(lws_get_context(wsi)));
+            const char* uri = static_cast<const char*>(in);
+            if (uri == NULL || server->path != uri)
+            {
+                server->notFound.fetch_add(1, std::memory_order_relaxed);
+                lws_return_http_status(wsi, HTTP_STATUS_NOT_FOUND, NULL);
+                return lws_http_transaction_completed(wsi) ? -1 : 0;
+            }
+
+            if (session->body == NULL)
+            {
+                session->body = new (std::nothrow) std::string();
+                if (session->body == NULL)
+                    return -1;
+            }
+            {
+                std::lock_guard<std::mutex> lock(server->mutex);
+                rcnet_metrics_renderLocked(server, *session->body);
+            }
+            session->sent = 0;
+
+            // Taille connue : Content-Length plutôt qu'un envoi chunked
+            uint8_t headers[LWS_PRE + kHttpHeaderBytes];
+            uint8_t* start = headers + LWS_PRE;
+            uint8_t* p = start;
+            uint8_t* end = headers + sizeof(headers) - 1;
+            if (lws_add_http_common_headers(wsi, HTTP_STATUS_OK, kContentType, session->body->size(), &p, end) != 0
+                || lws_finalize_write_http_header(wsi, start, &p, end) != 0)
+                return 1;
+
+            session->sending = true;
+            lws_callback_on_writable(wsi);
+            return 0;
+        }
+
+        case LWS_CALLBACK_HTTP_WRITEABLE:
+        {
+            if (session == NULL || !session->sending)
+                break;
+
+            RCNET_MetricsServer* server = static_cast<RCNET_MetricsServer*>(lws_context_user(lws_get_context(wsi)));
+            const std::string& body = *session->body;
+            size_t remaining = body.size() - session->sent;
+            size_t chunkLength = std::min(remaining, kHttpChunkBytes);
+            bool last = (chunkLength == remaining);
+
+            // lws_write a besoin de LWS_PRE octets libres devant les données
+            uint8_t chunk[LWS_PRE + kHttpChunkBytes];
+            std::memcpy(chunk + LWS_PRE, body.data() + session->sent, chunkLength);
+            int written = lws_write(wsi, chunk + LWS_PRE, chunkLength, last ? LWS_WRITE_HTTP_FINAL : LWS_WRITE_HTTP);
+            if (written != static_cast<int>(chunkLength))
+                return 1;
+
+            session->sent += chunkLength;
+            server->bytesSent.fetch_add(chunkLength, std::memory_order_relaxed);
+            if (!last)
+            {
+                lws_callback_on_writable(wsi);
+                return 0;
+            }
+
+            session->sending = false;
+            return lws_http_transaction_completed(wsi) ? -1 : 0;
+        }
+
+        case LWS_CALLBACK_HTTP_DROP_PROTOCOL:
+        case LWS_CALLBACK_CLOSED_HTTP:
+            if (session != NULL)
+            {
+                delete session->body;
+                session->body = NULL;
+                session->sending = false;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return lws_callback_http_dummy(wsi, reason, user, in, len);
+}
+
+// Sans mount, toutes les requêtes HTTP vont au premier protocole
+static const struct lws_protocols kMetricsProtocols[] = {
+    { "http", rcnet_metrics_httpCallback, sizeof(RCNET_MetricsHttpSession), 0, 0, NULL, 0 },
+    { NULL, NULL, 0, 0, 0, NULL, 0 }
+};
+
+static void rcnet_metrics_lwsLog(int level, const char* line)
+{
+    RCNET_log((level & LLL_ERR) ? RCNET_LOG_ERROR : RCNET_LOG_WARN, "libwebsockets: %s", line);
+}
+
+static void rcnet_metrics_threadMain(RCNET_MetricsServer* server)
+{
+    // Réveillé par lws_cancel_service à la destruction
+    while (server->running.load(std::memory_order_acquire))
+    {
+        if (lws_service(server->context, 0) < 0)
+            break;
+    }
+}
+
+void rcnet_metrics_server_get_default_config(RCNET_MetricsServerConfig* outConfig)
+{
+    if (outConfig == NULL)
+        return;
+
+    outConfig->bindAddress = NULL;
+    outConfig->port = 9464;
+    outConfig->path = "/metrics";
+}
+
+RCNET_MetricsServer* rcnet_metrics_server_create(const RCNET_MetricsServerConfig* config)
+{
+    RCNET_MetricsServerConfig defaultConfig;
+    if (config == NULL)
+    {
+        rcnet_metrics_server_get_default_config(&defaultConfig);
+        config = &defaultConfig;
+    }
+
+    if (config->path == NULL || config->path[0] != '/')
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_metrics_server_create: path must start with '/'\n");
+        return NULL;
+    }
+
+    RCNET_MetricsServer* server = new (std::nothrow) RCNET_MetricsServer();
+    if (server == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_metrics_server_create: out of memory\n");
+        return NULL;
+    }
+
+    server->bindAddress = (config->bindAddress != NULL) ? config->bindAddress : "";
+    server->path = config->path;
+    server->port = config->port;
+    server->renderNs = rcnet_histogram_create();
+    if (server->renderNs == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_metrics_server_create: out of memory\n");
+        rcnet_metrics_server_destroy(server);
+        return NULL;
+    }
+
+    if (server->port == 0)
+        return server;
+
+    lws_set_log_level(LLL_ERR | LLL_WARN, rcnet_metrics_lwsLog);
+
+    struct lws_context_creation_info info;
+    std::memset(&info, 0, sizeof(info));
+    info.port = server->port;
+    info.iface = server->bindAddress.empty() ? NULL : server->bindAddress.c_str();
+    info.protocols = kMetricsProtocols;
+    info.user = server;
+
+    server->context = lws_create_context(&info);
+    if (server->context == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_metrics_server_create: cannot listen on %s:%u\n",
+                  server->bindAddress.empty() ? "*" : server->bindAddress.c_str(), server->port);
+        rcnet_metrics_server_destroy(server);
+        return NULL;
+    }
+
+    server->running.store(true, std::memory_order_release);
+    server->thread = std::thread(rcnet_metrics_threadMain, server);
+
+    RCNET_log(RCNET_LOG_INFO, "rcnet_metrics_server_create: serving http://%s:%u%s\n",
+              server->bindAddress.empty() ? "*" : server->bindAddress.c_str(), server->port, server->path.c_str());
+    return server;
+}
+
+void rcnet_metrics_server_destroy(RCNET_MetricsServer* server)
+{
+    if (server == NULL)
+        return;
+
+    if (server->context != NULL)
+    {
+        server->running.store(false, std::memory_order_release);
+        lws_cancel_service(server->context);
+        if (server->thread.joinable())
+            server->thread.join();
+
+        // Ferme les connexions restantes (LWS_CALLBACK_CLOSED_HTTP libère leurs bodies)
+        lws_context_destroy(server->context);
+        server->context = nullptr;
+    }
+
+    rcnet_histogram_destroy(server->renderNs);
+    delete server;
+}
+
+bool rcnet_metrics_server_add_collector(RCNET_MetricsServer* server, RCNET_MetricsCollectFn collect, void* userdata,
+                                        const char* labels)
+{
+    if (server == NULL || collect == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_metrics_server_add_collector: invalid parameters\n");
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(server->mutex);
+    server->collectors.push_back(RCNET_MetricsCollector{ collect, userdata, (labels != NULL) ? labels : "" });
+    return true;
+}
+
+bool rcnet_metrics_server_remove_collector(RCNET_MetricsServer* server, RCNET_MetricsCollectFn collect, void* userdata)
+{
+    if (server == NULL)
+        return false;
+
+    std::lock_guard<std::mutex> lock(server->mutex);
+    auto it = std::find_if(server->collectors.begin(), server->collectors.end(), [&](const RCNET_MetricsCollector& collector) {
+        return collector.collect == collect && collector.userdata == userdata;
+    });
+    if (it == server->collectors.end())
+        return false;
+
+    server->collectors.erase(it);
+    return true;
+}
+
+bool rcnet_metrics_server_add_counter(RCNET_MetricsServer* server, RCNET_MetricsCounter* counter, RCNET_MetricType type,
+                                      const char* name, const char* help, const char* labels)
+{
+    if (server == NULL || counter == NULL || name == NULL || name[0] == '\0' || type == RCNET_METRIC_SUMMARY)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_metrics_server_add_counter: invalid parameters\n");
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(server->mutex);
+    server->counters.push_back(RCNET_MetricsCounterEntry{ counter, type, name, (help != NULL) ? help : "", (labels != NULL) ? labels : "" });
+    return true;
+}
+
+bool rcnet_metrics_server_remove_counter(RCNET_MetricsServer* server, RCNET_MetricsCounter* counter)
+{
+    if (server == NULL)
+        return false;
+
+    std::lock_guard<std::mutex> lock(server->mutex);
+    auto it = std::find_if(server->counters.begin(), server->counters.end(), [&](const RCNET_MetricsCounterEntry& entry) {
+        return entry.counter == counter;
+    });
+    if (it == server->counters.end())
+        return false;
+
+    server->counters.erase(it);
+    return true;
+}
+
+size_t rcnet_metrics_server_render(RCNET_MetricsServer* server, char* outBuffer, size_t capacity)
+{
+    if (server == NULL)
+        return 0;
+
+    std::lock_guard<std::mutex> lock(server->mutex);
+    rcnet_metrics_renderLocked(server, server->renderBuffer);
+
+    const std::string& text = server->renderBuffer;
+    if (outBuffer != NULL && capacity > 0)
+    {
+        size_t copied = std::min(text.size(), capacity - 1);
+        std::memcpy(outBuffer, text.data(), copied);
+        outBuffer[copied] = '\0';
+    }
+    return text.size();
+}
+
+void rcnet_metrics_server_get_stats(const RCNET_MetricsServer* server, RCNET_MetricsServerStats* outStats)
+{
+    if (outStats == NULL)
+        return;
+
+    std::memset(outStats, 0, sizeof(*outStats));
+    if (server == NULL)
+        return;
+
+    outStats->scrapes   = server->scrapes.load(std::memory_order_relaxed);
+    outStats->notFound  = server->notFound.load(std::memory_order_relaxed);
+    outStats->bytesSent = server->bytesSent.load(std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(server->mutex);
+        outStats->collectors = static_cast<uint32_t>(server->collectors.size());
+        outStats->counters   = static_cast<uint32_t>(server->counters.size());
+    }
+    rcnet_histogram_get_summary(server->renderNs, &outStats->renderNs);
+}
+
+// ======================================================
+// Collectors des modules RCNET
+// ======================================================
+
+static constexpr double kNsToSeconds = 1e-9;
+static constexpr double kMsToSeconds = 1e-3;
+
+void rcnet_metrics_collect_engine(RCNET_MetricsWriter* writer, void* userdata)
+{
+    (void)userdata;
+
+    RCNET_EngineStats stats;
+    if (!rcnet_engine_get_stats(&stats))
+        return;
+
+    static const char* const kSim = "loop=\"sim\"";
+    static const char* const kNet = "loop=\"net\"";
+
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_engine_ticks_total", "Ticks executed", kSim, static_cast<double>(stats.simTickCount));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_engine_ticks_total", NULL, kNet, static_cast<double>(stats.netTickCount));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_engine_catch_up_ticks_total", "Catch-up ticks (beyond the first of a loop iteration)", kSim, static_cast<double>(stats.simCatchUpTicks));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_engine_catch_up_ticks_total", NULL, kNet, static_cast<double>(stats.netCatchUpTicks));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_engine_backlog_drops_total", "Backlogs dropped (catch-up limit reached)", kSim, static_cast<double>(stats.simBacklogDrops));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_engine_backlog_drops_total", NULL, kNet, static_cast<double>(stats.netBacklogDrops));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_engine_backlog_dropped_seconds_total", "Backlog time dropped", kSim, stats.simBacklogDroppedNs * kNsToSeconds);
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_engine_backlog_dropped_seconds_total", NULL, kNet, stats.netBacklogDroppedNs * kNsToSeconds);
+
+    rcnet_metrics_write_summary(writer, "rcnet_engine_update_seconds", "Tick callback duration", kSim, &stats.simUpdateNs, kNsToSeconds);
+    rcnet_metrics_write_summary(writer, "rcnet_engine_update_seconds", NULL, kNet, &stats.netUpdateNs, kNsToSeconds);
+    rcnet_metrics_write_summary(writer, "rcnet_engine_sim_ticks_per_loop", "Simulation ticks per loop iteration", NULL, &stats.simTicksPerLoop, 1.0);
+    rcnet_metrics_write_summary(writer, "rcnet_engine_sleep_overshoot_seconds", "Wake-up delay after the deadline", NULL, &stats.sleepOvershootNs, kNsToSeconds);
+    rcnet_metrics_write_summary(writer, "rcnet_engine_sleep_spin_seconds", "Spin time before the deadline", NULL, &stats.sleepSpinNs, kNsToSeconds);
+
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_engine_spin_margin_seconds", "Learned spin margin", NULL, stats.spinMarginNs * kNsToSeconds);
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_engine_idle_wakeups_total", "Idle wake-ups", NULL, static_cast<double>(stats.idleWakeups));
+
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_engine_peers", "Connected clients", NULL, stats.peerCount);
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_engine_congested_peers", "Congested clients", NULL, stats.congestedPeerCount);
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_engine_peer_rtt_avg_seconds", "Average client RTT", NULL, stats.peerRttAvgMs * kMsToSeconds);
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_engine_peer_rtt_max_seconds", "Max client RTT", NULL, stats.peerRttMaxMs * kMsToSeconds);
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_engine_peer_sent_bytes_per_second", "Sent rate, all clients", NULL, static_cast<double>(stats.peerSentBytesPerSecond));
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_engine_peer_estimated_bytes_per_second", "Estimated delivered rate, all clients", NULL, static_cast<double>(stats.peerEstimatedBytesPerSecond));
+}
+
+void rcnet_metrics_collect_net_shards(RCNET_MetricsWriter* writer, void* userdata)
+{
+    const RCNET_NetShards* shards = static_cast<const RCNET_NetShards*>(userdata);
+    if (shards == NULL)
+        return;
+
+    uint32_t connected = 0;
+    uint32_t maxClients = rcnet_net_shards_get_max_clients(shards);
+    for (uint32_t clientId = 0; clientId < maxClients; ++clientId)
+    {
+        RCNET_NetPeerStats peer;
+        if (!rcnet_net_shards_get_peer_stats(shards, clientId, &peer))
+            continue;
+
+        connected++;
+        char labels[32];
+        std::snprintf(labels, sizeof(labels), "client=\"%u\"", clientId);
+
+        rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_net_peer_rtt_seconds", "Smoothed RTT (ENet)", labels, peer.roundTripTimeMs * kMsToSeconds);
+        rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_net_peer_rtt_variance_seconds", "RTT variance (ENet)", labels, peer.roundTripTimeVarianceMs * kMsToSeconds);
+        rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_net_peer_min_rtt_seconds", "Lowest RTT since connection", labels, peer.minRoundTripTimeMs * kMsToSeconds);
+        rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_net_peer_packet_loss_ratio", "Packet loss estimated by ENet", labels, peer.packetLoss);
+        rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_net_peer_queued_commands", "Commands queued in ENet", labels, peer.queuedCommands);
+        rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_net_peer_reliable_bytes_in_transit", "Reliable bytes not yet acknowledged", labels, peer.reliableBytesInTransit);
+        rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_net_peer_sent_bytes_per_second", "Sent rate", labels, peer.sentBytesPerSecond);
+        rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_net_peer_estimated_bytes_per_second", "Estimated delivered rate", labels, peer.estimatedBytesPerSecond);
+        rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_net_peer_sent_bytes_total", "Bytes sent since connection", labels, static_cast<double>(peer.sentBytes));
+        rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_net_peer_congested", "Congested at the last sample", labels, peer.congested ? 1.0 : 0.0);
+        rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_net_peer_payload_budget_bytes", "Recommended payload budget per snapshot", labels, peer.payloadBudgetBytes);
+    }
+
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_net_peers", "Connected clients", NULL, connected);
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_net_send_overflow_total", "Sends refused (send queue full)", NULL,
+                        static_cast<double>(rcnet_net_shards_get_send_overflow_count(shards)));
+}
+
+void rcnet_metrics_collect_input_receiver(RCNET_MetricsWriter* writer, void* userdata)
+{
+    const RCNET_InputReceiver* receiver = static_cast<const RCNET_InputReceiver*>(userdata);
+    if (receiver == NULL)
+        return;
+
+    RCNET_InputReceiverStats stats;
+    rcnet_input_receiver_get_stats(receiver, &stats);
+
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_input_packets_total", "Input packets decoded", NULL, static_cast<double>(stats.packets));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_input_invalid_packets_total", "Input packets rejected", NULL, static_cast<double>(stats.invalidPackets));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_input_inputs_total", "Inputs decoded, redundant included", NULL, static_cast<double>(stats.inputs));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_input_accepted_total", "New inputs", NULL, static_cast<double>(stats.accepted));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_input_redundant_total", "Inputs already received", NULL, static_cast<double>(stats.redundant));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_input_recovered_total", "Inputs recovered through redundancy", NULL, static_cast<double>(stats.recovered));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_input_late_packets_total", "Packets targeting a past tick", NULL, static_cast<double>(stats.late));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_input_resyncs_total", "Client tick offset resyncs", NULL, static_cast<double>(stats.resyncs));
+}
+
+void rcnet_metrics_collect_ring_queue(RCNET_MetricsWriter* writer, void* userdata)
+{
+    const RCNET_RingQueue* queue = static_cast<const RCNET_RingQueue*>(userdata);
+    if (queue == NULL)
+        return;
+
+    RCNET_RingQueueStats stats;
+    rcnet_ring_queue_get_stats(queue, &stats);
+
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_queue_depth", "Pending elements", NULL, stats.size);
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_queue_capacity", "Capacity", NULL, stats.capacity);
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_queue_pushed_total", "Elements pushed", NULL, static_cast<double>(stats.pushed));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_queue_popped_total", "Elements popped", NULL, static_cast<double>(stats.popped));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_queue_dropped_total", "Pushes refused (queue full)", NULL, static_cast<double>(stats.overflowed));
+}
+
+void rcnet_metrics_collect_nats_publisher(RCNET_MetricsWriter* writer, void* userdata)
+{
+    const RCNET_NATSAsyncPublisher* publisher = static_cast<const RCNET_NATSAsyncPublisher*>(userdata);
+    if (publisher == NULL)
+        return;
+
+    RCNET_NATSAsyncPublisherStats stats;
+    rcnet_nats_async_publisher_get_stats(publisher, &stats);
+
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_nats_published_total", "Messages accepted by the publisher", NULL, static_cast<double>(stats.published));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_nats_acked_total", "JetStream messages acknowledged", NULL, static_cast<double>(stats.acked));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_nats_failed_total", "Messages failed", NULL, static_cast<double>(stats.failed));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_nats_dropped_total", "Messages refused (buffer full)", NULL, static_cast<double>(stats.dropped));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_nats_expired_total", "JetStream messages not acknowledged before the ack timeout", NULL, static_cast<double>(stats.expired));
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_nats_pending_acks", "JetStream messages awaiting acknowledgement", NULL, stats.inFlight);
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_nats_queued", "Messages not sent yet", NULL, stats.queued);
+    rcnet_metrics_write_summary(writer, "rcnet_nats_ack_latency_seconds", "Publish to acknowledgement latency", NULL,
+                                &stats.ackLatencyNs, kNsToSeconds);
+}
+
+void rcnet_metrics_collect_redis_cache(RCNET_MetricsWriter* writer, void* userdata)
+{
+    const RCNET_RedisCache* cache = static_cast<const RCNET_RedisCache*>(userdata);
+    if (cache == NULL)
+        return;
+
+    RCNET_RedisCacheStats stats;
+    rcnet_redis_cache_get_stats(cache, &stats);
+
+    uint64_t reads = stats.hits + stats.misses;
+    double hitRatio = (reads > 0) ? static_cast<double>(stats.hits) / static_cast<double>(reads) : 0.0;
+
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_redis_cache_hits_total", "Reads served by the cache", NULL, static_cast<double>(stats.hits));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_redis_cache_misses_total", "Reads sent to Redis", NULL, static_cast<double>(stats.misses));
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_redis_cache_hit_ratio", "hits / (hits + misses) since creation", NULL, hitRatio);
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_redis_cache_coalesced_total", "Reads attached to a pending GET", NULL, static_cast<double>(stats.coalesced));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_redis_cache_evictions_total", "Entries evicted", NULL, static_cast<double>(stats.evictions));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_redis_cache_expirations_total", "Entries expired", NULL, static_cast<double>(stats.expirations));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_redis_cache_invalidations_total", "Entries invalidated", NULL, static_cast<double>(stats.invalidations));
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_redis_cache_entries", "Cached entries", NULL, stats.entries);
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_redis_cache_bytes", "Bytes used", NULL, static_cast<double>(stats.bytes));
+}
+
+void rcnet_metrics_collect_packet_pool(RCNET_MetricsWriter* writer, void* userdata)
+{
+    const RCNET_PacketPool* pool = static_cast<const RCNET_PacketPool*>(userdata);
+    if (pool == NULL)
+        return;
+
+    RCNET_PacketPoolStats stats;
+    rcnet_packet_pool_get_stats(pool, &stats);
+
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_packet_pool_acquired_total", "Buffers acquired", NULL, static_cast<double>(stats.acquired));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_packet_pool_released_total", "Buffers released", NULL, static_cast<double>(stats.released));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_packet_pool_heap_allocations_total", "Buffers allocated on the heap", NULL, static_cast<double>(stats.heapAllocations));
+    rcnet_metrics_write(writer, RCNET_METRIC_COUNTER, "rcnet_packet_pool_oversized_total", "Requests larger than the largest class", NULL, static_cast<double>(stats.oversized));
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_packet_pool_outstanding", "Buffers held by packets in flight", NULL, stats.outstanding);
+    rcnet_metrics_write(writer, RCNET_METRIC_GAUGE, "rcnet_packet_pool_cached_bytes", "Bytes of free buffers kept", NULL, static_cast<double>(stats.cachedBytes));
+}
@@ -1,9 +1,24 @@
 #include "RCNET/RCNET_nats.h"
 #include "RCNET/RCNET_logger.h"
+#include "RCNET/RCNET_compression.h"
+#include "RCNET/RCNET_timer.h"
 
 // Standard C libraries
 #include <string.h>
 
+// Standard C++ libraries
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 static natsStatus customSignatureHandler(char **customErrTxt, unsigned char **signature, int *signatureLength, const char *nonce, void *closure)
 {
     const char *seed = (const char*) closure;
@@ -16,6 +31,170 @@ static natsStatus customSignatureHandler(char **customErrTxt, unsigned char **si
     return status;
 }
 
+// ======================================================
+// Registre des abonnements
+// ======================================================
+
+// Capacité initiale du registre (doublée ensuite)
+static const size_t kInitialSubscriptionCapacity = 16;
+
+static RCNET_NATSSubscriptionHandle rcnet_nats_makeHandle(uint32_t slot, uint32_t generation)
+{
+    return ((RCNET_NATSSubscriptionHandle)generation << 32) | slot;
+}
+
+static int rcnet_nats_growSubscriptions(RCNET_NATSClient *client)
+{
+    size_t newCapacity = (client->subscriptionCapacity == 0) ? kInitialSubscriptionCapacity : client->subscriptionCapacity * 2;
+    if (newCapacity > UINT32_MAX) {
+        RCNET_log(RCNET_LOG_ERROR, "Too many NATS subscriptions\n");
+        return -1;
+    }
+
+    natsSubscription **subscriptions = (natsSubscription **)realloc(client->subscriptions, newCapacity * sizeof(natsSubscription*));
+    if (subscriptions == NULL) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to allocate memory for new subscription\n");
+        return -1;
+    }
+    client->subscriptions = subscriptions;
+
+    uint32_t *generations = (uint32_t *)realloc(client->subscriptionGenerations, newCapacity * sizeof(uint32_t));
+    if (generations == NULL) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to allocate memory for new subscription\n");
+        return -1;
+    }
+    client->subscriptionGenerations = generations;
+
+    uint32_t *freeSlots = (uint32_t *)realloc(client->freeSubscriptionSlots, newCapacity * sizeof(uint32_t));
+    if (freeSlots == NULL) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to allocate memory for new subscription\n");
+        return -1;
+    }
+    client->freeSubscriptionSlots = freeSlots;
+
+    for (size_t i = client->subscriptionCapacity; i < newCapacity; i++) {
+        client->subscriptions[i] = NULL;
+        client->subscriptionGenerations[i] = 1;
+    }
+    client->subscriptionCapacity = newCapacity;
+    return 0;
+}
+
+static int rcnet_nats_registerSubscription(RCNET_NATSClient *client, natsSubscription *subscription, RCNET_NATSSubscriptionHandle *outHandle)
+{
+    uint32_t slot;
+    if (client->freeSubscriptionSlotCount > 0) {
+        slot = client->freeSubscriptionSlots[--client->freeSubscriptionSlotCount];
+    } else {
+        if (client->subscriptionCount == client->subscriptionCapacity && rcnet_nats_growSubscriptions(client) != 0)
+            return -1;
+        slot = (uint32_t)client->subscriptionCount++;
+    }
+
+    client->subscriptions[slot] = subscription;
+    if (outHandle != NULL)
+        *outHandle = rcnet_nats_makeHandle(slot, client->subscriptionGenerations[slot]);
+    return 0;
+}
+
+// Slot du handle, ou -1 si le handle ne désigne pas un abonnement actif
+static int64_t rcnet_nats_findSubscription(const RCNET_NATSClient *client, RCNET_NATSSubscriptionHandle handle)
+{
+    const uint32_t slot = (uint32_t)(handle & 0xFFFFFFFFu);
+    const uint32_t generation = (uint32_t)(handle >> 32);
+
+    if (client == NULL || handle == RCNET_NATS_INVALID_SUBSCRIPTION || slot >= client->subscriptionCount
+        || client->subscriptions[slot] == NULL || client->subscriptionGenerations[slot] != generation)
+        return -1;
+
+    return slot;
+}
+
+int rcnet_nats_unsubscribe(RCNET_NATSClient *client, RCNET_NATSSubscriptionHandle handle)
+{
+    const int64_t found = rcnet_nats_findSubscription(client, handle);
+    if (found < 0) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to unsubscribe: invalid subscription handle\n");
+        return -1;
+    }
+    const uint32_t slot = (uint32_t)found;
+
+    natsStatus status = natsSubscription_Unsubscribe(client->subscriptions[slot]);
+    if (status != NATS_OK) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to unsubscribe: %s\n", natsStatus_GetText(status));
+    }
+    natsSubscription_Destroy(client->subscriptions[slot]);
+
+    // Slot libéré : la génération suivante invalide tous les handles existants (jamais 0)
+    client->subscriptions[slot] = NULL;
+    if (++client->subscriptionGenerations[slot] == 0)
+        client->subscriptionGenerations[slot] = 1;
+    client->freeSubscriptionSlots[client->freeSubscriptionSlotCount++] = slot;
+
+    return 0;
+}
+
+// Fin d'un abonnement, signalée par le thread de livraison NATS après le dernier message.
+// Partagée entre l'appelant et le callback : après un timeout, l'appelant rend la main et
+// le callback, s'il arrive un jour, libère la dernière référence.
+struct RCNET_NATSUnsubscribeCompletion
+{
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool done = false;
+};
+
+static void rcnet_nats_unsubscribeCompleted(void *closure)
+{
+    std::shared_ptr<RCNET_NATSUnsubscribeCompletion> *reference = (std::shared_ptr<RCNET_NATSUnsubscribeCompletion>*)closure;
+    std::shared_ptr<RCNET_NATSUnsubscribeCompletion> completion = std::move(*reference);
+    delete reference;
+
+    std::lock_guard<std::mutex> lock(completion->mutex);
+    completion->done = true;
+    completion->condition.notify_all();
+}
+
+int rcnet_nats_unsubscribe_and_wait(RCNET_NATSClient *client, RCNET_NATSSubscriptionHandle handle, int timeoutMs)
+{
+    const int64_t slot = rcnet_nats_findSubscription(client, handle);
+    if (slot < 0) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to unsubscribe: invalid subscription handle\n");
+        return -1;
+    }
+
+    std::shared_ptr<RCNET_NATSUnsubscribeCompletion> completion = std::make_shared<RCNET_NATSUnsubscribeCompletion>();
+    std::shared_ptr<RCNET_NATSUnsubscribeCompletion> *reference = new (std::nothrow) std::shared_ptr<RCNET_NATSUnsubscribeCompletion>(completion);
+    if (reference == NULL) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to allocate NATS unsubscribe completion\n");
+        rcnet_nats_unsubscribe(client, handle);
+        return -2;
+    }
+
+    natsStatus status = natsSubscription_SetOnCompleteCB(client->subscriptions[slot], rcnet_nats_unsubscribeCompleted, reference);
+    if (status != NATS_OK) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to set NATS subscription completion callback: %s\n", natsStatus_GetText(status));
+        delete reference;
+        rcnet_nats_unsubscribe(client, handle);
+        return -2;
+    }
+
+    rcnet_nats_unsubscribe(client, handle);
+
+    std::unique_lock<std::mutex> lock(completion->mutex);
+    if (!completion->condition.wait_for(lock, std::chrono::milliseconds(timeoutMs), [&]() { return completion->done; })) {
+        RCNET_log(RCNET_LOG_WARN, "Unsubscribe: subscription did not complete within %d ms\n", timeoutMs);
+        return -2;
+    }
+
+    return 0;
+}
+
+size_t rcnet_nats_get_subscription_count(const RCNET_NATSClient *client)
+{
+    return (client != NULL) ? client->subscriptionCount - client->freeSubscriptionSlotCount : 0;
+}
+
 int rcnet_nats_initialize(RCNET_NATSClient *client, const char *natsServerURL, const char *certFile, const char *keyFile, const char *caFile, bool skipVerifyCertsServer, const char *publicKeyNKey, void *privateKeySeedNKey)
 {
     natsStatus status;
@@ -111,9 +290,13 @@ int rcnet_nats_initialize(RCNET_NATSClient *client, const char *natsServerURL, c
         return -1;
     }
 
-    // Initialiser les abonnements
+    // Initialiser le registre des abonnements
     client->subscriptions = NULL;
     client->subscriptionCount = 0;
+    client->subscriptionCapacity = 0;
+    client->subscriptionGenerations = NULL;
+    client->freeSubscriptionSlots = NULL;
+    client->freeSubscriptionSlotCount = 0;
 
     // Destroy the options
     natsOptions_Destroy(opts);    
@@ -131,6 +314,15 @@ void rcnet_nats_cleanup(RCNET_NATSClient *client)
         }
         free(client->subscriptions);
     }
+    free(client->subscriptionGenerations);
+    free(client->freeSubscriptionSlots);
+
+    client->subscriptions = NULL;
+    client->subscriptionCount = 0;
+    client->subscriptionCapacity = 0;
+    client->subscriptionGenerations = NULL;
+    client->freeSubscriptionSlots = NULL;
+    client->freeSubscriptionSlotCount = 0;
 
     if (client->jetStreamContext != NULL) {
         jsCtx_Destroy(client->jetStreamContext);
@@ -168,13 +360,43 @@ int rcnet_nats_publish(RCNET_NATSClient *client, const char *subject, const void
         return -1;
     }
 
-    // Log success
-    RCNET_log(RCNET_LOG_INFO, "Published message on subject: %s\n", subject);
+    // Pas de log en cas de succès (chemin appelé à chaque message)
+    return 0;
+}
+
+int rcnet_nats_publish_compressed(RCNET_NATSClient *client, const char *subject, const void* data, int dataLength, size_t minCompressSize)
+{
+    if (dataLength < 0) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to publish compressed message: invalid length\n");
+        return -1;
+    }
+
+    // Buffer de travail par thread : pas d'allocation par message une fois la taille max atteinte
+    thread_local std::vector<unsigned char> scratch;
+    const size_t capacity = rcnet_compression_get_max_output_size(static_cast<size_t>(dataLength));
+    if (capacity == 0) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to publish compressed message: payload too large\n");
+        return -1;
+    }
+    if (scratch.size() < capacity)
+        scratch.resize(capacity);
+
+    const size_t size = rcnet_compression_compress_block(data, static_cast<size_t>(dataLength), scratch.data(), scratch.size(), minCompressSize, 1);
+    if (size == 0) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to compress message for subject: %s\n", subject);
+        return -1;
+    }
+
+    natsStatus status = natsConnection_Publish(client->connection, subject, scratch.data(), static_cast<int>(size));
+    if (status != NATS_OK) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to publish compressed message: %s\n", natsStatus_GetText(status));
+        return -1;
+    }
 
     return 0;
 }
 
-int rcnet_nats_subscribe(RCNET_NATSClient *client, const char *subject, natsMsgHandler messageHandler, void *closure)
+int rcnet_nats_subscribe(RCNET_NATSClient *client, const char *subject, natsMsgHandler messageHandler, void *closure, RCNET_NATSSubscriptionHandle *outHandle)
 {
     // Créer un nouvel abonnement
     natsSubscription *newSubscription = NULL;
@@ -188,20 +410,13 @@ int rcnet_nats_subscribe(RCNET_NATSClient *client, const char *subject, natsMsgH
         return -1;
     }
 
-    // Redimensionner le tableau d'abonnements
-    natsSubscription **newSubscriptions = (natsSubscription **)realloc(client->subscriptions, (client->subscriptionCount + 1) * sizeof(natsSubscription*));
-    if (newSubscriptions == NULL) {
-        RCNET_log(RCNET_LOG_ERROR, "Failed to allocate memory for new subscription\n");
+    // Ranger l'abonnement dans le registre (slot libre réutilisé, ou capacité doublée)
+    if (rcnet_nats_registerSubscription(client, newSubscription, outHandle) != 0) {
+        natsSubscription_Unsubscribe(newSubscription);
         natsSubscription_Destroy(newSubscription);
         return -1;
     }
 
-    // Mise à jour du tableau d'abonnements
-    client->subscriptions = newSubscriptions;
-
-    // Ajouter le nouvel abonnement au tableau
-    client->subscriptions[client->subscriptionCount++] = newSubscription;
-
     // Log success
     RCNET_log(RCNET_LOG_INFO, "Subscribed to subject: %s\n", subject);
 
@@ -232,13 +447,11 @@ int rcnet_nats_jetstream_publish(RCNET_NATSClient *client, const char *subject,
     // Détruire l'accusé de réception JetStream
     jsPubAck_Destroy(jetStreamPubAck);
 
-    // Log success
-    RCNET_log(RCNET_LOG_INFO, "Published JetStream message on subject: %s\n", subject);
-
+    // Pas de log en cas de succès (chemin appelé à chaque message)
     return 0;
 }
 
-int rcnet_nats_jetstream_subscribe(RCNET_NATSClient *client, const char *subject, natsMsgHandler messageHandler, void *closure, RCNET_JetStreamSubscribeOptions *options)
+int rcnet_nats_jetstream_subscribe(RCNET_NATSClient *client, const char *subject, natsMsgHandler messageHandler, void *closure, RCNET_JetStreamSubscribeOptions *options, RCNET_NATSSubscriptionHandle *outHandle)
 {
     natsStatus status;
     jsErrCode jetStreamErrorCode;
@@ -262,26 +475,136 @@ int rcnet_nats_jetstream_subscribe(RCNET_NATSClient *client, const char *subject
         return -1;
     }
 
-    // Redimensionner le tableau d'abonnements
-    natsSubscription **newSubscriptions = (natsSubscription **)realloc(client->subscriptions, (client->subscriptionCount + 1) * sizeof(natsSubscription*));
-    if (newSubscriptions == NULL) {
-        RCNET_log(RCNET_LOG_ERROR, "Failed to allocate memory for new subscription\n");
+    // Ranger l'abonnement dans le registre (slot libre réutilisé, ou capacité doublée)
+    if (rcnet_nats_registerSubscription(client, newSubscription, outHandle) != 0) {
+        natsSubscription_Unsubscribe(newSubscription);
         natsSubscription_Destroy(newSubscription);
         return -1;
     }
 
-    // Mise à jour du tableau d'abonnements
-    client->subscriptions = newSubscriptions;
+    // Log success
+    RCNET_log(RCNET_LOG_INFO, "Subscribed to JetStream subject: %s\n", subject);
 
-    // Ajouter le nouvel abonnement au tableau
-    client->subscriptions[client->subscriptionCount++] = newSubscription;
+    return 0;
+}
+
+int rcnet_nats_jetstream_pull_subscribe(RCNET_NATSClient *client, const char *subject, const char *durable, RCNET_JetStreamPullSubscribeOptions *options, RCNET_NATSSubscriptionHandle *outHandle)
+{
+    natsStatus status;
+    jsErrCode jetStreamErrorCode;
+    jsSubOptions jetStreamSubOptions;
+    natsSubscription *newSubscription = NULL;
+
+    // Initialiser les options du consumer pull
+    jsSubOptions_Init(&jetStreamSubOptions);
+    if (options != NULL) {
+        jetStreamSubOptions.Config.MaxDeliver = options->maxDeliver;
+        jetStreamSubOptions.Config.AckWait = (int64_t)options->ackWait * 1000000; // ms -> ns
+        jetStreamSubOptions.Config.MaxAckPending = options->maxAckPending;
+        jetStreamSubOptions.Config.MaxRequestBatch = options->maxRequestBatch;
+        jetStreamSubOptions.Config.AckPolicy = options->ackAll ? js_AckAll : js_AckExplicit;
+    }
+
+    // Créer le consumer pull (aucun callback : les messages sont récupérés par rcnet_nats_jetstream_fetch)
+    status = js_PullSubscribe(&newSubscription, client->jetStreamContext, subject, durable, NULL, &jetStreamSubOptions, &jetStreamErrorCode);
+    if (status != NATS_OK) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to create JetStream pull consumer: %s\n", natsStatus_GetText(status));
+        RCNET_log(RCNET_LOG_ERROR, "Error code: %d\n", jetStreamErrorCode);
+        return -1;
+    }
+
+    // Ranger l'abonnement dans le registre (slot libre réutilisé, ou capacité doublée)
+    if (rcnet_nats_registerSubscription(client, newSubscription, outHandle) != 0) {
+        natsSubscription_Unsubscribe(newSubscription);
+        natsSubscription_Destroy(newSubscription);
+        return -1;
+    }
 
     // Log success
-    RCNET_log(RCNET_LOG_INFO, "Subscribed to JetStream subject: %s\n", subject);
+    RCNET_log(RCNET_LOG_INFO, "Created JetStream pull consumer %s on subject: %s\n", durable, subject);
 
     return 0;
 }
 
+int rcnet_nats_jetstream_fetch(RCNET_NATSClient *client, RCNET_NATSSubscriptionHandle handle, int batchSize, int timeoutMs, natsMsgList *outMessages)
+{
+    if (outMessages == NULL)
+        return -1;
+
+    outMessages->Msgs = NULL;
+    outMessages->Count = 0;
+
+    const int64_t slot = rcnet_nats_findSubscription(client, handle);
+    if (slot < 0 || batchSize <= 0) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to fetch JetStream messages: invalid parameters\n");
+        return -1;
+    }
+
+    natsSubscription *subscription = client->subscriptions[slot];
+    natsStatus status;
+    jsErrCode jetStreamErrorCode = (jsErrCode)0;
+
+    if (timeoutMs <= 0) {
+        // NoWait : uniquement les messages déjà disponibles (un aller-retour avec le serveur malgré tout)
+        jsFetchRequest fetchRequest;
+        jsFetchRequest_Init(&fetchRequest);
+        fetchRequest.Batch = batchSize;
+        fetchRequest.NoWait = true;
+        status = natsSubscription_FetchRequest(outMessages, subscription, &fetchRequest);
+    } else {
+        status = natsSubscription_Fetch(outMessages, subscription, batchSize, timeoutMs, &jetStreamErrorCode);
+    }
+
+    // Pas de message disponible avant l'échéance : cas normal, pas une erreur
+    if (status == NATS_TIMEOUT || status == NATS_NOT_FOUND)
+        return outMessages->Count;
+
+    if (status != NATS_OK) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to fetch JetStream messages: %s\n", natsStatus_GetText(status));
+        RCNET_log(RCNET_LOG_ERROR, "Error code: %d\n", jetStreamErrorCode);
+        return -1;
+    }
+
+    return outMessages->Count;
+}
+
+int rcnet_nats_jetstream_ack_batch(natsMsgList *messages, bool cumulative)
+{
+    if (messages == NULL || messages->Count == 0)
+        return 0;
+
+    // AckAll : le dernier message acquitte tout le batch (et tout ce qui le précède)
+    if (cumulative) {
+        natsStatus status = natsMsg_Ack(messages->Msgs[messages->Count - 1], NULL);
+        if (status != NATS_OK) {
+            RCNET_log(RCNET_LOG_ERROR, "Failed to ack JetStream batch: %s\n", natsStatus_GetText(status));
+            return -1;
+        }
+        return 0;
+    }
+
+    int result = 0;
+    for (int i = 0; i < messages->Count; i++) {
+        natsStatus status = natsMsg_Ack(messages->Msgs[i], NULL);
+        if (status != NATS_OK) {
+            RCNET_log(RCNET_LOG_ERROR, "Failed to ack JetStream message: %s\n", natsStatus_GetText(status));
+            result = -1;
+        }
+    }
+
+    return result;
+}
+
+void rcnet_nats_jetstream_release_batch(natsMsgList *messages)
+{
+    if (messages == NULL || messages->Msgs == NULL)
+        return;
+
+    natsMsgList_Destroy(messages);
+    messages->Msgs = NULL;
+    messages->Count = 0;
+}
+
 int rcnet_nats_check_and_create_stream(RCNET_NATSClient *client, const char *streamName, const char *subjects[], int subjectsCount, RCNET_JetStreamStreamOptions *options)
 {
     natsStatus status;
@@ -381,3 +704,778 @@ int rcnet_nats_update_stream_subjects(RCNET_NATSClient *client, const char *stre
 
     return 0;
 }
+
+// ======================================================
+// Publication asynchrone
+// ======================================================
+
+// Message en buffer : sujet et données sont stockés (avec '\0') dans RCNET_NATSAsyncBatch::bytes
+struct RCNET_NATSAsyncRecord
+{
+    size_t subjectOffset;
+    size_t dataOffset;
+    int dataLength;
+    bool jetStream;
+    RCNET_NATSPublishCallback callback;
+    void *userdata;
+    uint64_t enqueueNs;
+};
+
+// Buffer de messages : les capacités sont conservées d'un tick à l'autre (pas d'allocation en régime établi)
+struct RCNET_NATSAsyncBatch
+{
+    std::vector<RCNET_NATSAsyncRecord> records;
+    std::vector<char> bytes;
+
+    void clear()
+    {
+        records.clear();
+        bytes.clear();
+    }
+};
+
+// Message JetStream envoyé, en attente de son accusé de réception
+struct RCNET_NATSAsyncInFlight
+{
+    RCNET_NATSPublishCallback callback;
+    void *userdata;
+    uint64_t enqueueNs;
+};
+
+// Complétion à remonter sur le thread de flush
+struct RCNET_NATSAsyncCompletion
+{
+    RCNET_NATSPublishCallback callback;
+    void *userdata;
+    bool success;
+    uint64_t sequence;
+    bool duplicate;
+    int errorCode;
+    std::string errorText;
+    uint64_t latencyNs;
+};
+
+// Closure de rcnet_nats_asyncAckHandler. La librairie NATS ne signale pas quand son contexte JetStream
+// cesse d'appeler le handler (un accusé tardif peut arriver pendant ou après jsCtx_Destroy) : ce bloc
+// survit au publisher et n'est jamais libéré (volontairement, quelques octets par publisher).
+struct RCNET_NATSAsyncAckState
+{
+    std::mutex mutex;
+    RCNET_NATSAsyncPublisher *publisher = NULL; // NULL une fois le publisher détruit
+};
+
+struct RCNET_NATSAsyncPublisher
+{
+    RCNET_NATSClient *client = NULL;
+    jsCtx *jetStreamContext = NULL;
+    RCNET_NATSAsyncAckState *ackState = NULL;
+    RCNET_NATSAsyncPublisherConfig config;
+
+    // Sérialise flush et rcnet_nats_async_publisher_cancel_callbacks (jamais disputé en régime établi)
+    std::mutex flushMutex;
+
+    // Producteurs (n'importe quel thread)
+    std::mutex queueMutex;
+    RCNET_NATSAsyncBatch incoming;
+
+    // Thread de flush uniquement : batch en cours d'envoi (le reste attend que la fenêtre se libère)
+    RCNET_NATSAsyncBatch sending;
+    size_t sendCursor = 0;
+    std::vector<RCNET_NATSAsyncCompletion> dispatching;
+
+    // Partagé avec le thread de la librairie NATS (accusés de réception)
+    std::mutex inFlightMutex;
+    std::unordered_map<natsMsg*, RCNET_NATSAsyncInFlight> inFlight;
+    std::vector<RCNET_NATSAsyncCompletion> completions;
+
+    std::atomic<uint64_t> published{0};
+    std::atomic<uint64_t> acked{0};
+    std::atomic<uint64_t> failed{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<uint64_t> expired{0};
+    std::atomic<uint32_t> inFlightCount{0};
+    std::atomic<uint32_t> queuedCount{0};
+    RCNET_Histogram *ackLatencyNs = NULL;
+};
+
+// Accusé de réception (ou erreur) JetStream : appelé sur un thread de la librairie NATS.
+// Le message et l'accusé appartiennent à la librairie, qui les détruit au retour.
+static void rcnet_nats_asyncAckHandler(jsCtx *js, natsMsg *msg, jsPubAck *pubAck, jsPubAckErr *pubAckErr, void *closure)
+{
+    (void)js;
+    RCNET_NATSAsyncAckState *ackState = (RCNET_NATSAsyncAckState*)closure;
+    const uint64_t nowNs = rcnet_timer_get_time_ns();
+
+    // Tenu pendant tout le handler : rcnet_nats_async_publisher_destroy attend sa fin avant de libérer le publisher
+    std::lock_guard<std::mutex> stateLock(ackState->mutex);
+    RCNET_NATSAsyncPublisher *publisher = ackState->publisher;
+    if (publisher == NULL)
+        return;
+
+    std::lock_guard<std::mutex> lock(publisher->inFlightMutex);
+
+    auto it = publisher->inFlight.find(msg);
+    if (it == publisher->inFlight.end())
+        return;
+
+    RCNET_NATSAsyncCompletion completion;
+    completion.callback  = it->second.callback;
+    completion.userdata  = it->second.userdata;
+    completion.success   = (pubAck != NULL && pubAckErr == NULL);
+    completion.sequence  = completion.success ? pubAck->Sequence : 0;
+    completion.duplicate = completion.success ? pubAck->Duplicate : false;
+    completion.errorCode = (pubAckErr != NULL) ? (int)pubAckErr->ErrCode : 0;
+    if (pubAckErr != NULL)
+        completion.errorText = (pubAckErr->ErrText != NULL) ? pubAckErr->ErrText : natsStatus_GetText(pubAckErr->Err);
+    completion.latencyNs = nowNs - it->second.enqueueNs;
+    publisher->inFlight.erase(it);
+
+    publisher->inFlightCount.fetch_sub(1, std::memory_order_relaxed);
+    if (completion.success)
+    {
+        publisher->acked.fetch_add(1, std::memory_order_relaxed);
+        rcnet_histogram_record(publisher->ackLatencyNs, completion.latencyNs);
+    }
+    else
+    {
+        publisher->failed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (completion.callback != NULL)
+        publisher->completions.push_back(std::move(completion));
+}
+
+void rcnet_nats_async_publisher_get_default_config(RCNET_NATSAsyncPublisherConfig *outConfig)
+{
+    if (outConfig == NULL)
+        return;
+
+    outConfig->maxInFlight = 256;
+    outConfig->maxQueued = 8192;
+    outConfig->stallWaitMs = 1;
+    outConfig->ackTimeoutMs = 5000;
+}
+
+RCNET_NATSAsyncPublisher* rcnet_nats_async_publisher_create(RCNET_NATSClient *client, const RCNET_NATSAsyncPublisherConfig *config)
+{
+    if (client == NULL || client->connection == NULL) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to create NATS async publisher: client not initialized\n");
+        return NULL;
+    }
+
+    RCNET_NATSAsyncPublisher *publisher = new (std::nothrow) RCNET_NATSAsyncPublisher();
+    if (publisher == NULL) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to allocate NATS async publisher\n");
+        return NULL;
+    }
+
+    publisher->client = client;
+    if (config != NULL)
+        publisher->config = *config;
+    else
+        rcnet_nats_async_publisher_get_default_config(&publisher->config);
+
+    if (publisher->config.maxInFlight == 0)
+        publisher->config.maxInFlight = 1;
+
+    publisher->ackLatencyNs = rcnet_histogram_create();
+    publisher->ackState = new (std::nothrow) RCNET_NATSAsyncAckState();
+    if (publisher->ackLatencyNs == NULL || publisher->ackState == NULL) {
+        rcnet_histogram_destroy(publisher->ackLatencyNs);
+        delete publisher->ackState;
+        delete publisher;
+        return NULL;
+    }
+    publisher->ackState->publisher = publisher;
+
+    // Contexte JetStream dédié : les accusés de réception arrivent sur rcnet_nats_asyncAckHandler
+    jsOptions jetStreamOptions;
+    jsOptions_Init(&jetStreamOptions);
+    jetStreamOptions.PublishAsync.MaxPending = publisher->config.maxInFlight;
+    jetStreamOptions.PublishAsync.AckHandler = rcnet_nats_asyncAckHandler;
+    jetStreamOptions.PublishAsync.AckHandlerClosure = publisher->ackState;
+    jetStreamOptions.PublishAsync.StallWait = publisher->config.stallWaitMs;
+
+    natsStatus status = natsConnection_JetStream(&publisher->jetStreamContext, client->connection, &jetStreamOptions);
+    if (status != NATS_OK) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to create JetStream context for async publisher: %s\n", natsStatus_GetText(status));
+        rcnet_histogram_destroy(publisher->ackLatencyNs);
+        delete publisher->ackState; // aucun contexte : le handler ne sera jamais appelé
+        delete publisher;
+        return NULL;
+    }
+
+    return publisher;
+}
+
+static int rcnet_nats_asyncEnqueue(RCNET_NATSAsyncPublisher *publisher, const char *subject, const void* data, int dataLength, bool jetStream, RCNET_NATSPublishCallback callback, void *userdata)
+{
+    if (publisher == NULL || subject == NULL || dataLength < 0 || (data == NULL && dataLength > 0))
+        return -1;
+
+    const uint64_t nowNs = rcnet_timer_get_time_ns();
+    const size_t subjectLength = strlen(subject);
+
+    std::lock_guard<std::mutex> lock(publisher->queueMutex);
+
+    if (publisher->queuedCount.load(std::memory_order_relaxed) >= publisher->config.maxQueued) {
+        publisher->dropped.fetch_add(1, std::memory_order_relaxed);
+        return -1;
+    }
+
+    RCNET_NATSAsyncBatch &batch = publisher->incoming;
+
+    RCNET_NATSAsyncRecord record;
+    record.subjectOffset = batch.bytes.size();
+    record.dataOffset = record.subjectOffset + subjectLength + 1;
+    record.dataLength = dataLength;
+    record.jetStream = jetStream;
+    record.callback = callback;
+    record.userdata = userdata;
+    record.enqueueNs = nowNs;
+
+    // sujet\0données\0 (natsMsg_Create attend des chaînes terminées)
+    batch.bytes.insert(batch.bytes.end(), subject, subject + subjectLength + 1);
+    batch.bytes.insert(batch.bytes.end(), (const char*)data, (const char*)data + dataLength);
+    batch.bytes.push_back('\0');
+    batch.records.push_back(record);
+
+    publisher->queuedCount.fetch_add(1, std::memory_order_relaxed);
+    publisher->published.fetch_add(1, std::memory_order_relaxed);
+    return 0;
+}
+
+int rcnet_nats_async_publish(RCNET_NATSAsyncPublisher *publisher, const char *subject, const void* data, int dataLength, RCNET_NATSPublishCallback callback, void *userdata)
+{
+    return rcnet_nats_asyncEnqueue(publisher, subject, data, dataLength, true, callback, userdata);
+}
+
+int rcnet_nats_async_publish_core(RCNET_NATSAsyncPublisher *publisher, const char *subject, const void* data, int dataLength)
+{
+    return rcnet_nats_asyncEnqueue(publisher, subject, data, dataLength, false, NULL, NULL);
+}
+
+// Echec d'envoi immédiat (le message n'a jamais été en vol)
+static void rcnet_nats_asyncFailRecord(RCNET_NATSAsyncPublisher *publisher, const RCNET_NATSAsyncRecord &record, natsStatus status, uint64_t nowNs)
+{
+    publisher->failed.fetch_add(1, std::memory_order_relaxed);
+    if (record.callback == NULL)
+        return;
+
+    RCNET_NATSAsyncCompletion completion;
+    completion.callback  = record.callback;
+    completion.userdata  = record.userdata;
+    completion.success   = false;
+    completion.sequence  = 0;
+    completion.duplicate = false;
+    completion.errorCode = 0;
+    completion.errorText = natsStatus_GetText(status);
+    completion.latencyNs = nowNs - record.enqueueNs;
+    publisher->dispatching.push_back(std::move(completion));
+}
+
+// Messages en vol sans accusé après ackTimeoutMs (accusé perdu, serveur redémarré) : en échec.
+// Sans cela ils occuperaient leur place dans la fenêtre pour toujours. Un accusé arrivant ensuite
+// n'est plus trouvé dans inFlight et est ignoré.
+static void rcnet_nats_asyncExpire(RCNET_NATSAsyncPublisher *publisher)
+{
+    if (publisher->config.ackTimeoutMs == 0 || publisher->inFlightCount.load(std::memory_order_relaxed) == 0)
+        return;
+
+    const uint64_t nowNs = rcnet_timer_get_time_ns();
+    const uint64_t timeoutNs = (uint64_t)publisher->config.ackTimeoutMs * 1000000ull;
+
+    std::lock_guard<std::mutex> lock(publisher->inFlightMutex);
+    for (auto it = publisher->inFlight.begin(); it != publisher->inFlight.end(); )
+    {
+        if (nowNs - it->second.enqueueNs < timeoutNs)
+        {
+            ++it;
+            continue;
+        }
+
+        publisher->failed.fetch_add(1, std::memory_order_relaxed);
+        publisher->expired.fetch_add(1, std::memory_order_relaxed);
+        publisher->inFlightCount.fetch_sub(1, std::memory_order_relaxed);
+
+        if (it->second.callback != NULL)
+        {
+            RCNET_NATSAsyncCompletion completion;
+            completion.callback  = it->second.callback;
+            completion.userdata  = it->second.userdata;
+            completion.success   = false;
+            completion.sequence  = 0;
+            completion.duplicate = false;
+            completion.errorCode = 0;
+            completion.errorText = "not acknowledged before ack timeout";
+            completion.latencyNs = nowNs - it->second.enqueueNs;
+            publisher->completions.push_back(std::move(completion));
+        }
+        it = publisher->inFlight.erase(it);
+    }
+}
+
+// Envoie le batch courant tant que la fenêtre le permet. windowLimit = nombre max de messages JetStream en vol.
+static uint32_t rcnet_nats_asyncSend(RCNET_NATSAsyncPublisher *publisher, uint32_t windowLimit)
+{
+    // Batch précédent entièrement envoyé : on récupère celui des producteurs (swap, les capacités sont réutilisées)
+    if (publisher->sendCursor == publisher->sending.records.size())
+    {
+        publisher->sending.clear();
+        publisher->sendCursor = 0;
+
+        std::lock_guard<std::mutex> lock(publisher->queueMutex);
+        std::swap(publisher->incoming, publisher->sending);
+    }
+
+    RCNET_NATSAsyncBatch &batch = publisher->sending;
+    const uint64_t nowNs = rcnet_timer_get_time_ns();
+    uint32_t sent = 0;
+
+    jsPubOptions publishOptions;
+    jsPubOptions_Init(&publishOptions);
+    publishOptions.MaxWait = publisher->config.stallWaitMs;
+
+    while (publisher->sendCursor < batch.records.size())
+    {
+        const RCNET_NATSAsyncRecord &record = batch.records[publisher->sendCursor];
+        const char *subject = &batch.bytes[record.subjectOffset];
+        const char *data = &batch.bytes[record.dataOffset];
+
+        if (!record.jetStream)
+        {
+            // NATS core : la librairie bufferise et son flusher écrit tout le tick en une fois
+            natsStatus status = natsConnection_Publish(publisher->client->connection, subject, data, record.dataLength);
+            if (status != NATS_OK)
+                rcnet_nats_asyncFailRecord(publisher, record, status, nowNs);
+        }
+        else
+        {
+            // Fenêtre pleine : l'ordre est conservé, la suite part au prochain flush
+            if (publisher->inFlightCount.load(std::memory_order_relaxed) >= windowLimit)
+                break;
+
+            natsMsg *msg = NULL;
+            natsStatus status = natsMsg_Create(&msg, subject, NULL, data, record.dataLength);
+            if (status == NATS_OK)
+            {
+                // Enregistré avant l'envoi : l'accusé peut arriver avant le retour de js_PublishMsgAsync
+                natsMsg *key = msg;
+                {
+                    std::lock_guard<std::mutex> lock(publisher->inFlightMutex);
+                    publisher->inFlight[key] = RCNET_NATSAsyncInFlight{ record.callback, record.userdata, record.enqueueNs };
+                }
+                publisher->inFlightCount.fetch_add(1, std::memory_order_relaxed);
+
+                status = js_PublishMsgAsync(publisher->jetStreamContext, &msg, &publishOptions);
+                if (status != NATS_OK)
+                {
+                    std::lock_guard<std::mutex> lock(publisher->inFlightMutex);
+                    publisher->inFlight.erase(key);
+                    publisher->inFlightCount.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+
+            if (status != NATS_OK)
+            {
+                if (msg != NULL)
+                    natsMsg_Destroy(msg);
+                rcnet_nats_asyncFailRecord(publisher, record, status, nowNs);
+            }
+        }
+
+        ++publisher->sendCursor;
+        publisher->queuedCount.fetch_sub(1, std::memory_order_relaxed);
+        ++sent;
+    }
+
+    return sent;
+}
+
+static void rcnet_nats_asyncDispatch(RCNET_NATSAsyncPublisher *publisher)
+{
+    {
+        std::lock_guard<std::mutex> lock(publisher->inFlightMutex);
+        for (RCNET_NATSAsyncCompletion &completion : publisher->completions)
+            publisher->dispatching.push_back(std::move(completion));
+        publisher->completions.clear();
+    }
+
+    for (const RCNET_NATSAsyncCompletion &completion : publisher->dispatching)
+    {
+        RCNET_NATSPublishResult result;
+        result.success   = completion.success;
+        result.sequence  = completion.sequence;
+        result.duplicate = completion.duplicate;
+        result.errorCode = completion.errorCode;
+        result.errorText = completion.success ? NULL : completion.errorText.c_str();
+        result.latencyNs = completion.latencyNs;
+        completion.callback(&result, completion.userdata);
+    }
+    publisher->dispatching.clear();
+}
+
+uint32_t rcnet_nats_async_publisher_flush(RCNET_NATSAsyncPublisher *publisher)
+{
+    if (publisher == NULL)
+        return 0;
+
+    std::lock_guard<std::mutex> flushLock(publisher->flushMutex);
+    rcnet_nats_asyncExpire(publisher);
+
+    uint32_t sent = rcnet_nats_asyncSend(publisher, publisher->config.maxInFlight);
+
+    // Le batch précédent vient de finir : le nouveau batch des producteurs part dans le même tick
+    if (publisher->sendCursor == publisher->sending.records.size())
+        sent += rcnet_nats_asyncSend(publisher, publisher->config.maxInFlight);
+
+    rcnet_nats_asyncDispatch(publisher);
+    return sent;
+}
+
+uint32_t rcnet_nats_async_publisher_cancel_callbacks(RCNET_NATSAsyncPublisher *publisher, void *userdata)
+{
+    if (publisher == NULL)
+        return 0;
+
+    // Attend la fin d'un flush en cours : plus aucun callback de ce userdata ne tourne au retour
+    std::lock_guard<std::mutex> flushLock(publisher->flushMutex);
+    uint32_t canceled = 0;
+
+    // Les messages partent toujours, seuls leurs callbacks sont retirés
+    for (size_t i = publisher->sendCursor; i < publisher->sending.records.size(); ++i)
+    {
+        RCNET_NATSAsyncRecord &record = publisher->sending.records[i];
+        if (record.callback != NULL && record.userdata == userdata)
+        {
+            record.callback = NULL;
+            ++canceled;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(publisher->queueMutex);
+        for (RCNET_NATSAsyncRecord &record : publisher->incoming.records)
+        {
+            if (record.callback != NULL && record.userdata == userdata)
+            {
+                record.callback = NULL;
+                ++canceled;
+            }
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(publisher->inFlightMutex);
+        for (auto &entry : publisher->inFlight)
+        {
+            if (entry.second.callback != NULL && entry.second.userdata == userdata)
+            {
+                entry.second.callback = NULL;
+                ++canceled;
+            }
+        }
+
+        std::vector<RCNET_NATSAsyncCompletion> &completions = publisher->completions;
+        size_t kept = 0;
+        for (size_t i = 0; i < completions.size(); ++i)
+        {
+            if (completions[i].userdata == userdata)
+            {
+                ++canceled;
+                continue;
+            }
+            if (kept != i)
+                completions[kept] = std::move(completions[i]);
+            ++kept;
+        }
+        completions.resize(kept);
+    }
+
+    return canceled;
+}
+
+void rcnet_nats_async_publisher_destroy(RCNET_NATSAsyncPublisher *publisher, int timeoutMs)
+{
+    if (publisher == NULL)
+        return;
+
+    if (timeoutMs < 1)
+        timeoutMs = 1;
+
+    const uint64_t deadlineNs = rcnet_timer_get_time_ns() + (uint64_t)timeoutMs * 1000000ull;
+
+    jsPubOptions completeOptions;
+    jsPubOptions_Init(&completeOptions);
+
+    // 1) Vider le buffer en respectant la fenêtre : on attend des accusés quand elle est pleine
+    while (publisher->queuedCount.load(std::memory_order_relaxed) > 0 && rcnet_timer_get_time_ns() < deadlineNs)
+    {
+        if (rcnet_nats_asyncSend(publisher, publisher->config.maxInFlight) == 0)
+        {
+            completeOptions.MaxWait = 10;
+            js_PublishAsyncComplete(publisher->jetStreamContext, &completeOptions);
+        }
+    }
+
+    // Jamais envoyés avant l'échéance : en échec
+    const uint64_t abandonNs = rcnet_timer_get_time_ns();
+    for (; publisher->sendCursor < publisher->sending.records.size(); ++publisher->sendCursor)
+        rcnet_nats_asyncFailRecord(publisher, publisher->sending.records[publisher->sendCursor], NATS_TIMEOUT, abandonNs);
+    {
+        std::lock_guard<std::mutex> lock(publisher->queueMutex);
+        for (const RCNET_NATSAsyncRecord &record : publisher->incoming.records)
+            rcnet_nats_asyncFailRecord(publisher, record, NATS_TIMEOUT, abandonNs);
+        publisher->incoming.clear();
+    }
+    publisher->queuedCount.store(0, std::memory_order_relaxed);
+
+    // 2) Attendre les accusés de réception restants
+    const uint64_t nowNs = rcnet_timer_get_time_ns();
+    completeOptions.MaxWait = (nowNs < deadlineNs) ? (int64_t)((deadlineNs - nowNs) / 1000000ull) + 1 : 1;
+    natsStatus status = js_PublishAsyncComplete(publisher->jetStreamContext, &completeOptions);
+    if (status != NATS_OK)
+        RCNET_log(RCNET_LOG_ERROR, "NATS async publisher: %u message(s) not acknowledged: %s\n",
+                  publisher->inFlightCount.load(std::memory_order_relaxed), natsStatus_GetText(status));
+
+    // 3) Les messages encore en vol ne seront plus acquittés : en échec
+    natsMsgList pendingList;
+    memset(&pendingList, 0, sizeof(pendingList));
+    if (js_PublishAsyncGetPendingList(&pendingList, publisher->jetStreamContext) == NATS_OK)
+        natsMsgList_Destroy(&pendingList);
+
+    jsCtx_Destroy(publisher->jetStreamContext);
+    publisher->jetStreamContext = NULL;
+
+    // Un accusé tardif peut encore atteindre rcnet_nats_asyncAckHandler : on attend celui en cours
+    // (mutex de l'état) et les suivants ne verront plus le publisher. L'état lui-même n'est pas libéré.
+    {
+        std::lock_guard<std::mutex> stateLock(publisher->ackState->mutex);
+        publisher->ackState->publisher = NULL;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(publisher->inFlightMutex);
+        for (const auto &entry : publisher->inFlight)
+        {
+            publisher->failed.fetch_add(1, std::memory_order_relaxed);
+            if (entry.second.callback == NULL)
+                continue;
+
+            RCNET_NATSAsyncCompletion completion;
+            completion.callback  = entry.second.callback;
+            completion.userdata  = entry.second.userdata;
+            completion.success   = false;
+            completion.sequence  = 0;
+            completion.duplicate = false;
+            completion.errorCode = 0;
+            completion.errorText = "not acknowledged before publisher destruction";
+            completion.latencyNs = nowNs - entry.second.enqueueNs;
+            publisher->completions.push_back(std::move(completion));
+        }
+        publisher->inFlight.clear();
+        publisher->inFlightCount.store(0, std::memory_order_relaxed);
+    }
+
+    // 4) Derniers callbacks sur le thread appelant
+    rcnet_nats_asyncDispatch(publisher);
+
+    rcnet_histogram_destroy(publisher->ackLatencyNs);
+    delete publisher;
+}
+
+void rcnet_nats_async_publisher_get_stats(const RCNET_NATSAsyncPublisher *publisher, RCNET_NATSAsyncPublisherStats *outStats)
+{
+    if (outStats == NULL)
+        return;
+
+    memset(outStats, 0, sizeof(*outStats));
+    if (publisher == NULL)
+        return;
+
+    outStats->published = publisher->published.load(std::memory_order_relaxed);
+    outStats->acked     = publisher->acked.load(std::memory_order_relaxed);
+    outStats->failed    = publisher->failed.load(std::memory_order_relaxed);
+    outStats->dropped   = publisher->dropped.load(std::memory_order_relaxed);
+    outStats->expired   = publisher->expired.load(std::memory_order_relaxed);
+    outStats->inFlight  = publisher->inFlightCount.load(std::memory_order_relaxed);
+    outStats->queued    = publisher->queuedCount.load(std::memory_order_relaxed);
+    rcnet_histogram_get_summary(publisher->ackLatencyNs, &outStats->ackLatencyNs);
+}
+
+// ======================================================
+// Fan-in wildcard
+// ======================================================
+
+struct RCNET_NATSFanInRoute
+{
+    natsMsgHandler handler;
+    void *closure;
+};
+
+struct RCNET_NATSFanIn
+{
+    RCNET_NATSClient *client = NULL;
+    RCNET_NATSSubscriptionHandle handle = RCNET_NATS_INVALID_SUBSCRIPTION;
+    int routeTokenIndex = 0;
+
+    std::mutex routesMutex;
+    std::unordered_map<std::string, RCNET_NATSFanInRoute> routes;
+
+    // Route en cours d'appel (sous routesMutex). NATS livre les messages d'un abonnement un par un :
+    // au plus un handler du fan-in tourne à la fois.
+    std::condition_variable dispatchDone;
+    RCNET_NATSFanInRoute dispatchingRoute = { NULL, NULL };
+    std::thread::id dispatchingThread;
+
+    std::atomic<uint64_t> unrouted{0};
+};
+
+// Token routeTokenIndex du sujet (séparateur '.'), false s'il n'existe pas
+static bool rcnet_nats_fanInToken(const char *subject, int tokenIndex, const char **outBegin, size_t *outLength)
+{
+    const char *begin = subject;
+    for (int i = 0; i < tokenIndex; i++) {
+        begin = strchr(begin, '.');
+        if (begin == NULL)
+            return false;
+        begin++;
+    }
+
+    const char *end = strchr(begin, '.');
+    *outBegin = begin;
+    *outLength = (end != NULL) ? (size_t)(end - begin) : strlen(begin);
+    return true;
+}
+
+static void rcnet_nats_fanInHandler(natsConnection *connection, natsSubscription *subscription, natsMsg *msg, void *closure)
+{
+    RCNET_NATSFanIn *fanIn = (RCNET_NATSFanIn*)closure;
+
+    const char *token = NULL;
+    size_t tokenLength = 0;
+    RCNET_NATSFanInRoute route = { NULL, NULL };
+
+    if (rcnet_nats_fanInToken(natsMsg_GetSubject(msg), fanIn->routeTokenIndex, &token, &tokenLength)) {
+        // Clé réutilisée d'un message à l'autre (pas d'allocation une fois la taille max atteinte)
+        thread_local std::string key;
+        key.assign(token, tokenLength);
+
+        std::lock_guard<std::mutex> lock(fanIn->routesMutex);
+        auto it = fanIn->routes.find(key);
+        if (it != fanIn->routes.end()) {
+            route = it->second;
+            fanIn->dispatchingRoute = route;
+            fanIn->dispatchingThread = std::this_thread::get_id();
+        }
+    }
+
+    // Handler appelé hors du verrou : il peut ajouter / retirer des routes
+    if (route.handler == NULL) {
+        fanIn->unrouted.fetch_add(1, std::memory_order_relaxed);
+        natsMsg_Destroy(msg);
+        return;
+    }
+
+    route.handler(connection, subscription, msg, route.closure);
+
+    {
+        std::lock_guard<std::mutex> lock(fanIn->routesMutex);
+        fanIn->dispatchingRoute = RCNET_NATSFanInRoute{ NULL, NULL };
+        fanIn->dispatchingThread = std::thread::id();
+    }
+    fanIn->dispatchDone.notify_all();
+}
+
+RCNET_NATSFanIn* rcnet_nats_fanin_create(RCNET_NATSClient *client, const char *wildcardSubject, int routeTokenIndex)
+{
+    if (client == NULL || wildcardSubject == NULL || routeTokenIndex < 0) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to create NATS fan-in: invalid parameters\n");
+        return NULL;
+    }
+
+    RCNET_NATSFanIn *fanIn = new (std::nothrow) RCNET_NATSFanIn();
+    if (fanIn == NULL) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to allocate NATS fan-in\n");
+        return NULL;
+    }
+
+    fanIn->client = client;
+    fanIn->routeTokenIndex = routeTokenIndex;
+
+    if (rcnet_nats_subscribe(client, wildcardSubject, rcnet_nats_fanInHandler, fanIn, &fanIn->handle) != 0) {
+        delete fanIn;
+        return NULL;
+    }
+
+    return fanIn;
+}
+
+void rcnet_nats_fanin_destroy(RCNET_NATSFanIn *fanIn)
+{
+    if (fanIn == NULL)
+        return;
+
+    // natsSubscription_Unsubscribe n'attend pas un rcnet_nats_fanInHandler déjà en cours sur le thread
+    // de livraison : le fan-in n'est libéré qu'après le dernier message.
+    if (rcnet_nats_unsubscribe_and_wait(fanIn->client, fanIn->handle, RCNET_NATS_UNSUBSCRIBE_WAIT_TIMEOUT_MS) == -2) {
+        // Un handler tourne peut-être encore : fuite volontaire plutôt qu'un use-after-free
+        RCNET_log(RCNET_LOG_WARN, "rcnet_nats_fanin_destroy: subscription did not complete, fan-in leaked\n");
+        return;
+    }
+
+    delete fanIn;
+}
+
+int rcnet_nats_fanin_add_route(RCNET_NATSFanIn *fanIn, const char *token, natsMsgHandler messageHandler, void *closure)
+{
+    if (fanIn == NULL || token == NULL || messageHandler == NULL) {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to add NATS fan-in route: invalid parameters\n");
+        return -1;
+    }
+
+    std::lock_guard<std::mutex> lock(fanIn->routesMutex);
+    fanIn->routes[token] = RCNET_NATSFanInRoute{ messageHandler, closure };
+    return 0;
+}
+
+int rcnet_nats_fanin_remove_route(RCNET_NATSFanIn *fanIn, const char *token)
+{
+    if (fanIn == NULL || token == NULL)
+        return -1;
+
+    std::lock_guard<std::mutex> lock(fanIn->routesMutex);
+    return (fanIn->routes.erase(token) > 0) ? 0 : -1;
+}
+
+int rcnet_nats_fanin_remove_route_and_wait(RCNET_NATSFanIn *fanIn, const char *token, int timeoutMs)
+{
+    if (fanIn == NULL || token == NULL)
+        return -1;
+
+    std::unique_lock<std::mutex> lock(fanIn->routesMutex);
+    auto it = fanIn->routes.find(token);
+    if (it == fanIn->routes.end())
+        return -1;
+
+    const RCNET_NATSFanInRoute removed = it->second;
+    fanIn->routes.erase(it);
+
+    // Appelée depuis le handler en cours : c'est l'appelant lui-même qui utilise la closure
+    if (fanIn->dispatchingThread == std::this_thread::get_id())
+        return 0;
+
+    // Un message déjà routé vers cette route peut être en cours de traitement : on attend son retour
+    const bool done = fanIn->dispatchDone.wait_for(lock, std::chrono::milliseconds(timeoutMs), [&]() {
+        return fanIn->dispatchingRoute.handler != removed.handler || fanIn->dispatchingRoute.closure != removed.closure;
+    });
+    if (!done) {
+        RCNET_log(RCNET_LOG_WARN, "rcnet_nats_fanin_remove_route_and_wait: handler still running after %d ms\n", timeoutMs);
+        return -2;
+    }
+
+    return 0;
+}
+
+uint64_t rcnet_nats_fanin_get_unrouted_count(const RCNET_NATSFanIn *fanIn)
+{
+    return (fanIn != NULL) ? fanIn->unrouted.load(std::memory_order_relaxed) : 0;
+}
@@ -0,0 +1,821 @@
+#include "RCNET/RCNET_net_shards.h"
+#include "RCNET/RCNET_arena.h"
+#include "RCNET/RCNET_engine.h"
+#include "RCNET/RCNET_logger.h"
+#include "RCNET/RCNET_queue.h"
+#include "RCNET/RCNET_secure_channel.h"
+#include "RCNET/RCNET_subsystem.h"
+#include "RCNET/RCNET_timer.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <thread>
+
+// ================================
+// Plateforme : SO_REUSEPORT + affinité CPU
+// (port partagé uniquement sur Linux : seul son SO_REUSEPORT répartit les datagrammes UDP entre
+// les sockets, macOS / BSD livrent tout au même socket et les autres shards ne verraient aucun client)
+// ================================
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <sys/socket.h>
+    #if defined(__linux__) && defined(SO_REUSEPORT)
+        #define RCNET_NET_SHARDS_HAS_REUSEPORT 1
+    #endif
+#endif
+
+// Nombre de requêtes d'envoi traitées par pop_batch
+static constexpr uint32_t kSendBatchSize = 256;
+
+// Une requête d'envoi (thread appelant -> thread du shard)
+struct RCNET_NetShardSendRequest
+{
+    uint32_t clientId;
+    uint32_t connectionGeneration; // génération au moment de l'appel (détecte déconnexion / reconnexion)
+    uint8_t channelId;
+    ENetPacket* packet;
+};
+
+// Lissage du débit envoyé entre deux échantillons (poids du nouvel échantillon)
+static constexpr double kSentRateSmoothing = 0.25;
+
+// Réaction à la congestion : budget multiplié par kBudgetDecrease, remonté de maxPayloadBytes / kBudgetIncreaseDivisor
+static constexpr double kBudgetDecrease = 0.7;
+static constexpr uint32_t kBudgetIncreaseDivisor = 16;
+
+// Etat réseau d'un client : la première partie n'est touchée que par le thread du shard,
+// la seconde est publiée pour rcnet_net_shards_get_peer_stats (atomics relaxed, valeurs indépendantes)
+struct RCNET_NetPeerState
+{
+    uint64_t sentBytes = 0;
+    uint64_t sampledSentBytes = 0;
+    uint64_t lastSampleNs = 0;
+    double sentRate = 0.0;
+    uint32_t minRoundTripTime = UINT32_MAX;
+    uint32_t payloadBudget = 0;
+    uint32_t sendInterval = 1;
+
+    std::atomic<bool> congested{false};
+    std::atomic<uint32_t> roundTripTime{0};
+    std::atomic<uint32_t> roundTripTimeVariance{0};
+    std::atomic<uint32_t> minRoundTripTimePublished{0};
+    std::atomic<uint32_t> packetLoss{0}; // sur ENET_PEER_PACKET_LOSS_SCALE
+    std::atomic<uint32_t> queuedCommands{0};
+    std::atomic<uint32_t> reliableBytesInTransit{0};
+    std::atomic<uint32_t> sentBytesPerSecond{0};
+    std::atomic<uint32_t> estimatedBytesPerSecond{0};
+    std::atomic<uint64_t> sentBytesPublished{0};
+    std::atomic<uint32_t> sendIntervalPublished{1};
+    std::atomic<uint32_t> payloadBudgetPublished{0};
+};
+
+struct RCNET_NetShard
+{
+    RCNET_NetShards* owner = nullptr;
+    uint32_t index = 0;
+    uint32_t firstClientId = 0;
+    uint16_t port = 0;
+    ENetHost* host = nullptr;
+    RCNET_RingQueue* sendQueue = nullptr;
+    RCNET_Arena* receiveArena = nullptr; // scratch des callbacks on_receive, reset après chaque passe de réception
+    uint64_t nextPeerSampleNs = 0;
+    std::thread thread;
+};
+
+struct RCNET_NetShards
+{
+    RCNET_NetShardsConfig config;
+    bool reusePort = false;
+    bool rcenetAcquired = false;
+    uint32_t maxClients = 0;
+
+    RCNET_NetShard* shards = nullptr;
+
+    // Génération de connexion par clientId : impaire = connecté, paire = déconnecté.
+    // Ecrite uniquement par le thread du shard propriétaire du client.
+    std::atomic<uint32_t>* connectionGeneration = nullptr;
+
+    // Etat réseau par clientId (écrit par le thread du shard propriétaire du client)
+    RCNET_NetPeerState* peerStates = nullptr;
+
+    // Session chiffrée par clientId si config.secure (pré-allouées : aucune allocation à la connexion)
+    RCNET_SecureSession** secureSessions = nullptr;
+
+    std::atomic<bool> running{false};
+};
+
+// Arena du shard dont le thread courant est le thread (NULL hors d'un thread de shard)
+static thread_local RCNET_Arena* tlsReceiveArena = nullptr;
+
+// ======================================================
+// Helpers plateforme
+// ======================================================
+
+static void rcnet_net_shards_pinCurrentThread(uint32_t cpuCore)
+{
+#if defined(_WIN32)
+    if (cpuCore < sizeof(DWORD_PTR) * 8)
+        SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpuCore);
+#elif defined(__linux__)
+    if (cpuCore >= static_cast<uint32_t>(CPU_SETSIZE))
+    {
+        RCNET_log(RCNET_LOG_WARN, "[NET] CPU core %u out of range (max %d), network shard thread not pinned\n", cpuCore, CPU_SETSIZE - 1);
+        return;
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpuCore, &cpuSet);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) != 0)
+        RCNET_log(RCNET_LOG_WARN, "[NET] Failed to pin network shard thread to core %u\n", cpuCore);
+#else
+    // macOS : pas d'affinité stricte exposée par le système, le scheduler décide
+    (void)cpuCore;
+#endif
+}
+
+static ENetHost* rcnet_net_shards_createHost(const RCNET_NetShardsConfig* config, uint16_t port, bool reusePort)
+{
+    ENetAddress address;
+    enet_address_build_any(&address, ENET_ADDRESS_TYPE_IPV6);
+    address.port = port;
+
+    if (!reusePort)
+    {
+        return enet_host_create(
+            ENET_ADDRESS_TYPE_ANY, // dual-stack IPv4/IPv6
+            &address,
+            config->peersPerShard,
+            config->channelCount,
+            config->incomingBandwidth,
+            config->outgoingBandwidth
+        );
+    }
+
+#if defined(RCNET_NET_SHARDS_HAS_REUSEPORT)
+    // Host sans bind, puis SO_REUSEPORT + bind manuel :
+    // l'option doit être posée avant le bind, ce que enet_host_create ne permet pas.
+    ENetHost* host = enet_host_create(
+        ENET_ADDRESS_TYPE_ANY, // dual-stack IPv4/IPv6
+        NULL,
+        config->peersPerShard,
+        config->channelCount,
+        config->incomingBandwidth,
+        config->outgoingBandwidth
+    );
+    if (!host)
+        return NULL;
+
+    int enable = 1;
+    if (setsockopt(host->socket, SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) != 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "[NET] setsockopt(SO_REUSEPORT) failed\n");
+        enet_host_destroy(host);
+        return NULL;
+    }
+
+    if (enet_socket_bind(host->socket, &address) < 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "[NET] Failed to bind shard socket on port %u\n", port);
+        enet_host_destroy(host);
+        return NULL;
+    }
+
+    if (enet_socket_get_address(host->socket, &host->address) < 0)
+        host->address = address;
+
+    return host;
+#else
+    return NULL;
+#endif
+}
+
+// ======================================================
+// Thread de shard
+// ======================================================
+
+static void rcnet_net_shards_resetPeerState(RCNET_NetShards* owner, uint32_t clientId)
+{
+    RCNET_NetPeerState& state = owner->peerStates[clientId];
+    const RCNET_NetPeerRateConfig& rate = owner->config.peerRate;
+
+    state.sentBytes = 0;
+    state.sampledSentBytes = 0;
+    state.lastSampleNs = rcnet_timer_get_time_ns();
+    state.sentRate = 0.0;
+    state.minRoundTripTime = UINT32_MAX;
+    state.payloadBudget = rate.maxPayloadBytes;
+    state.sendInterval = 1;
+
+    state.congested.store(false, std::memory_order_relaxed);
+    state.roundTripTime.store(0, std::memory_order_relaxed);
+    state.roundTripTimeVariance.store(0, std::memory_order_relaxed);
+    state.minRoundTripTimePublished.store(0, std::memory_order_relaxed);
+    state.packetLoss.store(0, std::memory_order_relaxed);
+    state.queuedCommands.store(0, std::memory_order_relaxed);
+    state.reliableBytesInTransit.store(0, std::memory_order_relaxed);
+    state.sentBytesPerSecond.store(0, std::memory_order_relaxed);
+    state.estimatedBytesPerSecond.store(0, std::memory_order_relaxed);
+    state.sentBytesPublished.store(0, std::memory_order_relaxed);
+    state.sendIntervalPublished.store(1, std::memory_order_relaxed);
+    state.payloadBudgetPublished.store(rate.maxPayloadBytes, std::memory_order_relaxed);
+}
+
+// Echantillonne les stats ENet d'un peer connecté puis adapte son intervalle et son budget
+static void rcnet_net_shards_samplePeer(RCNET_NetShards* owner, uint32_t clientId, ENetPeer* peer, uint64_t nowNs)
+{
+    RCNET_NetPeerState& state = owner->peerStates[clientId];
+    const RCNET_NetPeerRateConfig& rate = owner->config.peerRate;
+
+    // Débit envoyé (octets passés à enet_peer_send) lissé
+    uint64_t elapsedNs = nowNs - state.lastSampleNs;
+    if (elapsedNs > 0)
+    {
+        double instantRate = static_cast<double>(state.sentBytes - state.sampledSentBytes) * 1e9 / static_cast<double>(elapsedNs);
+        state.sentRate += (instantRate - state.sentRate) * kSentRateSmoothing;
+    }
+    state.sampledSentBytes = state.sentBytes;
+    state.lastSampleNs = nowNs;
+
+    uint32_t roundTripTime = peer->roundTripTime;
+    if (roundTripTime > 0 && roundTripTime < state.minRoundTripTime)
+        state.minRoundTripTime = roundTripTime;
+
+    float packetLoss = static_cast<float>(peer->packetLoss) / static_cast<float>(ENET_PEER_PACKET_LOSS_SCALE);
+    uint32_t queuedCommands = static_cast<uint32_t>(enet_list_size(&peer->outgoingCommands) + enet_list_size(&peer->outgoingSendReliableCommands));
+
+    bool congested = packetLoss > rate.maxPacketLoss
+        || queuedCommands > rate.maxQueuedCommands
+        || (state.minRoundTripTime != UINT32_MAX && roundTripTime > state.minRoundTripTime + rate.maxRttInflationMs);
+
+    // AIMD : on recule vite (moins d'octets, moins souvent), on revient doucement
+    if (congested)
+    {
+        state.payloadBudget = std::max(rate.minPayloadBytes, static_cast<uint32_t>(state.payloadBudget * kBudgetDecrease));
+        state.sendInterval = std::min(std::max(rate.maxSendInterval, 1u), state.sendInterval + 1);
+    }
+    else if (state.sendInterval > 1)
+    {
+        state.sendInterval--;
+    }
+    else
+    {
+        state.payloadBudget = std::min(rate.maxPayloadBytes, state.payloadBudget + std::max(rate.maxPayloadBytes / kBudgetIncreaseDivisor, 1u));
+    }
+
+    state.congested.store(congested, std::memory_order_relaxed);
+    state.roundTripTime.store(roundTripTime, std::memory_order_relaxed);
+    state.roundTripTimeVariance.store(peer->roundTripTimeVariance, std::memory_order_relaxed);
+    state.minRoundTripTimePublished.store(state.minRoundTripTime != UINT32_MAX ? state.minRoundTripTime : 0, std::memory_order_relaxed);
+    state.packetLoss.store(peer->packetLoss, std::memory_order_relaxed);
+    state.queuedCommands.store(queuedCommands, std::memory_order_relaxed);
+    state.reliableBytesInTransit.store(peer->reliableDataInTransit, std::memory_order_relaxed);
+    state.sentBytesPerSecond.store(static_cast<uint32_t>(state.sentRate), std::memory_order_relaxed);
+    state.estimatedBytesPerSecond.store(static_cast<uint32_t>(state.sentRate * (1.0 - std::min(packetLoss, 1.0f))), std::memory_order_relaxed);
+    state.sentBytesPublished.store(state.sentBytes, std::memory_order_relaxed);
+    state.sendIntervalPublished.store(state.sendInterval, std::memory_order_relaxed);
+    state.payloadBudgetPublished.store(state.payloadBudget, std::memory_order_relaxed);
+}
+
+static void rcnet_net_shards_samplePeers(RCNET_NetShard* shard)
+{
+    RCNET_NetShards* owner = shard->owner;
+    if (owner->config.peerRate.sampleIntervalMs == 0)
+        return;
+
+    uint64_t nowNs = rcnet_timer_get_time_ns();
+    if (nowNs < shard->nextPeerSampleNs)
+        return;
+    shard->nextPeerSampleNs = nowNs + static_cast<uint64_t>(owner->config.peerRate.sampleIntervalMs) * 1000000ull;
+
+    for (uint32_t i = 0; i < owner->config.peersPerShard; ++i)
+    {
+        ENetPeer* peer = &shard->host->peers[i];
+        if (peer->state == ENET_PEER_STATE_CONNECTED)
+            rcnet_net_shards_samplePeer(owner, shard->firstClientId + i, peer, nowNs);
+    }
+}
+
+// Passe à une génération impaire (= connecté) puis appelle on_connect
+static void rcnet_net_shards_publishConnect(RCNET_NetShards* owner, uint32_t clientId)
+{
+    uint32_t generation = owner->connectionGeneration[clientId].load(std::memory_order_relaxed);
+    owner->connectionGeneration[clientId].store((generation & 1u) ? generation + 2 : generation + 1, std::memory_order_release);
+
+    if (owner->config.callbacks.on_connect)
+        owner->config.callbacks.on_connect(clientId, owner->config.userdata);
+}
+
+static void rcnet_net_shards_handleEvent(RCNET_NetShard* shard, ENetEvent& event)
+{
+    RCNET_NetShards* owner = shard->owner;
+    const RCNET_NetShardsCallbacks& callbacks = owner->config.callbacks;
+    uint32_t clientId = shard->firstClientId + event.peer->incomingPeerID;
+
+    // Moteur en idle : un peer qui arrive ou parle relance les ticks (aucun coût si le moteur tourne)
+    if (owner->config.wakeEngineOnActivity && (event.type == ENET_EVENT_TYPE_CONNECT || event.type == ENET_EVENT_TYPE_RECEIVE))
+        rcnet_engine_wake();
+
+    switch (event.type)
+    {
+        case ENET_EVENT_TYPE_CONNECT:
+        {
+            // Stats de l'ancien occupant du slot oubliées avant de publier la connexion
+            rcnet_net_shards_resetPeerState(owner, clientId);
+
+            // Chiffrement : le client n'est annoncé qu'après son HELLO (premier packet reçu)
+            if (owner->config.secure)
+            {
+                rcnet_secure_session_reset(owner->secureSessions[clientId]);
+                break;
+            }
+
+            rcnet_net_shards_publishConnect(owner, clientId);
+            break;
+        }
+
+        case ENET_EVENT_TYPE_RECEIVE:
+        {
+            const uint8_t* data = event.packet->data;
+            size_t dataLength = event.packet->dataLength;
+            bool deliver = true;
+
+            if (owner->config.secure)
+            {
+                RCNET_SecureSession* session = owner->secureSessions[clientId];
+                if (!rcnet_secure_session_is_established(session))
+                {
+                    // Seul un HELLO non authentifié déconnecte : un autre packet reçu avant lui est ignoré (earlyPackets).
+                    // Le WELCOME (nonce de la connexion) part avant tout packet chiffré : les clés en dépendent,
+                    // les packets d'une connexion précédente rejoués avec son HELLO ne s'authentifient pas.
+                    uint8_t welcome[RCNET_SECURE_WELCOME_SIZE];
+                    if (rcnet_secure_session_accept_client(session, &owner->config.secureKeys, data, dataLength, welcome))
+                    {
+                        ENetPacket* welcomePacket = enet_packet_create(welcome, sizeof(welcome), ENET_PACKET_FLAG_RELIABLE);
+                        if (welcomePacket != NULL && enet_peer_send(event.peer, event.channelID, welcomePacket) == 0)
+                        {
+                            rcnet_net_shards_publishConnect(owner, clientId);
+                        }
+                        else
+                        {
+                            if (welcomePacket != NULL)
+                                enet_packet_destroy(welcomePacket);
+                            rcnet_secure_session_reset(session);
+                            enet_peer_disconnect(event.peer, 0);
+                        }
+                    }
+                    else if (rcnet_secure_is_hello(data, dataLength))
+                    {
+                        enet_peer_disconnect(event.peer, 0);
+                    }
+                    deliver = false;
+                }
+                else
+                {
+                    // Déchiffré en place dans le packet ENet (packet forgé, rejoué ou trop ancien : ignoré)
+                    deliver = rcnet_secure_session_open(session, event.channelID, event.packet->data, event.packet->dataLength, &data, &dataLength);
+                }
+            }
+
+            if (deliver && callbacks.on_receive)
+                callbacks.on_receive(clientId, event.channelID, data, dataLength, owner->config.userdata);
+
+            enet_packet_destroy(event.packet);
+            break;
+        }
+
+        case ENET_EVENT_TYPE_DISCONNECT:
+        case ENET_EVENT_TYPE_DISCONNECT_TIMEOUT:
+        {
+            // Passe à une génération paire (= déconnecté) : les envois en attente seront droppés
+            uint32_t generation = owner->connectionGeneration[clientId].load(std::memory_order_relaxed);
+            if (generation & 1u)
+                owner->connectionGeneration[clientId].store(generation + 1, std::memory_order_release);
+
+            // Chiffrement : un peer qui n'a jamais envoyé de HELLO valide n'a pas été annoncé
+            bool announced = (generation & 1u) != 0 || !owner->config.secure;
+            if (owner->config.secure)
+                rcnet_secure_session_reset(owner->secureSessions[clientId]);
+
+            if (announced && callbacks.on_disconnect)
+                callbacks.on_disconnect(clientId, event.type == ENET_EVENT_TYPE_DISCONNECT_TIMEOUT, owner->config.userdata);
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+// Chiffre en place un packet à envoyer (sans effet sans config.secure). La génération du client est
+// impaire, donc son HELLO a été accepté. Le packet n'appartient qu'à cette requête (un packet par envoi).
+static bool rcnet_net_shards_sealPacket(RCNET_NetShards* owner, const RCNET_NetShardSendRequest& request)
+{
+    if (!owner->config.secure)
+        return true;
+
+    ENetPacket* packet = request.packet;
+    if (packet->dataLength < RCNET_SECURE_OVERHEAD)
+    {
+        RCNET_log(RCNET_LOG_WARN, "[NET] Packet for client %u dropped: no room for encryption\n", request.clientId);
+        return false;
+    }
+
+    return rcnet_secure_session_seal(owner->secureSessions[request.clientId], request.channelId, packet->data,
+                                     packet->dataLength - RCNET_SECURE_OVERHEAD, packet->dataLength) != 0;
+}
+
+static bool rcnet_net_shards_processSendQueue(RCNET_NetShard* shard)
+{
+    RCNET_NetShards* owner = shard->owner;
+    RCNET_NetShardSendRequest batch[kSendBatchSize];
+    bool sentAny = false;
+
+    uint32_t count;
+    while ((count = rcnet_ring_queue_pop_batch(shard->sendQueue, batch, kSendBatchSize)) > 0)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            RCNET_NetShardSendRequest& request = batch[i];
+            uint32_t currentGeneration = owner->connectionGeneration[request.clientId].load(std::memory_order_relaxed);
+
+            if (currentGeneration == request.connectionGeneration)
+            {
+                ENetPeer* peer = &shard->host->peers[request.clientId - shard->firstClientId];
+                size_t packetLength = request.packet->dataLength;
+                if (peer->state == ENET_PEER_STATE_CONNECTED && rcnet_net_shards_sealPacket(owner, request) &&
+                    enet_peer_send(peer, request.channelId, request.packet) == 0)
+                {
+                    owner->peerStates[request.clientId].sentBytes += packetLength;
+                    sentAny = true;
+                    continue;
+                }
+            }
+
+            // Client parti (ou slot réutilisé), chiffrement ou envoi refusé : le packet n'a pas été pris par ENet
+            enet_packet_destroy(request.packet);
+        }
+    }
+
+    return sentAny;
+}
+
+static void rcnet_net_shards_threadMain(RCNET_NetShard* shard)
+{
+    RCNET_NetShards* owner = shard->owner;
+
+    if (owner->config.pinThreads)
+        rcnet_net_shards_pinCurrentThread(owner->config.firstCpuCore + shard->index);
+
+    tlsReceiveArena = shard->receiveArena;
+
+    ENetEvent event;
+    while (owner->running.load(std::memory_order_relaxed))
+    {
+        // 1) Envois demandés par les autres threads, puis flush (latence plus faible)
+        if (rcnet_net_shards_processSendQueue(shard))
+            enet_host_flush(shard->host);
+
+        // 2) Réception : un service (avec petit timeout) puis on vide tous les events déjà reçus
+        int serviceResult = enet_host_service(shard->host, &event, owner->config.serviceTimeoutMs);
+        while (serviceResult > 0)
+        {
+            rcnet_net_shards_handleEvent(shard, event);
+            serviceResult = enet_host_check_events(shard->host, &event);
+        }
+
+        // Les données décodées dans l'arena par les callbacks de cette passe ne sont plus utilisées
+        rcnet_arena_reset(shard->receiveArena);
+
+        // 3) Stats ENet des peers + débit recommandé (toutes les sampleIntervalMs)
+        rcnet_net_shards_samplePeers(shard);
+    }
+
+    tlsReceiveArena = nullptr;
+}
+
+// ======================================================
+// API
+// ======================================================
+
+void rcnet_net_shards_get_default_config(RCNET_NetShardsConfig* outConfig)
+{
+    outConfig->port = 7777;
+    outConfig->shardCount = 1;
+    outConfig->peersPerShard = 64;
+    outConfig->channelCount = 2;
+    outConfig->incomingBandwidth = 0;
+    outConfig->outgoingBandwidth = 0;
+    outConfig->serviceTimeoutMs = 1;
+    outConfig->sendQueueCapacity = 4096;
+    outConfig->receiveArenaBytes = 64 * 1024;
+    outConfig->pinThreads = false;
+    outConfig->firstCpuCore = 0;
+    outConfig->wakeEngineOnActivity = true;
+    outConfig->peerRate.sampleIntervalMs = 100;
+    outConfig->peerRate.minPayloadBytes = 256;
+    outConfig->peerRate.maxPayloadBytes = 1200;
+    outConfig->peerRate.maxSendInterval = 4;
+    outConfig->peerRate.maxQueuedCommands = 64;
+    outConfig->peerRate.maxRttInflationMs = 150;
+    outConfig->peerRate.maxPacketLoss = 0.05f;
+    outConfig->secure = false;
+    outConfig->secureKeys = RCNET_SecureKeyPair{};
+    outConfig->callbacks.on_connect = NULL;
+    outConfig->callbacks.on_disconnect = NULL;
+    outConfig->callbacks.on_receive = NULL;
+    outConfig->userdata = NULL;
+}
+
+RCNET_NetShards* rcnet_net_shards_create(const RCNET_NetShardsConfig* config)
+{
+    if (config == NULL || config->shardCount == 0 || config->peersPerShard == 0 || config->channelCount == 0 ||
+        (config->secure && config->channelCount > RCNET_SECURE_MAX_CHANNELS))
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_net_shards_create: invalid configuration\n");
+        return NULL;
+    }
+
+    RCNET_NetShards* shards = new (std::nothrow) RCNET_NetShards();
+    if (shards == NULL)
+        return NULL;
+
+    // RCENet initialisé à la demande (compté : partagé avec les autres shards / matchs du process)
+    if (!rcnet_subsystem_acquire(RCNET_SUBSYSTEM_RCENET))
+    {
+        delete shards;
+        return NULL;
+    }
+    shards->rcenetAcquired = true;
+
+    shards->config = *config;
+    shards->maxClients = config->shardCount * config->peersPerShard;
+
+#if defined(RCNET_NET_SHARDS_HAS_REUSEPORT)
+    shards->reusePort = config->shardCount > 1;
+#else
+    shards->reusePort = false;
+#endif
+
+    shards->shards = new (std::nothrow) RCNET_NetShard[config->shardCount];
+    shards->connectionGeneration = new (std::nothrow) std::atomic<uint32_t>[shards->maxClients];
+    shards->peerStates = new (std::nothrow) RCNET_NetPeerState[shards->maxClients];
+    if (shards->shards == NULL || shards->connectionGeneration == NULL || shards->peerStates == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_net_shards_create: out of memory\n");
+        rcnet_net_shards_destroy(shards);
+        return NULL;
+    }
+
+    for (uint32_t clientId = 0; clientId < shards->maxClients; ++clientId)
+        shards->connectionGeneration[clientId].store(0, std::memory_order_relaxed);
+
+    if (config->secure)
+    {
+        shards->secureSessions = new (std::nothrow) RCNET_SecureSession*[shards->maxClients]();
+        if (shards->secureSessions == NULL)
+        {
+            RCNET_log(RCNET_LOG_ERROR, "rcnet_net_shards_create: out of memory\n");
+            rcnet_net_shards_destroy(shards);
+            return NULL;
+        }
+
+        for (uint32_t clientId = 0; clientId < shards->maxClients; ++clientId)
+        {
+            shards->secureSessions[clientId] = rcnet_secure_session_create(config->channelCount);
+            if (shards->secureSessions[clientId] == NULL)
+            {
+                rcnet_net_shards_destroy(shards);
+                return NULL;
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < config->shardCount; ++i)
+    {
+        RCNET_NetShard& shard = shards->shards[i];
+        shard.owner = shards;
+        shard.index = i;
+        shard.firstClientId = i * config->peersPerShard;
+        shard.port = shards->reusePort ? config->port : static_cast<uint16_t>(config->port + i);
+
+        shard.host = rcnet_net_shards_createHost(config, shard.port, shards->reusePort);
+        shard.sendQueue = rcnet_ring_queue_create(sizeof(RCNET_NetShardSendRequest), config->sendQueueCapacity, RCNET_RING_QUEUE_MPSC);
+        shard.receiveArena = rcnet_arena_create(config->receiveArenaBytes > 0 ? config->receiveArenaBytes : 4096);
+        if (shard.host == NULL || shard.sendQueue == NULL || shard.receiveArena == NULL)
+        {
+            RCNET_log(RCNET_LOG_ERROR, "rcnet_net_shards_create: failed to create shard %u on port %u\n", i, shard.port);
+            rcnet_net_shards_destroy(shards);
+            return NULL;
+        }
+    }
+
+    RCNET_log(RCNET_LOG_INFO, "[NET] %u shard(s) x %u peers listening on port %u%s%s\n",
+              config->shardCount, config->peersPerShard, config->port,
+              shards->reusePort ? " (SO_REUSEPORT)" : (config->shardCount > 1 ? " (+ port range)" : ""),
+              config->secure ? ", encrypted" : "");
+
+    return shards;
+}
+
+bool rcnet_net_shards_start(RCNET_NetShards* shards)
+{
+    shards->running.store(true, std::memory_order_relaxed);
+
+    for (uint32_t i = 0; i < shards->config.shardCount; ++i)
+    {
+        try
+        {
+            shards->shards[i].thread = std::thread(rcnet_net_shards_threadMain, &shards->shards[i]);
+        }
+        catch (const std::exception&)
+        {
+            RCNET_log(RCNET_LOG_ERROR, "rcnet_net_shards_start: failed to start thread for shard %u\n", i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void rcnet_net_shards_destroy(RCNET_NetShards* shards)
+{
+    if (shards == NULL)
+        return;
+
+    shards->running.store(false, std::memory_order_relaxed);
+
+    if (shards->shards != NULL)
+    {
+        for (uint32_t i = 0; i < shards->config.shardCount; ++i)
+        {
+            if (shards->shards[i].thread.joinable())
+                shards->shards[i].thread.join();
+        }
+
+        // Packets jamais envoyés : un packet par requête, jamais pris par ENet
+        for (uint32_t i = 0; i < shards->config.shardCount; ++i)
+        {
+            RCNET_NetShard& shard = shards->shards[i];
+            if (shard.sendQueue == NULL)
+                continue;
+
+            RCNET_NetShardSendRequest batch[kSendBatchSize];
+            uint32_t count;
+            while ((count = rcnet_ring_queue_pop_batch(shard.sendQueue, batch, kSendBatchSize)) > 0)
+            {
+                for (uint32_t r = 0; r < count; ++r)
+                    enet_packet_destroy(batch[r].packet);
+            }
+            rcnet_ring_queue_destroy(shard.sendQueue);
+        }
+
+        for (uint32_t i = 0; i < shards->config.shardCount; ++i)
+        {
+            RCNET_NetShard& shard = shards->shards[i];
+
+            if (shard.host != NULL)
+                enet_host_destroy(shard.host);
+
+            rcnet_arena_destroy(shard.receiveArena);
+        }
+        delete[] shards->shards;
+    }
+
+    delete[] shards->connectionGeneration;
+    delete[] shards->peerStates;
+    if (shards->secureSessions != NULL)
+    {
+        for (uint32_t clientId = 0; clientId < shards->maxClients; ++clientId)
+            rcnet_secure_session_destroy(shards->secureSessions[clientId]);
+        delete[] shards->secureSessions;
+    }
+    rcnet_secure_wipe(&shards->config.secureKeys, sizeof(shards->config.secureKeys));
+    if (shards->rcenetAcquired)
+        rcnet_subsystem_release(RCNET_SUBSYSTEM_RCENET);
+    delete shards;
+}
+
+RCNET_Arena* rcnet_net_shards_get_receive_arena(void)
+{
+    return tlsReceiveArena;
+}
+
+uint32_t rcnet_net_shards_get_shard_count(const RCNET_NetShards* shards)
+{
+    return shards->config.shardCount;
+}
+
+uint32_t rcnet_net_shards_get_max_clients(const RCNET_NetShards* shards)
+{
+    return shards->maxClients;
+}
+
+uint16_t rcnet_net_shards_get_port(const RCNET_NetShards* shards, uint32_t shardIndex)
+{
+    if (shardIndex >= shards->config.shardCount)
+        return 0;
+    return shards->shards[shardIndex].port;
+}
+
+bool rcnet_net_shards_uses_reuseport(const RCNET_NetShards* shards)
+{
+    return shards->reusePort;
+}
+
+bool rcnet_net_shards_is_connected(const RCNET_NetShards* shards, uint32_t clientId)
+{
+    if (clientId >= shards->maxClients)
+        return false;
+    return (shards->connectionGeneration[clientId].load(std::memory_order_acquire) & 1u) != 0;
+}
+
+bool rcnet_net_shards_send(RCNET_NetShards* shards, uint32_t clientId, uint8_t channelId, ENetPacket* packet)
+{
+    if (packet == NULL)
+        return false;
+
+    uint32_t generation = (clientId < shards->maxClients)
+        ? shards->connectionGeneration[clientId].load(std::memory_order_acquire)
+        : 0;
+
+    if ((generation & 1u) == 0 || channelId >= shards->config.channelCount)
+    {
+        enet_packet_destroy(packet);
+        return false;
+    }
+
+    RCNET_NetShardSendRequest request;
+    request.clientId = clientId;
+    request.connectionGeneration = generation;
+    request.channelId = channelId;
+    request.packet = packet;
+
+    RCNET_NetShard& shard = shards->shards[clientId / shards->config.peersPerShard];
+    if (!rcnet_ring_queue_push(shard.sendQueue, &request))
+    {
+        enet_packet_destroy(packet);
+        return false;
+    }
+
+    return true;
+}
+
+bool rcnet_net_shards_get_peer_stats(const RCNET_NetShards* shards, uint32_t clientId, RCNET_NetPeerStats* outStats)
+{
+    if (outStats == NULL)
+        return false;
+
+    *outStats = RCNET_NetPeerStats{};
+    if (!rcnet_net_shards_is_connected(shards, clientId))
+        return false;
+
+    const RCNET_NetPeerState& state = shards->peerStates[clientId];
+    outStats->connected               = true;
+    outStats->congested               = state.congested.load(std::memory_order_relaxed);
+    outStats->roundTripTimeMs         = state.roundTripTime.load(std::memory_order_relaxed);
+    outStats->roundTripTimeVarianceMs = state.roundTripTimeVariance.load(std::memory_order_relaxed);
+    outStats->minRoundTripTimeMs      = state.minRoundTripTimePublished.load(std::memory_order_relaxed);
+    outStats->packetLoss              = static_cast<float>(state.packetLoss.load(std::memory_order_relaxed)) / static_cast<float>(ENET_PEER_PACKET_LOSS_SCALE);
+    outStats->queuedCommands          = state.queuedCommands.load(std::memory_order_relaxed);
+    outStats->reliableBytesInTransit  = state.reliableBytesInTransit.load(std::memory_order_relaxed);
+    outStats->sentBytesPerSecond      = state.sentBytesPerSecond.load(std::memory_order_relaxed);
+    outStats->estimatedBytesPerSecond = state.estimatedBytesPerSecond.load(std::memory_order_relaxed);
+    outStats->sentBytes               = state.sentBytesPublished.load(std::memory_order_relaxed);
+    outStats->sendInterval            = state.sendIntervalPublished.load(std::memory_order_relaxed);
+    outStats->payloadBudgetBytes      = state.payloadBudgetPublished.load(std::memory_order_relaxed);
+    return true;
+}
+
+uint64_t rcnet_net_shards_get_send_overflow_count(const RCNET_NetShards* shards)
+{
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < shards->config.shardCount; ++i)
+        total += rcnet_ring_queue_get_overflow_count(shards->shards[i].sendQueue);
+    return total;
+}
+
+bool rcnet_net_shards_get_secure_stats(const RCNET_NetShards* shards, uint32_t clientId, RCNET_SecureSessionStats* outStats)
+{
+    if (outStats == NULL)
+        return false;
+
+    *outStats = RCNET_SecureSessionStats{};
+    if (shards->secureSessions == NULL || clientId >= shards->maxClients)
+        return false;
+
+    rcnet_secure_session_get_stats(shards->secureSessions[clientId], outStats);
+    return true;
+}
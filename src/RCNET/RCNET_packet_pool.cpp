@@ -0,0 +1,292 @@
+#include "RCNET/RCNET_packet_pool.h"
+#include "RCNET/RCNET_logger.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// Classe des buffers plus grands que maxBufferSize (alloués / libérés à chaque packet)
+static constexpr uint32_t kOversizedClass = UINT32_MAX;
+
+// En-tête placé juste avant les données : permet de rendre le buffer depuis le seul pointeur
+struct alignas(16) RCNET_PacketBufferHeader
+{
+    RCNET_PacketPool* pool;
+    uint32_t sizeClass;
+    uint32_t capacity;
+};
+
+struct RCNET_PacketPoolClass
+{
+    std::mutex mutex;
+    std::vector<RCNET_PacketBufferHeader*> freeBuffers;
+    uint32_t capacity = 0;
+};
+
+struct RCNET_PacketPool
+{
+    RCNET_PacketPoolConfig config;
+    uint32_t minShift = 0;
+    uint32_t classCount = 0;
+    RCNET_PacketPoolClass* classes = nullptr;
+
+    std::atomic<uint64_t> acquired{0};
+    std::atomic<uint64_t> released{0};
+    std::atomic<uint64_t> heapAllocations{0};
+    std::atomic<uint64_t> oversized{0};
+    std::atomic<uint32_t> outstanding{0};
+    std::atomic<size_t> cachedBytes{0};
+};
+
+static inline uint32_t rcnet_packet_pool_ceilShift(uint32_t value)
+{
+    uint32_t shift = 0;
+    while ((1u << shift) < value && shift < 31)
+        shift++;
+    return shift;
+}
+
+static inline RCNET_PacketBufferHeader* rcnet_packet_pool_header(const void* buffer)
+{
+    return reinterpret_cast<RCNET_PacketBufferHeader*>(const_cast<uint8_t*>(static_cast<const uint8_t*>(buffer))) - 1;
+}
+
+static RCNET_PacketBufferHeader* rcnet_packet_pool_allocateBuffer(RCNET_PacketPool* pool, uint32_t sizeClass, size_t capacity)
+{
+    RCNET_PacketBufferHeader* header = static_cast<RCNET_PacketBufferHeader*>(std::malloc(sizeof(RCNET_PacketBufferHeader) + capacity));
+    if (header == NULL)
+        return NULL;
+
+    header->pool = pool;
+    header->sizeClass = sizeClass;
+    header->capacity = static_cast<uint32_t>(capacity);
+    pool->heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    return header;
+}
+
+// freeCallback des packets créés par rcnet_packet_pool_create_packet (thread du shard qui détruit le packet)
+static void rcnet_packet_pool_onPacketFree(ENetPacket* packet)
+{
+    rcnet_packet_pool_release(packet->userData);
+    packet->userData = NULL;
+}
+
+void rcnet_packet_pool_get_default_config(RCNET_PacketPoolConfig* outConfig)
+{
+    if (outConfig == NULL)
+        return;
+
+    outConfig->minBufferSize = 64;
+    outConfig->maxBufferSize = 64 * 1024;
+    outConfig->preallocatedPerClass = 32;
+    outConfig->maxFreePerClass = 4096;
+}
+
+RCNET_PacketPool* rcnet_packet_pool_create(const RCNET_PacketPoolConfig* config)
+{
+    RCNET_PacketPoolConfig effective;
+    if (config != NULL)
+        effective = *config;
+    else
+        rcnet_packet_pool_get_default_config(&effective);
+
+    if (effective.minBufferSize == 0 || effective.maxBufferSize < effective.minBufferSize)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_packet_pool_create: invalid buffer sizes (min=%u max=%u)\n",
+                  effective.minBufferSize, effective.maxBufferSize);
+        return NULL;
+    }
+
+    RCNET_PacketPool* pool = new (std::nothrow) RCNET_PacketPool();
+    if (pool == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_packet_pool_create: out of memory\n");
+        return NULL;
+    }
+
+    pool->config = effective;
+    pool->minShift = rcnet_packet_pool_ceilShift(effective.minBufferSize);
+    pool->classCount = rcnet_packet_pool_ceilShift(effective.maxBufferSize) - pool->minShift + 1;
+    pool->classes = new (std::nothrow) RCNET_PacketPoolClass[pool->classCount];
+    if (pool->classes == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_packet_pool_create: out of memory\n");
+        delete pool;
+        return NULL;
+    }
+
+    for (uint32_t c = 0; c < pool->classCount; ++c)
+    {
+        RCNET_PacketPoolClass& sizeClass = pool->classes[c];
+        sizeClass.capacity = 1u << (pool->minShift + c);
+
+        try
+        {
+            sizeClass.freeBuffers.reserve(effective.maxFreePerClass);
+        }
+        catch (const std::exception&)
+        {
+            RCNET_log(RCNET_LOG_ERROR, "rcnet_packet_pool_create: out of memory\n");
+            rcnet_packet_pool_destroy(pool);
+            return NULL;
+        }
+
+        for (uint32_t i = 0; i < effective.preallocatedPerClass && i < effective.maxFreePerClass; ++i)
+        {
+            RCNET_PacketBufferHeader* header = rcnet_packet_pool_allocateBuffer(pool, c, sizeClass.capacity);
+            if (header == NULL)
+                break;
+
+            sizeClass.freeBuffers.push_back(header);
+            pool->cachedBytes.fetch_add(sizeClass.capacity, std::memory_order_relaxed);
+        }
+    }
+
+    return pool;
+}
+
+void rcnet_packet_pool_destroy(RCNET_PacketPool* pool)
+{
+    if (pool == NULL)
+        return;
+
+    uint32_t outstanding = pool->outstanding.load(std::memory_order_acquire);
+    if (outstanding != 0)
+        RCNET_log(RCNET_LOG_WARN, "rcnet_packet_pool_destroy: %u buffer(s) still in flight\n", outstanding);
+
+    if (pool->classes != NULL)
+    {
+        for (uint32_t c = 0; c < pool->classCount; ++c)
+        {
+            for (RCNET_PacketBufferHeader* header : pool->classes[c].freeBuffers)
+                std::free(header);
+        }
+        delete[] pool->classes;
+    }
+
+    delete pool;
+}
+
+void* rcnet_packet_pool_acquire(RCNET_PacketPool* pool, size_t capacity)
+{
+    if (pool == NULL)
+        return NULL;
+
+    RCNET_PacketBufferHeader* header = NULL;
+
+    if (capacity > pool->config.maxBufferSize)
+    {
+        pool->oversized.fetch_add(1, std::memory_order_relaxed);
+        header = rcnet_packet_pool_allocateBuffer(pool, kOversizedClass, capacity);
+    }
+    else
+    {
+        uint32_t shift = rcnet_packet_pool_ceilShift(static_cast<uint32_t>(capacity));
+        uint32_t c = (shift > pool->minShift) ? shift - pool->minShift : 0;
+        RCNET_PacketPoolClass& sizeClass = pool->classes[c];
+
+        {
+            std::lock_guard<std::mutex> lock(sizeClass.mutex);
+            if (!sizeClass.freeBuffers.empty())
+            {
+                header = sizeClass.freeBuffers.back();
+                sizeClass.freeBuffers.pop_back();
+            }
+        }
+
+        if (header != NULL)
+            pool->cachedBytes.fetch_sub(sizeClass.capacity, std::memory_order_relaxed);
+        else
+            header = rcnet_packet_pool_allocateBuffer(pool, c, sizeClass.capacity);
+    }
+
+    if (header == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_packet_pool_acquire: out of memory (%zu bytes)\n", capacity);
+        return NULL;
+    }
+
+    pool->acquired.fetch_add(1, std::memory_order_relaxed);
+    pool->outstanding.fetch_add(1, std::memory_order_relaxed);
+    return header + 1;
+}
+
+size_t rcnet_packet_pool_get_buffer_capacity(const void* buffer)
+{
+    return buffer != NULL ? rcnet_packet_pool_header(buffer)->capacity : 0;
+}
+
+void rcnet_packet_pool_release(void* buffer)
+{
+    if (buffer == NULL)
+        return;
+
+    RCNET_PacketBufferHeader* header = rcnet_packet_pool_header(buffer);
+    RCNET_PacketPool* pool = header->pool;
+
+    pool->released.fetch_add(1, std::memory_order_relaxed);
+    pool->outstanding.fetch_sub(1, std::memory_order_release);
+
+    if (header->sizeClass != kOversizedClass)
+    {
+        RCNET_PacketPoolClass& sizeClass = pool->classes[header->sizeClass];
+
+        std::lock_guard<std::mutex> lock(sizeClass.mutex);
+        if (sizeClass.freeBuffers.size() < pool->config.maxFreePerClass)
+        {
+            sizeClass.freeBuffers.push_back(header);
+            pool->cachedBytes.fetch_add(sizeClass.capacity, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    std::free(header);
+}
+
+ENetPacket* rcnet_packet_pool_create_packet(void* buffer, size_t length, enet_uint32 flags)
+{
+    if (buffer == NULL)
+        return NULL;
+
+    if (length > rcnet_packet_pool_get_buffer_capacity(buffer))
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_packet_pool_create_packet: length %zu exceeds buffer capacity\n", length);
+        rcnet_packet_pool_release(buffer);
+        return NULL;
+    }
+
+    // Les données ne sont ni copiées ni allouées par ENet
+    ENetPacket* packet = enet_packet_create(buffer, length, flags | ENET_PACKET_FLAG_NO_ALLOCATE);
+    if (packet == NULL)
+    {
+        rcnet_packet_pool_release(buffer);
+        return NULL;
+    }
+
+    packet->freeCallback = rcnet_packet_pool_onPacketFree;
+    packet->userData = buffer;
+    return packet;
+}
+
+void rcnet_packet_pool_get_stats(const RCNET_PacketPool* pool, RCNET_PacketPoolStats* outStats)
+{
+    if (outStats == NULL)
+        return;
+
+    std::memset(outStats, 0, sizeof(*outStats));
+    if (pool == NULL)
+        return;
+
+    outStats->acquired        = pool->acquired.load(std::memory_order_relaxed);
+    outStats->released        = pool->released.load(std::memory_order_relaxed);
+    outStats->heapAllocations = pool->heapAllocations.load(std::memory_order_relaxed);
+    outStats->oversized       = pool->oversized.load(std::memory_order_relaxed);
+    outStats->outstanding     = pool->outstanding.load(std::memory_order_relaxed);
+    outStats->cachedBytes     = pool->cachedBytes.load(std::memory_order_relaxed);
+}
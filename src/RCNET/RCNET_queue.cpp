@@ -0,0 +1,267 @@
+#include "RCNET/RCNET_queue.h"
+#include "RCNET/RCNET_logger.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <cstring>
+#include <new>
+
+// Taille d'une ligne de cache (x64 et arm64 courants)
+static constexpr size_t kCacheLineSize = 64;
+
+// Capacité maximale (2^31) pour que l'arrondi à la puissance de 2 ne déborde pas
+static constexpr uint32_t kMaxRingQueueCapacity = 1u << 31;
+
+/**
+ * Layout :
+ * - ligne 1 : index producteur (+ cache de l'index consommateur en SPSC)
+ * - ligne 2 : index consommateur (+ cache de l'index producteur)
+ * - ligne 3 : compteur d'overflow (écrit uniquement quand la queue est pleine)
+ * - ligne 4 : paramètres immuables (lus par tout le monde, jamais écrits)
+ *
+ * SPSC : une cellule = elementSize octets.
+ * MPSC : une cellule = [sequence atomic u64][element] (algorithme de Dmitry Vyukov),
+ *        la sequence indique si la cellule est libre (== pos) ou publiée (== pos + 1).
+ */
+struct RCNET_RingQueue
+{
+    alignas(kCacheLineSize) std::atomic<uint64_t> tail{0};
+    uint64_t cachedHead = 0;
+
+    alignas(kCacheLineSize) std::atomic<uint64_t> head{0};
+    uint64_t cachedTail = 0;
+
+    alignas(kCacheLineSize) std::atomic<uint64_t> overflowed{0};
+
+    alignas(kCacheLineSize) RCNET_RingQueueMode mode = RCNET_RING_QUEUE_SPSC;
+    uint32_t capacity = 0;
+    uint64_t mask = 0;
+    size_t elementSize = 0;
+    size_t cellStride = 0;
+    size_t elementOffset = 0;
+    uint8_t* cells = nullptr;
+};
+
+static inline std::atomic<uint64_t>* rcnet_ring_queue_cellSequence(RCNET_RingQueue* queue, uint64_t position)
+{
+    return reinterpret_cast<std::atomic<uint64_t>*>(queue->cells + (position & queue->mask) * queue->cellStride);
+}
+
+static inline uint8_t* rcnet_ring_queue_cellData(RCNET_RingQueue* queue, uint64_t position)
+{
+    return queue->cells + (position & queue->mask) * queue->cellStride + queue->elementOffset;
+}
+
+RCNET_RingQueue* rcnet_ring_queue_create(size_t elementSize, uint32_t capacity, RCNET_RingQueueMode mode)
+{
+    if (elementSize == 0 || capacity == 0 || capacity > kMaxRingQueueCapacity)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_ring_queue_create: invalid elementSize=%zu or capacity=%u\n", elementSize, capacity);
+        return NULL;
+    }
+
+    // Arrondi à la puissance de 2 supérieure (index & mask au lieu de modulo)
+    uint32_t realCapacity = 1;
+    while (realCapacity < capacity)
+        realCapacity <<= 1;
+
+    RCNET_RingQueue* queue = new (std::nothrow) RCNET_RingQueue();
+    if (queue == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_ring_queue_create: out of memory\n");
+        return NULL;
+    }
+
+    queue->mode = mode;
+    queue->capacity = realCapacity;
+    queue->mask = static_cast<uint64_t>(realCapacity) - 1;
+    queue->elementSize = elementSize;
+
+    if (mode == RCNET_RING_QUEUE_MPSC)
+    {
+        constexpr size_t kSeqSize = sizeof(std::atomic<uint64_t>);
+        queue->elementOffset = kSeqSize;
+        queue->cellStride = (kSeqSize + elementSize + (kSeqSize - 1)) & ~(kSeqSize - 1);
+    }
+    else
+    {
+        queue->elementOffset = 0;
+        queue->cellStride = elementSize;
+    }
+
+    size_t totalBytes = queue->cellStride * static_cast<size_t>(realCapacity);
+    queue->cells = static_cast<uint8_t*>(::operator new(totalBytes, std::align_val_t(kCacheLineSize), std::nothrow));
+    if (queue->cells == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_ring_queue_create: out of memory (%zu bytes)\n", totalBytes);
+        delete queue;
+        return NULL;
+    }
+
+    if (mode == RCNET_RING_QUEUE_MPSC)
+    {
+        for (uint64_t i = 0; i < realCapacity; ++i)
+            new (rcnet_ring_queue_cellSequence(queue, i)) std::atomic<uint64_t>(i);
+    }
+
+    return queue;
+}
+
+void rcnet_ring_queue_destroy(RCNET_RingQueue* queue)
+{
+    if (queue == NULL)
+        return;
+
+    ::operator delete(queue->cells, std::align_val_t(kCacheLineSize));
+    delete queue;
+}
+
+static bool rcnet_ring_queue_pushSpsc(RCNET_RingQueue* queue, const void* element)
+{
+    uint64_t tail = queue->tail.load(std::memory_order_relaxed);
+
+    // On ne relit l'index consommateur (autre ligne de cache) que si le cache dit "plein"
+    if (tail - queue->cachedHead >= queue->capacity)
+    {
+        queue->cachedHead = queue->head.load(std::memory_order_acquire);
+        if (tail - queue->cachedHead >= queue->capacity)
+        {
+            queue->overflowed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    std::memcpy(rcnet_ring_queue_cellData(queue, tail), element, queue->elementSize);
+    queue->tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+static bool rcnet_ring_queue_pushMpsc(RCNET_RingQueue* queue, const void* element)
+{
+    uint64_t position = queue->tail.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        std::atomic<uint64_t>* sequence = rcnet_ring_queue_cellSequence(queue, position);
+        uint64_t seq = sequence->load(std::memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(position);
+
+        if (diff == 0)
+        {
+            // Cellule libre : on tente de réserver la position
+            if (queue->tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                std::memcpy(rcnet_ring_queue_cellData(queue, position), element, queue->elementSize);
+                sequence->store(position + 1, std::memory_order_release);
+                return true;
+            }
+            // Echec CAS : position a été rechargée, on réessaie
+        }
+        else if (diff < 0)
+        {
+            // Cellule encore occupée par un tour précédent => pleine
+            queue->overflowed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            // Un autre producteur a avancé, relire la position courante
+            position = queue->tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool rcnet_ring_queue_push(RCNET_RingQueue* queue, const void* element)
+{
+    if (queue->mode == RCNET_RING_QUEUE_MPSC)
+        return rcnet_ring_queue_pushMpsc(queue, element);
+    return rcnet_ring_queue_pushSpsc(queue, element);
+}
+
+static uint32_t rcnet_ring_queue_popBatchSpsc(RCNET_RingQueue* queue, uint8_t* out, uint32_t maxCount)
+{
+    uint64_t head = queue->head.load(std::memory_order_relaxed);
+
+    uint64_t available = queue->cachedTail - head;
+    if (available < maxCount)
+    {
+        queue->cachedTail = queue->tail.load(std::memory_order_acquire);
+        available = queue->cachedTail - head;
+    }
+
+    uint32_t count = (available < maxCount) ? static_cast<uint32_t>(available) : maxCount;
+    if (count == 0)
+        return 0;
+
+    // Copie en 2 segments contigus max (avant / après le bouclage du ring)
+    uint64_t firstIndex = head & queue->mask;
+    uint64_t firstCount = queue->capacity - firstIndex;
+    if (firstCount > count)
+        firstCount = count;
+
+    std::memcpy(out, queue->cells + firstIndex * queue->elementSize, firstCount * queue->elementSize);
+    if (firstCount < count)
+        std::memcpy(out + firstCount * queue->elementSize, queue->cells, (count - firstCount) * queue->elementSize);
+
+    queue->head.store(head + count, std::memory_order_release);
+    return count;
+}
+
+static uint32_t rcnet_ring_queue_popBatchMpsc(RCNET_RingQueue* queue, uint8_t* out, uint32_t maxCount)
+{
+    uint64_t head = queue->head.load(std::memory_order_relaxed);
+    uint32_t count = 0;
+
+    while (count < maxCount)
+    {
+        std::atomic<uint64_t>* sequence = rcnet_ring_queue_cellSequence(queue, head);
+        if (sequence->load(std::memory_order_acquire) != head + 1)
+            break; // pas encore publié
+
+        std::memcpy(out + static_cast<size_t>(count) * queue->elementSize, rcnet_ring_queue_cellData(queue, head), queue->elementSize);
+
+        // Libère la cellule pour le tour suivant
+        sequence->store(head + queue->capacity, std::memory_order_release);
+        head++;
+        count++;
+    }
+
+    if (count > 0)
+        queue->head.store(head, std::memory_order_release);
+    return count;
+}
+
+uint32_t rcnet_ring_queue_pop_batch(RCNET_RingQueue* queue, void* outElements, uint32_t maxCount)
+{
+    if (maxCount == 0)
+        return 0;
+
+    uint8_t* out = static_cast<uint8_t*>(outElements);
+    if (queue->mode == RCNET_RING_QUEUE_MPSC)
+        return rcnet_ring_queue_popBatchMpsc(queue, out, maxCount);
+    return rcnet_ring_queue_popBatchSpsc(queue, out, maxCount);
+}
+
+uint32_t rcnet_ring_queue_get_capacity(const RCNET_RingQueue* queue)
+{
+    return queue->capacity;
+}
+
+uint64_t rcnet_ring_queue_get_overflow_count(const RCNET_RingQueue* queue)
+{
+    return queue->overflowed.load(std::memory_order_relaxed);
+}
+
+void rcnet_ring_queue_get_stats(const RCNET_RingQueue* queue, RCNET_RingQueueStats* outStats)
+{
+    uint64_t head = queue->head.load(std::memory_order_acquire);
+    uint64_t tail = queue->tail.load(std::memory_order_acquire);
+
+    outStats->capacity   = queue->capacity;
+    outStats->size       = (tail > head) ? static_cast<uint32_t>(tail - head) : 0;
+    outStats->pushed     = tail;
+    outStats->popped     = head;
+    outStats->overflowed = queue->overflowed.load(std::memory_order_relaxed);
+}
@@ -1,16 +1,739 @@
-#include <hiredis.h>
+#include "RCNET/RCNET_redis.h"
+#include "RCNET/RCNET_logger.h"
+#include "RCNET/RCNET_subsystem.h"
+#include "RCNET/RCNET_timer.h"
+
+// ================================
+// Dependencies Libraries hiredis
+// ================================
+#include <async.h>
 #include <hiredis_ssl.h>
 
-void test(void)
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <winsock2.h>
+    typedef WSAPOLLFD RCNET_RedisPollFd;
+#else
+    #include <poll.h>
+    typedef struct pollfd RCNET_RedisPollFd;
+#endif
+
+// Commande formatée (protocole RESP) en attente dans RCNET_RedisBatch::bytes
+struct RCNET_RedisQueuedCommand
+{
+    size_t offset;
+    size_t length;
+    RCNET_RedisCallback callback;
+    void* userdata;
+    uint64_t enqueueNs;
+};
+
+// Buffer de commandes : les capacités sont conservées d'un tick à l'autre (pas d'allocation en régime établi)
+struct RCNET_RedisBatch
+{
+    std::vector<RCNET_RedisQueuedCommand> commands;
+    std::vector<char> bytes;
+
+    void clear()
+    {
+        commands.clear();
+        bytes.clear();
+    }
+};
+
+struct RCNET_RedisConnection;
+
+// Commande envoyée, en attente de sa réponse (slot préalloué, passé en privdata à hiredis)
+struct RCNET_RedisInFlight
+{
+    RCNET_RedisConnection* connection;
+    RCNET_RedisCallback callback;
+    void* userdata;
+    uint64_t enqueueNs;
+    uint32_t index;
+};
+
+struct RCNET_RedisConnection
+{
+    RCNET_RedisClient* client = nullptr;
+    redisAsyncContext* context = nullptr;
+    bool connected = false;
+    bool wantRead = false;
+    bool wantWrite = false;
+    uint64_t timerDeadlineNs = 0;   // 0 = pas de timer hiredis (timeouts connexion / commande)
+    uint64_t reconnectAtNs = 0;
+    bool everConnected = false;
+    uint32_t pending = 0;
+};
+
+struct RCNET_RedisClient
+{
+    RCNET_RedisConfig config;
+
+    // Copies des chaînes de la configuration
+    std::string host;
+    std::string username;
+    std::string password;
+    std::string caFile;
+    std::string certFile;
+    std::string keyFile;
+    std::string serverName;
+
+    redisSSLContext* sslContext = nullptr;
+    bool opensslAcquired = false;
+    bool destroying = false;   // écrit sous queueMutex (lu aussi par le thread de rcnet_redis_update)
+
+    // Pool (thread de rcnet_redis_update uniquement)
+    std::vector<RCNET_RedisConnection> connections;
+    uint32_t nextConnection = 0;
+    std::vector<RCNET_RedisInFlight> inFlight;
+    std::vector<uint32_t> freeInFlight;
+    std::vector<RCNET_RedisPollFd> pollFds;
+    std::vector<RCNET_RedisConnection*> pollConnections;
+    uint32_t deliveredThisUpdate = 0;
+
+    // Producteurs (n'importe quel thread)
+    std::mutex queueMutex;
+    RCNET_RedisBatch incoming;
+
+    // Batch en cours d'envoi (le reste attend qu'une connexion ait de la place)
+    RCNET_RedisBatch sending;
+    size_t sendCursor = 0;
+
+    std::atomic<uint64_t> commands{0};
+    std::atomic<uint64_t> replies{0};
+    std::atomic<uint64_t> errorReplies{0};
+    std::atomic<uint64_t> failed{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<uint64_t> reconnects{0};
+    std::atomic<uint32_t> queuedCount{0};
+    std::atomic<uint32_t> pendingCount{0};
+    std::atomic<uint32_t> connectedCount{0};
+    RCNET_Histogram* latencyNs = nullptr;
+};
+
+static inline struct timeval rcnet_redis_toTimeval(int ms)
+{
+    struct timeval tv;
+    tv.tv_sec = ms / 1000;
+    tv.tv_usec = (ms % 1000) * 1000;
+    return tv;
+}
+
+static inline int rcnet_redis_poll(RCNET_RedisPollFd* fds, size_t count)
+{
+#if defined(_WIN32)
+    return WSAPoll(fds, static_cast<ULONG>(count), 0);
+#else
+    return poll(fds, static_cast<nfds_t>(count), 0);
+#endif
+}
+
+// ======================================================
+// Adaptateur d'event loop hiredis : on note seulement les intérêts,
+// rcnet_redis_update() fait le poll (timeout 0) et appelle redisAsyncHandle*
+// ======================================================
+static void rcnet_redis_addRead(void* privdata)  { static_cast<RCNET_RedisConnection*>(privdata)->wantRead = true; }
+static void rcnet_redis_delRead(void* privdata)  { static_cast<RCNET_RedisConnection*>(privdata)->wantRead = false; }
+static void rcnet_redis_addWrite(void* privdata) { static_cast<RCNET_RedisConnection*>(privdata)->wantWrite = true; }
+static void rcnet_redis_delWrite(void* privdata) { static_cast<RCNET_RedisConnection*>(privdata)->wantWrite = false; }
+
+static void rcnet_redis_cleanup(void* privdata)
+{
+    RCNET_RedisConnection* connection = static_cast<RCNET_RedisConnection*>(privdata);
+    connection->wantRead = false;
+    connection->wantWrite = false;
+    connection->timerDeadlineNs = 0;
+}
+
+static void rcnet_redis_scheduleTimer(void* privdata, struct timeval tv)
+{
+    RCNET_RedisConnection* connection = static_cast<RCNET_RedisConnection*>(privdata);
+    connection->timerDeadlineNs = rcnet_timer_get_time_ns() + static_cast<uint64_t>(tv.tv_sec) * 1000000000ull + static_cast<uint64_t>(tv.tv_usec) * 1000ull;
+}
+
+// ======================================================
+// Callbacks hiredis
+// ======================================================
+
+// Connexion perdue ou jamais établie : hiredis libère le contexte au retour du callback
+static void rcnet_redis_connectionLost(RCNET_RedisConnection* connection)
+{
+    RCNET_RedisClient* client = connection->client;
+
+    if (connection->connected)
+        client->connectedCount.fetch_sub(1, std::memory_order_relaxed);
+
+    connection->context = nullptr;
+    connection->connected = false;
+    connection->wantRead = false;
+    connection->wantWrite = false;
+    connection->timerDeadlineNs = 0;
+    connection->reconnectAtNs = rcnet_timer_get_time_ns() + static_cast<uint64_t>(client->config.reconnectDelayMs) * 1000000ull;
+}
+
+static void rcnet_redis_connectCallback(const redisAsyncContext* context, int status)
+{
+    RCNET_RedisConnection* connection = static_cast<RCNET_RedisConnection*>(context->data);
+
+    if (status != REDIS_OK)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to connect to Redis %s:%d: %s\n",
+                  connection->client->host.c_str(), connection->client->config.port, context->errstr ? context->errstr : "unknown error");
+        rcnet_redis_connectionLost(connection);
+        return;
+    }
+
+    connection->connected = true;
+    connection->everConnected = true;
+    connection->client->connectedCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void rcnet_redis_disconnectCallback(const redisAsyncContext* context, int status)
+{
+    RCNET_RedisConnection* connection = static_cast<RCNET_RedisConnection*>(context->data);
+
+    if (status != REDIS_OK && !connection->client->destroying)
+        RCNET_log(RCNET_LOG_ERROR, "Redis connection lost: %s\n", context->errstr ? context->errstr : "unknown error");
+
+    rcnet_redis_connectionLost(connection);
+}
+
+// Réponse d'AUTH / SELECT (commandes internes envoyées à chaque connexion)
+static void rcnet_redis_setupCallback(redisAsyncContext* context, void* reply, void* privdata)
+{
+    (void)context;
+    const redisReply* r = static_cast<const redisReply*>(reply);
+    const char* command = static_cast<const char*>(privdata);
+
+    if (r != nullptr && r->type == REDIS_REPLY_ERROR)
+        RCNET_log(RCNET_LOG_ERROR, "Redis %s failed: %s\n", command, r->str);
+}
+
+static void rcnet_redis_replyCallback(redisAsyncContext* context, void* reply, void* privdata)
+{
+    (void)context;
+    RCNET_RedisInFlight* record = static_cast<RCNET_RedisInFlight*>(privdata);
+    RCNET_RedisConnection* connection = record->connection;
+    RCNET_RedisClient* client = connection->client;
+    const redisReply* r = static_cast<const redisReply*>(reply);
+
+    connection->pending--;
+    client->pendingCount.fetch_sub(1, std::memory_order_relaxed);
+
+    if (r == nullptr)
+    {
+        client->failed.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        client->replies.fetch_add(1, std::memory_order_relaxed);
+        if (r->type == REDIS_REPLY_ERROR)
+            client->errorReplies.fetch_add(1, std::memory_order_relaxed);
+        rcnet_histogram_record(client->latencyNs, rcnet_timer_get_time_ns() - record->enqueueNs);
+    }
+
+    RCNET_RedisCallback callback = record->callback;
+    void* userdata = record->userdata;
+    client->freeInFlight.push_back(record->index);
+
+    if (callback != nullptr)
+    {
+        client->deliveredThisUpdate++;
+        callback(r, userdata);
+    }
+}
+
+// ======================================================
+// Connexions
+// ======================================================
+static void rcnet_redis_sendSetupCommand(RCNET_RedisConnection* connection, const char* name, int argc, const char** argv)
+{
+    char* command = nullptr;
+    long long length = redisFormatCommandArgv(&command, argc, argv, nullptr);
+    if (length <= 0)
+        return;
+
+    redisAsyncFormattedCommand(connection->context, rcnet_redis_setupCallback, const_cast<char*>(name), command, static_cast<size_t>(length));
+    redisFreeCommand(command);
+}
+
+static bool rcnet_redis_connect(RCNET_RedisConnection* connection)
+{
+    RCNET_RedisClient* client = connection->client;
+
+    redisOptions options;
+    memset(&options, 0, sizeof(options));
+    REDIS_OPTIONS_SET_TCP(&options, client->host.c_str(), client->config.port);
+
+    struct timeval connectTimeout = rcnet_redis_toTimeval(client->config.connectTimeoutMs);
+    struct timeval commandTimeout = rcnet_redis_toTimeval(client->config.commandTimeoutMs);
+    options.connect_timeout = &connectTimeout;
+    if (client->config.commandTimeoutMs > 0)
+        options.command_timeout = &commandTimeout;
+
+    // Retenter plus tard en cas d'échec immédiat
+    connection->reconnectAtNs = rcnet_timer_get_time_ns() + static_cast<uint64_t>(client->config.reconnectDelayMs) * 1000000ull;
+
+    redisAsyncContext* context = redisAsyncConnectWithOptions(&options);
+    if (context == nullptr || context->err)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to create Redis connection to %s:%d: %s\n",
+                  client->host.c_str(), client->config.port, (context && context->errstr) ? context->errstr : "allocation failed");
+        if (context)
+            redisAsyncFree(context);
+        return false;
+    }
+
+    if (client->sslContext != nullptr && redisInitiateSSLWithContext(&context->c, client->sslContext) != REDIS_OK)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "Failed to initiate Redis TLS: %s\n", context->c.errstr);
+        redisAsyncFree(context);
+        return false;
+    }
+
+    // L'adaptateur doit être en place avant le callback de connexion (hiredis attend l'écriture)
+    context->data = connection;
+    context->ev.data = connection;
+    context->ev.addRead = rcnet_redis_addRead;
+    context->ev.delRead = rcnet_redis_delRead;
+    context->ev.addWrite = rcnet_redis_addWrite;
+    context->ev.delWrite = rcnet_redis_delWrite;
+    context->ev.cleanup = rcnet_redis_cleanup;
+    context->ev.scheduleTimer = rcnet_redis_scheduleTimer;
+    connection->context = context;
+
+    redisAsyncSetConnectCallback(context, rcnet_redis_connectCallback);
+    redisAsyncSetDisconnectCallback(context, rcnet_redis_disconnectCallback);
+
+    // Envoyées dès que la connexion est établie, avant toute commande utilisateur
+    if (!client->password.empty())
+    {
+        if (!client->username.empty())
+        {
+            const char* argv[3] = { "AUTH", client->username.c_str(), client->password.c_str() };
+            rcnet_redis_sendSetupCommand(connection, "AUTH", 3, argv);
+        }
+        else
+        {
+            const char* argv[2] = { "AUTH", client->password.c_str() };
+            rcnet_redis_sendSetupCommand(connection, "AUTH", 2, argv);
+        }
+    }
+    if (client->config.database != 0)
+    {
+        char database[16];
+        std::snprintf(database, sizeof(database), "%d", client->config.database);
+        const char* argv[2] = { "SELECT", database };
+        rcnet_redis_sendSetupCommand(connection, "SELECT", 2, argv);
+    }
+
+    return true;
+}
+
+// Connexion établie avec de la place dans sa fenêtre (round-robin), nullptr si aucune
+static RCNET_RedisConnection* rcnet_redis_pickConnection(RCNET_RedisClient* client)
+{
+    const uint32_t count = static_cast<uint32_t>(client->connections.size());
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        RCNET_RedisConnection& connection = client->connections[(client->nextConnection + i) % count];
+        if (connection.connected && connection.pending < client->config.maxPendingPerConnection)
+        {
+            client->nextConnection = (client->nextConnection + i + 1) % count;
+            return &connection;
+        }
+    }
+    return nullptr;
+}
+
+// Commande qui ne partira jamais : callback immédiat avec reply = NULL
+static void rcnet_redis_failQueued(RCNET_RedisClient* client, const RCNET_RedisQueuedCommand& command)
+{
+    client->failed.fetch_add(1, std::memory_order_relaxed);
+    if (command.callback != nullptr)
+    {
+        client->deliveredThisUpdate++;
+        command.callback(nullptr, command.userdata);
+    }
+}
+
+// Pipelining : toutes les commandes du tick sont ajoutées aux buffers de sortie hiredis,
+// écrits ensuite en une fois par connexion
+static void rcnet_redis_sendQueued(RCNET_RedisClient* client)
 {
-    redisContext *c = redisConnect("127.0.0.1", 6379);
-    if (c == NULL || c->err) {
-        if (c) {
-            printf("Error: %s\n", c->errstr);
-            redisFree(c);
-        } else {
-            printf("Can't allocate redis context\n");
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        // Batch précédent entièrement envoyé : on récupère celui des producteurs
+        if (client->sendCursor == client->sending.commands.size())
+        {
+            client->sending.clear();
+            client->sendCursor = 0;
+
+            std::lock_guard<std::mutex> lock(client->queueMutex);
+            std::swap(client->incoming, client->sending);
         }
+
+        RCNET_RedisBatch& batch = client->sending;
+        while (client->sendCursor < batch.commands.size())
+        {
+            RCNET_RedisConnection* connection = rcnet_redis_pickConnection(client);
+            if (connection == nullptr)
+                return;
+
+            const RCNET_RedisQueuedCommand& command = batch.commands[client->sendCursor];
+
+            const uint32_t index = client->freeInFlight.back();
+            client->freeInFlight.pop_back();
+            RCNET_RedisInFlight& record = client->inFlight[index];
+            record.connection = connection;
+            record.callback = command.callback;
+            record.userdata = command.userdata;
+            record.enqueueNs = command.enqueueNs;
+
+            if (redisAsyncFormattedCommand(connection->context, rcnet_redis_replyCallback, &record, &batch.bytes[command.offset], command.length) == REDIS_OK)
+            {
+                connection->pending++;
+                client->pendingCount.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                client->freeInFlight.push_back(index);
+                rcnet_redis_failQueued(client, command);
+            }
+
+            ++client->sendCursor;
+            client->queuedCount.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+// ======================================================
+// API
+// ======================================================
+void rcnet_redis_get_default_config(RCNET_RedisConfig* outConfig)
+{
+    if (outConfig == NULL)
         return;
+
+    memset(outConfig, 0, sizeof(*outConfig));
+    outConfig->host = "127.0.0.1";
+    outConfig->port = 6379;
+    outConfig->poolSize = 2;
+    outConfig->maxPendingPerConnection = 1024;
+    outConfig->maxQueued = 16384;
+    outConfig->connectTimeoutMs = 2000;
+    outConfig->commandTimeoutMs = 2000;
+    outConfig->reconnectDelayMs = 1000;
+}
+
+RCNET_RedisClient* rcnet_redis_create(const RCNET_RedisConfig* config)
+{
+    RCNET_RedisClient* client = new (std::nothrow) RCNET_RedisClient();
+    if (client == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_redis_create: allocation echouee\n");
+        return NULL;
+    }
+
+    if (config != NULL)
+        client->config = *config;
+    else
+        rcnet_redis_get_default_config(&client->config);
+
+    RCNET_RedisConfig& cfg = client->config;
+    if (cfg.host == NULL || cfg.poolSize == 0 || cfg.maxPendingPerConnection == 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_redis_create: configuration invalide\n");
+        delete client;
+        return NULL;
+    }
+
+    client->host       = cfg.host;
+    client->username   = cfg.username   ? cfg.username   : "";
+    client->password   = cfg.password   ? cfg.password   : "";
+    client->caFile     = cfg.caFile     ? cfg.caFile     : "";
+    client->certFile   = cfg.certFile   ? cfg.certFile   : "";
+    client->keyFile    = cfg.keyFile    ? cfg.keyFile    : "";
+    client->serverName = cfg.serverName ? cfg.serverName : client->host;
+    cfg.host = cfg.username = cfg.password = cfg.caFile = cfg.certFile = cfg.keyFile = cfg.serverName = NULL;
+
+    if (cfg.useTLS)
+    {
+        // OpenSSL initialisé à la demande (compté, partagé avec les autres clients du process)
+        if (!rcnet_subsystem_acquire(RCNET_SUBSYSTEM_OPENSSL))
+        {
+            delete client;
+            return NULL;
+        }
+        client->opensslAcquired = true;
+
+        redisSSLContextError sslError = REDIS_SSL_CTX_NONE;
+        client->sslContext = redisCreateSSLContext(client->caFile.empty() ? NULL : client->caFile.c_str(), NULL,
+                                                   client->certFile.empty() ? NULL : client->certFile.c_str(),
+                                                   client->keyFile.empty() ? NULL : client->keyFile.c_str(),
+                                                   client->serverName.c_str(), &sslError);
+        if (client->sslContext == NULL)
+        {
+            RCNET_log(RCNET_LOG_ERROR, "Failed to create Redis TLS context: %s\n", redisSSLContextGetError(sslError));
+            rcnet_subsystem_release(RCNET_SUBSYSTEM_OPENSSL);
+            delete client;
+            return NULL;
+        }
+    }
+
+    client->latencyNs = rcnet_histogram_create();
+    if (client->latencyNs == NULL)
+    {
+        redisFreeSSLContext(client->sslContext);
+        if (client->opensslAcquired)
+            rcnet_subsystem_release(RCNET_SUBSYSTEM_OPENSSL);
+        delete client;
+        return NULL;
+    }
+
+    // Slots "en vol" préalloués : la fenêtre de chaque connexion garantit qu'il y en a toujours un de libre
+    const uint32_t inFlightCapacity = cfg.poolSize * cfg.maxPendingPerConnection;
+    client->inFlight.resize(inFlightCapacity);
+    client->freeInFlight.reserve(inFlightCapacity);
+    for (uint32_t i = inFlightCapacity; i > 0; --i)
+    {
+        client->inFlight[i - 1].index = i - 1;
+        client->freeInFlight.push_back(i - 1);
+    }
+
+    client->connections.resize(cfg.poolSize);
+    client->pollFds.reserve(cfg.poolSize);
+    client->pollConnections.reserve(cfg.poolSize);
+    for (RCNET_RedisConnection& connection : client->connections)
+    {
+        connection.client = client;
+        rcnet_redis_connect(&connection);
+    }
+
+    RCNET_log(RCNET_LOG_INFO, "Redis client created: %s:%d (%u connexion(s)%s)\n",
+              client->host.c_str(), cfg.port, cfg.poolSize, cfg.useTLS ? ", TLS" : "");
+    return client;
+}
+
+void rcnet_redis_destroy(RCNET_RedisClient* client)
+{
+    if (client == NULL)
+        return;
+
+    // Sous queueMutex : rcnet_redis_enqueue refuse ensuite toute nouvelle commande,
+    // y compris celles qu'un callback appelé plus bas tenterait de renvoyer
+    {
+        std::lock_guard<std::mutex> lock(client->queueMutex);
+        client->destroying = true;
+    }
+    client->deliveredThisUpdate = 0;
+
+    // Les commandes en vol reçoivent reply = NULL (appelé par hiredis)
+    for (RCNET_RedisConnection& connection : client->connections)
+    {
+        if (connection.context != nullptr)
+            redisAsyncFree(connection.context);
+    }
+
+    // Commandes jamais envoyées
+    for (; client->sendCursor < client->sending.commands.size(); ++client->sendCursor)
+        rcnet_redis_failQueued(client, client->sending.commands[client->sendCursor]);
+
+    // Comme rcnet_redis_sendQueued : le batch des producteurs est récupéré sous le verrou,
+    // les callbacks sont appelés après l'avoir relâché
+    client->sending.clear();
+    client->sendCursor = 0;
+    {
+        std::lock_guard<std::mutex> lock(client->queueMutex);
+        std::swap(client->incoming, client->sending);
+    }
+    for (const RCNET_RedisQueuedCommand& command : client->sending.commands)
+        rcnet_redis_failQueued(client, command);
+
+    redisFreeSSLContext(client->sslContext);
+    if (client->opensslAcquired)
+        rcnet_subsystem_release(RCNET_SUBSYSTEM_OPENSSL);
+    rcnet_histogram_destroy(client->latencyNs);
+    delete client;
+}
+
+// Copie une commande formatée dans le buffer des producteurs
+static bool rcnet_redis_enqueue(RCNET_RedisClient* client, RCNET_RedisCallback callback, void* userdata, const char* command, size_t length)
+{
+    const uint64_t nowNs = rcnet_timer_get_time_ns();
+
+    std::lock_guard<std::mutex> lock(client->queueMutex);
+
+    if (client->destroying)
+        return false;
+
+    if (client->queuedCount.load(std::memory_order_relaxed) >= client->config.maxQueued)
+    {
+        client->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    RCNET_RedisBatch& batch = client->incoming;
+
+    RCNET_RedisQueuedCommand queued;
+    queued.offset = batch.bytes.size();
+    queued.length = length;
+    queued.callback = callback;
+    queued.userdata = userdata;
+    queued.enqueueNs = nowNs;
+
+    batch.bytes.insert(batch.bytes.end(), command, command + length);
+    batch.commands.push_back(queued);
+
+    client->queuedCount.fetch_add(1, std::memory_order_relaxed);
+    client->commands.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool rcnet_redis_command(RCNET_RedisClient* client, RCNET_RedisCallback callback, void* userdata, const char* format, ...)
+{
+    if (client == NULL || format == NULL)
+        return false;
+
+    char* command = NULL;
+    va_list args;
+    va_start(args, format);
+    int length = redisvFormatCommand(&command, format, args);
+    va_end(args);
+
+    if (length <= 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_redis_command: format invalide (%s)\n", format);
+        return false;
+    }
+
+    bool queued = rcnet_redis_enqueue(client, callback, userdata, command, static_cast<size_t>(length));
+    redisFreeCommand(command);
+    return queued;
+}
+
+bool rcnet_redis_command_argv(RCNET_RedisClient* client, RCNET_RedisCallback callback, void* userdata, int argc, const char** argv, const size_t* argvLengths)
+{
+    if (client == NULL || argc <= 0 || argv == NULL)
+        return false;
+
+    char* command = NULL;
+    long long length = redisFormatCommandArgv(&command, argc, argv, argvLengths);
+    if (length <= 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_redis_command_argv: commande invalide\n");
+        return false;
     }
-}
\ No newline at end of file
+
+    bool queued = rcnet_redis_enqueue(client, callback, userdata, command, static_cast<size_t>(length));
+    redisFreeCommand(command);
+    return queued;
+}
+
+uint32_t rcnet_redis_update(RCNET_RedisClient* client)
+{
+    if (client == NULL)
+        return 0;
+
+    client->deliveredThisUpdate = 0;
+    const uint64_t nowNs = rcnet_timer_get_time_ns();
+
+    // 1) Connexions perdues : nouvelle tentative après reconnectDelayMs
+    for (RCNET_RedisConnection& connection : client->connections)
+    {
+        if (connection.context == nullptr && nowNs >= connection.reconnectAtNs)
+        {
+            if (connection.everConnected)
+                client->reconnects.fetch_add(1, std::memory_order_relaxed);
+            rcnet_redis_connect(&connection);
+        }
+    }
+
+    // 2) Buffer -> connexions (dans la limite de leur fenêtre)
+    rcnet_redis_sendQueued(client);
+
+    // 3) I/O non bloquantes : écriture du pipeline puis lecture des réponses déjà arrivées
+    client->pollFds.clear();
+    client->pollConnections.clear();
+    for (RCNET_RedisConnection& connection : client->connections)
+    {
+        if (connection.context == nullptr || (!connection.wantRead && !connection.wantWrite))
+            continue;
+
+        RCNET_RedisPollFd pollFd;
+        pollFd.fd = connection.context->c.fd;
+        pollFd.events = static_cast<short>((connection.wantRead ? POLLIN : 0) | (connection.wantWrite ? POLLOUT : 0));
+        pollFd.revents = 0;
+        client->pollFds.push_back(pollFd);
+        client->pollConnections.push_back(&connection);
+    }
+
+    if (!client->pollFds.empty() && rcnet_redis_poll(client->pollFds.data(), client->pollFds.size()) > 0)
+    {
+        for (size_t i = 0; i < client->pollFds.size(); ++i)
+        {
+            RCNET_RedisConnection* connection = client->pollConnections[i];
+            const short revents = client->pollFds[i].revents;
+
+            // Un handler peut fermer la connexion (contexte libéré par hiredis)
+            if ((revents & (POLLOUT | POLLERR | POLLHUP)) && connection->context != nullptr && connection->wantWrite)
+                redisAsyncHandleWrite(connection->context);
+
+            if ((revents & (POLLIN | POLLERR | POLLHUP)) && connection->context != nullptr)
+                redisAsyncHandleRead(connection->context);
+        }
+    }
+
+    // 4) Timeouts hiredis (connexion / commande)
+    const uint64_t timerNowNs = rcnet_timer_get_time_ns();
+    for (RCNET_RedisConnection& connection : client->connections)
+    {
+        if (connection.context != nullptr && connection.timerDeadlineNs != 0 && timerNowNs >= connection.timerDeadlineNs)
+        {
+            connection.timerDeadlineNs = 0;
+            redisAsyncHandleTimeout(connection.context);
+        }
+    }
+
+    return client->deliveredThisUpdate;
+}
+
+void rcnet_redis_get_stats(const RCNET_RedisClient* client, RCNET_RedisStats* outStats)
+{
+    if (outStats == NULL)
+        return;
+
+    memset(outStats, 0, sizeof(*outStats));
+    if (client == NULL)
+        return;
+
+    outStats->commands     = client->commands.load(std::memory_order_relaxed);
+    outStats->replies      = client->replies.load(std::memory_order_relaxed);
+    outStats->errorReplies = client->errorReplies.load(std::memory_order_relaxed);
+    outStats->failed       = client->failed.load(std::memory_order_relaxed);
+    outStats->dropped      = client->dropped.load(std::memory_order_relaxed);
+    outStats->reconnects   = client->reconnects.load(std::memory_order_relaxed);
+    outStats->queued       = client->queuedCount.load(std::memory_order_relaxed);
+    outStats->pending      = client->pendingCount.load(std::memory_order_relaxed);
+    outStats->connected    = client->connectedCount.load(std::memory_order_relaxed);
+    rcnet_histogram_get_summary(client->latencyNs, &outStats->latencyNs);
+}
@@ -0,0 +1,510 @@
+#include "RCNET/RCNET_redis_cache.h"
+#include "RCNET/RCNET_logger.h"
+#include "RCNET/RCNET_timer.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Coût fixe estimé d'une entrée (slot + noeud de l'index), compté dans maxBytes
+static constexpr size_t kEntryOverheadBytes = 96;
+
+// Payload d'invalidation : "<origine sur 16 chiffres hex>:<clé>" (une clé seule est aussi acceptée)
+static constexpr size_t kOriginPrefixLength = 17;
+
+struct RCNET_RedisCacheEntry
+{
+    std::string key;
+    std::string value;
+    bool found = false;        // false : clé absente de Redis (cache négatif)
+    bool used = false;
+    bool referenced = false;   // bit CLOCK
+    uint64_t expiresAtNs = 0;
+    size_t bytes = 0;
+};
+
+struct RCNET_RedisCacheWaiter
+{
+    RCNET_RedisCacheCallback callback;
+    void* userdata;
+};
+
+struct RCNET_RedisCacheState;
+
+// GET en cours : toutes les lectures de la clé attendent sa réponse
+struct RCNET_RedisCacheFetch
+{
+    std::shared_ptr<RCNET_RedisCacheState> state;
+    std::string key;
+    std::vector<RCNET_RedisCacheWaiter> waiters;
+    bool invalidated = false;  // invalidée / écrite entre-temps : la réponse ne doit pas être mise en cache
+};
+
+// Etat partagé avec les GET en cours (qui peuvent répondre après rcnet_redis_cache_destroy)
+struct RCNET_RedisCacheState
+{
+    RCNET_RedisCacheConfig config;
+    RCNET_RedisClient* redis = nullptr;
+    char origin[kOriginPrefixLength + 1] = {};  // préfixe des invalidations publiées par ce cache
+
+    std::mutex mutex;
+    std::unordered_map<std::string, uint32_t> index;
+    std::vector<RCNET_RedisCacheEntry> entries;
+    std::vector<uint32_t> freeEntries;
+    uint32_t clockHand = 0;
+    size_t bytes = 0;
+    std::unordered_map<std::string, RCNET_RedisCacheFetch*> fetches;
+    bool closed = false;
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> coalesced{0};
+    std::atomic<uint64_t> evictions{0};
+    std::atomic<uint64_t> expirations{0};
+    std::atomic<uint64_t> invalidations{0};
+    std::atomic<uint32_t> entryCount{0};
+    std::atomic<size_t> bytesUsed{0};
+};
+
+struct RCNET_RedisCache
+{
+    std::shared_ptr<RCNET_RedisCacheState> state;
+
+    // Invalidation NATS (closure = copie du shared_ptr, détruite après le désabonnement)
+    RCNET_NATSClient* nats = nullptr;
+    std::string invalidationSubject;
+    RCNET_NATSSubscriptionHandle natsHandle = RCNET_NATS_INVALID_SUBSCRIPTION;
+    std::shared_ptr<RCNET_RedisCacheState>* natsClosure = nullptr;
+};
+
+// ======================================================
+// Entrées (mutex tenu)
+// ======================================================
+static void rcnet_redis_cache_removeEntry(RCNET_RedisCacheState* state, uint32_t slot)
+{
+    RCNET_RedisCacheEntry& entry = state->entries[slot];
+    state->index.erase(entry.key);
+    state->bytes -= entry.bytes;
+
+    entry.used = false;
+    entry.referenced = false;
+    entry.key.clear();
+    entry.value.clear();
+    entry.bytes = 0;
+    state->freeEntries.push_back(slot);
+
+    state->entryCount.store(static_cast<uint32_t>(state->index.size()), std::memory_order_relaxed);
+    state->bytesUsed.store(state->bytes, std::memory_order_relaxed);
+}
+
+// CLOCK : une entrée lue depuis le dernier passage de l'aiguille a une seconde chance
+static void rcnet_redis_cache_evictOne(RCNET_RedisCacheState* state)
+{
+    const uint32_t count = static_cast<uint32_t>(state->entries.size());
+    for (uint32_t step = 0; step < count * 2; ++step)
+    {
+        const uint32_t slot = state->clockHand;
+        state->clockHand = (state->clockHand + 1) % count;
+
+        RCNET_RedisCacheEntry& entry = state->entries[slot];
+        if (!entry.used)
+            continue;
+
+        if (entry.referenced)
+        {
+            entry.referenced = false;
+            continue;
+        }
+
+        rcnet_redis_cache_removeEntry(state, slot);
+        state->evictions.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+}
+
+static void rcnet_redis_cache_insert(RCNET_RedisCacheState* state, const std::string& key, const char* value, size_t length, bool found, uint32_t ttlMs)
+{
+    const size_t bytes = key.size() + length + kEntryOverheadBytes;
+    if (ttlMs == 0 || bytes > state->config.maxBytes)
+        return;
+
+    auto existing = state->index.find(key);
+    if (existing != state->index.end())
+        rcnet_redis_cache_removeEntry(state, existing->second);
+
+    while (state->bytes + bytes > state->config.maxBytes && state->bytes > 0)
+        rcnet_redis_cache_evictOne(state);
+
+    uint32_t slot;
+    if (!state->freeEntries.empty())
+    {
+        slot = state->freeEntries.back();
+        state->freeEntries.pop_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(state->entries.size());
+        state->entries.emplace_back();
+    }
+
+    RCNET_RedisCacheEntry& entry = state->entries[slot];
+    entry.key = key;
+    entry.value.assign(value != nullptr ? value : "", value != nullptr ? length : 0);
+    entry.found = found;
+    entry.used = true;
+    entry.referenced = false;
+    entry.expiresAtNs = rcnet_timer_get_time_ns() + static_cast<uint64_t>(ttlMs) * 1000000ull;
+    entry.bytes = bytes;
+
+    state->index[key] = slot;
+    state->bytes += bytes;
+    state->entryCount.store(static_cast<uint32_t>(state->index.size()), std::memory_order_relaxed);
+    state->bytesUsed.store(state->bytes, std::memory_order_relaxed);
+}
+
+static void rcnet_redis_cache_invalidateLocked(RCNET_RedisCacheState* state, const std::string& key)
+{
+    auto it = state->index.find(key);
+    if (it != state->index.end())
+    {
+        rcnet_redis_cache_removeEntry(state, it->second);
+        state->invalidations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    auto fetch = state->fetches.find(key);
+    if (fetch != state->fetches.end())
+        fetch->second->invalidated = true;
+}
+
+// ======================================================
+// Réponse Redis d'un GET (thread de rcnet_redis_update)
+// ======================================================
+static void rcnet_redis_cache_onReply(const redisReply* reply, void* userdata)
+{
+    RCNET_RedisCacheFetch* fetch = static_cast<RCNET_RedisCacheFetch*>(userdata);
+    RCNET_RedisCacheState* state = fetch->state.get();
+
+    const bool found = (reply != NULL && reply->type == REDIS_REPLY_STRING);
+    const bool absent = (reply != NULL && reply->type == REDIS_REPLY_NIL);
+
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+
+        auto it = state->fetches.find(fetch->key);
+        if (it != state->fetches.end() && it->second == fetch)
+            state->fetches.erase(it);
+
+        if (!state->closed && !fetch->invalidated)
+        {
+            if (found)
+                rcnet_redis_cache_insert(state, fetch->key, reply->str, reply->len, true, state->config.defaultTtlMs);
+            else if (absent)
+                rcnet_redis_cache_insert(state, fetch->key, NULL, 0, false, state->config.negativeTtlMs);
+        }
+    }
+
+    if (reply != NULL && reply->type == REDIS_REPLY_ERROR)
+        RCNET_log(RCNET_LOG_ERROR, "Redis cache GET %s failed: %s\n", fetch->key.c_str(), reply->str);
+
+    // Callbacks hors du verrou : ils peuvent relire / écrire le cache
+    for (const RCNET_RedisCacheWaiter& waiter : fetch->waiters)
+        waiter.callback(fetch->key.c_str(), found ? reply->str : NULL, found ? reply->len : 0, found, waiter.userdata);
+
+    delete fetch;
+}
+
+// ======================================================
+// API
+// ======================================================
+void rcnet_redis_cache_get_default_config(RCNET_RedisCacheConfig* outConfig)
+{
+    if (outConfig == NULL)
+        return;
+
+    outConfig->maxBytes = 64 * 1024 * 1024;
+    outConfig->defaultTtlMs = 30000;
+    outConfig->negativeTtlMs = 1000;
+}
+
+RCNET_RedisCache* rcnet_redis_cache_create(RCNET_RedisClient* redis, const RCNET_RedisCacheConfig* config)
+{
+    if (redis == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_redis_cache_create: client Redis invalide\n");
+        return NULL;
+    }
+
+    RCNET_RedisCache* cache = new (std::nothrow) RCNET_RedisCache();
+    if (cache == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_redis_cache_create: allocation echouee\n");
+        return NULL;
+    }
+
+    try
+    {
+        cache->state = std::make_shared<RCNET_RedisCacheState>();
+    }
+    catch (const std::exception&)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_redis_cache_create: allocation echouee\n");
+        delete cache;
+        return NULL;
+    }
+
+    cache->state->redis = redis;
+
+    // Identifiant d'instance : ce cache ignore ses propres invalidations (il vient d'écrire la valeur)
+    std::random_device randomDevice;
+    const uint64_t originId = (static_cast<uint64_t>(randomDevice()) << 32 | randomDevice()) ^ rcnet_timer_get_time_ns();
+    std::snprintf(cache->state->origin, sizeof(cache->state->origin), "%016llx:", static_cast<unsigned long long>(originId));
+
+    if (config != NULL)
+        cache->state->config = *config;
+    else
+        rcnet_redis_cache_get_default_config(&cache->state->config);
+
+    return cache;
+}
+
+void rcnet_redis_cache_destroy(RCNET_RedisCache* cache)
+{
+    if (cache == NULL)
+        return;
+
+    if (cache->natsClosure != nullptr)
+    {
+        // rcnet_redis_cache_onInvalidation peut être en cours sur le thread de livraison NATS :
+        // la closure n'est libérée qu'une fois l'abonnement terminé
+        if (rcnet_nats_unsubscribe_and_wait(cache->nats, cache->natsHandle, RCNET_NATS_UNSUBSCRIBE_WAIT_TIMEOUT_MS) == -2)
+            RCNET_log(RCNET_LOG_WARN, "rcnet_redis_cache_destroy: invalidation subscription did not complete, closure leaked\n");
+        else
+            delete cache->natsClosure;
+    }
+
+    // Les GET en cours gardent l'état en vie : leurs callbacks seront appelés, sans mise en cache
+    {
+        std::lock_guard<std::mutex> lock(cache->state->mutex);
+        cache->state->closed = true;
+    }
+
+    delete cache;
+}
+
+// Hit : copie la valeur (le callback est appelé hors du verrou). Une entrée expirée est retirée.
+static bool rcnet_redis_cache_lookupLocked(RCNET_RedisCacheState* state, const std::string& key, std::string& outValue, bool& outFound)
+{
+    auto it = state->index.find(key);
+    if (it == state->index.end())
+        return false;
+
+    RCNET_RedisCacheEntry& entry = state->entries[it->second];
+    if (rcnet_timer_get_time_ns() >= entry.expiresAtNs)
+    {
+        rcnet_redis_cache_removeEntry(state, it->second);
+        state->expirations.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    entry.referenced = true;
+    outValue.assign(entry.value);
+    outFound = entry.found;
+    state->hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool rcnet_redis_cache_get(RCNET_RedisCache* cache, const char* key, RCNET_RedisCacheCallback callback, void* userdata)
+{
+    if (cache == NULL || key == NULL || callback == NULL)
+        return false;
+
+    RCNET_RedisCacheState* state = cache->state.get();
+
+    // Buffers par thread : pas d'allocation sur un hit une fois leur capacité atteinte
+    thread_local std::string lookupKey;
+    thread_local std::string hitValue;
+    bool hitFound = false;
+    lookupKey.assign(key);
+
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+
+        if (!rcnet_redis_cache_lookupLocked(state, lookupKey, hitValue, hitFound))
+        {
+            // Miss : rattaché au GET déjà en cours pour cette clé, sinon nouveau GET
+            auto pending = state->fetches.find(lookupKey);
+            if (pending != state->fetches.end())
+            {
+                pending->second->waiters.push_back(RCNET_RedisCacheWaiter{ callback, userdata });
+                state->coalesced.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            RCNET_RedisCacheFetch* fetch = new (std::nothrow) RCNET_RedisCacheFetch();
+            if (fetch == NULL)
+                return false;
+
+            fetch->state = cache->state;
+            fetch->key = lookupKey;
+            fetch->waiters.push_back(RCNET_RedisCacheWaiter{ callback, userdata });
+
+            // Sous le verrou : la réponse ne peut pas arriver avant l'enregistrement du GET
+            const char* argv[2] = { "GET", key };
+            if (!rcnet_redis_command_argv(state->redis, rcnet_redis_cache_onReply, fetch, 2, argv, NULL))
+            {
+                delete fetch;
+                return false;
+            }
+
+            state->fetches[lookupKey] = fetch;
+            state->misses.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    callback(key, hitFound ? hitValue.data() : NULL, hitFound ? hitValue.size() : 0, hitFound, userdata);
+    return true;
+}
+
+bool rcnet_redis_cache_set(RCNET_RedisCache* cache, const char* key, const void* value, size_t length, uint32_t ttlMs)
+{
+    if (cache == NULL || key == NULL || (value == NULL && length > 0))
+        return false;
+
+    RCNET_RedisCacheState* state = cache->state.get();
+
+    char ttl[16];
+    std::snprintf(ttl, sizeof(ttl), "%u", ttlMs);
+    const char* argv[5] = { "SET", key, static_cast<const char*>(value), "PX", ttl };
+    const size_t argvLengths[5] = { 3, strlen(key), length, 2, strlen(ttl) };
+
+    if (!rcnet_redis_command_argv(state->redis, NULL, NULL, ttlMs > 0 ? 5 : 3, argv, argvLengths))
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+
+        const std::string cacheKey(key);
+        auto fetch = state->fetches.find(cacheKey);
+        if (fetch != state->fetches.end())
+            fetch->second->invalidated = true;
+
+        rcnet_redis_cache_insert(state, cacheKey, static_cast<const char*>(value), length, true, ttlMs > 0 ? ttlMs : state->config.defaultTtlMs);
+    }
+
+    // Les autres serveurs retirent la clé de leur cache ; ce cache garde la valeur qu'il vient d'écrire
+    if (cache->nats != nullptr)
+    {
+        std::string payload(state->origin, kOriginPrefixLength);
+        payload.append(key);
+        rcnet_nats_publish(cache->nats, cache->invalidationSubject.c_str(), payload.data(), static_cast<int>(payload.size()));
+    }
+
+    return true;
+}
+
+void rcnet_redis_cache_invalidate(RCNET_RedisCache* cache, const char* key)
+{
+    if (cache == NULL || key == NULL)
+        return;
+
+    std::lock_guard<std::mutex> lock(cache->state->mutex);
+    rcnet_redis_cache_invalidateLocked(cache->state.get(), key);
+}
+
+// Vrai si le payload commence par un préfixe d'origine ("<16 chiffres hex>:")
+static bool rcnet_redis_cache_hasOriginPrefix(const char* data, size_t length)
+{
+    if (length < kOriginPrefixLength || data[kOriginPrefixLength - 1] != ':')
+        return false;
+
+    for (size_t i = 0; i + 1 < kOriginPrefixLength; ++i)
+    {
+        const char c = data[i];
+        if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f')))
+            return false;
+    }
+    return true;
+}
+
+// Message d'invalidation (thread de la librairie NATS) : payload = [origine:]clé
+static void rcnet_redis_cache_onInvalidation(natsConnection* connection, natsSubscription* subscription, natsMsg* msg, void* closure)
+{
+    (void)connection;
+    (void)subscription;
+    RCNET_RedisCacheState* state = static_cast<std::shared_ptr<RCNET_RedisCacheState>*>(closure)->get();
+
+    const char* data = natsMsg_GetData(msg);
+    size_t length = static_cast<size_t>(natsMsg_GetDataLength(msg));
+    if (rcnet_redis_cache_hasOriginPrefix(data, length))
+    {
+        // Ecriture de ce cache : l'entrée locale est déjà à jour
+        if (memcmp(data, state->origin, kOriginPrefixLength) == 0)
+        {
+            natsMsg_Destroy(msg);
+            return;
+        }
+        data += kOriginPrefixLength;
+        length -= kOriginPrefixLength;
+    }
+
+    const std::string key(data, length);
+    natsMsg_Destroy(msg);
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    rcnet_redis_cache_invalidateLocked(state, key);
+}
+
+bool rcnet_redis_cache_attach_nats_invalidation(RCNET_RedisCache* cache, RCNET_NATSClient* nats, const char* subject)
+{
+    if (cache == NULL || nats == NULL || subject == NULL || cache->natsClosure != nullptr)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_redis_cache_attach_nats_invalidation: parametres invalides\n");
+        return false;
+    }
+
+    std::shared_ptr<RCNET_RedisCacheState>* closure = new (std::nothrow) std::shared_ptr<RCNET_RedisCacheState>(cache->state);
+    if (closure == NULL)
+        return false;
+
+    if (rcnet_nats_subscribe(nats, subject, rcnet_redis_cache_onInvalidation, closure, &cache->natsHandle) != 0)
+    {
+        delete closure;
+        return false;
+    }
+
+    cache->nats = nats;
+    cache->invalidationSubject = subject;
+    cache->natsClosure = closure;
+    return true;
+}
+
+void rcnet_redis_cache_get_stats(const RCNET_RedisCache* cache, RCNET_RedisCacheStats* outStats)
+{
+    if (outStats == NULL)
+        return;
+
+    memset(outStats, 0, sizeof(*outStats));
+    if (cache == NULL)
+        return;
+
+    const RCNET_RedisCacheState* state = cache->state.get();
+    outStats->hits          = state->hits.load(std::memory_order_relaxed);
+    outStats->misses        = state->misses.load(std::memory_order_relaxed);
+    outStats->coalesced     = state->coalesced.load(std::memory_order_relaxed);
+    outStats->evictions     = state->evictions.load(std::memory_order_relaxed);
+    outStats->expirations   = state->expirations.load(std::memory_order_relaxed);
+    outStats->invalidations = state->invalidations.load(std::memory_order_relaxed);
+    outStats->entries       = state->entryCount.load(std::memory_order_relaxed);
+    outStats->bytes         = state->bytesUsed.load(std::memory_order_relaxed);
+}
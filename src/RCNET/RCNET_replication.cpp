@@ -0,0 +1,947 @@
+#include "RCNET/RCNET_replication.h"
+#include "RCNET/RCNET_compression.h"
+#include "RCNET/RCNET_logger.h"
+#include "RCNET/RCNET_timer.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// En-tête d'un message : magic "RP" | version | flags | epoch (u64) | séquence (u64), little-endian
+static constexpr uint8_t kMagic0 = 'R';
+static constexpr uint8_t kMagic1 = 'P';
+static constexpr uint8_t kVersion = 1;
+static constexpr size_t kHeaderSize = 20;
+
+static constexpr uint8_t kFlagSnapshot = 1u << 0; // état complet : les clés absentes sont supprimées
+static constexpr uint8_t kFlagBlock = 1u << 1;    // corps au format rcnet_compression_compress_block
+
+// Corps : nombre d'entrées (u32) puis, par entrée, op (u8) | taille de la clé (u16) | clé [| taille (u32) | valeur]
+static constexpr uint8_t kOpSet = 1;
+static constexpr uint8_t kOpRemove = 2;
+static constexpr size_t kMaxKeyLength = UINT16_MAX;
+
+// Messages du stream lus par appel à rcnet_replication_poll pendant une resynchronisation
+static constexpr uint32_t kResyncBatch = 256;
+
+// Sujets d'une source : "<subjectPrefix>.<sourceId>.snapshot" (états complets) et ".delta" (changements).
+// Le dernier état complet se retrouve dans le stream sans le rejouer depuis le début (DeliverLastPerSubject).
+static constexpr const char* kSnapshotSuffix = ".snapshot";
+static constexpr const char* kDeltaSuffix = ".delta";
+
+// Ratio max de LZ4 : un bloc plus petit que originalSize / kMaxCompressionRatio n'est pas un bloc valide
+static constexpr size_t kMaxCompressionRatio = 255;
+
+// Valeur de l'état local. dirty : changée depuis le dernier flush (présente dans dirtyEntries)
+struct RCNET_ReplicationLocalEntry
+{
+    std::vector<uint8_t> value;
+    bool present = false;
+    bool dirty = false;
+};
+
+// Réplique d'une autre source (thread de poll uniquement)
+struct RCNET_ReplicationSource
+{
+    std::string subjectBase;   // "<subjectPrefix>.<sourceId>"
+    uint64_t epoch = 0;        // instance de la source (croissante d'un redémarrage à l'autre)
+    uint64_t lastSequence = 0; // dernière séquence appliquée dans epoch (0 = rien d'appliqué)
+    std::unordered_map<std::string, std::vector<uint8_t>> values;
+
+    // Resynchronisation : recherche du dernier état complet (locating), puis lecture du stream à partir de lui
+    natsSubscription* resyncSubscription = NULL;
+    bool resyncLocating = false;
+    uint64_t resyncSnapshotStreamSequence = 0;
+    uint64_t resyncStartEpoch = 0;
+    uint64_t resyncStartSequence = 0;
+    uint64_t resyncDeadlineNs = 0;
+    uint64_t resyncRetryNs = 0; // pas de nouvelle resynchronisation avant (après un échec ou une resync inutile)
+};
+
+struct RCNET_Replication
+{
+    RCNET_NATSClient* client = NULL;
+    RCNET_ReplicationConfig config;
+    std::string subjectPrefix;
+    std::string sourceId;
+    std::string streamName;
+    std::string snapshotSubject;
+    std::string deltaSubject;
+    uint64_t epoch = 0;
+
+    RCNET_NATSAsyncPublisher* publisher = NULL;
+    bool ownsPublisher = false;
+    RCNET_NATSSubscriptionHandle subscription = RCNET_NATS_INVALID_SUBSCRIPTION;
+
+    // Etat local (set / remove depuis n'importe quel thread). Les pointeurs d'un unordered_map
+    // restent valides jusqu'à l'effacement de l'élément : dirtyEntries les garde entre deux flush.
+    std::mutex localMutex;
+    std::unordered_map<std::string, RCNET_ReplicationLocalEntry> local;
+    std::vector<std::pair<const std::string*, RCNET_ReplicationLocalEntry*>> dirtyEntries;
+
+    // Thread de flush : buffers réutilisés d'un tick à l'autre
+    uint64_t sequence = 0;
+    uint64_t flushCount = 0;
+    std::atomic<bool> snapshotRequested{false}; // publication échouée (ou accusé JetStream négatif) : état complet au prochain flush
+    std::vector<uint8_t> body;
+    std::vector<uint8_t> message;
+
+    // Messages reçus (thread de la librairie NATS -> thread de poll)
+    std::mutex inboxMutex;
+    std::vector<natsMsg*> inbox;
+
+    // Thread de poll
+    std::vector<natsMsg*> processing;
+    std::unordered_map<std::string, RCNET_ReplicationSource> sources;
+    std::vector<uint8_t> decoded;
+
+    std::atomic<uint64_t> updates{0};
+    std::atomic<uint64_t> coalesced{0};
+    std::atomic<uint64_t> batchesPublished{0};
+    std::atomic<uint64_t> snapshotsPublished{0};
+    std::atomic<uint64_t> entriesPublished{0};
+    std::atomic<uint64_t> bytesPublished{0};
+    std::atomic<uint64_t> bytesUncompressed{0};
+    std::atomic<uint64_t> publishFailures{0};
+    std::atomic<uint64_t> batchesReceived{0};
+    std::atomic<uint64_t> entriesApplied{0};
+    std::atomic<uint64_t> duplicates{0};
+    std::atomic<uint64_t> gaps{0};
+    std::atomic<uint64_t> resyncs{0};
+    std::atomic<uint64_t> resyncFailures{0};
+    std::atomic<uint64_t> decodeErrors{0};
+    std::atomic<uint32_t> sourceCount{0};
+};
+
+// Message décodé (pointeurs dans le message NATS ou dans RCNET_Replication::decoded)
+struct RCNET_ReplicationBatch
+{
+    uint8_t flags;
+    uint64_t epoch;
+    uint64_t sequence;
+    const uint8_t* body;
+    size_t bodyLength;
+};
+
+enum RCNET_ReplicationVerdict
+{
+    RCNET_REPLICATION_APPLY,
+    RCNET_REPLICATION_DUPLICATE,
+    RCNET_REPLICATION_GAP
+};
+
+// ======================================================
+// Encodage
+// ======================================================
+static inline void rcnet_replication_putU16(std::vector<uint8_t>& out, uint16_t value)
+{
+    out.push_back(static_cast<uint8_t>(value));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+static inline void rcnet_replication_putU32(std::vector<uint8_t>& out, uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+}
+
+static inline void rcnet_replication_putU64(std::vector<uint8_t>& out, uint64_t value)
+{
+    for (int i = 0; i < 8; ++i)
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+}
+
+static inline uint64_t rcnet_replication_readLE(const uint8_t* in, int size)
+{
+    uint64_t value = 0;
+    for (int i = 0; i < size; ++i)
+        value |= static_cast<uint64_t>(in[i]) << (8 * i);
+    return value;
+}
+
+static void rcnet_replication_putEntry(std::vector<uint8_t>& out, const std::string& key, const RCNET_ReplicationLocalEntry& entry)
+{
+    out.push_back(entry.present ? kOpSet : kOpRemove);
+    rcnet_replication_putU16(out, static_cast<uint16_t>(key.size()));
+    out.insert(out.end(), key.begin(), key.end());
+    if (entry.present)
+    {
+        rcnet_replication_putU32(out, static_cast<uint32_t>(entry.value.size()));
+        out.insert(out.end(), entry.value.begin(), entry.value.end());
+    }
+}
+
+// Parcourt les entrées d'un corps (avec un visiteur vide : validation seule)
+template <typename Visitor>
+static bool rcnet_replication_forEachEntry(const uint8_t* body, size_t length, Visitor&& visit)
+{
+    if (length < 4)
+        return false;
+
+    uint32_t count = static_cast<uint32_t>(rcnet_replication_readLE(body, 4));
+    size_t offset = 4;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (length - offset < 3)
+            return false;
+        uint8_t op = body[offset];
+        size_t keyLength = static_cast<size_t>(rcnet_replication_readLE(body + offset + 1, 2));
+        offset += 3;
+        if ((op != kOpSet && op != kOpRemove) || length - offset < keyLength)
+            return false;
+        const char* key = reinterpret_cast<const char*>(body + offset);
+        offset += keyLength;
+
+        const uint8_t* value = NULL;
+        size_t valueLength = 0;
+        if (op == kOpSet)
+        {
+            if (length - offset < 4)
+                return false;
+            valueLength = static_cast<size_t>(rcnet_replication_readLE(body + offset, 4));
+            offset += 4;
+            if (length - offset < valueLength)
+                return false;
+            value = body + offset;
+            offset += valueLength;
+        }
+
+        visit(key, keyLength, value, valueLength);
+    }
+    return offset == length;
+}
+
+// ======================================================
+// Publication (thread de flush)
+// ======================================================
+static void rcnet_replication_publishCallback(const RCNET_NATSPublishResult* result, void* userdata)
+{
+    if (result->success)
+        return;
+
+    // Message refusé par JetStream : ses changements ne sont plus dans dirtyEntries et il ne sera
+    // pas rejoué par le stream, le prochain flush publie l'état complet
+    RCNET_Replication* replication = static_cast<RCNET_Replication*>(userdata);
+    replication->publishFailures.fetch_add(1, std::memory_order_relaxed);
+    replication->snapshotRequested.store(true, std::memory_order_relaxed);
+}
+
+static bool rcnet_replication_publish(RCNET_Replication* replication, uint8_t flags, size_t entryCount)
+{
+    // Nombre d'entrées en tête du corps (réservé avant l'encodage)
+    for (int i = 0; i < 4; ++i)
+        replication->body[i] = static_cast<uint8_t>(entryCount >> (8 * i));
+
+    std::vector<uint8_t>& message = replication->message;
+    message.clear();
+    message.push_back(kMagic0);
+    message.push_back(kMagic1);
+    message.push_back(kVersion);
+    message.push_back(0); // flags, complétés ci-dessous
+    rcnet_replication_putU64(message, replication->epoch);
+    rcnet_replication_putU64(message, replication->sequence + 1);
+
+    // Séquence consommée même en cas d'échec : les abonnés voient le trou et se resynchronisent.
+    // Les changements de ce message ne sont plus dans dirtyEntries : le prochain flush publie l'état complet.
+    replication->sequence++;
+
+    if (replication->config.compress)
+    {
+        size_t capacity = rcnet_compression_get_max_output_size(replication->body.size());
+        message.resize(kHeaderSize + capacity);
+        size_t size = rcnet_compression_compress_block(replication->body.data(), replication->body.size(), message.data() + kHeaderSize,
+                                                       capacity, replication->config.minCompressSize, 1);
+        if (size == 0)
+        {
+            RCNET_log(RCNET_LOG_ERROR, "rcnet_replication_flush: compression failed\n");
+            replication->publishFailures.fetch_add(1, std::memory_order_relaxed);
+            replication->snapshotRequested.store(true, std::memory_order_relaxed);
+            return false;
+        }
+        message.resize(kHeaderSize + size);
+        flags |= kFlagBlock;
+    }
+    else
+    {
+        message.insert(message.end(), replication->body.begin(), replication->body.end());
+    }
+    message[3] = flags;
+
+    const char* subject = (flags & kFlagSnapshot) ? replication->snapshotSubject.c_str() : replication->deltaSubject.c_str();
+    int result = replication->streamName.empty()
+        ? rcnet_nats_async_publish_core(replication->publisher, subject, message.data(), static_cast<int>(message.size()))
+        : rcnet_nats_async_publish(replication->publisher, subject, message.data(), static_cast<int>(message.size()),
+                                   rcnet_replication_publishCallback, replication);
+
+    if (result != 0)
+    {
+        replication->publishFailures.fetch_add(1, std::memory_order_relaxed);
+        replication->snapshotRequested.store(true, std::memory_order_relaxed);
+        return false;
+    }
+
+    replication->batchesPublished.fetch_add(1, std::memory_order_relaxed);
+    if (flags & kFlagSnapshot)
+        replication->snapshotsPublished.fetch_add(1, std::memory_order_relaxed);
+    replication->entriesPublished.fetch_add(entryCount, std::memory_order_relaxed);
+    replication->bytesPublished.fetch_add(message.size(), std::memory_order_relaxed);
+    replication->bytesUncompressed.fetch_add(kHeaderSize + replication->body.size(), std::memory_order_relaxed);
+    return true;
+}
+
+// ======================================================
+// Réception (thread de la librairie NATS)
+// ======================================================
+static void rcnet_replication_messageHandler(natsConnection* connection, natsSubscription* subscription, natsMsg* msg, void* closure)
+{
+    (void)connection;
+    (void)subscription;
+    RCNET_Replication* replication = static_cast<RCNET_Replication*>(closure);
+
+    std::lock_guard<std::mutex> lock(replication->inboxMutex);
+    replication->inbox.push_back(msg);
+}
+
+// ======================================================
+// Application (thread de poll)
+// ======================================================
+
+// Décode l'en-tête et, si besoin, décompresse le corps dans replication->decoded
+static bool rcnet_replication_decode(RCNET_Replication* replication, natsMsg* msg, RCNET_ReplicationBatch* outBatch)
+{
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(natsMsg_GetData(msg));
+    int dataLength = natsMsg_GetDataLength(msg);
+    if (data == NULL || dataLength < static_cast<int>(kHeaderSize) || data[0] != kMagic0 || data[1] != kMagic1 || data[2] != kVersion ||
+        static_cast<size_t>(dataLength) - kHeaderSize > replication->config.maxMessageSize)
+        return false;
+
+    outBatch->flags = data[3];
+    outBatch->epoch = rcnet_replication_readLE(data + 4, 8);
+    outBatch->sequence = rcnet_replication_readLE(data + 12, 8);
+    outBatch->body = data + kHeaderSize;
+    outBatch->bodyLength = static_cast<size_t>(dataLength) - kHeaderSize;
+
+    if (outBatch->flags & kFlagBlock)
+    {
+        // Taille lue dans le message : bornée avant toute allocation (message corrompu ou étranger)
+        size_t originalSize = rcnet_compression_get_block_original_size(outBatch->body, outBatch->bodyLength);
+        if (originalSize == 0 || originalSize > replication->config.maxMessageSize ||
+            originalSize / kMaxCompressionRatio > outBatch->bodyLength)
+            return false;
+        replication->decoded.resize(originalSize);
+        if (rcnet_compression_decompress_block(outBatch->body, outBatch->bodyLength, replication->decoded.data(), originalSize) != originalSize)
+            return false;
+        outBatch->body = replication->decoded.data();
+        outBatch->bodyLength = originalSize;
+    }
+
+    return rcnet_replication_forEachEntry(outBatch->body, outBatch->bodyLength, [](const char*, size_t, const uint8_t*, size_t) {});
+}
+
+static RCNET_ReplicationVerdict rcnet_replication_judge(const RCNET_ReplicationSource& source, const RCNET_ReplicationBatch& batch)
+{
+    bool snapshot = (batch.flags & kFlagSnapshot) != 0;
+
+    // Instance précédente de la source (rejouée par le stream) : déjà remplacée, jamais réappliquée
+    if (batch.epoch < source.epoch)
+        return RCNET_REPLICATION_DUPLICATE;
+
+    // Nouvelle instance de la source : seul un état complet sert de base
+    if (batch.epoch != source.epoch)
+        return snapshot ? RCNET_REPLICATION_APPLY : RCNET_REPLICATION_GAP;
+    if (batch.sequence <= source.lastSequence)
+        return RCNET_REPLICATION_DUPLICATE;
+    if (batch.sequence == source.lastSequence + 1 || snapshot)
+        return RCNET_REPLICATION_APPLY;
+    return RCNET_REPLICATION_GAP;
+}
+
+static uint32_t rcnet_replication_apply(RCNET_Replication* replication, const std::string& sourceId, RCNET_ReplicationSource& source,
+                                        const RCNET_ReplicationBatch& batch)
+{
+    const RCNET_ReplicationChangeCallback onChange = replication->config.on_change;
+    void* userdata = replication->config.userdata;
+    bool snapshot = (batch.flags & kFlagSnapshot) != 0;
+
+    // Clés de l'état complet (snapshots seulement, rares : l'allocation est acceptable)
+    std::unordered_set<std::string> snapshotKeys;
+    thread_local std::string key;
+    uint32_t applied = 0;
+
+    rcnet_replication_forEachEntry(batch.body, batch.bodyLength, [&](const char* keyData, size_t keyLength, const uint8_t* value, size_t valueLength) {
+        key.assign(keyData, keyLength);
+        if (value != NULL)
+        {
+            if (snapshot)
+                snapshotKeys.insert(key);
+
+            // Un état complet renvoie surtout des valeurs inchangées : pas de callback pour celles-là
+            auto inserted = source.values.try_emplace(key);
+            std::vector<uint8_t>& stored = inserted.first->second;
+            bool changed = inserted.second || stored.size() != valueLength ||
+                           (valueLength > 0 && std::memcmp(stored.data(), value, valueLength) != 0);
+            if (changed)
+            {
+                stored.assign(value, value + valueLength);
+                if (onChange)
+                    onChange(sourceId.c_str(), key.c_str(), value, valueLength, userdata);
+            }
+        }
+        else if (source.values.erase(key) > 0 && onChange)
+        {
+            onChange(sourceId.c_str(), key.c_str(), NULL, 0, userdata);
+        }
+        applied++;
+    });
+
+    if (snapshot)
+    {
+        for (auto it = source.values.begin(); it != source.values.end();)
+        {
+            if (snapshotKeys.count(it->first) != 0)
+            {
+                ++it;
+                continue;
+            }
+            if (onChange)
+                onChange(sourceId.c_str(), it->first.c_str(), NULL, 0, userdata);
+            it = source.values.erase(it);
+        }
+    }
+
+    source.epoch = batch.epoch;
+    source.lastSequence = batch.sequence;
+    replication->entriesApplied.fetch_add(applied, std::memory_order_relaxed);
+    return applied;
+}
+
+static void rcnet_replication_stopResync(RCNET_ReplicationSource& source)
+{
+    if (source.resyncSubscription == NULL)
+        return;
+
+    natsSubscription_Unsubscribe(source.resyncSubscription);
+    natsSubscription_Destroy(source.resyncSubscription);
+    source.resyncSubscription = NULL;
+}
+
+// Consumer ordonné éphémère sur les deux sujets de la source
+static bool rcnet_replication_subscribeResync(RCNET_Replication* replication, RCNET_ReplicationSource& source, jsDeliverPolicy policy,
+                                              uint64_t startSequence)
+{
+    jsSubOptions subscribeOptions;
+    jsSubOptions_Init(&subscribeOptions);
+    subscribeOptions.Stream = replication->streamName.c_str();
+    subscribeOptions.Ordered = true;
+    subscribeOptions.Config.DeliverPolicy = policy;
+    subscribeOptions.Config.OptStartSeq = startSequence;
+
+    const std::string filter = source.subjectBase + ".*";
+    jsErrCode errorCode;
+    natsStatus status = js_SubscribeSync(&source.resyncSubscription, replication->client->jetStreamContext, filter.c_str(), NULL,
+                                         &subscribeOptions, &errorCode);
+    if (status != NATS_OK)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_replication_poll: resync subscription on %s failed: %s\n", filter.c_str(),
+                  natsStatus_GetText(status));
+        source.resyncSubscription = NULL;
+        return false;
+    }
+    return true;
+}
+
+// Fin d'une resynchronisation. Sans progrès (rien de plus récent dans le stream), la suivante attend
+// resyncTimeoutMs : un trou que le stream ne comble pas ne relance pas une lecture à chaque message.
+static void rcnet_replication_finishResync(RCNET_Replication* replication, const std::string& sourceId, RCNET_ReplicationSource& source,
+                                           uint64_t nowNs, bool completed)
+{
+    rcnet_replication_stopResync(source);
+
+    const bool progressed = source.epoch != source.resyncStartEpoch || source.lastSequence != source.resyncStartSequence;
+    if (!completed || !progressed)
+        source.resyncRetryNs = nowNs + static_cast<uint64_t>(replication->config.resyncTimeoutMs) * 1000000ull;
+
+    if (completed)
+    {
+        replication->resyncs.fetch_add(1, std::memory_order_relaxed);
+        RCNET_log(RCNET_LOG_INFO, "[REPL] %s resynchronized at sequence %llu%s\n", sourceId.c_str(),
+                  static_cast<unsigned long long>(source.lastSequence), progressed ? "" : " (nothing newer in the stream)");
+    }
+    else
+    {
+        replication->resyncFailures.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// Cherche le dernier état complet de la source dans le stream (DeliverLastPerSubject : au plus un message
+// par sujet, jamais tout l'historique)
+static bool rcnet_replication_startResync(RCNET_Replication* replication, RCNET_ReplicationSource& source, uint64_t nowNs)
+{
+    if (replication->streamName.empty() || replication->client->jetStreamContext == NULL || nowNs < source.resyncRetryNs)
+        return false;
+
+    if (!rcnet_replication_subscribeResync(replication, source, js_DeliverLastPerSubject, 0))
+    {
+        source.resyncRetryNs = nowNs + static_cast<uint64_t>(replication->config.resyncTimeoutMs) * 1000000ull;
+        replication->resyncFailures.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    source.resyncLocating = true;
+    source.resyncSnapshotStreamSequence = 0;
+    source.resyncStartEpoch = source.epoch;
+    source.resyncStartSequence = source.lastSequence;
+    source.resyncDeadlineNs = nowNs + static_cast<uint64_t>(replication->config.resyncTimeoutMs) * 1000000ull;
+    return true;
+}
+
+// Lit les messages du stream déjà arrivés : d'abord le dernier état complet, puis le stream à partir de
+// lui (état complet inclus). Terminé quand le consumer n'a plus de message en attente.
+static uint32_t rcnet_replication_advanceResync(RCNET_Replication* replication, const std::string& sourceId, RCNET_ReplicationSource& source,
+                                                uint64_t nowNs)
+{
+    uint32_t applied = 0;
+    for (uint32_t i = 0; i < kResyncBatch; ++i)
+    {
+        int pendingMessages = 0;
+        int pendingBytes = 0;
+        if (natsSubscription_GetPending(source.resyncSubscription, &pendingMessages, &pendingBytes) != NATS_OK || pendingMessages <= 0)
+            break;
+
+        // Un message est déjà en attente : NextMsg ne bloque pas
+        natsMsg* msg = NULL;
+        if (natsSubscription_NextMsg(&msg, source.resyncSubscription, 1) != NATS_OK)
+            break;
+
+        uint64_t streamSequence = 0;
+        uint64_t streamPending = 0;
+        jsMsgMetaData* metaData = NULL;
+        if (natsMsg_GetMetaData(&metaData, msg) == NATS_OK)
+        {
+            streamSequence = metaData->Sequence.Stream;
+            streamPending = metaData->NumPending;
+            jsMsgMetaData_Destroy(metaData);
+        }
+
+        if (source.resyncLocating)
+        {
+            // Dernier message de chaque sujet de la source : seul celui du sujet snapshot compte
+            const char* subject = natsMsg_GetSubject(msg);
+            size_t baseLength = source.subjectBase.size();
+            if (subject != NULL && std::strncmp(subject, source.subjectBase.c_str(), baseLength) == 0 &&
+                std::strcmp(subject + baseLength, kSnapshotSuffix) == 0 && streamSequence > source.resyncSnapshotStreamSequence)
+                source.resyncSnapshotStreamSequence = streamSequence;
+            natsMsg_Destroy(msg);
+
+            if (streamPending != 0)
+                continue;
+
+            rcnet_replication_stopResync(source);
+            if (source.resyncSnapshotStreamSequence == 0 ||
+                !rcnet_replication_subscribeResync(replication, source, js_DeliverByStartSequence, source.resyncSnapshotStreamSequence))
+            {
+                RCNET_log(RCNET_LOG_WARN, "[REPL] Resync of %s failed: no complete state in the stream\n", sourceId.c_str());
+                rcnet_replication_finishResync(replication, sourceId, source, nowNs, false);
+                return applied;
+            }
+            source.resyncLocating = false;
+            continue;
+        }
+
+        // Epoques et séquences déjà appliquées ignorées : pas de on_change pour un état plus ancien
+        RCNET_ReplicationBatch batch;
+        if (!rcnet_replication_decode(replication, msg, &batch))
+            replication->decodeErrors.fetch_add(1, std::memory_order_relaxed);
+        else if (rcnet_replication_judge(source, batch) == RCNET_REPLICATION_APPLY)
+            applied += rcnet_replication_apply(replication, sourceId, source, batch);
+        natsMsg_Destroy(msg);
+
+        if (streamPending == 0)
+        {
+            rcnet_replication_finishResync(replication, sourceId, source, nowNs, true);
+            return applied;
+        }
+    }
+
+    if (nowNs >= source.resyncDeadlineNs)
+    {
+        RCNET_log(RCNET_LOG_WARN, "[REPL] Resync of %s timed out\n", sourceId.c_str());
+        rcnet_replication_finishResync(replication, sourceId, source, nowNs, false);
+    }
+    return applied;
+}
+
+static uint32_t rcnet_replication_receive(RCNET_Replication* replication, natsMsg* msg, uint64_t nowNs)
+{
+    // Source = token après le préfixe ("<subjectPrefix>.<sourceId>.snapshot" / ".delta")
+    const char* subject = natsMsg_GetSubject(msg);
+    size_t prefixLength = replication->subjectPrefix.size();
+    if (subject == NULL || std::strncmp(subject, replication->subjectPrefix.c_str(), prefixLength) != 0 || subject[prefixLength] != '.')
+        return 0;
+
+    const char* sourceBegin = subject + prefixLength + 1;
+    const char* sourceEnd = std::strchr(sourceBegin, '.');
+    if (sourceEnd == NULL || (std::strcmp(sourceEnd, kSnapshotSuffix) != 0 && std::strcmp(sourceEnd, kDeltaSuffix) != 0))
+        return 0;
+
+    thread_local std::string sourceId;
+    sourceId.assign(sourceBegin, static_cast<size_t>(sourceEnd - sourceBegin));
+    if (sourceId.empty() || sourceId == replication->sourceId)
+        return 0;
+
+    RCNET_ReplicationBatch batch;
+    if (!rcnet_replication_decode(replication, msg, &batch))
+    {
+        replication->decodeErrors.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+    }
+    replication->batchesReceived.fetch_add(1, std::memory_order_relaxed);
+
+    auto inserted = replication->sources.try_emplace(sourceId);
+    RCNET_ReplicationSource& source = inserted.first->second;
+    if (inserted.second)
+    {
+        source.subjectBase.assign(subject, static_cast<size_t>(sourceEnd - subject));
+        replication->sourceCount.store(static_cast<uint32_t>(replication->sources.size()), std::memory_order_relaxed);
+    }
+
+    // Resynchronisation en cours : ce message est aussi dans le stream
+    if (source.resyncSubscription != NULL)
+        return 0;
+
+    switch (rcnet_replication_judge(source, batch))
+    {
+    case RCNET_REPLICATION_DUPLICATE:
+        replication->duplicates.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+
+    case RCNET_REPLICATION_GAP:
+        replication->gaps.fetch_add(1, std::memory_order_relaxed);
+        if (rcnet_replication_startResync(replication, source, nowNs))
+            return 0;
+        // Sans stream : appliqué tel quel, le prochain état complet corrige ce qui a été perdu
+        return rcnet_replication_apply(replication, inserted.first->first, source, batch);
+
+    default:
+        return rcnet_replication_apply(replication, inserted.first->first, source, batch);
+    }
+}
+
+// ======================================================
+// API
+// ======================================================
+void rcnet_replication_get_default_config(RCNET_ReplicationConfig* outConfig)
+{
+    if (outConfig == NULL)
+        return;
+
+    outConfig->subjectPrefix = NULL;
+    outConfig->sourceId = NULL;
+    outConfig->streamName = NULL;
+    outConfig->streamMaxAgeNs = 0;
+    outConfig->snapshotIntervalTicks = 600;
+    outConfig->compress = true;
+    outConfig->minCompressSize = 256;
+    outConfig->resyncTimeoutMs = 2000;
+    outConfig->maxMessageSize = 4 * 1024 * 1024;
+    outConfig->publisher = NULL;
+    outConfig->on_change = NULL;
+    outConfig->userdata = NULL;
+}
+
+RCNET_Replication* rcnet_replication_create(RCNET_NATSClient* client, const RCNET_ReplicationConfig* config)
+{
+    if (client == NULL || client->connection == NULL || config == NULL || config->subjectPrefix == NULL || config->subjectPrefix[0] == '\0' ||
+        config->sourceId == NULL || config->sourceId[0] == '\0' || std::strpbrk(config->sourceId, ".*> ") != NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_replication_create: invalid configuration\n");
+        return NULL;
+    }
+
+    RCNET_Replication* replication = new (std::nothrow) RCNET_Replication();
+    if (replication == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_replication_create: allocation failed\n");
+        return NULL;
+    }
+
+    replication->client = client;
+    replication->config = *config;
+    replication->subjectPrefix = config->subjectPrefix;
+    replication->sourceId = config->sourceId;
+    replication->streamName = (config->streamName != NULL) ? config->streamName : "";
+    replication->snapshotSubject = replication->subjectPrefix + "." + replication->sourceId + kSnapshotSuffix;
+    replication->deltaSubject = replication->subjectPrefix + "." + replication->sourceId + kDeltaSuffix;
+    replication->config.subjectPrefix = replication->subjectPrefix.c_str();
+    replication->config.sourceId = replication->sourceId.c_str();
+    replication->config.streamName = replication->streamName.empty() ? NULL : replication->streamName.c_str();
+
+    // Instance de la source : distingue un redémarrage (séquences reparties de 1). Croissante d'un démarrage
+    // à l'autre (ns depuis 1970) : un récepteur reconnaît les messages d'une instance précédente.
+    replication->epoch = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+    replication->body.reserve(4096);
+    replication->message.reserve(4096);
+
+    std::string wildcardSubject = replication->subjectPrefix + ".*.*";
+    if (!replication->streamName.empty())
+    {
+        RCNET_JetStreamStreamOptions streamOptions;
+        streamOptions.noAck = false;
+        streamOptions.messageMaxAge = config->streamMaxAgeNs;
+        const char* subjects[] = { wildcardSubject.c_str() };
+        if (rcnet_nats_check_and_create_stream(client, replication->streamName.c_str(), subjects, 1, &streamOptions) != 0)
+        {
+            delete replication;
+            return NULL;
+        }
+    }
+
+    replication->publisher = config->publisher;
+    if (replication->publisher == NULL)
+    {
+        replication->publisher = rcnet_nats_async_publisher_create(client, NULL);
+        replication->ownsPublisher = true;
+        if (replication->publisher == NULL)
+        {
+            delete replication;
+            return NULL;
+        }
+    }
+
+    if (rcnet_nats_subscribe(client, wildcardSubject.c_str(), rcnet_replication_messageHandler, replication, &replication->subscription) != 0)
+    {
+        if (replication->ownsPublisher)
+            rcnet_nats_async_publisher_destroy(replication->publisher, 0);
+        delete replication;
+        return NULL;
+    }
+
+    return replication;
+}
+
+void rcnet_replication_destroy(RCNET_Replication* replication)
+{
+    if (replication == NULL)
+        return;
+
+    // rcnet_replication_messageHandler peut être en cours sur le thread de livraison NATS :
+    // l'inbox n'est vidée et le canal libéré qu'une fois l'abonnement terminé
+    const bool completed = rcnet_nats_unsubscribe_and_wait(replication->client, replication->subscription,
+                                                           RCNET_NATS_UNSUBSCRIBE_WAIT_TIMEOUT_MS) != -2;
+    for (auto& entry : replication->sources)
+        rcnet_replication_stopResync(entry.second);
+
+    // Publisher propre : les messages déjà mis en buffer partent encore (attente courte des accusés)
+    if (replication->ownsPublisher)
+        rcnet_nats_async_publisher_destroy(replication->publisher, 100);
+    else
+        rcnet_nats_async_publisher_cancel_callbacks(replication->publisher, replication);
+
+    if (!completed)
+    {
+        // Un handler tourne peut-être encore : fuite volontaire plutôt qu'un use-after-free
+        RCNET_log(RCNET_LOG_WARN, "rcnet_replication_destroy: subscription did not complete, channel leaked\n");
+        return;
+    }
+
+    for (natsMsg* msg : replication->inbox)
+        natsMsg_Destroy(msg);
+    delete replication;
+}
+
+bool rcnet_replication_set(RCNET_Replication* replication, const char* key, const void* value, size_t valueLength)
+{
+    if (replication == NULL || key == NULL || (value == NULL && valueLength > 0) || valueLength > UINT32_MAX)
+        return false;
+
+    size_t keyLength = std::strlen(key);
+    if (keyLength == 0 || keyLength > kMaxKeyLength)
+        return false;
+
+    std::lock_guard<std::mutex> lock(replication->localMutex);
+    auto inserted = replication->local.try_emplace(key);
+    RCNET_ReplicationLocalEntry& entry = inserted.first->second;
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(value);
+    entry.value.assign(bytes, bytes + valueLength);
+    entry.present = true;
+
+    replication->updates.fetch_add(1, std::memory_order_relaxed);
+    if (entry.dirty)
+    {
+        replication->coalesced.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    entry.dirty = true;
+    replication->dirtyEntries.emplace_back(&inserted.first->first, &entry);
+    return true;
+}
+
+bool rcnet_replication_remove(RCNET_Replication* replication, const char* key)
+{
+    if (replication == NULL || key == NULL)
+        return false;
+
+    std::lock_guard<std::mutex> lock(replication->localMutex);
+    auto it = replication->local.find(key);
+    if (it == replication->local.end() || !it->second.present)
+        return false;
+
+    RCNET_ReplicationLocalEntry& entry = it->second;
+    entry.present = false;
+    entry.value.clear();
+
+    replication->updates.fetch_add(1, std::memory_order_relaxed);
+    if (entry.dirty)
+    {
+        replication->coalesced.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    entry.dirty = true;
+    replication->dirtyEntries.emplace_back(&it->first, &entry);
+    return true;
+}
+
+uint32_t rcnet_replication_flush(RCNET_Replication* replication)
+{
+    if (replication == NULL)
+        return 0;
+
+    const uint32_t interval = replication->config.snapshotIntervalTicks;
+    const bool snapshotRequested = replication->snapshotRequested.exchange(false, std::memory_order_relaxed);
+    const bool snapshot = replication->flushCount == 0 || (interval > 0 && replication->flushCount % interval == 0) ||
+                          snapshotRequested;
+    replication->flushCount++;
+
+    std::vector<uint8_t>& body = replication->body;
+    body.assign(4, 0); // nombre d'entrées, écrit par rcnet_replication_publish
+    size_t entryCount = 0;
+    bool publish = false;
+    {
+        std::lock_guard<std::mutex> lock(replication->localMutex);
+        publish = snapshot || !replication->dirtyEntries.empty();
+
+        if (!publish)
+        {
+            // Rien de changé depuis le dernier flush : aucun message
+        }
+        else if (snapshot)
+        {
+            for (const auto& entry : replication->local)
+            {
+                if (!entry.second.present)
+                    continue;
+                rcnet_replication_putEntry(body, entry.first, entry.second);
+                entryCount++;
+            }
+        }
+        else
+        {
+            for (const auto& dirty : replication->dirtyEntries)
+                rcnet_replication_putEntry(body, *dirty.first, *dirty.second);
+            entryCount = replication->dirtyEntries.size();
+        }
+
+        // Changements publiés : les clés supprimées quittent l'état local
+        for (const auto& dirty : replication->dirtyEntries)
+        {
+            dirty.second->dirty = false;
+            if (!dirty.second->present)
+                replication->local.erase(replication->local.find(*dirty.first));
+        }
+        replication->dirtyEntries.clear();
+    }
+
+    if (publish)
+        rcnet_replication_publish(replication, snapshot ? kFlagSnapshot : 0, entryCount);
+
+    if (replication->ownsPublisher)
+        rcnet_nats_async_publisher_flush(replication->publisher);
+    return static_cast<uint32_t>(entryCount);
+}
+
+uint32_t rcnet_replication_poll(RCNET_Replication* replication)
+{
+    if (replication == NULL)
+        return 0;
+
+    {
+        std::lock_guard<std::mutex> lock(replication->inboxMutex);
+        replication->processing.swap(replication->inbox);
+    }
+
+    const uint64_t nowNs = rcnet_timer_get_time_ns();
+    uint32_t applied = 0;
+    for (natsMsg* msg : replication->processing)
+    {
+        applied += rcnet_replication_receive(replication, msg, nowNs);
+        natsMsg_Destroy(msg);
+    }
+    replication->processing.clear();
+
+    for (auto& entry : replication->sources)
+    {
+        if (entry.second.resyncSubscription != NULL)
+            applied += rcnet_replication_advanceResync(replication, entry.first, entry.second, nowNs);
+    }
+
+    return applied;
+}
+
+bool rcnet_replication_get(const RCNET_Replication* replication, const char* sourceId, const char* key, const uint8_t** outValue,
+                           size_t* outValueLength)
+{
+    if (replication == NULL || sourceId == NULL || key == NULL || outValue == NULL || outValueLength == NULL)
+        return false;
+
+    auto source = replication->sources.find(sourceId);
+    if (source == replication->sources.end())
+        return false;
+
+    auto value = source->second.values.find(key);
+    if (value == source->second.values.end())
+        return false;
+
+    *outValue = value->second.data();
+    *outValueLength = value->second.size();
+    return true;
+}
+
+void rcnet_replication_get_stats(const RCNET_Replication* replication, RCNET_ReplicationStats* outStats)
+{
+    if (outStats == NULL)
+        return;
+
+    *outStats = RCNET_ReplicationStats{};
+    if (replication == NULL)
+        return;
+
+    outStats->updates = replication->updates.load(std::memory_order_relaxed);
+    outStats->coalesced = replication->coalesced.load(std::memory_order_relaxed);
+    outStats->batchesPublished = replication->batchesPublished.load(std::memory_order_relaxed);
+    outStats->snapshotsPublished = replication->snapshotsPublished.load(std::memory_order_relaxed);
+    outStats->entriesPublished = replication->entriesPublished.load(std::memory_order_relaxed);
+    outStats->bytesPublished = replication->bytesPublished.load(std::memory_order_relaxed);
+    outStats->bytesUncompressed = replication->bytesUncompressed.load(std::memory_order_relaxed);
+    outStats->publishFailures = replication->publishFailures.load(std::memory_order_relaxed);
+    outStats->batchesReceived = replication->batchesReceived.load(std::memory_order_relaxed);
+    outStats->entriesApplied = replication->entriesApplied.load(std::memory_order_relaxed);
+    outStats->duplicates = replication->duplicates.load(std::memory_order_relaxed);
+    outStats->gaps = replication->gaps.load(std::memory_order_relaxed);
+    outStats->resyncs = replication->resyncs.load(std::memory_order_relaxed);
+    outStats->resyncFailures = replication->resyncFailures.load(std::memory_order_relaxed);
+    outStats->decodeErrors = replication->decodeErrors.load(std::memory_order_relaxed);
+    outStats->sources = replication->sourceCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,409 @@
+#include "RCNET/RCNET_secure_channel.h"
+#include "RCNET/RCNET_logger.h"
+#include "RCNET/RCNET_subsystem.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <cstring>
+#include <new>
+
+// ================================
+// Dependencies Libraries libsodium
+// ================================
+#include <sodium.h>
+
+static_assert(RCNET_SECURE_PUBLIC_KEY_SIZE == crypto_kx_PUBLICKEYBYTES, "crypto_kx public key size");
+static_assert(RCNET_SECURE_SECRET_KEY_SIZE == crypto_kx_SECRETKEYBYTES, "crypto_kx secret key size");
+static_assert(crypto_kx_SESSIONKEYBYTES == crypto_aead_chacha20poly1305_ietf_KEYBYTES, "crypto_kx session key size");
+static_assert(RCNET_SECURE_TAG_SIZE == crypto_aead_chacha20poly1305_ietf_ABYTES, "Poly1305 tag size");
+static_assert(RCNET_SECURE_SERVER_NONCE_SIZE >= crypto_generichash_KEYBYTES_MIN &&
+              RCNET_SECURE_SERVER_NONCE_SIZE <= crypto_generichash_KEYBYTES_MAX, "server nonce used as BLAKE2b key");
+
+// "RCS" / "RCW" + version du format (2 : clés de session mêlées au nonce du serveur)
+static constexpr uint8_t kHelloMagic[4] = { 'R', 'C', 'S', 2 };
+static constexpr uint8_t kWelcomeMagic[4] = { 'R', 'C', 'W', 2 };
+
+// Fenêtre anti-rejeu : un bit par compteur, bit 0 = rxHighest
+static constexpr uint64_t kReplayWindow = 64;
+
+// Demi-période du compteur transmis : au-delà, le compteur reconstruit bascule sur l'époque voisine
+static constexpr uint64_t kCounterHalfRange = 1ull << 31;
+static constexpr uint64_t kCounterRange = 1ull << 32;
+
+struct RCNET_SecureChannelState
+{
+    uint64_t txCounter = 0; // dernier compteur envoyé (le premier packet utilise 1)
+    uint64_t rxHighest = 0; // plus grand compteur reçu et authentifié
+    uint64_t rxWindow = 1;  // compteurs reçus dans [rxHighest - 63, rxHighest] (0 est réservé)
+};
+
+struct RCNET_SecureSession
+{
+    uint8_t rxKey[crypto_kx_SESSIONKEYBYTES];
+    uint8_t txKey[crypto_kx_SESSIONKEYBYTES];
+    bool established = false;
+    bool awaitingWelcome = false; // client : HELLO envoyé, rxKey / txKey sont encore les clés crypto_kx brutes
+    uint32_t channelCount = 0;
+    RCNET_SecureChannelState channels[RCNET_SECURE_MAX_CHANNELS];
+
+    // Un seul écrivain (le thread de la session) : relaxed, lisibles depuis n'importe quel thread
+    std::atomic<uint64_t> sealed{0};
+    std::atomic<uint64_t> opened{0};
+    std::atomic<uint64_t> authFailures{0};
+    std::atomic<uint64_t> replays{0};
+    std::atomic<uint64_t> tooOld{0};
+    std::atomic<uint64_t> handshakeFailures{0};
+    std::atomic<uint64_t> earlyPackets{0};
+};
+
+static inline void rcnet_secure_increment(std::atomic<uint64_t>& counter)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+static inline void rcnet_secure_writeU32(uint8_t* out, uint32_t value)
+{
+    out[0] = static_cast<uint8_t>(value);
+    out[1] = static_cast<uint8_t>(value >> 8);
+    out[2] = static_cast<uint8_t>(value >> 16);
+    out[3] = static_cast<uint8_t>(value >> 24);
+}
+
+static inline uint32_t rcnet_secure_readU32(const uint8_t* in)
+{
+    return static_cast<uint32_t>(in[0]) | (static_cast<uint32_t>(in[1]) << 8) | (static_cast<uint32_t>(in[2]) << 16) |
+           (static_cast<uint32_t>(in[3]) << 24);
+}
+
+// Nonce implicite : channel | 0 0 0 | compteur 64 bits (LE). Chaque sens a sa clé, le même nonce
+// peut donc servir une fois dans chaque sens. Le compteur et le channel étant dans le nonce, un
+// header ou un channel falsifié fait échouer l'authentification : pas besoin de données associées.
+static inline void rcnet_secure_buildNonce(uint8_t* nonce, uint8_t channelId, uint64_t counter)
+{
+    nonce[0] = channelId;
+    nonce[1] = 0;
+    nonce[2] = 0;
+    nonce[3] = 0;
+    for (int i = 0; i < 8; ++i)
+        nonce[4 + i] = static_cast<uint8_t>(counter >> (8 * i));
+}
+
+// Compteur 64 bits le plus proche de rxHighest + 1 dont les 32 bits de poids faible valent truncated
+static inline uint64_t rcnet_secure_expandCounter(uint64_t rxHighest, uint32_t truncated)
+{
+    uint64_t expected = rxHighest + 1;
+    uint64_t candidate = (expected & ~(kCounterRange - 1)) | truncated;
+
+    if (candidate + kCounterHalfRange <= expected && candidate <= UINT64_MAX - kCounterRange)
+        return candidate + kCounterRange;
+    if (candidate > expected + kCounterHalfRange && candidate >= kCounterRange)
+        return candidate - kCounterRange;
+    return candidate;
+}
+
+static void rcnet_secure_clearKeys(RCNET_SecureSession* session)
+{
+    sodium_memzero(session->rxKey, sizeof(session->rxKey));
+    sodium_memzero(session->txKey, sizeof(session->txKey));
+    session->established = false;
+    session->awaitingWelcome = false;
+    for (uint32_t i = 0; i < RCNET_SECURE_MAX_CHANNELS; ++i)
+        session->channels[i] = RCNET_SecureChannelState{};
+}
+
+// Clé de session = BLAKE2b(clé crypto_kx, clé = nonce du serveur). Le nonce est tiré à chaque HELLO
+// accepté : un HELLO rejoué sur une nouvelle connexion donne d'autres clés, les packets capturés
+// avec lui ne s'authentifient plus.
+static void rcnet_secure_mixServerNonce(RCNET_SecureSession* session, const uint8_t* serverNonce)
+{
+    uint8_t mixed[crypto_kx_SESSIONKEYBYTES];
+    crypto_generichash(mixed, sizeof(mixed), session->rxKey, sizeof(session->rxKey), serverNonce, RCNET_SECURE_SERVER_NONCE_SIZE);
+    std::memcpy(session->rxKey, mixed, sizeof(mixed));
+    crypto_generichash(mixed, sizeof(mixed), session->txKey, sizeof(session->txKey), serverNonce, RCNET_SECURE_SERVER_NONCE_SIZE);
+    std::memcpy(session->txKey, mixed, sizeof(mixed));
+    sodium_memzero(mixed, sizeof(mixed));
+}
+
+// Tag du WELCOME : prouve au client que le serveur détient sa clé secrète statique (clé serveur -> client)
+static void rcnet_secure_welcomeTag(uint8_t* tag, const uint8_t* serverNonce, const uint8_t* serverToClientKey)
+{
+    crypto_generichash(tag, RCNET_SECURE_TAG_SIZE, serverNonce, RCNET_SECURE_SERVER_NONCE_SIZE, serverToClientKey,
+                       crypto_kx_SESSIONKEYBYTES);
+}
+
+// ======================================================
+// Clés
+// ======================================================
+bool rcnet_secure_generate_keypair(RCNET_SecureKeyPair* outKeys)
+{
+    if (outKeys == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_secure_generate_keypair: outKeys is NULL\n");
+        return false;
+    }
+    if (!rcnet_subsystem_acquire(RCNET_SUBSYSTEM_LIBSODIUM))
+        return false;
+
+    crypto_kx_keypair(outKeys->publicKey, outKeys->secretKey);
+    rcnet_subsystem_release(RCNET_SUBSYSTEM_LIBSODIUM);
+    return true;
+}
+
+void rcnet_secure_wipe(void* data, size_t size)
+{
+    if (data != NULL)
+        sodium_memzero(data, size);
+}
+
+// ======================================================
+// Session
+// ======================================================
+RCNET_SecureSession* rcnet_secure_session_create(uint32_t channelCount)
+{
+    if (channelCount == 0 || channelCount > RCNET_SECURE_MAX_CHANNELS)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_secure_session_create: channelCount must be in [1, %u]\n", RCNET_SECURE_MAX_CHANNELS);
+        return NULL;
+    }
+    if (!rcnet_subsystem_acquire(RCNET_SUBSYSTEM_LIBSODIUM))
+        return NULL;
+
+    RCNET_SecureSession* session = new (std::nothrow) RCNET_SecureSession();
+    if (session == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_secure_session_create: allocation failed\n");
+        rcnet_subsystem_release(RCNET_SUBSYSTEM_LIBSODIUM);
+        return NULL;
+    }
+
+    session->channelCount = channelCount;
+    rcnet_secure_clearKeys(session);
+    return session;
+}
+
+void rcnet_secure_session_destroy(RCNET_SecureSession* session)
+{
+    if (session == NULL)
+        return;
+
+    rcnet_secure_clearKeys(session);
+    delete session;
+    rcnet_subsystem_release(RCNET_SUBSYSTEM_LIBSODIUM);
+}
+
+void rcnet_secure_session_reset(RCNET_SecureSession* session)
+{
+    if (session != NULL)
+        rcnet_secure_clearKeys(session);
+}
+
+bool rcnet_secure_session_start_client(RCNET_SecureSession* session, const uint8_t* serverPublicKey, uint8_t* outHello)
+{
+    if (session == NULL || serverPublicKey == NULL || outHello == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_secure_session_start_client: invalid parameters\n");
+        return false;
+    }
+
+    rcnet_secure_clearKeys(session);
+
+    // Paire éphémère : la clé secrète n'existe que le temps de dériver les clés de session
+    uint8_t clientPublicKey[crypto_kx_PUBLICKEYBYTES];
+    uint8_t clientSecretKey[crypto_kx_SECRETKEYBYTES];
+    crypto_kx_keypair(clientPublicKey, clientSecretKey);
+
+    int result = crypto_kx_client_session_keys(session->rxKey, session->txKey, clientPublicKey, clientSecretKey, serverPublicKey);
+    sodium_memzero(clientSecretKey, sizeof(clientSecretKey));
+    if (result != 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_secure_session_start_client: invalid server public key\n");
+        rcnet_secure_clearKeys(session);
+        return false;
+    }
+
+    std::memcpy(outHello, kHelloMagic, sizeof(kHelloMagic));
+    std::memcpy(outHello + sizeof(kHelloMagic), clientPublicKey, sizeof(clientPublicKey));
+    session->awaitingWelcome = true;
+    return true;
+}
+
+bool rcnet_secure_session_finish_client(RCNET_SecureSession* session, const uint8_t* welcome, size_t welcomeLength)
+{
+    if (session == NULL || !session->awaitingWelcome)
+        return false;
+
+    if (!rcnet_secure_is_welcome(welcome, welcomeLength))
+    {
+        rcnet_secure_increment(session->earlyPackets);
+        return false;
+    }
+
+    const uint8_t* serverNonce = welcome + sizeof(kWelcomeMagic);
+    rcnet_secure_mixServerNonce(session, serverNonce);
+
+    uint8_t tag[RCNET_SECURE_TAG_SIZE];
+    rcnet_secure_welcomeTag(tag, serverNonce, session->rxKey);
+    if (sodium_memcmp(tag, serverNonce + RCNET_SECURE_SERVER_NONCE_SIZE, sizeof(tag)) != 0)
+    {
+        rcnet_secure_increment(session->handshakeFailures);
+        rcnet_secure_clearKeys(session);
+        return false;
+    }
+
+    session->awaitingWelcome = false;
+    session->established = true;
+    return true;
+}
+
+bool rcnet_secure_session_accept_client(RCNET_SecureSession* session, const RCNET_SecureKeyPair* serverKeys, const uint8_t* hello,
+                                        size_t helloLength, uint8_t* outWelcome)
+{
+    if (session == NULL || serverKeys == NULL || outWelcome == NULL)
+        return false;
+
+    if (!rcnet_secure_is_hello(hello, helloLength))
+    {
+        rcnet_secure_increment(session->earlyPackets);
+        return false;
+    }
+
+    rcnet_secure_clearKeys(session);
+    if (crypto_kx_server_session_keys(session->rxKey, session->txKey, serverKeys->publicKey, serverKeys->secretKey,
+                                      hello + sizeof(kHelloMagic)) != 0)
+    {
+        rcnet_secure_increment(session->handshakeFailures);
+        rcnet_secure_clearKeys(session);
+        return false;
+    }
+
+    // Aléa propre à cette connexion : WELCOME = magic | nonce | tag
+    uint8_t* serverNonce = outWelcome + sizeof(kWelcomeMagic);
+    std::memcpy(outWelcome, kWelcomeMagic, sizeof(kWelcomeMagic));
+    randombytes_buf(serverNonce, RCNET_SECURE_SERVER_NONCE_SIZE);
+    rcnet_secure_mixServerNonce(session, serverNonce);
+    rcnet_secure_welcomeTag(serverNonce + RCNET_SECURE_SERVER_NONCE_SIZE, serverNonce, session->txKey);
+
+    session->established = true;
+    return true;
+}
+
+bool rcnet_secure_is_hello(const uint8_t* data, size_t length)
+{
+    return data != NULL && length == RCNET_SECURE_HELLO_SIZE && std::memcmp(data, kHelloMagic, sizeof(kHelloMagic)) == 0;
+}
+
+bool rcnet_secure_is_welcome(const uint8_t* data, size_t length)
+{
+    return data != NULL && length == RCNET_SECURE_WELCOME_SIZE && std::memcmp(data, kWelcomeMagic, sizeof(kWelcomeMagic)) == 0;
+}
+
+bool rcnet_secure_session_is_established(const RCNET_SecureSession* session)
+{
+    return session != NULL && session->established;
+}
+
+// ======================================================
+// Chemin chaud : seal / open en place
+// ======================================================
+size_t rcnet_secure_session_seal(RCNET_SecureSession* session, uint8_t channelId, uint8_t* buffer, size_t payloadLength,
+                                 size_t capacity)
+{
+    if (session == NULL || buffer == NULL || !session->established || channelId >= session->channelCount ||
+        payloadLength > capacity || capacity - payloadLength < RCNET_SECURE_OVERHEAD)
+        return 0;
+
+    RCNET_SecureChannelState& channel = session->channels[channelId];
+    uint64_t counter = ++channel.txCounter;
+
+    uint8_t nonce[crypto_aead_chacha20poly1305_ietf_NPUBBYTES];
+    rcnet_secure_buildNonce(nonce, channelId, counter);
+    rcnet_secure_writeU32(buffer, static_cast<uint32_t>(counter));
+
+    uint8_t* payload = buffer + RCNET_SECURE_HEADER_SIZE;
+    crypto_aead_chacha20poly1305_ietf_encrypt_detached(payload, payload + payloadLength, NULL, payload, payloadLength, NULL, 0, NULL,
+                                                       nonce, session->txKey);
+
+    rcnet_secure_increment(session->sealed);
+    return payloadLength + RCNET_SECURE_OVERHEAD;
+}
+
+bool rcnet_secure_session_open(RCNET_SecureSession* session, uint8_t channelId, uint8_t* data, size_t length,
+                               const uint8_t** outPayload, size_t* outPayloadLength)
+{
+    if (session == NULL || data == NULL || outPayload == NULL || outPayloadLength == NULL)
+        return false;
+
+    if (!session->established || channelId >= session->channelCount || length < RCNET_SECURE_OVERHEAD)
+    {
+        rcnet_secure_increment(session->authFailures);
+        return false;
+    }
+
+    RCNET_SecureChannelState& channel = session->channels[channelId];
+    uint64_t counter = rcnet_secure_expandCounter(channel.rxHighest, rcnet_secure_readU32(data));
+
+    // Rejeu / trop ancien : rejeté avant tout calcul cryptographique
+    if (counter <= channel.rxHighest)
+    {
+        uint64_t age = channel.rxHighest - counter;
+        if (age >= kReplayWindow)
+        {
+            rcnet_secure_increment(session->tooOld);
+            return false;
+        }
+        if ((channel.rxWindow >> age) & 1u)
+        {
+            rcnet_secure_increment(session->replays);
+            return false;
+        }
+    }
+
+    uint8_t nonce[crypto_aead_chacha20poly1305_ietf_NPUBBYTES];
+    rcnet_secure_buildNonce(nonce, channelId, counter);
+
+    uint8_t* payload = data + RCNET_SECURE_HEADER_SIZE;
+    size_t payloadLength = length - RCNET_SECURE_OVERHEAD;
+    if (crypto_aead_chacha20poly1305_ietf_decrypt_detached(payload, NULL, payload, payloadLength, payload + payloadLength, NULL, 0, nonce,
+                                                           session->rxKey) != 0)
+    {
+        rcnet_secure_increment(session->authFailures);
+        return false;
+    }
+
+    // La fenêtre n'avance qu'une fois le packet authentifié
+    if (counter > channel.rxHighest)
+    {
+        uint64_t shift = counter - channel.rxHighest;
+        channel.rxWindow = (shift >= kReplayWindow) ? 1u : ((channel.rxWindow << shift) | 1u);
+        channel.rxHighest = counter;
+    }
+    else
+    {
+        channel.rxWindow |= 1ull << (channel.rxHighest - counter);
+    }
+
+    rcnet_secure_increment(session->opened);
+    *outPayload = payload;
+    *outPayloadLength = payloadLength;
+    return true;
+}
+
+void rcnet_secure_session_get_stats(const RCNET_SecureSession* session, RCNET_SecureSessionStats* outStats)
+{
+    if (outStats == NULL)
+        return;
+
+    std::memset(outStats, 0, sizeof(*outStats));
+    if (session == NULL)
+        return;
+
+    outStats->sealed = session->sealed.load(std::memory_order_relaxed);
+    outStats->opened = session->opened.load(std::memory_order_relaxed);
+    outStats->authFailures = session->authFailures.load(std::memory_order_relaxed);
+    outStats->replays = session->replays.load(std::memory_order_relaxed);
+    outStats->tooOld = session->tooOld.load(std::memory_order_relaxed);
+    outStats->handshakeFailures = session->handshakeFailures.load(std::memory_order_relaxed);
+    outStats->earlyPackets = session->earlyPackets.load(std::memory_order_relaxed);
+}
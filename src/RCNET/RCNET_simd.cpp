@@ -0,0 +1,683 @@
+#include "RCNET/RCNET_simd.h"
+#include "RCNET/RCNET_snapshot.h" // rcnet_quantize_float (référence scalaire)
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <cstring>
+
+// ================================
+// Architecture
+// ================================
+// x86-64 : les kernels SSE4.1 / AVX2 sont compilés avec un attribut target (GCC / Clang) ou
+// directement (MSVC accepte les intrinsics sans /arch), et choisis à l'exécution par cpuid.
+// arm64 : NEON fait partie de l'ABI, pas de détection.
+#if defined(__x86_64__) || defined(_M_X64)
+    #define RCNET_SIMD_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define RCNET_SIMD_TARGET_SSE41
+        #define RCNET_SIMD_TARGET_AVX2
+    #else
+        #define RCNET_SIMD_TARGET_SSE41 __attribute__((target("sse4.1")))
+        #define RCNET_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define RCNET_SIMD_NEON 1
+    #include <arm_neon.h>
+#endif
+
+// Table des kernels d'un backend
+struct RCNET_SimdKernels
+{
+    RCNET_SimdBackend backend;
+    void (*quantize)(const float*, uint32_t, float, float, uint32_t, uint32_t*);
+    uint32_t (*xorDiff)(const uint32_t*, const uint32_t*, uint32_t, uint64_t*, uint32_t*);
+    size_t (*encodeDeltaVarint)(const uint32_t*, const uint32_t*, uint32_t, uint8_t*, size_t);
+};
+
+// ============================================================
+// Scalaire (référence, et fin de tableau des backends vectoriels)
+// ============================================================
+static inline uint32_t rcnet_simd_zigzag(uint32_t delta)
+{
+    return (delta << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(delta) >> 31);
+}
+
+static inline uint32_t rcnet_simd_unzigzag(uint32_t value)
+{
+    return (value >> 1) ^ (0u - (value & 1u));
+}
+
+// Ecrit un varint, 0 si le buffer est trop petit
+static inline size_t rcnet_simd_writeVarint(uint32_t value, uint8_t* out, size_t capacity)
+{
+    size_t size = 0;
+    while (value >= 0x80u)
+    {
+        if (size >= capacity)
+            return 0;
+        out[size++] = static_cast<uint8_t>(value | 0x80u);
+        value >>= 7;
+    }
+    if (size >= capacity)
+        return 0;
+    out[size++] = static_cast<uint8_t>(value);
+    return size;
+}
+
+static void rcnet_simd_quantizeScalar(const float* values, uint32_t count, float minValue, float maxValue, uint32_t bitCount,
+                                      uint32_t* outQuantized)
+{
+    for (uint32_t i = 0; i < count; ++i)
+        outQuantized[i] = rcnet_quantize_float(values[i], minValue, maxValue, bitCount);
+}
+
+// Diff XOR de [start, count) : le mot du masque de start est supposé déjà initialisé
+static uint32_t rcnet_simd_xorDiffTail(const uint32_t* current, const uint32_t* baseline, uint32_t start, uint32_t count,
+                                       uint64_t* outChangedMask, uint32_t* outPacked, uint32_t packedCount)
+{
+    for (uint32_t i = start; i < count; ++i)
+    {
+        if ((i & 63) == 0)
+            outChangedMask[i >> 6] = 0;
+
+        uint32_t diff = current[i] ^ baseline[i];
+        if (diff != 0)
+        {
+            outChangedMask[i >> 6] |= 1ull << (i & 63);
+            outPacked[packedCount++] = diff;
+        }
+    }
+    return packedCount;
+}
+
+static uint32_t rcnet_simd_xorDiffScalar(const uint32_t* current, const uint32_t* baseline, uint32_t count, uint64_t* outChangedMask,
+                                         uint32_t* outPacked)
+{
+    return rcnet_simd_xorDiffTail(current, baseline, 0, count, outChangedMask, outPacked, 0);
+}
+
+// Encode [start, count) à partir de out + size, 0 si le buffer est trop petit
+static size_t rcnet_simd_encodeDeltaVarintTail(const uint32_t* current, const uint32_t* baseline, uint32_t start, uint32_t count,
+                                               uint8_t* out, size_t capacity, size_t size)
+{
+    for (uint32_t i = start; i < count; ++i)
+    {
+        size_t written = rcnet_simd_writeVarint(rcnet_simd_zigzag(current[i] - baseline[i]), out + size, capacity - size);
+        if (written == 0)
+            return 0;
+        size += written;
+    }
+    return size;
+}
+
+static size_t rcnet_simd_encodeDeltaVarintScalar(const uint32_t* current, const uint32_t* baseline, uint32_t count, uint8_t* out,
+                                                 size_t capacity)
+{
+    return rcnet_simd_encodeDeltaVarintTail(current, baseline, 0, count, out, capacity, 0);
+}
+
+// Tables de compaction ("left-pack") : pour un masque de lanes modifiées, les lanes à garder, en tête
+// du registre. Une seule écriture vectorielle par bloc, le compteur avance du popcount du masque.
+struct RCNET_SimdPackTable4
+{
+    uint8_t bytes[16][16]; // shuffle d'octets (pshufb / tbl) pour 4 lanes de 32 bits
+    uint8_t counts[16];
+};
+
+struct RCNET_SimdPackTable8
+{
+    uint8_t lanes[256][8]; // index de lane (vpermd) pour 8 lanes de 32 bits
+    uint8_t counts[256];
+};
+
+static constexpr RCNET_SimdPackTable4 rcnet_simd_buildPackTable4(void)
+{
+    RCNET_SimdPackTable4 table = {};
+    for (uint32_t mask = 0; mask < 16; ++mask)
+    {
+        uint32_t count = 0;
+        for (uint32_t lane = 0; lane < 4; ++lane)
+        {
+            if ((mask >> lane) & 1u)
+            {
+                for (uint32_t byte = 0; byte < 4; ++byte)
+                    table.bytes[mask][count * 4 + byte] = static_cast<uint8_t>(lane * 4 + byte);
+                count++;
+            }
+        }
+        for (uint32_t byte = count * 4; byte < 16; ++byte)
+            table.bytes[mask][byte] = 0x80u; // zéro (jamais lu : au-delà du compteur)
+        table.counts[mask] = static_cast<uint8_t>(count);
+    }
+    return table;
+}
+
+static constexpr RCNET_SimdPackTable8 rcnet_simd_buildPackTable8(void)
+{
+    RCNET_SimdPackTable8 table = {};
+    for (uint32_t mask = 0; mask < 256; ++mask)
+    {
+        uint32_t count = 0;
+        for (uint32_t lane = 0; lane < 8; ++lane)
+        {
+            if ((mask >> lane) & 1u)
+                table.lanes[mask][count++] = static_cast<uint8_t>(lane);
+        }
+        table.counts[mask] = static_cast<uint8_t>(count);
+    }
+    return table;
+}
+
+#if defined(RCNET_SIMD_X86) || defined(RCNET_SIMD_NEON)
+alignas(16) static constexpr RCNET_SimdPackTable4 kPackTable4 = rcnet_simd_buildPackTable4();
+#endif
+#if defined(RCNET_SIMD_X86)
+alignas(16) static constexpr RCNET_SimdPackTable8 kPackTable8 = rcnet_simd_buildPackTable8();
+#endif
+
+static const RCNET_SimdKernels kScalarKernels = {
+    RCNET_SIMD_BACKEND_SCALAR,
+    rcnet_simd_quantizeScalar,
+    rcnet_simd_xorDiffScalar,
+    rcnet_simd_encodeDeltaVarintScalar
+};
+
+// ============================================================
+// SSE4.1 / AVX2
+// ============================================================
+#if defined(RCNET_SIMD_X86)
+
+RCNET_SIMD_TARGET_SSE41
+static void rcnet_simd_quantizeSse41(const float* values, uint32_t count, float minValue, float maxValue, uint32_t bitCount,
+                                     uint32_t* outQuantized)
+{
+    const uint32_t maxQuantized = (1u << bitCount) - 1u;
+    const __m128 minVector = _mm_set1_ps(minValue);
+    const __m128 maxVector = _mm_set1_ps(maxValue);
+    const __m128 rangeVector = _mm_set1_ps(maxValue - minValue);
+    const __m128 scaleVector = _mm_set1_ps(static_cast<float>(maxQuantized));
+    const __m128 halfVector = _mm_set1_ps(0.5f);
+    const __m128i maxQuantizedVector = _mm_set1_epi32(static_cast<int32_t>(maxQuantized));
+
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 value = _mm_loadu_ps(values + i);
+        __m128 normalized = _mm_div_ps(_mm_sub_ps(value, minVector), rangeVector);
+        __m128i quantized = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(normalized, scaleVector), halfVector));
+
+        // !(value > min) (NaN compris) -> 0, value >= max -> maxQuantized
+        __m128 aboveMin = _mm_cmpgt_ps(value, minVector);
+        __m128 atMax = _mm_cmpge_ps(value, maxVector);
+        quantized = _mm_and_si128(quantized, _mm_castps_si128(aboveMin));
+        quantized = _mm_blendv_epi8(quantized, maxQuantizedVector, _mm_castps_si128(atMax));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(outQuantized + i), quantized);
+    }
+
+    rcnet_simd_quantizeScalar(values + i, count - i, minValue, maxValue, bitCount, outQuantized + i);
+}
+
+RCNET_SIMD_TARGET_AVX2
+static void rcnet_simd_quantizeAvx2(const float* values, uint32_t count, float minValue, float maxValue, uint32_t bitCount,
+                                    uint32_t* outQuantized)
+{
+    const uint32_t maxQuantized = (1u << bitCount) - 1u;
+    const __m256 minVector = _mm256_set1_ps(minValue);
+    const __m256 maxVector = _mm256_set1_ps(maxValue);
+    const __m256 rangeVector = _mm256_set1_ps(maxValue - minValue);
+    const __m256 scaleVector = _mm256_set1_ps(static_cast<float>(maxQuantized));
+    const __m256 halfVector = _mm256_set1_ps(0.5f);
+    const __m256i maxQuantizedVector = _mm256_set1_epi32(static_cast<int32_t>(maxQuantized));
+
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 value = _mm256_loadu_ps(values + i);
+        __m256 normalized = _mm256_div_ps(_mm256_sub_ps(value, minVector), rangeVector);
+        __m256i quantized = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(normalized, scaleVector), halfVector));
+
+        __m256 aboveMin = _mm256_cmp_ps(value, minVector, _CMP_GT_OQ);
+        __m256 atMax = _mm256_cmp_ps(value, maxVector, _CMP_GE_OQ);
+        quantized = _mm256_and_si256(quantized, _mm256_castps_si256(aboveMin));
+        quantized = _mm256_blendv_epi8(quantized, maxQuantizedVector, _mm256_castps_si256(atMax));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(outQuantized + i), quantized);
+    }
+
+    rcnet_simd_quantizeScalar(values + i, count - i, minValue, maxValue, bitCount, outQuantized + i);
+}
+
+RCNET_SIMD_TARGET_SSE41
+static uint32_t rcnet_simd_xorDiffSse41(const uint32_t* current, const uint32_t* baseline, uint32_t count, uint64_t* outChangedMask,
+                                        uint32_t* outPacked)
+{
+    const __m128i zero = _mm_setzero_si128();
+    uint32_t packedCount = 0;
+
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        if ((i & 63) == 0)
+            outChangedMask[i >> 6] = 0;
+
+        __m128i diff = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(current + i)),
+                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(baseline + i)));
+        uint32_t changed = ~static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(diff, zero)))) & 0xFu;
+        if (changed == 0)
+            continue;
+
+        outChangedMask[i >> 6] |= static_cast<uint64_t>(changed) << (i & 63);
+
+        // packedCount <= i : l'écriture de 4 valeurs reste dans [0, count)
+        __m128i shuffle = _mm_load_si128(reinterpret_cast<const __m128i*>(kPackTable4.bytes[changed]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(outPacked + packedCount), _mm_shuffle_epi8(diff, shuffle));
+        packedCount += kPackTable4.counts[changed];
+    }
+
+    return rcnet_simd_xorDiffTail(current, baseline, i, count, outChangedMask, outPacked, packedCount);
+}
+
+RCNET_SIMD_TARGET_AVX2
+static uint32_t rcnet_simd_xorDiffAvx2(const uint32_t* current, const uint32_t* baseline, uint32_t count, uint64_t* outChangedMask,
+                                       uint32_t* outPacked)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    uint32_t packedCount = 0;
+
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        if ((i & 63) == 0)
+            outChangedMask[i >> 6] = 0;
+
+        __m256i diff = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(current + i)),
+                                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(baseline + i)));
+        uint32_t changed = ~static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(diff, zero)))) & 0xFFu;
+        if (changed == 0)
+            continue;
+
+        outChangedMask[i >> 6] |= static_cast<uint64_t>(changed) << (i & 63);
+
+        __m256i permutation = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(kPackTable8.lanes[changed])));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(outPacked + packedCount), _mm256_permutevar8x32_epi32(diff, permutation));
+        packedCount += kPackTable8.counts[changed];
+    }
+
+    return rcnet_simd_xorDiffTail(current, baseline, i, count, outChangedMask, outPacked, packedCount);
+}
+
+RCNET_SIMD_TARGET_SSE41
+static size_t rcnet_simd_encodeDeltaVarintSse41(const uint32_t* current, const uint32_t* baseline, uint32_t count, uint8_t* out,
+                                                size_t capacity)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t size = 0;
+
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i delta = _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(current + i)),
+                                      _mm_loadu_si128(reinterpret_cast<const __m128i*>(baseline + i)));
+        __m128i zigzag = _mm_xor_si128(_mm_slli_epi32(delta, 1), _mm_srai_epi32(delta, 31));
+
+        // Les 4 valeurs tiennent sur un octet : 32 -> 16 -> 8 bits et une écriture de 4 octets
+        bool allSmall = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_srli_epi32(zigzag, 7), zero)) == 0xFFFF;
+        if (allSmall && capacity - size >= 4)
+        {
+            __m128i bytes = _mm_packus_epi16(_mm_packus_epi32(zigzag, zero), zero);
+            int32_t packed = _mm_cvtsi128_si32(bytes);
+            std::memcpy(out + size, &packed, 4);
+            size += 4;
+            continue;
+        }
+
+        alignas(16) uint32_t lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), zigzag);
+        for (uint32_t lane = 0; lane < 4; ++lane)
+        {
+            size_t written = rcnet_simd_writeVarint(lanes[lane], out + size, capacity - size);
+            if (written == 0)
+                return 0;
+            size += written;
+        }
+    }
+
+    return rcnet_simd_encodeDeltaVarintTail(current, baseline, i, count, out, capacity, size);
+}
+
+RCNET_SIMD_TARGET_AVX2
+static size_t rcnet_simd_encodeDeltaVarintAvx2(const uint32_t* current, const uint32_t* baseline, uint32_t count, uint8_t* out,
+                                               size_t capacity)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    size_t size = 0;
+
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i delta = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(current + i)),
+                                         _mm256_loadu_si256(reinterpret_cast<const __m256i*>(baseline + i)));
+        __m256i zigzag = _mm256_xor_si256(_mm256_slli_epi32(delta, 1), _mm256_srai_epi32(delta, 31));
+
+        bool allSmall = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_srli_epi32(zigzag, 7), zero))) == 0xFFFFFFFFu;
+        if (allSmall && capacity - size >= 8)
+        {
+            // Les pack AVX2 travaillent par moitié de 128 bits : packer les deux moitiés ensemble
+            __m128i low = _mm256_castsi256_si128(zigzag);
+            __m128i high = _mm256_extracti128_si256(zigzag, 1);
+            __m128i bytes = _mm_packus_epi16(_mm_packus_epi32(low, high), _mm_setzero_si128());
+            int64_t packed = _mm_cvtsi128_si64(bytes);
+            std::memcpy(out + size, &packed, 8);
+            size += 8;
+            continue;
+        }
+
+        alignas(32) uint32_t lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), zigzag);
+        for (uint32_t lane = 0; lane < 8; ++lane)
+        {
+            size_t written = rcnet_simd_writeVarint(lanes[lane], out + size, capacity - size);
+            if (written == 0)
+                return 0;
+            size += written;
+        }
+    }
+
+    return rcnet_simd_encodeDeltaVarintTail(current, baseline, i, count, out, capacity, size);
+}
+
+static const RCNET_SimdKernels kSse41Kernels = {
+    RCNET_SIMD_BACKEND_SSE41,
+    rcnet_simd_quantizeSse41,
+    rcnet_simd_xorDiffSse41,
+    rcnet_simd_encodeDeltaVarintSse41
+};
+
+static const RCNET_SimdKernels kAvx2Kernels = {
+    RCNET_SIMD_BACKEND_AVX2,
+    rcnet_simd_quantizeAvx2,
+    rcnet_simd_xorDiffAvx2,
+    rcnet_simd_encodeDeltaVarintAvx2
+};
+
+static bool rcnet_simd_cpuSupports(RCNET_SimdBackend backend)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int registers[4];
+    __cpuid(registers, 1);
+    bool sse41 = (registers[2] & (1 << 19)) != 0;
+    bool osxsave = (registers[2] & (1 << 27)) != 0;
+    bool avx = (registers[2] & (1 << 28)) != 0;
+    if (backend == RCNET_SIMD_BACKEND_SSE41)
+        return sse41;
+
+    // AVX2 : bit CPU + registres ymm sauvegardés par l'OS (XCR0 bits 1 et 2)
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+        return false;
+    __cpuidex(registers, 7, 0);
+    return (registers[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    if (backend == RCNET_SIMD_BACKEND_SSE41)
+        return __builtin_cpu_supports("sse4.1");
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif // RCNET_SIMD_X86
+
+// ============================================================
+// NEON (arm64)
+// ============================================================
+#if defined(RCNET_SIMD_NEON)
+
+static void rcnet_simd_quantizeNeon(const float* values, uint32_t count, float minValue, float maxValue, uint32_t bitCount,
+                                    uint32_t* outQuantized)
+{
+    const uint32_t maxQuantized = (1u << bitCount) - 1u;
+    const float32x4_t minVector = vdupq_n_f32(minValue);
+    const float32x4_t maxVector = vdupq_n_f32(maxValue);
+    const float32x4_t rangeVector = vdupq_n_f32(maxValue - minValue);
+    const float32x4_t scaleVector = vdupq_n_f32(static_cast<float>(maxQuantized));
+    const float32x4_t halfVector = vdupq_n_f32(0.5f);
+    const uint32x4_t maxQuantizedVector = vdupq_n_u32(maxQuantized);
+
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t value = vld1q_f32(values + i);
+        float32x4_t normalized = vdivq_f32(vsubq_f32(value, minVector), rangeVector);
+        uint32x4_t quantized = vreinterpretq_u32_s32(vcvtq_s32_f32(vaddq_f32(vmulq_f32(normalized, scaleVector), halfVector)));
+
+        uint32x4_t aboveMin = vcgtq_f32(value, minVector);
+        uint32x4_t atMax = vcgeq_f32(value, maxVector);
+        quantized = vandq_u32(quantized, aboveMin);
+        quantized = vbslq_u32(atMax, maxQuantizedVector, quantized);
+        vst1q_u32(outQuantized + i, quantized);
+    }
+
+    rcnet_simd_quantizeScalar(values + i, count - i, minValue, maxValue, bitCount, outQuantized + i);
+}
+
+static uint32_t rcnet_simd_xorDiffNeon(const uint32_t* current, const uint32_t* baseline, uint32_t count, uint64_t* outChangedMask,
+                                       uint32_t* outPacked)
+{
+    static const uint32_t kLaneBits[4] = { 1u, 2u, 4u, 8u };
+    const uint32x4_t laneBits = vld1q_u32(kLaneBits);
+    uint32_t packedCount = 0;
+
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        if ((i & 63) == 0)
+            outChangedMask[i >> 6] = 0;
+
+        uint32x4_t diff = veorq_u32(vld1q_u32(current + i), vld1q_u32(baseline + i));
+        uint32_t changed = vaddvq_u32(vandq_u32(vtstq_u32(diff, diff), laneBits));
+        if (changed == 0)
+            continue;
+
+        outChangedMask[i >> 6] |= static_cast<uint64_t>(changed) << (i & 63);
+
+        uint8x16_t shuffle = vld1q_u8(kPackTable4.bytes[changed]);
+        vst1q_u32(outPacked + packedCount, vreinterpretq_u32_u8(vqtbl1q_u8(vreinterpretq_u8_u32(diff), shuffle)));
+        packedCount += kPackTable4.counts[changed];
+    }
+
+    return rcnet_simd_xorDiffTail(current, baseline, i, count, outChangedMask, outPacked, packedCount);
+}
+
+static size_t rcnet_simd_encodeDeltaVarintNeon(const uint32_t* current, const uint32_t* baseline, uint32_t count, uint8_t* out,
+                                               size_t capacity)
+{
+    size_t size = 0;
+
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        uint32x4_t delta = vsubq_u32(vld1q_u32(current + i), vld1q_u32(baseline + i));
+        uint32x4_t sign = vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_u32(delta), 31));
+        uint32x4_t zigzag = veorq_u32(vshlq_n_u32(delta, 1), sign);
+
+        if (vmaxvq_u32(zigzag) < 0x80u && capacity - size >= 4)
+        {
+            uint8x8_t bytes = vmovn_u16(vcombine_u16(vmovn_u32(zigzag), vdup_n_u16(0)));
+            uint32_t packed = vget_lane_u32(vreinterpret_u32_u8(bytes), 0);
+            std::memcpy(out + size, &packed, 4);
+            size += 4;
+            continue;
+        }
+
+        uint32_t lanes[4];
+        vst1q_u32(lanes, zigzag);
+        for (uint32_t lane = 0; lane < 4; ++lane)
+        {
+            size_t written = rcnet_simd_writeVarint(lanes[lane], out + size, capacity - size);
+            if (written == 0)
+                return 0;
+            size += written;
+        }
+    }
+
+    return rcnet_simd_encodeDeltaVarintTail(current, baseline, i, count, out, capacity, size);
+}
+
+static const RCNET_SimdKernels kNeonKernels = {
+    RCNET_SIMD_BACKEND_NEON,
+    rcnet_simd_quantizeNeon,
+    rcnet_simd_xorDiffNeon,
+    rcnet_simd_encodeDeltaVarintNeon
+};
+
+#endif // RCNET_SIMD_NEON
+
+// ============================================================
+// Dispatch
+// ============================================================
+
+// NULL = pas encore détecté (la détection est idempotente : deux threads peuvent la faire en même temps)
+static std::atomic<const RCNET_SimdKernels*> gSimdKernels{nullptr};
+
+static const RCNET_SimdKernels* rcnet_simd_kernelsFor(RCNET_SimdBackend backend)
+{
+    switch (backend)
+    {
+        case RCNET_SIMD_BACKEND_SCALAR:
+            return &kScalarKernels;
+#if defined(RCNET_SIMD_X86)
+        case RCNET_SIMD_BACKEND_SSE41:
+            return rcnet_simd_cpuSupports(RCNET_SIMD_BACKEND_SSE41) ? &kSse41Kernels : NULL;
+        case RCNET_SIMD_BACKEND_AVX2:
+            return rcnet_simd_cpuSupports(RCNET_SIMD_BACKEND_AVX2) ? &kAvx2Kernels : NULL;
+#endif
+#if defined(RCNET_SIMD_NEON)
+        case RCNET_SIMD_BACKEND_NEON:
+            return &kNeonKernels;
+#endif
+        case RCNET_SIMD_BACKEND_AUTO:
+        {
+            static const RCNET_SimdBackend kPreferred[] = {
+                RCNET_SIMD_BACKEND_AVX2, RCNET_SIMD_BACKEND_NEON, RCNET_SIMD_BACKEND_SSE41
+            };
+            for (RCNET_SimdBackend preferred : kPreferred)
+            {
+                const RCNET_SimdKernels* kernels = rcnet_simd_kernelsFor(preferred);
+                if (kernels != NULL)
+                    return kernels;
+            }
+            return &kScalarKernels;
+        }
+        default:
+            return NULL;
+    }
+}
+
+static inline const RCNET_SimdKernels* rcnet_simd_kernels(void)
+{
+    const RCNET_SimdKernels* kernels = gSimdKernels.load(std::memory_order_acquire);
+    if (kernels == NULL)
+    {
+        kernels = rcnet_simd_kernelsFor(RCNET_SIMD_BACKEND_AUTO);
+        gSimdKernels.store(kernels, std::memory_order_release);
+    }
+    return kernels;
+}
+
+RCNET_SimdBackend rcnet_simd_get_backend(void)
+{
+    return rcnet_simd_kernels()->backend;
+}
+
+bool rcnet_simd_set_backend(RCNET_SimdBackend backend)
+{
+    const RCNET_SimdKernels* kernels = rcnet_simd_kernelsFor(backend);
+    if (kernels == NULL)
+        return false;
+
+    gSimdKernels.store(kernels, std::memory_order_release);
+    return true;
+}
+
+bool rcnet_simd_is_backend_supported(RCNET_SimdBackend backend)
+{
+    return rcnet_simd_kernelsFor(backend) != NULL;
+}
+
+const char* rcnet_simd_get_backend_name(RCNET_SimdBackend backend)
+{
+    switch (backend)
+    {
+        case RCNET_SIMD_BACKEND_AUTO:   return "auto";
+        case RCNET_SIMD_BACKEND_SCALAR: return "scalar";
+        case RCNET_SIMD_BACKEND_SSE41:  return "sse4.1";
+        case RCNET_SIMD_BACKEND_AVX2:   return "avx2";
+        case RCNET_SIMD_BACKEND_NEON:   return "neon";
+        default:                        return "unknown";
+    }
+}
+
+// ============================================================
+// API
+// ============================================================
+void rcnet_simd_quantize_floats(const float* values, uint32_t count, float minValue, float maxValue, uint32_t bitCount,
+                                uint32_t* outQuantized)
+{
+    rcnet_simd_kernels()->quantize(values, count, minValue, maxValue, bitCount, outQuantized);
+}
+
+uint32_t rcnet_simd_xor_diff(const uint32_t* current, const uint32_t* baseline, uint32_t count, uint64_t* outChangedMask,
+                             uint32_t* outPacked)
+{
+    return rcnet_simd_kernels()->xorDiff(current, baseline, count, outChangedMask, outPacked);
+}
+
+uint32_t rcnet_simd_xor_apply(const uint32_t* baseline, uint32_t count, const uint64_t* changedMask, const uint32_t* packed,
+                              uint32_t* outCurrent)
+{
+    uint32_t packedCount = 0;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t value = baseline[i];
+        if ((changedMask[i >> 6] >> (i & 63)) & 1u)
+            value ^= packed[packedCount++];
+        outCurrent[i] = value;
+    }
+    return packedCount;
+}
+
+size_t rcnet_simd_encode_delta_varint(const uint32_t* current, const uint32_t* baseline, uint32_t count, uint8_t* out,
+                                      size_t capacity)
+{
+    return rcnet_simd_kernels()->encodeDeltaVarint(current, baseline, count, out, capacity);
+}
+
+size_t rcnet_simd_decode_delta_varint(const uint8_t* data, size_t length, const uint32_t* baseline, uint32_t count,
+                                      uint32_t* outCurrent)
+{
+    size_t offset = 0;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t value = 0;
+        uint32_t shift = 0;
+        for (;;)
+        {
+            // 5 octets max pour 32 bits, le 5e ne porte que 4 bits
+            if (offset >= length || shift > 28)
+                return 0;
+
+            uint8_t byte = data[offset++];
+            if (shift == 28 && (byte & 0xF0u) != 0)
+                return 0;
+
+            value |= static_cast<uint32_t>(byte & 0x7Fu) << shift;
+            if ((byte & 0x80u) == 0)
+                break;
+            shift += 7;
+        }
+        outCurrent[i] = baseline[i] + rcnet_simd_unzigzag(value);
+    }
+    return offset;
+}
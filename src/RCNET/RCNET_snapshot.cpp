@@ -0,0 +1,686 @@
+#include "RCNET/RCNET_snapshot.h"
+#include "RCNET/RCNET_logger.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <cstring>
+#include <new>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+// Un état du monde conservé dans le ring
+struct RCNET_SnapshotFrame
+{
+    uint64_t tick;      // 0 = slot vide (ou en cours d'écriture)
+    uint64_t* presence; // bitset maxEntities (vue sur RCNET_SnapshotHistory::presenceStorage)
+    uint32_t* fields;   // maxEntities * fieldCount (vue sur RCNET_SnapshotHistory::fieldStorage)
+};
+
+struct RCNET_SnapshotHistory
+{
+    RCNET_SnapshotSchema schema;
+    uint32_t historySize = 0;
+    uint32_t maxClients = 0;
+    uint32_t presenceWords = 0;
+    uint32_t entityIdBits = 0;
+
+    RCNET_SnapshotFrame* frames = nullptr;
+    uint64_t* presenceStorage = nullptr;
+    uint32_t* fieldStorage = nullptr;
+
+    // Etat en cours d'écriture (begin_frame -> commit_frame)
+    RCNET_SnapshotFrame* writingFrame = nullptr;
+    uint64_t writingTick = 0;
+
+    // Dernier état terminé (lu par les threads réseau pour valider les acks)
+    std::atomic<uint64_t> latestTick{0};
+
+    // Dernier tick acké par client (écrit par les threads réseau)
+    std::atomic<uint64_t>* clientAckTicks = nullptr;
+
+    // Interest management (rcnet_snapshot_history_enable_interest) : vue de chaque client pour chaque
+    // état encodé, indexée par [clientId * historySize + tick % historySize].
+    // viewSources[e] = tick (32 bits bas) de l'état global dont le client a reçu la valeur de e.
+    uint64_t* viewTicks = nullptr;      // tick de la vue (0 = aucune)
+    uint64_t* viewPresence = nullptr;   // presenceWords par vue
+    uint32_t* viewSources = nullptr;    // maxEntities par vue
+
+    // Compteurs (encode peut tourner en parallèle sur plusieurs workers)
+    std::atomic<uint64_t> fullEncoded{0};
+    std::atomic<uint64_t> deltaEncoded{0};
+    std::atomic<uint64_t> encodedBytes{0};
+    uint64_t decoded = 0;
+    uint64_t decodeFailures = 0;
+};
+
+// Nombre de bits de l'offset baseline dans le payload (RCNET_SNAPSHOT_MAX_HISTORY < 2^16)
+static constexpr uint32_t kBaselineOffsetBits = 16;
+
+static inline uint32_t rcnet_snapshot_countTrailingZeros(uint64_t value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+}
+
+static inline bool rcnet_snapshot_isPresent(const RCNET_SnapshotFrame* frame, uint32_t entityId)
+{
+    return (frame->presence[entityId >> 6] >> (entityId & 63)) & 1u;
+}
+
+static inline RCNET_SnapshotFrame* rcnet_snapshot_frameForTick(const RCNET_SnapshotHistory* history, uint64_t tick)
+{
+    return &history->frames[tick % history->historySize];
+}
+
+RCNET_SnapshotHistory* rcnet_snapshot_history_create(const RCNET_SnapshotSchema* schema, uint32_t historySize, uint32_t maxClients)
+{
+    if (schema == NULL || schema->maxEntities == 0 || schema->fieldCount == 0 || schema->fieldCount > RCNET_SNAPSHOT_MAX_FIELDS
+        || historySize < 2 || historySize > RCNET_SNAPSHOT_MAX_HISTORY)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_snapshot_history_create: invalid schema or historySize=%u\n", historySize);
+        return NULL;
+    }
+    for (uint32_t f = 0; f < schema->fieldCount; ++f)
+    {
+        if (schema->fieldBits[f] == 0 || schema->fieldBits[f] > 32)
+        {
+            RCNET_log(RCNET_LOG_ERROR, "rcnet_snapshot_history_create: invalid fieldBits[%u]=%u\n", f, schema->fieldBits[f]);
+            return NULL;
+        }
+    }
+
+    RCNET_SnapshotHistory* history = new (std::nothrow) RCNET_SnapshotHistory();
+    if (history == NULL)
+        return NULL;
+
+    history->schema = *schema;
+    history->historySize = historySize;
+    history->maxClients = maxClients;
+    history->presenceWords = (schema->maxEntities + 63) / 64;
+
+    history->entityIdBits = 1;
+    while (history->entityIdBits < 32 && (1ull << history->entityIdBits) < schema->maxEntities)
+        history->entityIdBits++;
+
+    size_t presenceCount = static_cast<size_t>(historySize) * history->presenceWords;
+    size_t fieldCount = static_cast<size_t>(historySize) * schema->maxEntities * schema->fieldCount;
+
+    history->frames = new (std::nothrow) RCNET_SnapshotFrame[historySize];
+    history->presenceStorage = new (std::nothrow) uint64_t[presenceCount]();
+    history->fieldStorage = new (std::nothrow) uint32_t[fieldCount]();
+    if (maxClients > 0)
+        history->clientAckTicks = new (std::nothrow) std::atomic<uint64_t>[maxClients];
+
+    if (history->frames == NULL || history->presenceStorage == NULL || history->fieldStorage == NULL
+        || (maxClients > 0 && history->clientAckTicks == NULL))
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_snapshot_history_create: out of memory\n");
+        rcnet_snapshot_history_destroy(history);
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < historySize; ++i)
+    {
+        history->frames[i].tick = 0;
+        history->frames[i].presence = history->presenceStorage + static_cast<size_t>(i) * history->presenceWords;
+        history->frames[i].fields = history->fieldStorage + static_cast<size_t>(i) * schema->maxEntities * schema->fieldCount;
+    }
+    for (uint32_t c = 0; c < maxClients; ++c)
+        history->clientAckTicks[c].store(0, std::memory_order_relaxed);
+
+    return history;
+}
+
+void rcnet_snapshot_history_destroy(RCNET_SnapshotHistory* history)
+{
+    if (history == NULL)
+        return;
+
+    delete[] history->frames;
+    delete[] history->presenceStorage;
+    delete[] history->fieldStorage;
+    delete[] history->clientAckTicks;
+    delete[] history->viewTicks;
+    delete[] history->viewPresence;
+    delete[] history->viewSources;
+    delete history;
+}
+
+void rcnet_snapshot_history_begin_frame(RCNET_SnapshotHistory* history, uint64_t tick)
+{
+    RCNET_SnapshotFrame* frame = rcnet_snapshot_frameForTick(history, tick);
+
+    // Le slot recyclé n'est plus une baseline valide pendant l'écriture
+    frame->tick = 0;
+    std::memset(frame->presence, 0, history->presenceWords * sizeof(uint64_t));
+
+    history->writingFrame = frame;
+    history->writingTick = tick;
+}
+
+void rcnet_snapshot_history_write_entity(RCNET_SnapshotHistory* history, uint32_t entityId, const uint32_t* fields)
+{
+    if (history->writingFrame == NULL || entityId >= history->schema.maxEntities)
+        return;
+
+    RCNET_SnapshotFrame* frame = history->writingFrame;
+    frame->presence[entityId >> 6] |= 1ull << (entityId & 63);
+    std::memcpy(frame->fields + static_cast<size_t>(entityId) * history->schema.fieldCount, fields,
+                history->schema.fieldCount * sizeof(uint32_t));
+}
+
+void rcnet_snapshot_history_commit_frame(RCNET_SnapshotHistory* history)
+{
+    if (history->writingFrame == NULL)
+        return;
+
+    history->writingFrame->tick = history->writingTick;
+    history->writingFrame = NULL;
+    history->latestTick.store(history->writingTick, std::memory_order_release);
+}
+
+uint64_t rcnet_snapshot_history_get_latest_tick(const RCNET_SnapshotHistory* history)
+{
+    return history->latestTick.load(std::memory_order_acquire);
+}
+
+void rcnet_snapshot_history_ack(RCNET_SnapshotHistory* history, uint32_t clientId, uint64_t tick)
+{
+    if (clientId >= history->maxClients)
+        return;
+
+    // Un ack pour un état qui n'existe pas encore est forcément invalide
+    if (tick > history->latestTick.load(std::memory_order_acquire))
+        return;
+
+    std::atomic<uint64_t>& ack = history->clientAckTicks[clientId];
+    uint64_t current = ack.load(std::memory_order_relaxed);
+    while (tick > current && !ack.compare_exchange_weak(current, tick, std::memory_order_release, std::memory_order_relaxed))
+    {
+        // current rechargé par compare_exchange_weak
+    }
+}
+
+void rcnet_snapshot_history_reset_client(RCNET_SnapshotHistory* history, uint32_t clientId)
+{
+    if (clientId < history->maxClients)
+        history->clientAckTicks[clientId].store(0, std::memory_order_release);
+}
+
+uint64_t rcnet_snapshot_history_get_client_ack(const RCNET_SnapshotHistory* history, uint32_t clientId)
+{
+    if (clientId >= history->maxClients)
+        return 0;
+    return history->clientAckTicks[clientId].load(std::memory_order_acquire);
+}
+
+size_t rcnet_snapshot_history_get_max_encoded_size(const RCNET_SnapshotHistory* history)
+{
+    uint64_t bitsPerEntity = 1 + history->entityIdBits + 1;
+    for (uint32_t f = 0; f < history->schema.fieldCount; ++f)
+        bitsPerEntity += 1 + history->schema.fieldBits[f];
+
+    uint64_t totalBits = 1 + kBaselineOffsetBits + bitsPerEntity * history->schema.maxEntities + 1;
+    return static_cast<size_t>((totalBits + 7) / 8);
+}
+
+bool rcnet_snapshot_history_encode(RCNET_SnapshotHistory* history, uint32_t clientId, RCNET_PacketWriter* writer, uint64_t* outBaselineTick)
+{
+    if (outBaselineTick != NULL)
+        *outBaselineTick = 0;
+
+    uint64_t latestTick = history->latestTick.load(std::memory_order_acquire);
+    if (latestTick == 0 || writer->overflow)
+        return false;
+
+    const RCNET_SnapshotFrame* current = rcnet_snapshot_frameForTick(history, latestTick);
+
+    // Baseline = dernier état acké par ce client, s'il est encore dans le ring
+    const RCNET_SnapshotFrame* baseline = NULL;
+    uint64_t baselineTick = 0;
+    if (clientId < history->maxClients)
+    {
+        uint64_t ackTick = history->clientAckTicks[clientId].load(std::memory_order_acquire);
+        if (ackTick != 0 && ackTick < latestTick && latestTick - ackTick < history->historySize)
+        {
+            const RCNET_SnapshotFrame* candidate = rcnet_snapshot_frameForTick(history, ackTick);
+            if (candidate->tick == ackTick)
+            {
+                baseline = candidate;
+                baselineTick = ackTick;
+            }
+        }
+    }
+
+    const uint32_t fieldCount = history->schema.fieldCount;
+    const uint8_t* fieldBits = history->schema.fieldBits;
+    static const uint32_t kZeroFields[RCNET_SNAPSHOT_MAX_FIELDS] = {0};
+
+    RCNET_BitWriter bits;
+    rcnet_bit_writer_init(&bits, writer->data + writer->size, writer->capacity - writer->size);
+
+    rcnet_bit_write(&bits, baseline != NULL ? 1u : 0u, 1);
+    if (baseline != NULL)
+        rcnet_bit_write(&bits, static_cast<uint32_t>(latestTick - baselineTick), kBaselineOffsetBits);
+
+    for (uint32_t word = 0; word < history->presenceWords; ++word)
+    {
+        uint64_t candidates = current->presence[word] | (baseline != NULL ? baseline->presence[word] : 0);
+
+        while (candidates != 0)
+        {
+            uint32_t entityId = word * 64 + rcnet_snapshot_countTrailingZeros(candidates);
+            candidates &= candidates - 1;
+
+            bool inBaseline = baseline != NULL && rcnet_snapshot_isPresent(baseline, entityId);
+
+            if (!rcnet_snapshot_isPresent(current, entityId))
+            {
+                // Présente dans la baseline, plus maintenant => supprimée
+                rcnet_bit_write(&bits, 1, 1);
+                rcnet_bit_write(&bits, entityId, history->entityIdBits);
+                rcnet_bit_write(&bits, 1, 1);
+                continue;
+            }
+
+            const uint32_t* currentFields = current->fields + static_cast<size_t>(entityId) * fieldCount;
+            const uint32_t* baselineFields = inBaseline ? baseline->fields + static_cast<size_t>(entityId) * fieldCount : kZeroFields;
+
+            if (inBaseline && std::memcmp(currentFields, baselineFields, fieldCount * sizeof(uint32_t)) == 0)
+                continue; // inchangée
+
+            rcnet_bit_write(&bits, 1, 1);
+            rcnet_bit_write(&bits, entityId, history->entityIdBits);
+            rcnet_bit_write(&bits, 0, 1);
+            for (uint32_t f = 0; f < fieldCount; ++f)
+            {
+                if (currentFields[f] != baselineFields[f])
+                {
+                    rcnet_bit_write(&bits, 1, 1);
+                    rcnet_bit_write(&bits, currentFields[f], fieldBits[f]);
+                }
+                else
+                {
+                    rcnet_bit_write(&bits, 0, 1);
+                }
+            }
+        }
+    }
+
+    rcnet_bit_write(&bits, 0, 1); // fin des entités
+    size_t payloadSize = rcnet_bit_writer_flush(&bits);
+
+    if (bits.overflow)
+    {
+        writer->overflow = true;
+        return false;
+    }
+
+    writer->size += payloadSize;
+
+    if (baseline != NULL)
+        history->deltaEncoded.fetch_add(1, std::memory_order_relaxed);
+    else
+        history->fullEncoded.fetch_add(1, std::memory_order_relaxed);
+    history->encodedBytes.fetch_add(payloadSize, std::memory_order_relaxed);
+
+    if (outBaselineTick != NULL)
+        *outBaselineTick = baselineTick;
+    return true;
+}
+
+bool rcnet_snapshot_history_enable_interest(RCNET_SnapshotHistory* history)
+{
+    if (history->viewTicks != NULL)
+        return true;
+
+    if (history->maxClients == 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_snapshot_history_enable_interest: history has no client (maxClients=0)\n");
+        return false;
+    }
+
+    size_t viewCount = static_cast<size_t>(history->maxClients) * history->historySize;
+    history->viewTicks = new (std::nothrow) uint64_t[viewCount]();
+    history->viewPresence = new (std::nothrow) uint64_t[viewCount * history->presenceWords]();
+    history->viewSources = new (std::nothrow) uint32_t[viewCount * history->schema.maxEntities]();
+    if (history->viewTicks == NULL || history->viewPresence == NULL || history->viewSources == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_snapshot_history_enable_interest: out of memory (%zu views)\n", viewCount);
+        delete[] history->viewTicks;
+        delete[] history->viewPresence;
+        delete[] history->viewSources;
+        history->viewTicks = NULL;
+        history->viewPresence = NULL;
+        history->viewSources = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+// Ecrit une entité présente (delta champ par champ contre baselineFields, tous les champs si NULL)
+static inline void rcnet_snapshot_writeEntity(const RCNET_SnapshotHistory* history, RCNET_BitWriter* bits, uint32_t entityId,
+                                              const uint32_t* currentFields, const uint32_t* baselineFields)
+{
+    rcnet_bit_write(bits, 1, 1);
+    rcnet_bit_write(bits, entityId, history->entityIdBits);
+    rcnet_bit_write(bits, 0, 1);
+    for (uint32_t f = 0; f < history->schema.fieldCount; ++f)
+    {
+        if (baselineFields == NULL || currentFields[f] != baselineFields[f])
+        {
+            rcnet_bit_write(bits, 1, 1);
+            rcnet_bit_write(bits, currentFields[f], history->schema.fieldBits[f]);
+        }
+        else
+        {
+            rcnet_bit_write(bits, 0, 1);
+        }
+    }
+}
+
+bool rcnet_snapshot_history_encode_interest(RCNET_SnapshotHistory* history, uint32_t clientId, RCNET_PacketWriter* writer,
+                                            const RCNET_SnapshotInterest* interest, uint32_t* outWrittenCount, uint64_t* outBaselineTick)
+{
+    if (outWrittenCount != NULL)
+        *outWrittenCount = 0;
+    if (outBaselineTick != NULL)
+        *outBaselineTick = 0;
+
+    if (history->viewTicks == NULL || clientId >= history->maxClients || interest == NULL || interest->visibleMask == NULL)
+        return false;
+
+    uint64_t latestTick = history->latestTick.load(std::memory_order_acquire);
+    if (latestTick == 0 || writer->overflow)
+        return false;
+
+    const uint32_t historySize = history->historySize;
+    const uint32_t words = history->presenceWords;
+    const uint32_t maxEntities = history->schema.maxEntities;
+    const uint32_t fieldCount = history->schema.fieldCount;
+    const size_t clientViews = static_cast<size_t>(clientId) * historySize;
+
+    // Une seule vue par état : un client ne reçoit jamais deux contenus différents pour le même tick
+    const size_t outIndex = clientViews + latestTick % historySize;
+    if (history->viewTicks[outIndex] == latestTick)
+        return false;
+
+    const RCNET_SnapshotFrame* current = rcnet_snapshot_frameForTick(history, latestTick);
+
+    // Baseline = vue du client pour son dernier état acké, si elle est encore dans le ring
+    const uint64_t* basePresence = NULL;
+    const uint32_t* baseSources = NULL;
+    uint64_t baselineTick = 0;
+    uint64_t ackTick = history->clientAckTicks[clientId].load(std::memory_order_acquire);
+    if (ackTick != 0 && ackTick < latestTick && latestTick - ackTick < historySize)
+    {
+        const size_t baseIndex = clientViews + ackTick % historySize;
+        if (history->viewTicks[baseIndex] == ackTick && rcnet_snapshot_frameForTick(history, ackTick)->tick == ackTick)
+        {
+            basePresence = history->viewPresence + baseIndex * words;
+            baseSources = history->viewSources + baseIndex * maxEntities;
+            baselineTick = ackTick;
+        }
+    }
+
+    uint64_t* outPresence = history->viewPresence + outIndex * words;
+    uint32_t* outSources = history->viewSources + outIndex * maxEntities;
+    history->viewTicks[outIndex] = 0;
+    std::memset(outPresence, 0, words * sizeof(uint64_t));
+
+    const uint64_t* visible = interest->visibleMask;
+    const uint32_t latestTick32 = static_cast<uint32_t>(latestTick);
+
+    RCNET_BitWriter bits;
+    rcnet_bit_writer_init(&bits, writer->data + writer->size, writer->capacity - writer->size);
+
+    rcnet_bit_write(&bits, basePresence != NULL ? 1u : 0u, 1);
+    if (basePresence != NULL)
+        rcnet_bit_write(&bits, static_cast<uint32_t>(latestTick - baselineTick), kBaselineOffsetBits);
+
+    // 1) Obligatoire (hors budget) : entités reçues par le client mais détruites ou plus visibles
+    if (basePresence != NULL)
+    {
+        for (uint32_t word = 0; word < words; ++word)
+        {
+            uint64_t removed = basePresence[word] & ~(current->presence[word] & visible[word]);
+            while (removed != 0)
+            {
+                uint32_t entityId = word * 64 + rcnet_snapshot_countTrailingZeros(removed);
+                removed &= removed - 1;
+
+                rcnet_bit_write(&bits, 1, 1);
+                rcnet_bit_write(&bits, entityId, history->entityIdBits);
+                rcnet_bit_write(&bits, 1, 1);
+            }
+        }
+    }
+
+    // 2) Par priorité, tant que le budget le permet
+    uint64_t bitsPerEntity = 1 + history->entityIdBits + 1;
+    for (uint32_t f = 0; f < fieldCount; ++f)
+        bitsPerEntity += 1 + history->schema.fieldBits[f];
+
+    const uint64_t budgetBits = (interest->maxPayloadBytes > 0) ? static_cast<uint64_t>(interest->maxPayloadBytes) * 8 : UINT64_MAX;
+
+    uint32_t consumed = 0;
+    for (; consumed < interest->priorityCount; ++consumed)
+    {
+        uint32_t entityId = interest->priorityList[consumed];
+        if (entityId >= maxEntities || !rcnet_snapshot_isPresent(current, entityId)
+            || ((visible[entityId >> 6] >> (entityId & 63)) & 1u) == 0)
+            continue;
+
+        const uint32_t* currentFields = current->fields + static_cast<size_t>(entityId) * fieldCount;
+        bool inBaseline = basePresence != NULL && ((basePresence[entityId >> 6] >> (entityId & 63)) & 1u);
+
+        // Valeur connue du client = état global de sa source, s'il est encore dans le ring
+        // (nouvelle pour ce client : delta contre des champs à 0)
+        static const uint32_t kZeroFields[RCNET_SNAPSHOT_MAX_FIELDS] = {0};
+        const uint32_t* knownFields = inBaseline ? NULL : kZeroFields;
+        if (inBaseline)
+        {
+            uint32_t sourceAge = latestTick32 - baseSources[entityId];
+            if (sourceAge < historySize)
+            {
+                const RCNET_SnapshotFrame* source = rcnet_snapshot_frameForTick(history, latestTick - sourceAge);
+                if (source->tick == latestTick - sourceAge)
+                    knownFields = source->fields + static_cast<size_t>(entityId) * fieldCount;
+            }
+
+            if (knownFields != NULL && std::memcmp(currentFields, knownFields, fieldCount * sizeof(uint32_t)) == 0)
+            {
+                // Inchangée : rien à écrire, la valeur du client est celle de cet état
+                outPresence[entityId >> 6] |= 1ull << (entityId & 63);
+                outSources[entityId] = latestTick32;
+                continue;
+            }
+        }
+
+        // Pire cas de cette entité + bit de fin : au-delà, elle et les suivantes attendent le prochain tick
+        uint64_t usedBits = static_cast<uint64_t>(bits.size) * 8 + bits.scratchBits;
+        if (usedBits + bitsPerEntity + 1 > budgetBits)
+            break;
+
+        // knownFields NULL (source évincée) : tous les champs, le décodeur les écrase quelle que soit sa baseline
+        rcnet_snapshot_writeEntity(history, &bits, entityId, currentFields, knownFields);
+        outPresence[entityId >> 6] |= 1ull << (entityId & 63);
+        outSources[entityId] = latestTick32;
+    }
+
+    // 3) Entités visibles déjà reçues mais pas envoyées ce tick : le client garde sa valeur
+    if (basePresence != NULL)
+    {
+        for (uint32_t word = 0; word < words; ++word)
+        {
+            uint64_t kept = basePresence[word] & current->presence[word] & visible[word] & ~outPresence[word];
+            outPresence[word] |= kept;
+            while (kept != 0)
+            {
+                uint32_t entityId = word * 64 + rcnet_snapshot_countTrailingZeros(kept);
+                kept &= kept - 1;
+                outSources[entityId] = baseSources[entityId];
+            }
+        }
+    }
+
+    rcnet_bit_write(&bits, 0, 1); // fin des entités
+    size_t payloadSize = rcnet_bit_writer_flush(&bits);
+
+    if (bits.overflow)
+    {
+        writer->overflow = true;
+        return false;
+    }
+
+    writer->size += payloadSize;
+    history->viewTicks[outIndex] = latestTick;
+
+    if (basePresence != NULL)
+        history->deltaEncoded.fetch_add(1, std::memory_order_relaxed);
+    else
+        history->fullEncoded.fetch_add(1, std::memory_order_relaxed);
+    history->encodedBytes.fetch_add(payloadSize, std::memory_order_relaxed);
+
+    if (outWrittenCount != NULL)
+        *outWrittenCount = consumed;
+    if (outBaselineTick != NULL)
+        *outBaselineTick = baselineTick;
+    return true;
+}
+
+bool rcnet_snapshot_history_decode(RCNET_SnapshotHistory* history, uint64_t tick, RCNET_PacketReader* reader)
+{
+    uint64_t latestTick = history->latestTick.load(std::memory_order_relaxed);
+    if (tick == 0 || tick <= latestTick || reader->overflow)
+    {
+        history->decodeFailures++;
+        return false;
+    }
+
+    RCNET_BitReader bits;
+    rcnet_bit_reader_init(&bits, reader->data + reader->offset, reader->size - reader->offset);
+
+    RCNET_SnapshotFrame* target = rcnet_snapshot_frameForTick(history, tick);
+    const size_t frameFieldCount = static_cast<size_t>(history->schema.maxEntities) * history->schema.fieldCount;
+
+    // 1) Point de départ : baseline locale (delta) ou état vide (complet)
+    bool isDelta = rcnet_bit_read(&bits, 1) != 0;
+    if (isDelta)
+    {
+        uint32_t baselineOffset = rcnet_bit_read(&bits, kBaselineOffsetBits);
+        if (bits.overflow || baselineOffset == 0 || baselineOffset >= history->historySize || baselineOffset > tick)
+        {
+            history->decodeFailures++;
+            return false;
+        }
+
+        uint64_t baselineTick = tick - baselineOffset;
+        const RCNET_SnapshotFrame* baseline = rcnet_snapshot_frameForTick(history, baselineTick);
+        if (baseline->tick != baselineTick)
+        {
+            // Baseline évincée localement : on attendra un snapshot complet
+            history->decodeFailures++;
+            return false;
+        }
+
+        target->tick = 0;
+        std::memcpy(target->presence, baseline->presence, history->presenceWords * sizeof(uint64_t));
+        std::memcpy(target->fields, baseline->fields, frameFieldCount * sizeof(uint32_t));
+    }
+    else
+    {
+        target->tick = 0;
+        std::memset(target->presence, 0, history->presenceWords * sizeof(uint64_t));
+    }
+
+    // 2) Application des entités modifiées
+    const uint32_t fieldCount = history->schema.fieldCount;
+    while (true)
+    {
+        uint32_t more = rcnet_bit_read(&bits, 1);
+        if (bits.overflow)
+        {
+            history->decodeFailures++;
+            return false;
+        }
+        if (!more)
+            break;
+
+        uint32_t entityId = rcnet_bit_read(&bits, history->entityIdBits);
+        bool removed = rcnet_bit_read(&bits, 1) != 0;
+        if (bits.overflow || entityId >= history->schema.maxEntities)
+        {
+            history->decodeFailures++;
+            return false;
+        }
+
+        uint64_t& presenceWord = target->presence[entityId >> 6];
+        uint64_t presenceBit = 1ull << (entityId & 63);
+        uint32_t* fields = target->fields + static_cast<size_t>(entityId) * fieldCount;
+
+        if (removed)
+        {
+            presenceWord &= ~presenceBit;
+            continue;
+        }
+
+        if ((presenceWord & presenceBit) == 0)
+        {
+            // Nouvelle entité : delta contre des champs à 0
+            std::memset(fields, 0, fieldCount * sizeof(uint32_t));
+            presenceWord |= presenceBit;
+        }
+
+        for (uint32_t f = 0; f < fieldCount; ++f)
+        {
+            if (rcnet_bit_read(&bits, 1))
+                fields[f] = rcnet_bit_read(&bits, history->schema.fieldBits[f]);
+        }
+    }
+
+    if (bits.overflow)
+    {
+        history->decodeFailures++;
+        return false;
+    }
+
+    reader->offset = reader->size;
+    target->tick = tick;
+    history->latestTick.store(tick, std::memory_order_release);
+    history->decoded++;
+    return true;
+}
+
+bool rcnet_snapshot_history_read_entity(const RCNET_SnapshotHistory* history, uint64_t tick, uint32_t entityId, uint32_t* outFields)
+{
+    if (tick == 0 || entityId >= history->schema.maxEntities)
+        return false;
+
+    const RCNET_SnapshotFrame* frame = rcnet_snapshot_frameForTick(history, tick);
+    if (frame->tick != tick || !rcnet_snapshot_isPresent(frame, entityId))
+        return false;
+
+    std::memcpy(outFields, frame->fields + static_cast<size_t>(entityId) * history->schema.fieldCount,
+                history->schema.fieldCount * sizeof(uint32_t));
+    return true;
+}
+
+void rcnet_snapshot_history_get_stats(const RCNET_SnapshotHistory* history, RCNET_SnapshotHistoryStats* outStats)
+{
+    outStats->fullEncoded    = history->fullEncoded.load(std::memory_order_relaxed);
+    outStats->deltaEncoded   = history->deltaEncoded.load(std::memory_order_relaxed);
+    outStats->encodedBytes   = history->encodedBytes.load(std::memory_order_relaxed);
+    outStats->decoded        = history->decoded;
+    outStats->decodeFailures = history->decodeFailures;
+}
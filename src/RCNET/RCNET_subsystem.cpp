@@ -0,0 +1,184 @@
+#include "RCNET/RCNET_subsystem.h"
+#include "RCNET/RCNET_logger.h"
+#include "RCNET/RCNET_timer.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <mutex>
+
+// ================================
+// Dependencies Libraries OpenSSL / libsodium / RCENet
+// ================================
+#include <openssl/ssl.h>
+#include <openssl/err.h>
+#include <sodium.h>
+#include <rcenet/RCENET_enet.h>
+
+struct RCNET_SubsystemState
+{
+    uint32_t refCount = 0;
+    bool initialized = false;
+    uint32_t initCount = 0;
+    uint64_t initNs = 0;
+};
+
+// Un seul mutex : les acquisitions sont rares (création de modules), jamais sur un chemin chaud
+static std::mutex subsystemMutex;
+static RCNET_SubsystemState subsystemStates[RCNET_SUBSYSTEM_COUNT];
+
+static const char* const kSubsystemNames[RCNET_SUBSYSTEM_COUNT] = { "openssl", "libsodium", "rcenet" };
+
+// ======================================================
+// Init / cleanup de chaque dépendance
+// ======================================================
+static bool rcnet_subsystem_initOpenssl(void)
+{
+    // Sans chargement des chaînes d'erreur (le plus gros de l'init) : chargées seulement pour logger un échec
+    if (OPENSSL_init_ssl(0, NULL) == 0)
+    {
+        OPENSSL_init_ssl(OPENSSL_INIT_LOAD_SSL_STRINGS | OPENSSL_INIT_LOAD_CRYPTO_STRINGS, NULL);
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_subsystem_acquire: OpenSSL init failed: %s\n", ERR_error_string(ERR_get_error(), NULL));
+        return false;
+    }
+    return true;
+}
+
+static bool rcnet_subsystem_initLibSodium(void)
+{
+    // 1 = déjà initialisé (idempotent), -1 = échec
+    if (sodium_init() < 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_subsystem_acquire: libsodium init failed\n");
+        return false;
+    }
+    return true;
+}
+
+static bool rcnet_subsystem_initRCENet(void)
+{
+    if (enet_initialize() < 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_subsystem_acquire: RCENet init failed\n");
+        return false;
+    }
+    return true;
+}
+
+static bool rcnet_subsystem_init(RCNET_Subsystem subsystem)
+{
+    switch (subsystem)
+    {
+    case RCNET_SUBSYSTEM_OPENSSL:   return rcnet_subsystem_initOpenssl();
+    case RCNET_SUBSYSTEM_LIBSODIUM: return rcnet_subsystem_initLibSodium();
+    case RCNET_SUBSYSTEM_RCENET:    return rcnet_subsystem_initRCENet();
+    default:                        return false;
+    }
+}
+
+// true si le sous-système reste initialisé après sa dernière libération (init process-wide)
+static bool rcnet_subsystem_isProcessWide(RCNET_Subsystem subsystem)
+{
+    return subsystem == RCNET_SUBSYSTEM_OPENSSL || subsystem == RCNET_SUBSYSTEM_LIBSODIUM;
+}
+
+static bool rcnet_subsystem_isValid(RCNET_Subsystem subsystem)
+{
+    return static_cast<uint32_t>(subsystem) < RCNET_SUBSYSTEM_COUNT;
+}
+
+// ======================================================
+// API
+// ======================================================
+bool rcnet_subsystem_acquire(RCNET_Subsystem subsystem)
+{
+    if (!rcnet_subsystem_isValid(subsystem))
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_subsystem_acquire: invalid subsystem %d\n", static_cast<int>(subsystem));
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(subsystemMutex);
+    RCNET_SubsystemState& state = subsystemStates[subsystem];
+
+    if (!state.initialized)
+    {
+        uint64_t startNs = rcnet_timer_get_time_ns();
+        if (!rcnet_subsystem_init(subsystem))
+            return false;
+
+        uint64_t elapsedNs = rcnet_timer_get_time_ns() - startNs;
+        state.initialized = true;
+        state.initCount++;
+        state.initNs += elapsedNs;
+        RCNET_log(RCNET_LOG_INFO, "%s initialise en %.3f ms.", kSubsystemNames[subsystem], static_cast<double>(elapsedNs) / 1e6);
+    }
+
+    state.refCount++;
+    return true;
+}
+
+void rcnet_subsystem_release(RCNET_Subsystem subsystem)
+{
+    if (!rcnet_subsystem_isValid(subsystem))
+        return;
+
+    std::lock_guard<std::mutex> lock(subsystemMutex);
+    RCNET_SubsystemState& state = subsystemStates[subsystem];
+    if (state.refCount == 0)
+        return;
+
+    if (--state.refCount > 0 || rcnet_subsystem_isProcessWide(subsystem))
+        return;
+
+    if (subsystem == RCNET_SUBSYSTEM_RCENET)
+        enet_deinitialize();
+    state.initialized = false;
+}
+
+bool rcnet_subsystem_acquire_flags(uint32_t flags)
+{
+    uint32_t acquired = 0;
+    for (uint32_t i = 0; i < RCNET_SUBSYSTEM_COUNT; ++i)
+    {
+        if ((flags & (1u << i)) == 0)
+            continue;
+
+        if (!rcnet_subsystem_acquire(static_cast<RCNET_Subsystem>(i)))
+        {
+            rcnet_subsystem_release_flags(acquired);
+            return false;
+        }
+        acquired |= 1u << i;
+    }
+    return true;
+}
+
+void rcnet_subsystem_release_flags(uint32_t flags)
+{
+    // Ordre inverse de l'acquisition
+    for (uint32_t i = RCNET_SUBSYSTEM_COUNT; i > 0; --i)
+    {
+        if ((flags & (1u << (i - 1))) != 0)
+            rcnet_subsystem_release(static_cast<RCNET_Subsystem>(i - 1));
+    }
+}
+
+bool rcnet_subsystem_get_stats(RCNET_Subsystem subsystem, RCNET_SubsystemStats* outStats)
+{
+    if (!rcnet_subsystem_isValid(subsystem) || outStats == NULL)
+        return false;
+
+    std::lock_guard<std::mutex> lock(subsystemMutex);
+    const RCNET_SubsystemState& state = subsystemStates[subsystem];
+    outStats->initialized = state.initialized;
+    outStats->refCount = state.refCount;
+    outStats->initCount = state.initCount;
+    outStats->initNs = state.initNs;
+    return true;
+}
+
+const char* rcnet_subsystem_get_name(RCNET_Subsystem subsystem)
+{
+    return rcnet_subsystem_isValid(subsystem) ? kSubsystemNames[subsystem] : "unknown";
+}
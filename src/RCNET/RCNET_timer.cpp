@@ -0,0 +1,349 @@
+#include "RCNET/RCNET_timer.h"
+#include "RCNET/RCNET_logger.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+
+// ================================
+// Plateforme : timers haute résolution
+// ================================
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+        #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+    #endif
+    #define RCNET_TIMER_HAS_PLATFORM_BACKEND 1
+#elif defined(__linux__)
+    #include <errno.h>
+    #include <poll.h>
+    #include <sys/eventfd.h>
+    #include <sys/timerfd.h>
+    #include <time.h>
+    #include <unistd.h>
+    #define RCNET_TIMER_HAS_PLATFORM_BACKEND 1
+#endif
+
+// Bornes de la marge de spin adaptative
+static constexpr uint64_t kMinSpinMarginNs = 20'000;     // 20 µs
+static constexpr uint64_t kMaxSpinMarginNs = 4'000'000;  // 4 ms (sleep Windows sans timer haute résolution)
+
+// Marge initiale (avant la première mesure) selon le backend
+static constexpr uint64_t kInitialPlatformSpinMarginNs = 100'000; // 100 µs
+static constexpr uint64_t kInitialPortableSpinMarginNs = 200'000; // 200 µs (valeur historique du moteur)
+
+// Décroissance de la marge quand l'OS se réveille à l'heure : 1/64 de l'écart par attente
+static constexpr uint32_t kSpinMarginDecayShift = 6;
+
+struct RCNET_Timer
+{
+    RCNET_TimerBackend backend = RCNET_TIMER_BACKEND_PORTABLE;
+
+    // Marge apprise (écrite par le thread qui attend, lisible partout pour les stats)
+    std::atomic<uint64_t> spinMarginNs{kInitialPortableSpinMarginNs};
+
+    // Réveil anticipé demandé (consommé par l'attente)
+    std::atomic<bool> wakePending{false};
+
+    // Backend portable
+    std::mutex mutex;
+    std::condition_variable condition;
+
+#if defined(_WIN32)
+    HANDLE waitableTimer = NULL;
+    HANDLE wakeEvent = NULL;
+#elif defined(__linux__)
+    int timerFd = -1;
+    int wakeFd = -1;
+#endif
+};
+
+uint64_t rcnet_timer_get_time_ns(void)
+{
+#if defined(__linux__)
+    // Même horloge que timerfd (CLOCK_MONOTONIC) : les échéances absolues restent cohérentes
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint64_t>(now.tv_sec) * 1'000'000'000ull + static_cast<uint64_t>(now.tv_nsec);
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+#if defined(RCNET_TIMER_HAS_PLATFORM_BACKEND)
+static bool rcnet_timer_createPlatform(RCNET_Timer* timer)
+{
+#if defined(_WIN32)
+    timer->waitableTimer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    if (timer->waitableTimer == NULL)
+    {
+        // Windows < 10 1803 : timer classique (marge adaptative plus grande)
+        timer->waitableTimer = CreateWaitableTimerExW(NULL, NULL, 0, TIMER_ALL_ACCESS);
+    }
+    timer->wakeEvent = CreateEventW(NULL, FALSE, FALSE, NULL);
+
+    return timer->waitableTimer != NULL && timer->wakeEvent != NULL;
+#else
+    timer->timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    timer->wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+    return timer->timerFd >= 0 && timer->wakeFd >= 0;
+#endif
+}
+
+static void rcnet_timer_destroyPlatform(RCNET_Timer* timer)
+{
+#if defined(_WIN32)
+    if (timer->waitableTimer != NULL)
+        CloseHandle(timer->waitableTimer);
+    if (timer->wakeEvent != NULL)
+        CloseHandle(timer->wakeEvent);
+    timer->waitableTimer = NULL;
+    timer->wakeEvent = NULL;
+#else
+    if (timer->timerFd >= 0)
+        close(timer->timerFd);
+    if (timer->wakeFd >= 0)
+        close(timer->wakeFd);
+    timer->timerFd = -1;
+    timer->wakeFd = -1;
+#endif
+}
+
+// Sommeil OS jusqu'à wakeAtNs, interrompu par rcnet_timer_wake()
+static void rcnet_timer_waitPlatform(RCNET_Timer* timer, uint64_t wakeAtNs)
+{
+#if defined(_WIN32)
+    uint64_t nowNs = rcnet_timer_get_time_ns();
+    if (wakeAtNs <= nowNs)
+        return;
+
+    // Echéance relative en unités de 100 ns (valeur négative = relative)
+    LARGE_INTEGER dueTime;
+    dueTime.QuadPart = -static_cast<LONGLONG>((wakeAtNs - nowNs) / 100);
+    if (dueTime.QuadPart == 0)
+        return;
+
+    if (!SetWaitableTimer(timer->waitableTimer, &dueTime, 0, NULL, NULL, FALSE))
+        return;
+
+    HANDLE handles[2] = { timer->waitableTimer, timer->wakeEvent };
+    WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+#else
+    struct itimerspec spec = {};
+    spec.it_value.tv_sec  = static_cast<time_t>(wakeAtNs / 1'000'000'000ull);
+    spec.it_value.tv_nsec = static_cast<long>(wakeAtNs % 1'000'000'000ull);
+    if (timerfd_settime(timer->timerFd, TFD_TIMER_ABSTIME, &spec, NULL) != 0)
+        return;
+
+    struct pollfd fds[2];
+    fds[0].fd = timer->timerFd;
+    fds[0].events = POLLIN;
+    fds[1].fd = timer->wakeFd;
+    fds[1].events = POLLIN;
+
+    while (poll(fds, 2, -1) < 0 && errno == EINTR)
+    {
+    }
+
+    // Vider les compteurs (les fds sont non bloquants)
+    uint64_t drained = 0;
+    if (fds[0].revents & POLLIN)
+        (void)read(timer->timerFd, &drained, sizeof(drained));
+    if (fds[1].revents & POLLIN)
+        (void)read(timer->wakeFd, &drained, sizeof(drained));
+#endif
+}
+
+static void rcnet_timer_signalPlatform(RCNET_Timer* timer)
+{
+#if defined(_WIN32)
+    SetEvent(timer->wakeEvent);
+#else
+    uint64_t one = 1;
+    (void)write(timer->wakeFd, &one, sizeof(one));
+#endif
+}
+#endif // RCNET_TIMER_HAS_PLATFORM_BACKEND
+
+static void rcnet_timer_waitPortable(RCNET_Timer* timer, uint64_t wakeAtNs)
+{
+    uint64_t nowNs = rcnet_timer_get_time_ns();
+    if (wakeAtNs <= nowNs)
+        return;
+
+    std::unique_lock<std::mutex> lock(timer->mutex);
+    timer->condition.wait_for(lock, std::chrono::nanoseconds(wakeAtNs - nowNs), [timer]() {
+        return timer->wakePending.load(std::memory_order_acquire);
+    });
+}
+
+/**
+ * Ajuste la marge à partir du retard de réveil de l'OS (réveil réel - réveil demandé) :
+ * un retard plus grand que la marge la remonte tout de suite (+25 %), sinon elle converge lentement vers retard + 25 %.
+ */
+static void rcnet_timer_updateSpinMargin(RCNET_Timer* timer, uint64_t lateNs)
+{
+    const uint64_t margin = timer->spinMarginNs.load(std::memory_order_relaxed);
+    uint64_t target = lateNs + (lateNs >> 2);
+    if (target < kMinSpinMarginNs)
+        target = kMinSpinMarginNs;
+    if (target > kMaxSpinMarginNs)
+        target = kMaxSpinMarginNs;
+
+    uint64_t next = margin;
+    if (target > margin)
+        next = target;
+    else
+        next = margin - ((margin - target) >> kSpinMarginDecayShift);
+
+    timer->spinMarginNs.store(next, std::memory_order_relaxed);
+}
+
+RCNET_Timer* rcnet_timer_create(RCNET_TimerBackend backend)
+{
+    RCNET_Timer* timer = new (std::nothrow) RCNET_Timer();
+    if (timer == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_timer_create: allocation echouee\n");
+        return NULL;
+    }
+
+    timer->backend = RCNET_TIMER_BACKEND_PORTABLE;
+
+#if defined(RCNET_TIMER_HAS_PLATFORM_BACKEND)
+    if (backend == RCNET_TIMER_BACKEND_AUTO || backend == RCNET_TIMER_BACKEND_PLATFORM)
+    {
+        if (rcnet_timer_createPlatform(timer))
+        {
+            timer->backend = RCNET_TIMER_BACKEND_PLATFORM;
+            timer->spinMarginNs.store(kInitialPlatformSpinMarginNs, std::memory_order_relaxed);
+        }
+        else
+        {
+            rcnet_timer_destroyPlatform(timer);
+            RCNET_log(RCNET_LOG_WARN, "rcnet_timer_create: timer haute resolution indisponible, backend portable utilise\n");
+        }
+    }
+#else
+    if (backend == RCNET_TIMER_BACKEND_PLATFORM)
+        RCNET_log(RCNET_LOG_WARN, "rcnet_timer_create: pas de timer haute resolution sur cette plateforme, backend portable utilise\n");
+#endif
+
+    return timer;
+}
+
+void rcnet_timer_destroy(RCNET_Timer* timer)
+{
+    if (timer == NULL)
+        return;
+
+#if defined(RCNET_TIMER_HAS_PLATFORM_BACKEND)
+    if (timer->backend == RCNET_TIMER_BACKEND_PLATFORM)
+        rcnet_timer_destroyPlatform(timer);
+#endif
+
+    delete timer;
+}
+
+RCNET_TimerBackend rcnet_timer_get_backend(const RCNET_Timer* timer)
+{
+    return (timer != NULL) ? timer->backend : RCNET_TIMER_BACKEND_PORTABLE;
+}
+
+RCNET_TimerWaitResult rcnet_timer_sleep_until(RCNET_Timer* timer, uint64_t deadlineNs, uint64_t* outSpinNs)
+{
+    if (outSpinNs != NULL)
+        *outSpinNs = 0;
+
+    if (timer->wakePending.exchange(false, std::memory_order_acquire))
+        return RCNET_TIMER_WAIT_WOKEN;
+
+    // 1) Sommeil de l'OS jusqu'à (échéance - marge)
+    uint64_t nowNs = rcnet_timer_get_time_ns();
+    const uint64_t margin = timer->spinMarginNs.load(std::memory_order_relaxed);
+    if (deadlineNs > nowNs + margin)
+    {
+        const uint64_t wakeAtNs = deadlineNs - margin;
+
+        // Un réveil OS en avance (signal déjà consommé par le spin, EINTR...) repart en sommeil
+        while (nowNs < wakeAtNs)
+        {
+#if defined(RCNET_TIMER_HAS_PLATFORM_BACKEND)
+            if (timer->backend == RCNET_TIMER_BACKEND_PLATFORM)
+                rcnet_timer_waitPlatform(timer, wakeAtNs);
+            else
+#endif
+                rcnet_timer_waitPortable(timer, wakeAtNs);
+
+            if (timer->wakePending.exchange(false, std::memory_order_acquire))
+                return RCNET_TIMER_WAIT_WOKEN;
+
+            nowNs = rcnet_timer_get_time_ns();
+        }
+
+        rcnet_timer_updateSpinMargin(timer, nowNs - wakeAtNs);
+    }
+
+    // 2) Spin court jusqu'à l'échéance (un réveil anticipé l'interrompt aussi)
+    const uint64_t spinStartNs = nowNs;
+    while (nowNs < deadlineNs)
+    {
+        if (timer->wakePending.exchange(false, std::memory_order_acquire))
+        {
+            if (outSpinNs != NULL)
+                *outSpinNs = nowNs - spinStartNs;
+            return RCNET_TIMER_WAIT_WOKEN;
+        }
+
+        std::this_thread::yield();
+        nowNs = rcnet_timer_get_time_ns();
+    }
+
+    if (outSpinNs != NULL)
+        *outSpinNs = (deadlineNs > spinStartNs) ? deadlineNs - spinStartNs : 0;
+
+    return RCNET_TIMER_WAIT_DEADLINE;
+}
+
+void rcnet_timer_wake(RCNET_Timer* timer)
+{
+    if (timer == NULL)
+        return;
+
+    // Un seul signal OS tant que le réveil précédent n'a pas été consommé
+    if (timer->wakePending.exchange(true, std::memory_order_release))
+        return;
+
+#if defined(RCNET_TIMER_HAS_PLATFORM_BACKEND)
+    if (timer->backend == RCNET_TIMER_BACKEND_PLATFORM)
+    {
+        rcnet_timer_signalPlatform(timer);
+        return;
+    }
+#endif
+
+    // Prendre le mutex évite de perdre le réveil entre le test du prédicat et la mise en attente
+    {
+        std::lock_guard<std::mutex> lock(timer->mutex);
+    }
+    timer->condition.notify_one();
+}
+
+uint64_t rcnet_timer_get_spin_margin_ns(const RCNET_Timer* timer)
+{
+    return (timer != NULL) ? timer->spinMarginNs.load(std::memory_order_relaxed) : 0;
+}
@@ -0,0 +1,105 @@
+#include "RCNET/RCNET_triple_buffer.h"
+#include "RCNET/RCNET_logger.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <cstring>
+#include <new>
+
+// Taille d'une ligne de cache (x64 et arm64 courants)
+static constexpr size_t kCacheLineSize = 64;
+
+// Bit "nouvel état" dans l'index du slot du milieu
+static constexpr uint32_t kFreshBit = 4u;
+static constexpr uint32_t kIndexMask = 3u;
+
+/**
+ * Les trois slots tournent entre trois rôles : écriture (écrivain), milieu (partagé), lecture (lecteur).
+ * Seul le milieu est partagé : un exchange atomique suffit des deux côtés.
+ */
+struct RCNET_TripleBuffer
+{
+    alignas(kCacheLineSize) std::atomic<uint32_t> middle{2};
+    std::atomic<uint64_t> publishCount{0};
+
+    alignas(kCacheLineSize) uint32_t writeIndex = 1;
+
+    alignas(kCacheLineSize) uint32_t readIndex = 0;
+
+    alignas(kCacheLineSize) uint8_t* storage = nullptr;
+    size_t slotStride = 0;
+};
+
+RCNET_TripleBuffer* rcnet_triple_buffer_create(size_t slotSize)
+{
+    if (slotSize == 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_triple_buffer_create: slotSize invalide\n");
+        return NULL;
+    }
+
+    RCNET_TripleBuffer* buffer = new (std::nothrow) RCNET_TripleBuffer();
+    if (buffer == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_triple_buffer_create: allocation echouee\n");
+        return NULL;
+    }
+
+    // Un slot par groupe de lignes de cache : l'écrivain et le lecteur ne partagent jamais une ligne
+    buffer->slotStride = (slotSize + kCacheLineSize - 1) & ~(kCacheLineSize - 1);
+    buffer->storage = static_cast<uint8_t*>(::operator new(buffer->slotStride * 3, std::align_val_t(kCacheLineSize), std::nothrow));
+    if (buffer->storage == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_triple_buffer_create: allocation des slots echouee (%zu octets)\n", buffer->slotStride * 3);
+        delete buffer;
+        return NULL;
+    }
+
+    memset(buffer->storage, 0, buffer->slotStride * 3);
+    return buffer;
+}
+
+void rcnet_triple_buffer_destroy(RCNET_TripleBuffer* buffer)
+{
+    if (buffer == NULL)
+        return;
+
+    ::operator delete(buffer->storage, std::align_val_t(kCacheLineSize));
+    delete buffer;
+}
+
+void* rcnet_triple_buffer_get_write_slot(RCNET_TripleBuffer* buffer)
+{
+    return buffer->storage + buffer->writeIndex * buffer->slotStride;
+}
+
+void rcnet_triple_buffer_publish(RCNET_TripleBuffer* buffer)
+{
+    // release : le contenu du slot est visible avant l'index ; acquire : on récupère l'ancien milieu
+    // (éventuellement rendu par le lecteur) avec son contenu
+    uint32_t previous = buffer->middle.exchange(buffer->writeIndex | kFreshBit, std::memory_order_acq_rel);
+    buffer->writeIndex = previous & kIndexMask;
+    buffer->publishCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool rcnet_triple_buffer_acquire(RCNET_TripleBuffer* buffer)
+{
+    if ((buffer->middle.load(std::memory_order_relaxed) & kFreshBit) == 0)
+        return false;
+
+    uint32_t previous = buffer->middle.exchange(buffer->readIndex, std::memory_order_acq_rel);
+    buffer->readIndex = previous & kIndexMask;
+    return true;
+}
+
+const void* rcnet_triple_buffer_get_read_slot(const RCNET_TripleBuffer* buffer)
+{
+    return buffer->storage + buffer->readIndex * buffer->slotStride;
+}
+
+uint64_t rcnet_triple_buffer_get_publish_count(const RCNET_TripleBuffer* buffer)
+{
+    return (buffer != NULL) ? buffer->publishCount.load(std::memory_order_relaxed) : 0;
+}
@@ -0,0 +1,226 @@
+#include "RCNET/RCNET_worker_pool.h"
+#include "RCNET/RCNET_logger.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+
+// Nombre de blocs visés par worker (équilibrage si les jobs ont des coûts différents)
+static constexpr uint32_t kChunksPerWorker = 4;
+
+// Worker courant (pour exécuter un parallel_for imbriqué en série sur le bon worker / la bonne arena)
+static thread_local const RCNET_WorkerPool* tlsCurrentPool = nullptr;
+static thread_local uint32_t tlsCurrentWorkerIndex = 0;
+
+struct RCNET_WorkerPool
+{
+    uint32_t threadCount = 0;
+    uint32_t workerCount = 0;
+    std::thread* threads = nullptr;
+    RCNET_Arena** arenas = nullptr;
+
+    // Réveil des workers / attente de fin (protégés par mutex)
+    std::mutex mutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable doneCondition;
+    uint64_t jobGeneration = 0;
+    uint32_t busyWorkers = 0;
+    bool stopping = false;
+
+    // Job courant (écrit sous mutex avant le réveil, lu par les workers après)
+    RCNET_ParallelForFn jobFn = nullptr;
+    void* jobUserdata = nullptr;
+    uint32_t jobCount = 0;
+    uint32_t jobChunkSize = 1;
+    std::atomic<uint32_t> jobNextIndex{0};
+
+    bool inParallelFor = false;
+};
+
+static void rcnet_worker_pool_runJob(RCNET_WorkerPool* pool, uint32_t workerIndex)
+{
+    const uint32_t count = pool->jobCount;
+    const uint32_t chunkSize = pool->jobChunkSize;
+
+    while (true)
+    {
+        uint32_t begin = pool->jobNextIndex.fetch_add(chunkSize, std::memory_order_relaxed);
+        if (begin >= count)
+            return;
+
+        uint32_t end = (count - begin > chunkSize) ? begin + chunkSize : count;
+        for (uint32_t index = begin; index < end; ++index)
+            pool->jobFn(index, workerIndex, pool->jobUserdata);
+    }
+}
+
+static void rcnet_worker_pool_threadMain(RCNET_WorkerPool* pool, uint32_t workerIndex)
+{
+    tlsCurrentPool = pool;
+    tlsCurrentWorkerIndex = workerIndex;
+
+    uint64_t seenGeneration = 0;
+    std::unique_lock<std::mutex> lock(pool->mutex);
+
+    while (true)
+    {
+        pool->wakeCondition.wait(lock, [&] { return pool->stopping || pool->jobGeneration != seenGeneration; });
+        if (pool->stopping)
+            return;
+        seenGeneration = pool->jobGeneration;
+
+        lock.unlock();
+        rcnet_worker_pool_runJob(pool, workerIndex);
+        lock.lock();
+
+        if (--pool->busyWorkers == 0)
+            pool->doneCondition.notify_one();
+    }
+}
+
+RCNET_WorkerPool* rcnet_worker_pool_create(uint32_t threadCount, size_t arenaBytesPerWorker)
+{
+    RCNET_WorkerPool* pool = new (std::nothrow) RCNET_WorkerPool();
+    if (pool == NULL)
+        return NULL;
+
+    pool->workerCount = threadCount + 1;
+    pool->arenas = new (std::nothrow) RCNET_Arena*[pool->workerCount]();
+    pool->threads = new (std::nothrow) std::thread[threadCount];
+    if (pool->arenas == NULL || pool->threads == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_worker_pool_create: out of memory\n");
+        rcnet_worker_pool_destroy(pool);
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < pool->workerCount; ++i)
+    {
+        pool->arenas[i] = rcnet_arena_create(arenaBytesPerWorker);
+        if (pool->arenas[i] == NULL)
+        {
+            rcnet_worker_pool_destroy(pool);
+            return NULL;
+        }
+    }
+
+    // Worker 0 = thread appelant, les threads du pool sont les workers 1..threadCount
+    for (uint32_t i = 0; i < threadCount; ++i)
+    {
+        try
+        {
+            pool->threads[i] = std::thread(rcnet_worker_pool_threadMain, pool, i + 1);
+        }
+        catch (const std::exception&)
+        {
+            RCNET_log(RCNET_LOG_ERROR, "rcnet_worker_pool_create: failed to start worker thread %u\n", i + 1);
+            rcnet_worker_pool_destroy(pool);
+            return NULL;
+        }
+        pool->threadCount++;
+    }
+
+    return pool;
+}
+
+void rcnet_worker_pool_destroy(RCNET_WorkerPool* pool)
+{
+    if (pool == NULL)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->stopping = true;
+    }
+    pool->wakeCondition.notify_all();
+
+    if (pool->threads != NULL)
+    {
+        for (uint32_t i = 0; i < pool->threadCount; ++i)
+        {
+            if (pool->threads[i].joinable())
+                pool->threads[i].join();
+        }
+        delete[] pool->threads;
+    }
+
+    if (pool->arenas != NULL)
+    {
+        for (uint32_t i = 0; i < pool->workerCount; ++i)
+            rcnet_arena_destroy(pool->arenas[i]);
+        delete[] pool->arenas;
+    }
+
+    delete pool;
+}
+
+uint32_t rcnet_worker_pool_get_worker_count(const RCNET_WorkerPool* pool)
+{
+    return pool->workerCount;
+}
+
+void rcnet_worker_pool_parallel_for(RCNET_WorkerPool* pool, uint32_t count, RCNET_ParallelForFn fn, void* userdata)
+{
+    if (count == 0 || fn == NULL)
+        return;
+
+    // Série : pas de threads, un seul job, ou appel imbriqué depuis un job
+    bool nested = (tlsCurrentPool == pool) || pool->inParallelFor;
+    if (pool->threadCount == 0 || count == 1 || nested)
+    {
+        uint32_t workerIndex = (tlsCurrentPool == pool) ? tlsCurrentWorkerIndex : 0;
+        for (uint32_t index = 0; index < count; ++index)
+            fn(index, workerIndex, userdata);
+        return;
+    }
+
+    pool->inParallelFor = true;
+
+    uint32_t chunkSize = count / (pool->workerCount * kChunksPerWorker);
+    if (chunkSize == 0)
+        chunkSize = 1;
+
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->jobFn = fn;
+        pool->jobUserdata = userdata;
+        pool->jobCount = count;
+        pool->jobChunkSize = chunkSize;
+        pool->jobNextIndex.store(0, std::memory_order_relaxed);
+        pool->busyWorkers = pool->threadCount;
+        pool->jobGeneration++;
+    }
+    pool->wakeCondition.notify_all();
+
+    // Le thread appelant travaille aussi (worker 0)
+    tlsCurrentPool = pool;
+    tlsCurrentWorkerIndex = 0;
+    rcnet_worker_pool_runJob(pool, 0);
+    tlsCurrentPool = nullptr;
+
+    // Attendre que tous les workers aient rendu la main (les jobs restants sont déjà pris)
+    {
+        std::unique_lock<std::mutex> lock(pool->mutex);
+        pool->doneCondition.wait(lock, [&] { return pool->busyWorkers == 0; });
+    }
+
+    pool->inParallelFor = false;
+}
+
+RCNET_Arena* rcnet_worker_pool_get_arena(RCNET_WorkerPool* pool, uint32_t workerIndex)
+{
+    if (workerIndex >= pool->workerCount)
+        return NULL;
+    return pool->arenas[workerIndex];
+}
+
+void rcnet_worker_pool_reset_arenas(RCNET_WorkerPool* pool)
+{
+    for (uint32_t i = 0; i < pool->workerCount; ++i)
+        rcnet_arena_reset(pool->arenas[i]);
+}
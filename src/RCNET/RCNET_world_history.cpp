@@ -0,0 +1,353 @@
+#include "RCNET/RCNET_world_history.h"
+#include "RCNET/RCNET_logger.h"
+
+// ================================
+// Standard C/C++ Libraries
+// ================================
+#include <cstring>
+#include <new>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+// Champs SoA d'un état, dans cet ordre dans chaque slot
+enum RCNET_WorldHistoryField : uint32_t
+{
+    kWorldHistoryPosX = 0,
+    kWorldHistoryPosY,
+    kWorldHistoryHalfWidth,
+    kWorldHistoryHalfHeight,
+    kWorldHistoryFieldCount
+};
+
+static constexpr uint64_t kNoTick = 0;
+
+struct RCNET_WorldHistory
+{
+    RCNET_WorldHistoryConfig config;
+    uint32_t capacityTicks = 0;
+    uint32_t words = 0;
+
+    // Slot i : fields + i * fieldCount * maxEntities, presence + i * words, ticks[i]
+    float* fields = nullptr;
+    uint64_t* presence = nullptr;
+    uint64_t* ticks = nullptr;
+
+    uint64_t latestTick = kNoTick;  // dernier tick validé
+    uint64_t writingTick = kNoTick; // tick en cours (entre begin et commit)
+    uint32_t writingSlot = 0;
+};
+
+static inline uint32_t rcnet_world_history_slotOf(const RCNET_WorldHistory* history, uint64_t tick)
+{
+    return static_cast<uint32_t>(tick % history->capacityTicks);
+}
+
+static inline float* rcnet_world_history_slotFields(const RCNET_WorldHistory* history, uint32_t slot, uint32_t field)
+{
+    return history->fields + (static_cast<size_t>(slot) * kWorldHistoryFieldCount + field) * history->config.maxEntities;
+}
+
+static inline uint64_t* rcnet_world_history_slotPresence(const RCNET_WorldHistory* history, uint32_t slot)
+{
+    return history->presence + static_cast<size_t>(slot) * history->words;
+}
+
+static inline uint32_t rcnet_world_history_countTrailingZeros(uint64_t value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+}
+
+static inline bool rcnet_world_history_isPresent(const uint64_t* presence, uint32_t entityId)
+{
+    return (presence[entityId >> 6] >> (entityId & 63)) & 1u;
+}
+
+// Slot d'un tick validé encore présent dans le ring, -1 sinon
+static int64_t rcnet_world_history_findSlot(const RCNET_WorldHistory* history, uint64_t tick)
+{
+    if (tick == kNoTick || tick > history->latestTick)
+        return -1;
+
+    uint32_t slot = rcnet_world_history_slotOf(history, tick);
+    return history->ticks[slot] == tick ? static_cast<int64_t>(slot) : -1;
+}
+
+void rcnet_world_history_get_default_config(RCNET_WorldHistoryConfig* outConfig)
+{
+    if (outConfig == NULL)
+        return;
+
+    outConfig->maxEntities = 0;
+    outConfig->simTickRateHz = 60;
+    outConfig->maxRewindMs = 250;
+}
+
+RCNET_WorldHistory* rcnet_world_history_create(const RCNET_WorldHistoryConfig* config)
+{
+    if (config == NULL || config->maxEntities == 0 || config->simTickRateHz == 0)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_world_history_create: invalid configuration\n");
+        return NULL;
+    }
+
+    RCNET_WorldHistory* history = new (std::nothrow) RCNET_WorldHistory();
+    if (history == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_world_history_create: out of memory\n");
+        return NULL;
+    }
+
+    history->config = *config;
+    history->words = (config->maxEntities + 63) / 64;
+
+    // Arrondi supérieur + le tick courant : maxRewindMs est toujours couvert
+    uint64_t rewindTicks = (static_cast<uint64_t>(config->simTickRateHz) * config->maxRewindMs + 999) / 1000;
+    history->capacityTicks = static_cast<uint32_t>(rewindTicks + 1);
+
+    size_t fieldCount = static_cast<size_t>(history->capacityTicks) * kWorldHistoryFieldCount * config->maxEntities;
+    size_t presenceCount = static_cast<size_t>(history->capacityTicks) * history->words;
+    history->fields = new (std::nothrow) float[fieldCount]();
+    history->presence = new (std::nothrow) uint64_t[presenceCount]();
+    history->ticks = new (std::nothrow) uint64_t[history->capacityTicks]();
+
+    if (history->fields == NULL || history->presence == NULL || history->ticks == NULL)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_world_history_create: out of memory (%u ticks x %u entities)\n",
+                  history->capacityTicks, config->maxEntities);
+        rcnet_world_history_destroy(history);
+        return NULL;
+    }
+
+    return history;
+}
+
+void rcnet_world_history_destroy(RCNET_WorldHistory* history)
+{
+    if (history == NULL)
+        return;
+
+    delete[] history->fields;
+    delete[] history->presence;
+    delete[] history->ticks;
+    delete history;
+}
+
+uint32_t rcnet_world_history_get_capacity_ticks(const RCNET_WorldHistory* history)
+{
+    return history->capacityTicks;
+}
+
+bool rcnet_world_history_begin_tick(RCNET_WorldHistory* history, uint64_t tick)
+{
+    if (tick == kNoTick || tick <= history->latestTick)
+    {
+        RCNET_log(RCNET_LOG_ERROR, "rcnet_world_history_begin_tick: tick %llu is not newer than %llu\n",
+                  (unsigned long long)tick, (unsigned long long)history->latestTick);
+        return false;
+    }
+
+    uint32_t slot = rcnet_world_history_slotOf(history, tick);
+    int64_t previousSlot = rcnet_world_history_findSlot(history, history->latestTick);
+
+    // Le slot est réécrit : plus consultable tant que le tick n'est pas validé
+    history->ticks[slot] = kNoTick;
+
+    // Repartir du dernier état validé (écriture incrémentale)
+    if (previousSlot >= 0 && static_cast<uint32_t>(previousSlot) != slot)
+    {
+        std::memcpy(rcnet_world_history_slotFields(history, slot, 0),
+                    rcnet_world_history_slotFields(history, static_cast<uint32_t>(previousSlot), 0),
+                    sizeof(float) * kWorldHistoryFieldCount * history->config.maxEntities);
+        std::memcpy(rcnet_world_history_slotPresence(history, slot),
+                    rcnet_world_history_slotPresence(history, static_cast<uint32_t>(previousSlot)),
+                    sizeof(uint64_t) * history->words);
+    }
+    else if (previousSlot < 0)
+    {
+        std::memset(rcnet_world_history_slotPresence(history, slot), 0, sizeof(uint64_t) * history->words);
+    }
+
+    history->writingTick = tick;
+    history->writingSlot = slot;
+    return true;
+}
+
+void rcnet_world_history_set_entity(RCNET_WorldHistory* history, uint32_t entityId, float posX, float posY,
+                                    float halfWidth, float halfHeight)
+{
+    if (history->writingTick == kNoTick || entityId >= history->config.maxEntities)
+        return;
+
+    uint32_t slot = history->writingSlot;
+    rcnet_world_history_slotFields(history, slot, kWorldHistoryPosX)[entityId] = posX;
+    rcnet_world_history_slotFields(history, slot, kWorldHistoryPosY)[entityId] = posY;
+    rcnet_world_history_slotFields(history, slot, kWorldHistoryHalfWidth)[entityId] = halfWidth;
+    rcnet_world_history_slotFields(history, slot, kWorldHistoryHalfHeight)[entityId] = halfHeight;
+    rcnet_world_history_slotPresence(history, slot)[entityId >> 6] |= (1ull << (entityId & 63));
+}
+
+void rcnet_world_history_remove_entity(RCNET_WorldHistory* history, uint32_t entityId)
+{
+    if (history->writingTick == kNoTick || entityId >= history->config.maxEntities)
+        return;
+
+    rcnet_world_history_slotPresence(history, history->writingSlot)[entityId >> 6] &= ~(1ull << (entityId & 63));
+}
+
+void rcnet_world_history_commit_tick(RCNET_WorldHistory* history)
+{
+    if (history->writingTick == kNoTick)
+        return;
+
+    history->ticks[history->writingSlot] = history->writingTick;
+    history->latestTick = history->writingTick;
+    history->writingTick = kNoTick;
+}
+
+uint64_t rcnet_world_history_get_latest_tick(const RCNET_WorldHistory* history)
+{
+    return history->latestTick;
+}
+
+uint64_t rcnet_world_history_get_oldest_tick(const RCNET_WorldHistory* history)
+{
+    if (history->latestTick == kNoTick)
+        return kNoTick;
+
+    uint64_t span = history->capacityTicks - 1;
+    return history->latestTick > span ? history->latestTick - span : 1;
+}
+
+bool rcnet_world_history_rewind(const RCNET_WorldHistory* history, uint64_t tick, RCNET_WorldHistoryView* outView)
+{
+    int64_t slot = rcnet_world_history_findSlot(history, tick);
+    if (slot < 0)
+        return false;
+
+    uint32_t index = static_cast<uint32_t>(slot);
+    outView->tick = tick;
+    outView->maxEntities = history->config.maxEntities;
+    outView->presentMask = rcnet_world_history_slotPresence(history, index);
+    outView->posX = rcnet_world_history_slotFields(history, index, kWorldHistoryPosX);
+    outView->posY = rcnet_world_history_slotFields(history, index, kWorldHistoryPosY);
+    outView->halfWidth = rcnet_world_history_slotFields(history, index, kWorldHistoryHalfWidth);
+    outView->halfHeight = rcnet_world_history_slotFields(history, index, kWorldHistoryHalfHeight);
+    return true;
+}
+
+// Etat interpolé de entityId entre from et to (to peut être NULL ou sans l'entité)
+static inline void rcnet_world_history_lerpEntity(const RCNET_WorldHistoryView& from, const RCNET_WorldHistoryView* to, float alpha,
+                                                  uint32_t entityId, RCNET_WorldHistoryEntity* outEntity)
+{
+    outEntity->posX = from.posX[entityId];
+    outEntity->posY = from.posY[entityId];
+    outEntity->halfWidth = from.halfWidth[entityId];
+    outEntity->halfHeight = from.halfHeight[entityId];
+
+    if (to == NULL || alpha <= 0.0f || !rcnet_world_history_isPresent(to->presentMask, entityId))
+        return;
+
+    outEntity->posX += (to->posX[entityId] - outEntity->posX) * alpha;
+    outEntity->posY += (to->posY[entityId] - outEntity->posY) * alpha;
+    outEntity->halfWidth += (to->halfWidth[entityId] - outEntity->halfWidth) * alpha;
+    outEntity->halfHeight += (to->halfHeight[entityId] - outEntity->halfHeight) * alpha;
+}
+
+bool rcnet_world_history_sample_entity(const RCNET_WorldHistory* history, uint64_t tick, float alpha, uint32_t entityId,
+                                       RCNET_WorldHistoryEntity* outEntity)
+{
+    RCNET_WorldHistoryView from;
+    if (entityId >= history->config.maxEntities || !rcnet_world_history_rewind(history, tick, &from)
+        || !rcnet_world_history_isPresent(from.presentMask, entityId))
+        return false;
+
+    RCNET_WorldHistoryView to;
+    const bool hasNext = rcnet_world_history_rewind(history, tick + 1, &to);
+    rcnet_world_history_lerpEntity(from, hasNext ? &to : NULL, alpha, entityId, outEntity);
+    return true;
+}
+
+bool rcnet_world_history_raycast(const RCNET_WorldHistory* history, uint64_t tick, float alpha, float x0, float y0,
+                                 float x1, float y1, uint32_t ignoreEntityId, uint32_t* outEntityId, float* outFraction)
+{
+    RCNET_WorldHistoryView from;
+    if (!rcnet_world_history_rewind(history, tick, &from))
+        return false;
+
+    RCNET_WorldHistoryView to;
+    const bool hasNext = alpha > 0.0f && rcnet_world_history_rewind(history, tick + 1, &to);
+
+    const float dx = x1 - x0;
+    const float dy = y1 - y0;
+    float bestFraction = 2.0f;
+    uint32_t bestEntity = 0;
+
+    // Parcours mot par mot du bitset de présence (les slots vides coûtent un test par 64 entités)
+    for (uint32_t word = 0; word < history->words; ++word)
+    {
+        uint64_t bits = from.presentMask[word];
+        while (bits != 0)
+        {
+            uint32_t entityId = word * 64 + rcnet_world_history_countTrailingZeros(bits);
+            bits &= bits - 1;
+            if (entityId == ignoreEntityId)
+                continue;
+
+            RCNET_WorldHistoryEntity entity;
+            rcnet_world_history_lerpEntity(from, hasNext ? &to : NULL, alpha, entityId, &entity);
+
+            // Slab test segment / AABB
+            float tMin = 0.0f;
+            float tMax = 1.0f;
+            const float origin[2] = { x0, y0 };
+            const float direction[2] = { dx, dy };
+            const float minBox[2] = { entity.posX - entity.halfWidth, entity.posY - entity.halfHeight };
+            const float maxBox[2] = { entity.posX + entity.halfWidth, entity.posY + entity.halfHeight };
+
+            bool hit = true;
+            for (int axis = 0; axis < 2 && hit; ++axis)
+            {
+                if (direction[axis] == 0.0f)
+                {
+                    hit = origin[axis] >= minBox[axis] && origin[axis] <= maxBox[axis];
+                    continue;
+                }
+
+                float inverse = 1.0f / direction[axis];
+                float t0 = (minBox[axis] - origin[axis]) * inverse;
+                float t1 = (maxBox[axis] - origin[axis]) * inverse;
+                if (t0 > t1)
+                {
+                    float swap = t0;
+                    t0 = t1;
+                    t1 = swap;
+                }
+                tMin = t0 > tMin ? t0 : tMin;
+                tMax = t1 < tMax ? t1 : tMax;
+                hit = tMin <= tMax;
+            }
+
+            if (hit && tMin < bestFraction)
+            {
+                bestFraction = tMin;
+                bestEntity = entityId;
+            }
+        }
+    }
+
+    if (bestFraction > 1.0f)
+        return false;
+
+    *outEntityId = bestEntity;
+    if (outFraction)
+        *outFraction = bestFraction;
+    return true;
+}